@@ -34,6 +34,9 @@ struct SimdBackend<float, IsaAvx2>
     static auto mul(reg a, reg b) -> reg { return _mm256_mul_ps(a, b); }
     static auto div(reg a, reg b) -> reg { return _mm256_div_ps(a, b); }
 
+    // a * b + c（FMA3）
+    static auto fma(reg a, reg b, reg c) -> reg { return _mm256_fmadd_ps(a, b, c); }
+
     static auto min(reg a, reg b) -> reg { return _mm256_min_ps(a, b); }
     static auto max(reg a, reg b) -> reg { return _mm256_max_ps(a, b); }
     // clang-format on
@@ -129,6 +132,9 @@ struct SimdBackend<double, IsaAvx2>
     static auto mul(reg a, reg b) -> reg { return _mm256_mul_pd(a, b); }
     static auto div(reg a, reg b) -> reg { return _mm256_div_pd(a, b); }
 
+    // a * b + c（FMA3）
+    static auto fma(reg a, reg b, reg c) -> reg { return _mm256_fmadd_pd(a, b, c); }
+
     static auto min(reg a, reg b) -> reg { return _mm256_min_pd(a, b); }
     static auto max(reg a, reg b) -> reg { return _mm256_max_pd(a, b); }
     // clang-format on
@@ -34,6 +34,9 @@ struct SimdBackend<float, IsaAvx512>
     static auto mul(reg a, reg b) -> reg { return _mm512_mul_ps(a, b); }
     static auto div(reg a, reg b) -> reg { return _mm512_div_ps(a, b); }
 
+    // a * b + c
+    static auto fma(reg a, reg b, reg c) -> reg { return _mm512_fmadd_ps(a, b, c); }
+
     static auto min(reg a, reg b) -> reg { return _mm512_min_ps(a, b); }
     static auto max(reg a, reg b) -> reg { return _mm512_max_ps(a, b); }
     // clang-format on
@@ -116,6 +119,9 @@ struct SimdBackend<double, IsaAvx512>
     static auto mul(reg a, reg b) -> reg { return _mm512_mul_pd(a, b); }
     static auto div(reg a, reg b) -> reg { return _mm512_div_pd(a, b); }
 
+    // a * b + c
+    static auto fma(reg a, reg b, reg c) -> reg { return _mm512_fmadd_pd(a, b, c); }
+
     static auto min(reg a, reg b) -> reg { return _mm512_min_pd(a, b); }
     static auto max(reg a, reg b) -> reg { return _mm512_max_pd(a, b); }
     // clang-format on
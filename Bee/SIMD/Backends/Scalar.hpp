@@ -32,6 +32,9 @@ struct SimdBackend<float, IsaScalar>
     static auto mul(reg a, reg b) -> reg { return a * b; }
     static auto div(reg a, reg b) -> reg { return a / b; }
 
+    // a * b + c
+    static auto fma(reg a, reg b, reg c) -> reg { return a * b + c; }
+
     static auto min(reg a, reg b) -> reg { return std::min(a, b); }
     static auto max(reg a, reg b) -> reg { return std::max(a, b); }
     static auto neg(reg a) -> reg { return -a; }
@@ -67,6 +70,9 @@ struct SimdBackend<double, IsaScalar>
     static auto mul(reg a, reg b) -> reg { return a * b; }
     static auto div(reg a, reg b) -> reg { return a / b; }
 
+    // a * b + c
+    static auto fma(reg a, reg b, reg c) -> reg { return a * b + c; }
+
     static auto min(reg a, reg b) -> reg { return std::min(a, b); }
     static auto max(reg a, reg b) -> reg { return std::max(a, b); }
     static auto neg(reg a) -> reg { return -a; }
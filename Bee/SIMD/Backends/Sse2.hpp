@@ -35,6 +35,9 @@ struct SimdBackend<float, IsaSse2>
     static auto mul(reg a, reg b) -> reg { return _mm_mul_ps(a, b); }
     static auto div(reg a, reg b) -> reg { return _mm_div_ps(a, b); }
 
+    // a * b + c（SSE 无 FMA，乘加两步）
+    static auto fma(reg a, reg b, reg c) -> reg { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+
     static auto min(reg a, reg b) -> reg { return _mm_min_ps(a, b); }
     static auto max(reg a, reg b) -> reg { return _mm_max_ps(a, b); }
     // clang-format on
@@ -123,6 +126,9 @@ struct SimdBackend<double, IsaSse2>
     static auto mul(reg a, reg b) -> reg { return _mm_mul_pd(a, b); }
     static auto div(reg a, reg b) -> reg { return _mm_div_pd(a, b); }
 
+    // a * b + c（SSE 无 FMA，乘加两步）
+    static auto fma(reg a, reg b, reg c) -> reg { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+
     static auto min(reg a, reg b) -> reg { return _mm_min_pd(a, b); }
     static auto max(reg a, reg b) -> reg { return _mm_max_pd(a, b); }
     // clang-format on
@@ -1,4 +1,4 @@
-// SIMD 组件实现：组件名 + 运行期 CPUID 检测
+// SIMD 组件实现：组件名 + 运行期 CPUID 检测（ISA 与缓存容量）
 //
 // 本文件**不**使用任何 SIMD intrinsics（只调用 CPUID / xgetbv），
 // 因此**不需要**附加 ISA 编译标志，可以在任何目标机上安全执行。
@@ -6,6 +6,12 @@
 #include "Detect.hpp"
 
 #include <atomic>
+#include <fstream>
+#include <string>
+
+#if !defined(_MSC_VER) && (defined(__x86_64__) || defined(__i386__))
+    #include <cpuid.h>
+#endif
 
 #if defined(_MSC_VER)
     #include <intrin.h>
@@ -116,6 +122,124 @@ namespace
 
 #endif
 
+    // ── 缓存容量 ─────────────────────────────────────────────────────────────
+
+    auto keep_min(std::size_t& dst, std::size_t v) -> void
+    {
+        if (v != 0 && (dst == 0 || v < dst))
+            dst = v;
+    }
+
+    auto record_cache(CacheSizes& out, int level, std::size_t bytes) -> void
+    {
+        switch (level) {
+        case 1: keep_min(out.l1d, bytes); break;
+        case 2: keep_min(out.l2, bytes); break;
+        case 3: keep_min(out.l3, bytes); break;
+        default: break;
+        }
+    }
+
+    // sysfs：/sys/devices/system/cpu/cpuN/cache/indexM/{level,type,size}，size 形如 "48K"
+    auto caches_from_sysfs(CacheSizes& out) -> bool
+    {
+        bool found = false;
+        for (int cpu = 0;; ++cpu) {
+            const std::string base = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cache/index";
+            std::ifstream     probe(base + "0/level");
+            if (!probe)
+                break;
+            for (int idx = 0;; ++idx) {
+                std::ifstream level_f(base + std::to_string(idx) + "/level");
+                std::ifstream type_f(base + std::to_string(idx) + "/type");
+                std::ifstream size_f(base + std::to_string(idx) + "/size");
+                if (!level_f || !type_f || !size_f)
+                    break;
+                int         level = 0;
+                std::string type;
+                std::string size;
+                level_f >> level;
+                type_f >> type;
+                size_f >> size;
+                if (type == "Instruction" || size.empty())
+                    continue;
+                std::size_t bytes = std::stoull(size);
+                switch (size.back()) {
+                case 'K': bytes <<= 10; break;
+                case 'M': bytes <<= 20; break;
+                case 'G': bytes <<= 30; break;
+                default: break;
+                }
+                record_cache(out, level, bytes);
+                found = true;
+            }
+        }
+        return found;
+    }
+
+    // CPUID 确定性缓存参数（leaf 4 / 0x8000001D 格式相同）：
+    //   EAX[4:0] 类型（0 结束，1 数据，2 指令，3 统一），EAX[7:5] 级别；
+    //   容量 = (ways + 1) * (partitions + 1) * (line + 1) * (sets + 1)
+    auto caches_from_cpuid(CacheSizes& out) -> bool
+    {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+        auto query = [](unsigned leaf, unsigned sub, unsigned r[4]) {
+    #if defined(_MSC_VER)
+            int info[4] = {0, 0, 0, 0};
+            __cpuidex(info, static_cast<int>(leaf), static_cast<int>(sub));
+            for (int i = 0; i < 4; ++i)
+                r[i] = static_cast<unsigned>(info[i]);
+    #else
+            __cpuid_count(leaf, sub, r[0], r[1], r[2], r[3]);
+    #endif
+        };
+
+        unsigned r[4] = {0, 0, 0, 0};
+        query(0, 0, r);
+        const unsigned max_leaf = r[0];
+        query(0x80000000U, 0, r);
+        const unsigned max_ext = r[0];
+
+        // Intel 用 leaf 4；AMD 的 leaf 4 全为 0，改用扩展 leaf 0x8000001D
+        bool found = false;
+        for (const unsigned leaf : {4U, 0x8000001DU}) {
+            if (found || (leaf == 4U ? max_leaf < leaf : max_ext < leaf))
+                continue;
+            for (unsigned sub = 0; sub < 16; ++sub) {
+                query(leaf, sub, r);
+                const unsigned type = r[0] & 0x1FU;
+                if (type == 0)
+                    break;
+                if (type == 2)
+                    continue;
+                const auto ways  = static_cast<std::size_t>((r[1] >> 22) & 0x3FFU) + 1;
+                const auto parts = static_cast<std::size_t>((r[1] >> 12) & 0x3FFU) + 1;
+                const auto line  = static_cast<std::size_t>(r[1] & 0xFFFU) + 1;
+                const auto sets  = static_cast<std::size_t>(r[2]) + 1;
+                record_cache(out, static_cast<int>((r[0] >> 5) & 0x7U), ways * parts * line * sets);
+                found = true;
+            }
+        }
+        return found;
+#else
+        (void)out;
+        return false;
+#endif
+    }
+
+    auto detect_caches_impl() noexcept -> CacheSizes
+    {
+        CacheSizes out{};
+        try {
+            if (caches_from_sysfs(out))
+                return out;
+        } catch (...) {
+            out = {};
+        }
+        caches_from_cpuid(out);
+        return out;
+    }
+
 } // namespace
 
 auto isa_name(Isa isa) noexcept -> const char*
@@ -136,6 +260,12 @@ auto detect_isa() noexcept -> Isa
     return kCached;
 }
 
+auto detect_cache_sizes() noexcept -> CacheSizes
+{
+    static const CacheSizes kCached = detect_caches_impl();
+    return kCached;
+}
+
 // 保留原组件名函数，供诊断/测试引用
 auto component_name() noexcept -> const char*
 {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace bee::simd
@@ -27,4 +28,17 @@ inline auto current_isa() noexcept -> Isa
     return detect_isa();
 }
 
+// CPU 数据缓存容量（字节），某一级未检测到时为 0
+struct CacheSizes
+{
+    std::size_t l1d = 0;
+    std::size_t l2  = 0;
+    std::size_t l3  = 0;
+};
+
+// 检测 L1d / L2 / L3 容量（线程安全，仅首次调用时执行）：
+// Linux 读取 sysfs 并取所有逻辑核中的最小值（混合架构按小核取保守值），
+// 其余平台回退到 CPUID leaf 4（Intel）/ 0x8000001D（AMD）
+auto detect_cache_sizes() noexcept -> CacheSizes;
+
 } // namespace bee::simd
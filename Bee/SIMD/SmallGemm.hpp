@@ -0,0 +1,206 @@
+/**
+ * @File SmallGemm.hpp
+ * @Brief 编译期定长的小矩阵乘（3×3 … 32×32）：C = A·B，A / B / C 均为行主序紧密排列。
+ *
+ * 面向大量独立小矩阵（变换、局部求解等）：不经过 Tensor / Result / pack / 运行期分派，
+ * 不分配内存。M / K / N 为模板参数，K 方向完全展开，C 的若干行常驻 SimdBackend 寄存器：
+ *   for each 行块 (RB 行)：
+ *     acc[RB][N / W] = 0
+ *     for k in 0..K（展开）：b = B[k, :]；acc[r] += A[r, k] · b
+ *     N % W 的余数列逐元素累加
+ *
+ * ISA 由调用方 TU 的编译标志决定（SmallGemmIsa）：在当前 TU 可用的后端中按 N 选取
+ * "向量条数 + 余数列数" 最少者（如 f32 的 N=12 选 SSE 的 3×4，而不是 AVX2 的 8 + 4 个标量列）。
+ * 也可显式指定 ISA 模板参数。
+ *
+ * small_gemm_batched：count 个独立问题（A / B / C 各自首尾相接），以 parallel_for 切分。
+ */
+
+#pragma once
+
+#include "Traits.hpp"
+#include "Backends/Scalar.hpp"
+#include "Backends/Sse2.hpp"
+#include "Backends/Avx2.hpp"
+#include "Backends/Avx512.hpp"
+
+#include "Base/Core/Defines.hpp"
+#include "Base/Parallel/ParallelFor.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// 当前 TU 的编译标志实际允许的后端（BEE_SIMD_ENABLE_<X> 只表示特化可见，不代表本 TU 带有对应指令集）
+#if defined(BEE_SIMD_ENABLE_AVX512) && defined(__AVX512F__)
+    #define BEE_SMALL_GEMM_AVX512 1
+#endif
+#if defined(BEE_SIMD_ENABLE_AVX2) && defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+    #define BEE_SMALL_GEMM_AVX2 1
+#endif
+#if defined(BEE_SIMD_ENABLE_SSE2) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define BEE_SMALL_GEMM_SSE2 1
+#endif
+
+namespace bee::simd
+{
+
+namespace detail
+{
+
+    template <typename... Isa>
+    struct IsaList
+    {
+    };
+
+    // 从宽到窄排列，IsaScalar 兜底
+    using SmallGemmIsaList = IsaList<
+#if defined(BEE_SMALL_GEMM_AVX512)
+        IsaAvx512,
+#endif
+#if defined(BEE_SMALL_GEMM_AVX2)
+        IsaAvx2,
+#endif
+#if defined(BEE_SMALL_GEMM_SSE2)
+        IsaSse2,
+#endif
+        IsaScalar>;
+
+    // 每行的指令条数估计：N / W 次向量 FMA + N % W 次标量 FMA；寄存器比 N 宽的 ISA 不参与
+    template <typename T, typename ISA, int N>
+    inline constexpr int small_gemm_cost = [] {
+        constexpr int W = static_cast<int>(SimdBackend<T, ISA>::width);
+        return W > N ? N + 1 : N / W + N % W;
+    }();
+
+    template <typename T, int N, typename Best, typename List>
+    struct PickSmallGemmIsa
+    {
+        using type = Best;
+    };
+
+    // 代价相同时保留靠前（更宽）的 ISA
+    template <typename T, int N, typename Best, typename Next, typename... Rest>
+    struct PickSmallGemmIsa<T, N, Best, IsaList<Next, Rest...>>
+        : PickSmallGemmIsa<T, N, std::conditional_t<(small_gemm_cost<T, Next, N> < small_gemm_cost<T, Best, N>), Next, Best>, IsaList<Rest...>>
+    {
+    };
+
+    template <typename T, int N, typename List>
+    struct SmallGemmIsaOf;
+
+    template <typename T, int N, typename First, typename... Rest>
+    struct SmallGemmIsaOf<T, N, IsaList<First, Rest...>> : PickSmallGemmIsa<T, N, First, IsaList<Rest...>>
+    {
+    };
+
+    // RB 行 × N 列的输出块：K 方向展开，acc 为 RB * NV 个寄存器
+    template <typename T, typename ISA, int RB, int K, int N>
+    BEE_FORCE_INLINE auto small_gemm_rows(const T* A, const T* B, T* C) noexcept -> void
+    {
+        using S             = SimdBackend<T, ISA>;
+        using reg           = typename S::reg;
+        constexpr int W     = static_cast<int>(S::width);
+        constexpr int NV    = N / W;
+        constexpr int NS    = N - NV * W;
+        constexpr int NACC  = RB * NV > 0 ? RB * NV : 1;
+        constexpr int NLOAD = NV > 0 ? NV : 1;
+
+        if constexpr (NV > 0) {
+            reg acc[NACC];
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                ((acc[I] = S::set1(T{0})), ...);
+            }(std::make_index_sequence<NACC>{});
+
+            [&]<std::size_t... Kk>(std::index_sequence<Kk...>) {
+                (
+                    [&] {
+                        constexpr int k = static_cast<int>(Kk);
+                        reg           b[NLOAD];
+                        [&]<std::size_t... J>(std::index_sequence<J...>) {
+                            ((b[J] = S::loadu(B + k * N + static_cast<int>(J) * W)), ...);
+                        }(std::make_index_sequence<NV>{});
+                        [&]<std::size_t... R>(std::index_sequence<R...>) {
+                            (
+                                [&] {
+                                    constexpr int r = static_cast<int>(R);
+                                    const reg     a = S::set1(A[r * K + k]);
+                                    [&]<std::size_t... J>(std::index_sequence<J...>) {
+                                        ((acc[r * NV + J] = S::fma(a, b[J], acc[r * NV + J])), ...);
+                                    }(std::make_index_sequence<NV>{});
+                                }(),
+                                ...
+                            );
+                        }(std::make_index_sequence<RB>{});
+                    }(),
+                    ...
+                );
+            }(std::make_index_sequence<K>{});
+
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                (S::storeu(C + (static_cast<int>(I) / NV) * N + (static_cast<int>(I) % NV) * W, acc[I]), ...);
+            }(std::make_index_sequence<NACC>{});
+        }
+
+        if constexpr (NS > 0) {
+            for (int r = 0; r < RB; ++r) {
+                for (int c = NV * W; c < N; ++c) {
+                    T s = T{0};
+                    for (int k = 0; k < K; ++k)
+                        s += A[r * K + k] * B[k * N + c];
+                    C[r * N + c] = s;
+                }
+            }
+        }
+    }
+
+    // 行块高度：acc（RB * NV）加上一行 B（NV）不超过寄存器预算；全标量时一次处理全部行。
+    // 预算为实测值：SSE2 取 12；256 / 512 位后端取 8（32×32 时 RB=2 的展开体过大，反而比 RB=1 慢约 40%）
+    template <typename T, typename ISA, int M, int N>
+    inline constexpr int small_gemm_row_block = [] {
+        using S              = SimdBackend<T, ISA>;
+        constexpr int NV     = N / static_cast<int>(S::width);
+        constexpr int budget = sizeof(typename S::reg) >= 32 ? 8 : 12;
+        if (NV == 0)
+            return M;
+        return std::clamp(budget / NV - 1, 1, M);
+    }();
+
+} // namespace detail
+
+// 本 TU 下 T 类型、N 列输出的默认 ISA
+template <typename T, int N>
+using SmallGemmIsa = typename detail::SmallGemmIsaOf<T, N, detail::SmallGemmIsaList>::type;
+
+// C[M×N] = A[M×K] · B[K×N]，行主序紧密排列；C 不得与 A / B 重叠
+template <int M, int K, int N, typename T, typename ISA = SmallGemmIsa<T, N>>
+inline auto small_gemm(const T* A, const T* B, T* C) noexcept -> void
+{
+    static_assert(M > 0 && K > 0 && N > 0, "small_gemm: 维度必须为正");
+    static_assert(std::is_floating_point_v<T>, "small_gemm: 仅支持 float / double");
+
+    constexpr int RB   = detail::small_gemm_row_block<T, ISA, M, N>;
+    constexpr int MAIN = M / RB * RB;
+    for (int i = 0; i < MAIN; i += RB)
+        detail::small_gemm_rows<T, ISA, RB, K, N>(A + i * K, B, C + i * N);
+    if constexpr (MAIN < M)
+        detail::small_gemm_rows<T, ISA, M - MAIN, K, N>(A + MAIN * K, B, C + MAIN * N);
+}
+
+// 每个并行任务至少约 64K FLOPs，避免调度开销淹没几十纳秒一次的小乘法
+inline constexpr std::size_t kSmallGemmGrainFlops = 64 * 1024;
+
+// count 个独立问题：A 为 count 个 M×K、B 为 count 个 K×N、C 为 count 个 M×N，均首尾相接
+template <int M, int K, int N, typename T, typename ISA = SmallGemmIsa<T, N>>
+inline auto small_gemm_batched(std::size_t count, const T* A, const T* B, T* C) -> void
+{
+    constexpr std::size_t kFlops = 2 * static_cast<std::size_t>(M) * K * N;
+    const std::size_t     grain  = std::max<std::size_t>(1, kSmallGemmGrainFlops / kFlops);
+    ::bee::parallel::parallel_for(std::size_t{0}, count, grain, [=](std::size_t lo, std::size_t hi) {
+        for (std::size_t i = lo; i < hi; ++i)
+            small_gemm<M, K, N, T, ISA>(A + i * M * K, B + i * K * N, C + i * M * N);
+    });
+}
+
+} // namespace bee::simd
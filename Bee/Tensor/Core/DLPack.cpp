@@ -0,0 +1,191 @@
+#include "Tensor/Core/Tensor.hpp"
+#include "Base/Memory/Allocator.hpp"
+#include "Tensor/Core/Storage.hpp"
+#include "Tensor/Core/dlpack.h"
+#include "Tensor/Cuda/CudaAllocator.hpp"
+
+#include <cstdint>
+#include <format>
+#include <optional>
+#include <utility>
+#include <vector>
+
+using namespace bee;
+
+namespace
+{
+
+// 导出上下文：DLManagedTensor 与它指向的 shape/strides 缓冲同生命周期；
+// storage 引用保证消费方持有期间内存不被释放，deleter 释放整个上下文
+struct DLPackExport
+{
+    DLManagedTensor          managed{};
+    std::shared_ptr<Storage> storage;
+    std::vector<int64_t>     shape;
+    std::vector<int64_t>     strides;
+};
+
+auto dlpack_export_deleter(DLManagedTensor* self) -> void
+{
+    delete static_cast<DLPackExport*>(self->manager_ctx);
+}
+
+// DType → DLDataType；FP8/FP4 在 DLPack v0.8 中没有标准编码
+auto to_dl_dtype(DType dt) -> std::optional<DLDataType>
+{
+    switch (dt) {
+    case DType::Bool: return DLDataType{kDLBool, 8, 1};
+    case DType::U8: return DLDataType{kDLUInt, 8, 1};
+    case DType::I8: return DLDataType{kDLInt, 8, 1};
+    case DType::I32: return DLDataType{kDLInt, 32, 1};
+    case DType::I64: return DLDataType{kDLInt, 64, 1};
+    case DType::F16: return DLDataType{kDLFloat, 16, 1};
+    case DType::F32: return DLDataType{kDLFloat, 32, 1};
+    case DType::F64: return DLDataType{kDLFloat, 64, 1};
+    case DType::BF16: return DLDataType{kDLBfloat, 16, 1};
+    default: return std::nullopt;
+    }
+}
+
+// DLDataType → DType；向量类型（lanes > 1）与其余位宽不支持
+auto from_dl_dtype(DLDataType t) -> std::optional<DType>
+{
+    if (t.lanes != 1)
+        return std::nullopt;
+    switch (t.code) {
+    case kDLBool: return t.bits == 8 ? std::optional{DType::Bool} : std::nullopt;
+    case kDLUInt: return t.bits == 8 ? std::optional{DType::U8} : std::nullopt;
+    case kDLInt:
+        switch (t.bits) {
+        case 8: return DType::I8;
+        case 32: return DType::I32;
+        case 64: return DType::I64;
+        default: return std::nullopt;
+        }
+    case kDLFloat:
+        switch (t.bits) {
+        case 16: return DType::F16;
+        case 32: return DType::F32;
+        case 64: return DType::F64;
+        default: return std::nullopt;
+        }
+    case kDLBfloat: return t.bits == 16 ? std::optional{DType::BF16} : std::nullopt;
+    default: return std::nullopt;
+    }
+}
+
+} // namespace
+
+// ── to_dlpack ────────────────────────────────────────────────────────────────
+
+auto Tensor::to_dlpack() -> Result<DLManagedTensor*>
+{
+    if (!defined())
+        return std::unexpected(make_error("to_dlpack: Tensor 未定义", Severity::Recoverable));
+    const auto dl_dtype = to_dl_dtype(impl_->dtype);
+    if (!dl_dtype)
+        return std::unexpected(make_error(std::format("to_dlpack: DType::{} 没有对应的 DLPack 编码", enum_to_name(impl_->dtype)), Severity::Recoverable));
+
+    // 消费方拿到的是可写裸指针：先结束写时复制共享，并禁止此后的 clone 再共享这块内存
+    if (auto r = impl_->storage->materialize(); !r)
+        return std::unexpected(std::move(r.error()));
+    impl_->storage->disable_sharing();
+
+    auto ctx     = std::make_unique<DLPackExport>();
+    ctx->storage = impl_->storage;
+    ctx->shape.assign(impl_->shape.begin(), impl_->shape.end());
+    ctx->strides.assign(impl_->strides.begin(), impl_->strides.end());
+
+    // data 直接指向首元素、byte_offset 置 0：与主流框架的导出约定一致
+    auto& t       = ctx->managed.dl_tensor;
+    t.data        = static_cast<uint8_t*>(ctx->storage->data()) + impl_->offset * static_cast<int64_t>(dtype_size(impl_->dtype));
+    t.device      = DLDevice{device() == Device::CUDA ? kDLCUDA : kDLCPU, 0};
+    t.ndim        = static_cast<int32_t>(ctx->shape.size());
+    t.dtype       = *dl_dtype;
+    t.shape       = ctx->shape.data();
+    t.strides     = ctx->strides.data();
+    t.byte_offset = 0;
+
+    ctx->managed.manager_ctx = ctx.get();
+    ctx->managed.deleter     = &dlpack_export_deleter;
+    return &ctx.release()->managed;
+}
+
+// ── from_dlpack ──────────────────────────────────────────────────────────────
+
+auto Tensor::from_dlpack(DLManagedTensor* managed) -> Result<Tensor>
+{
+    if (managed == nullptr)
+        return std::unexpected(make_error("from_dlpack: DLManagedTensor 为空", Severity::Recoverable));
+    const DLTensor& t = managed->dl_tensor;
+
+    // pinned host 内存可由 CPU 直接访问，按 CPU 处理；Bee 只有单个 CUDA 设备
+    IAllocator* alloc = nullptr;
+    switch (t.device.device_type) {
+    case kDLCPU:
+    case kDLCUDAHost: alloc = &CpuAllocator::instance(); break;
+    case kDLCUDA:
+        if (t.device.device_id != 0)
+            return std::unexpected(make_error(std::format("from_dlpack: 仅支持 device_id=0，当前为 {}", t.device.device_id), Severity::Recoverable));
+        alloc = &CudaAllocator::instance();
+        break;
+    default:
+        return std::unexpected(
+            make_error(std::format("from_dlpack: 不支持的设备类型 {}", static_cast<int32_t>(t.device.device_type)), Severity::Recoverable)
+        );
+    }
+
+    const auto dtype = from_dl_dtype(t.dtype);
+    if (!dtype)
+        return std::unexpected(make_error(
+            std::format("from_dlpack: 不支持的 dtype（code={}, bits={}, lanes={}）", t.dtype.code, t.dtype.bits, t.dtype.lanes), Severity::Recoverable
+        ));
+    if (t.ndim < 0 || (t.ndim > 0 && t.shape == nullptr))
+        return std::unexpected(make_error(std::format("from_dlpack: 非法的 ndim={} / shape", t.ndim), Severity::Recoverable));
+
+    Shape shape(t.shape, t.shape + t.ndim);
+    for (auto d : shape) {
+        if (d < 0)
+            return std::unexpected(make_error(std::format("from_dlpack: 非法的负维度 {}", d), Severity::Recoverable));
+    }
+    Strides strides = t.strides != nullptr ? Strides(t.strides, t.strides + t.ndim) : compute_contiguous_strides(shape);
+
+    // 覆盖范围（元素数）：首元素到最远元素；size 为 1 的维度其 stride 无意义，跳过
+    const int64_t n    = ::bee::numel(shape);
+    int64_t       span = n > 0 ? 1 : 0;
+    for (std::size_t i = 0; i < shape.size() && n > 0; ++i) {
+        if (shape[i] <= 1)
+            continue;
+        if (strides[i] < 0)
+            return std::unexpected(make_error("from_dlpack: 不支持负 stride", Severity::Recoverable));
+        span += (shape[i] - 1) * strides[i];
+    }
+
+    const std::size_t es   = dtype_size(*dtype);
+    auto*             data = static_cast<uint8_t*>(t.data) + t.byte_offset;
+    if (reinterpret_cast<std::uintptr_t>(data) % es != 0)
+        return std::unexpected(make_error(std::format("from_dlpack: 数据指针未按 {} 字节元素对齐", es), Severity::Recoverable));
+
+    auto ti     = std::make_shared<TensorImpl>();
+    ti->dtype   = *dtype;
+    ti->shape   = std::move(shape);
+    ti->strides = std::move(strides);
+
+    if (managed->deleter == &dlpack_export_deleter) {
+        // 本库导出的对象：取回原 storage，与导出前的张量及其视图继续共享同一内存
+        auto*       ctx  = static_cast<DLPackExport*>(managed->manager_ctx);
+        const auto* base = static_cast<const uint8_t*>(std::as_const(*ctx->storage).data());
+        ti->storage      = ctx->storage;
+        ti->offset       = static_cast<int64_t>(data - base) / static_cast<int64_t>(es);
+        managed->deleter(managed);
+    } else {
+        // 外部内存：最后一个引用释放时回调生产方的 deleter
+        auto block = std::shared_ptr<void>(data, [managed](void*) {
+            if (managed->deleter != nullptr)
+                managed->deleter(managed);
+        });
+        ti->storage = Storage::adopt(std::move(block), static_cast<std::size_t>(span) * es, *alloc);
+        ti->offset  = 0;
+    }
+    return Tensor(std::move(ti));
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Tensor/Core/Half.hpp"
+
 #include <cstdint>
 #include <cstddef>
 #include <string_view>
@@ -10,8 +12,10 @@ namespace bee
 // 元素数据类型枚举
 //
 // MVP 可计算类型：Bool/U8/I32/I64/F32/F64。
-// 扩展类型（F16/BF16/FP8E4M3/FP8E5M2/FP4）仅作为不透明存储占位：
-//  - 仅定义字节大小（F16/BF16=2；FP8*=1；FP4=1，按打包 2 元素/字节语义暂以 1 字节对齐表示）。
+// F16/BF16 为 CPU 存储类型（C++ 类型 Half / BFloat16）：cast、元素级、reduce 与 matmul
+// 加载时展开为 F32 计算、写回时 RNE 收窄；其余算子仍不接受。
+// 扩展类型（FP8E4M3/FP8E5M2/FP4）仅作为不透明存储占位：
+//  - 仅定义字节大小（FP8*=1；FP4=1，按打包 2 元素/字节语义暂以 1 字节对齐表示）。
 //  - CPU 算子遇到这些类型统一返回 NotImplemented 错误（不参与运算）。
 //  - 真正的计算实现后续在 CUDA 组件内接入（CUTLASS/wmma/tcgen05 路径）。
 enum class DType : uint8_t
@@ -23,9 +27,10 @@ enum class DType : uint8_t
     F32,
     F64,
     I8,
-    // —— 扩展占位（CPU 上不可计算）——
+    // —— 16 位浮点（CPU 上仅作存储，按 F32 计算）——
     F16,
     BF16,
+    // —— 扩展占位（CPU 上不可计算）——
     FP8E4M3,
     FP8E5M2,
     FP4,
@@ -68,6 +73,12 @@ enum class DType : uint8_t
     }
 }
 
+// 判断 DType 是否为 16 位浮点存储类型（F16/BF16）
+[[nodiscard]] constexpr auto dtype_is_half_float(DType dt) noexcept -> bool
+{
+    return dt == DType::F16 || dt == DType::BF16;
+}
+
 // 编译期双向映射：DType → C++ 原生类型
 template <DType D>
 struct DTypeToCpp;
@@ -114,6 +125,18 @@ struct DTypeToCpp<DType::F64>
     using type = double;
 };
 
+template <>
+struct DTypeToCpp<DType::F16>
+{
+    using type = Half;
+};
+
+template <>
+struct DTypeToCpp<DType::BF16>
+{
+    using type = BFloat16;
+};
+
 // 编译期双向映射：C++ 原生类型 → DType
 template <typename T>
 struct CppToDType;
@@ -160,6 +183,18 @@ struct CppToDType<double>
     static constexpr DType value = DType::F64;
 };
 
+template <>
+struct CppToDType<Half>
+{
+    static constexpr DType value = DType::F16;
+};
+
+template <>
+struct CppToDType<BFloat16>
+{
+    static constexpr DType value = DType::BF16;
+};
+
 // 便捷别名：DType → C++ 类型
 template <DType D>
 using dtype_cpp_t = typename DTypeToCpp<D>::type;
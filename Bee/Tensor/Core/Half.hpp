@@ -0,0 +1,131 @@
+#pragma once
+
+// 16 位浮点存储类型：F16（IEEE binary16）与 BF16（bfloat16，F32 的高 16 位）
+//
+// 仅作为存储格式：CPU 算子加载时展开为 F32 计算，写回时按舍入到最近偶数（RNE）收窄。
+// 标量转换为可移植实现（NaN 保持为 quiet NaN，F16 溢出到 ±Inf、下溢为次正规数 / ±0）；
+// 批量 SIMD 转换见 Cpu/CastCpu.hpp（F16C / 移位舍入）。
+
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+namespace bee
+{
+
+// F16 位模式 → F32（精确，无舍入）
+[[nodiscard]] constexpr auto f16_bits_to_f32(std::uint16_t h) noexcept -> float
+{
+    const std::uint32_t sign = static_cast<std::uint32_t>(h & 0x8000u) << 16;
+    const std::uint32_t exp  = (h >> 10) & 0x1Fu;
+    std::uint32_t       mant = h & 0x3FFu;
+
+    std::uint32_t bits = 0;
+    if (exp == 0x1Fu) {
+        bits = sign | 0x7F800000u | (mant << 13); // Inf / NaN
+    } else if (exp != 0) {
+        bits = sign | ((exp + 112u) << 23) | (mant << 13); // 正规数：指数偏置 15 → 127
+    } else if (mant == 0) {
+        bits = sign; // ±0
+    } else {
+        // 次正规数：规格化到 F32 的正规数
+        std::uint32_t e = 113;
+        while ((mant & 0x400u) == 0) {
+            mant <<= 1;
+            --e;
+        }
+        bits = sign | (e << 23) | ((mant & 0x3FFu) << 13);
+    }
+    return std::bit_cast<float>(bits);
+}
+
+// F32 → F16 位模式（RNE；≥ 65520 溢出为 ±Inf，NaN 置 quiet 位）
+[[nodiscard]] constexpr auto f32_to_f16_bits(float f) noexcept -> std::uint16_t
+{
+    const std::uint32_t x    = std::bit_cast<std::uint32_t>(f);
+    const std::uint32_t sign = (x >> 16) & 0x8000u;
+    std::uint32_t       ax   = x & 0x7FFFFFFFu;
+
+    if (ax >= 0x7F800000u)
+        return static_cast<std::uint16_t>(sign | 0x7C00u | (ax > 0x7F800000u ? 0x200u | ((ax >> 13) & 0x3FFu) : 0u));
+    if (ax >= 0x477FF000u)
+        return static_cast<std::uint16_t>(sign | 0x7C00u);
+    if (ax < 0x38800000u) {
+        // 结果为次正规数或 0：加 0.5f 使尾数末位对齐 2^-24，由 F32 加法完成 RNE
+        const float v = std::bit_cast<float>(ax) + 0.5f;
+        return static_cast<std::uint16_t>(sign | (std::bit_cast<std::uint32_t>(v) - 0x3F000000u));
+    }
+    // 正规数：指数重偏置（-112 << 23），再加 0xFFF + 末位奇偶完成 RNE
+    const std::uint32_t odd = (ax >> 13) & 1u;
+    ax += 0xC8000FFFu + odd;
+    return static_cast<std::uint16_t>(sign | (ax >> 13));
+}
+
+// BF16 位模式 → F32（精确）
+[[nodiscard]] constexpr auto bf16_bits_to_f32(std::uint16_t h) noexcept -> float
+{
+    return std::bit_cast<float>(static_cast<std::uint32_t>(h) << 16);
+}
+
+// F32 → BF16 位模式（RNE；NaN 置 quiet 位，避免截断成 Inf）
+[[nodiscard]] constexpr auto f32_to_bf16_bits(float f) noexcept -> std::uint16_t
+{
+    std::uint32_t x = std::bit_cast<std::uint32_t>(f);
+    if ((x & 0x7FFFFFFFu) > 0x7F800000u)
+        return static_cast<std::uint16_t>((x >> 16) | 0x40u);
+    x += 0x7FFFu + ((x >> 16) & 1u);
+    return static_cast<std::uint16_t>(x >> 16);
+}
+
+// IEEE binary16：1 符号 + 5 指数 + 10 尾数
+struct Half
+{
+    std::uint16_t bits = 0;
+
+    Half() = default;
+
+    constexpr explicit Half(float f) noexcept
+        : bits(f32_to_f16_bits(f))
+    {
+    }
+
+    [[nodiscard]] static constexpr auto from_bits(std::uint16_t b) noexcept -> Half
+    {
+        Half h;
+        h.bits = b;
+        return h;
+    }
+
+    constexpr explicit operator float() const noexcept { return f16_bits_to_f32(bits); }
+};
+
+// bfloat16：1 符号 + 8 指数 + 7 尾数（与 F32 同指数范围）
+struct BFloat16
+{
+    std::uint16_t bits = 0;
+
+    BFloat16() = default;
+
+    constexpr explicit BFloat16(float f) noexcept
+        : bits(f32_to_bf16_bits(f))
+    {
+    }
+
+    [[nodiscard]] static constexpr auto from_bits(std::uint16_t b) noexcept -> BFloat16
+    {
+        BFloat16 h;
+        h.bits = b;
+        return h;
+    }
+
+    constexpr explicit operator float() const noexcept { return bf16_bits_to_f32(bits); }
+};
+
+static_assert(sizeof(Half) == 2 && std::is_trivially_copyable_v<Half>);
+static_assert(sizeof(BFloat16) == 2 && std::is_trivially_copyable_v<BFloat16>);
+
+// 是否为 16 位浮点存储类型（CPU 内核据此走“展开为 F32 计算”的路径）
+template <typename T>
+inline constexpr bool is_half_float_v = std::is_same_v<T, Half> || std::is_same_v<T, BFloat16>;
+
+} // namespace bee
@@ -1,5 +1,8 @@
 #include "Tensor/Core/Storage.hpp"
 #include "Base/Memory/Allocator.hpp"
+#include "Base/Diagnostics/Check.hpp"
+
+#include <cstring>
 
 namespace bee
 {
@@ -13,10 +16,14 @@ Storage::Storage(void* data, std::size_t nbytes, std::size_t alignment, Device d
 {
 }
 
-Storage::~Storage()
+Storage::~Storage() = default;
+
+auto Storage::make_block(void* data, std::size_t nbytes, std::size_t alignment, IAllocator* allocator) -> std::shared_ptr<void>
 {
-    if (data_ != nullptr)
-        allocator_->deallocate(data_, nbytes_, alignment_);
+    return std::shared_ptr<void>(data, [nbytes, alignment, allocator](void* p) {
+        if (p != nullptr)
+            allocator->deallocate(p, nbytes, alignment);
+    });
 }
 
 auto Storage::allocate(std::size_t nbytes, IAllocator& allocator) -> Result<std::shared_ptr<Storage>>
@@ -26,11 +33,66 @@ auto Storage::allocate(std::size_t nbytes, IAllocator& allocator) -> Result<std:
         return std::unexpected(std::move(result.error()));
 
     // Storage 构造函数为私有，无法使用 make_shared，直接用 new
-    return std::shared_ptr<Storage>(new Storage(result.value(), nbytes, 64u, allocator.device(), &allocator));
+    auto storage    = std::shared_ptr<Storage>(new Storage(result.value(), nbytes, 64u, allocator.device(), &allocator));
+    storage->block_ = make_block(storage->data_, nbytes, 64u, &allocator);
+    return storage;
+}
+
+auto Storage::adopt(std::shared_ptr<void> block, std::size_t nbytes, IAllocator& allocator) -> std::shared_ptr<Storage>
+{
+    auto storage    = std::shared_ptr<Storage>(new Storage(block.get(), nbytes, 64u, allocator.device(), &allocator));
+    storage->block_ = std::move(block);
+    storage->disable_sharing();
+    return storage;
+}
+
+auto Storage::share() -> std::shared_ptr<Storage>
+{
+    BEE_CHECK(shareable());
+    auto storage    = std::shared_ptr<Storage>(new Storage(data_, nbytes_, alignment_, device_, allocator_));
+    storage->block_ = block_;
+    return storage;
+}
+
+auto Storage::shareable() const noexcept -> bool
+{
+    // 物化只实现了主机端 memcpy，设备内存不参与写时复制
+    return device_ == Device::CPU && !sharing_disabled_.load(std::memory_order_relaxed);
+}
+
+auto Storage::disable_sharing() noexcept -> void
+{
+    sharing_disabled_.store(true, std::memory_order_relaxed);
+}
+
+auto Storage::is_shared() const noexcept -> bool
+{
+    return block_.use_count() > 1;
+}
+
+auto Storage::materialize() -> Result<void>
+{
+    if (!is_shared())
+        return {};
+
+    auto result = allocator_->allocate(nbytes_, alignment_);
+    if (!result)
+        return std::unexpected(std::move(result.error()));
+
+    // 先建好新块再替换：旧块引用计数减一，仍由其他共享者持有
+    if (nbytes_ > 0)
+        std::memcpy(result.value(), data_, nbytes_);
+    block_ = make_block(result.value(), nbytes_, alignment_, allocator_);
+    data_  = result.value();
+    return {};
 }
 
 auto Storage::data() noexcept -> void*
 {
+    if (is_shared()) {
+        auto r = materialize();
+        BEE_CHECK_MSG(r.has_value(), "Storage 写时复制物化失败");
+    }
     return data_;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
 
@@ -13,6 +14,13 @@ class IAllocator;
 
 // Storage 持有一块裸内存及其分配器，通过 shared_ptr 共享所有权
 // 禁止拷贝与移动，生命周期由 shared_ptr<Storage> 管控
+//
+// 写时复制（COW）：share() 生成另一个 Storage，与本对象共享同一内存块。
+// 只要内存块仍被多个 Storage 共享，可写访问（非 const data() / materialize()）
+// 会先复制出私有副本再返回，另一方内容不受影响；只读访问始终零拷贝。
+// 注意：共享前已取得的可写裸指针不受保护，不应跨 share() 继续写入；
+// 会长期交出可写指针的一方（Tensor::data_ptr()、DLPack 导出）须先 disable_sharing()。
+// 共享状态的检查与物化不加锁：可写访问要求单一写者（见 Tensor::data_ptr() 的说明）。
 class Storage
 {
 public:
@@ -26,6 +34,26 @@ public:
     // 静态工厂：委托 allocator 分配内存，返回 shared_ptr<Storage>
     [[nodiscard]] static auto allocate(std::size_t nbytes, IAllocator& allocator) -> Result<std::shared_ptr<Storage>>;
 
+    // 接管外部内存块：block.get() 为数据起点，block 的删除器负责归还内存；
+    // allocator 决定所在设备，并用于物化时分配副本。外部仍可能经裸指针写入，故不参与写时复制
+    [[nodiscard]] static auto adopt(std::shared_ptr<void> block, std::size_t nbytes, IAllocator& allocator) -> std::shared_ptr<Storage>;
+
+    // 共享同一内存块的新 Storage（要求 shareable()）；双方均在首次写入时才真正拷贝
+    [[nodiscard]] auto share() -> std::shared_ptr<Storage>;
+
+    // 能否经 share() 共享：仅 CPU，且内存未以裸指针交给外部（Tensor::data_ptr() / DLPack 导出 / 外部导入）
+    [[nodiscard]] auto shareable() const noexcept -> bool;
+
+    // 内存已交给外部写入方：此后 clone 退回立即拷贝，已存在的共享不受影响
+    auto disable_sharing() noexcept -> void;
+
+    // 内存块是否仍与其他 Storage 共享
+    [[nodiscard]] auto is_shared() const noexcept -> bool;
+
+    // 若处于共享状态则立即复制出私有副本；分配失败时返回错误，原状态不变
+    [[nodiscard]] auto materialize() -> Result<void>;
+
+    // 可写访问：共享状态下先 materialize()，此处无法传播错误，分配失败即终止
     [[nodiscard]] auto data() noexcept -> void*;
     [[nodiscard]] auto data() const noexcept -> const void*;
     [[nodiscard]] auto nbytes() const noexcept -> std::size_t;
@@ -35,11 +63,16 @@ public:
 private:
     explicit Storage(void* data, std::size_t nbytes, std::size_t alignment, Device device, IAllocator* allocator) noexcept;
 
-    void*       data_      = nullptr;
-    std::size_t nbytes_    = 0;
-    std::size_t alignment_ = 64; // 分配时实际使用的对齐值，析构时传回 deallocate
-    Device      device_    = Device::CPU;
-    IAllocator* allocator_ = nullptr;
+    // 将 data 包装为内存块所有者：最后一个持有者析构时交回 allocator
+    [[nodiscard]] static auto make_block(void* data, std::size_t nbytes, std::size_t alignment, IAllocator* allocator) -> std::shared_ptr<void>;
+
+    void*                 data_      = nullptr;
+    std::size_t           nbytes_    = 0;
+    std::size_t           alignment_ = 64; // 分配时实际使用的对齐值，析构时传回 deallocate
+    Device                device_    = Device::CPU;
+    IAllocator*           allocator_ = nullptr;
+    std::shared_ptr<void> block_; // 内存块所有权；use_count > 1 即处于写时复制共享状态
+    std::atomic<bool>     sharing_disabled_{false};
 };
 
 } // namespace bee
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <cstring>
 #include <format>
+#include <utility>
 
 using namespace bee;
 
@@ -43,6 +44,8 @@ auto dispatch_fill(DType dt, void* data, std::size_t n, double value) -> void
     case DType::I64: fill_typed<DType::I64>(data, n, value); break;
     case DType::F32: fill_typed<DType::F32>(data, n, value); break;
     case DType::F64: fill_typed<DType::F64>(data, n, value); break;
+    case DType::F16: fill_typed<DType::F16>(data, n, value); break;
+    case DType::BF16: fill_typed<DType::BF16>(data, n, value); break;
     default: break;
     }
 }
@@ -116,35 +119,13 @@ auto resolve_shape(const Shape& new_shape, int64_t total_numel) -> Result<Shape>
     return resolved;
 }
 
-// ── 内部辅助：将非连续 TensorImpl 按 stride 逐元素拷贝到已分配目标缓冲区 ──────
+// ── 内部辅助：将非连续 TensorImpl 按 stride 拷贝到已分配的行优先连续缓冲区 ──────
+// CPU 分派：合并相邻维后按连续段 memcpy / 分块转置平面 / strided gather 三种情形处理
 void contiguous_copy_into(void* dst, const TensorImpl& src, std::size_t elem_sz)
 {
-    const auto* src_base = static_cast<const uint8_t*>(src.storage->data());
-    auto*       dst_ptr  = static_cast<uint8_t*>(dst);
-
-    const int      nd       = static_cast<int>(src.shape.size());
-    const int64_t  n        = src.numel();
-    const Shape&   sh       = src.shape;
-    const Strides& st       = src.strides;
-    const int64_t  base_off = src.offset;
-
-    // 按 C-order 枚举所有逻辑元素，依 stride 计算源偏移后逐元素拷贝
-    std::vector<int64_t> idx(nd, 0);
-    for (int64_t linear = 0; linear < n; ++linear) {
-        int64_t src_off = base_off;
-        for (int i = 0; i < nd; ++i)
-            src_off += idx[i] * st[i];
-
-        std::memcpy(dst_ptr + linear * static_cast<int64_t>(elem_sz), src_base + src_off * static_cast<int64_t>(elem_sz), elem_sz);
-
-        // 推进多维索引（末尾维度最快）
-        for (int i = nd - 1; i >= 0; --i) {
-            ++idx[i];
-            if (idx[i] < sh[i])
-                break;
-            idx[i] = 0;
-        }
-    }
+    const auto* src_base = static_cast<const uint8_t*>(std::as_const(*src.storage).data()) + src.offset * static_cast<int64_t>(elem_sz);
+    const auto  nd       = static_cast<int64_t>(src.shape.size());
+    BEE_RT_DISPATCH_STMT(tr_copy_nd, src_base, dst, nd, src.shape.data(), src.strides.data(), elem_sz);
 }
 
 } // namespace
@@ -201,9 +182,9 @@ auto Tensor::zeros(Shape shape, DType dtype, Device device) -> Result<Tensor>
     const std::size_t nbytes = static_cast<std::size_t>(n) * dtype_size(dtype);
     if (nbytes > 0) {
         if (device == Device::CUDA) {
-            BEE_TRY(tensor::cuda::memset(t.data_ptr(), 0, nbytes));
+            BEE_TRY(tensor::cuda::memset(t.scoped_data_ptr(), 0, nbytes));
         } else {
-            std::memset(t.data_ptr(), 0, nbytes);
+            std::memset(t.scoped_data_ptr(), 0, nbytes);
         }
     }
 
@@ -222,7 +203,7 @@ auto Tensor::ones(Shape shape, DType dtype, Device device) -> Result<Tensor>
 
 auto Tensor::full(Shape shape, DType dtype, double value, Device device) -> Result<Tensor>
 {
-    if (!dtype_is_cpu_computable(dtype))
+    if (!dtype_is_cpu_computable(dtype) && !dtype_is_half_float(dtype))
         return std::unexpected(
             make_error(std::format("Tensor::full: 扩展 dtype::{} 暂不支持 CPU 端填充（NotImplemented）", enum_to_name(dtype)), Severity::Recoverable)
         );
@@ -239,7 +220,7 @@ auto Tensor::full(Shape shape, DType dtype, double value, Device device) -> Resu
 
     const int64_t n = t.numel();
     if (n > 0)
-        dispatch_fill(dtype, t.data_ptr(), static_cast<std::size_t>(n), value);
+        dispatch_fill(dtype, t.scoped_data_ptr(), static_cast<std::size_t>(n), value);
 
     return t;
 }
@@ -284,7 +265,7 @@ auto Tensor::arange(int64_t start, int64_t end, int64_t step, DType dtype, Devic
     BEE_TRY_ASSIGN(t, empty({n}, dtype, device));
 
     if (n > 0)
-        dispatch_arange(dtype, t.data_ptr(), static_cast<std::size_t>(n), start, step);
+        dispatch_arange(dtype, t.scoped_data_ptr(), static_cast<std::size_t>(n), start, step);
 
     return t;
 }
@@ -345,19 +326,38 @@ auto Tensor::storage_offset() const noexcept -> int64_t
 }
 
 auto Tensor::data_ptr() noexcept -> void*
+{
+    auto* p = scoped_data_ptr();
+    impl_->storage->disable_sharing();
+    return p;
+}
+
+auto Tensor::data_ptr() const noexcept -> const void*
 {
     BEE_CHECK(impl_ != nullptr);
-    auto* base = static_cast<uint8_t*>(impl_->storage->data());
+    const auto* base = static_cast<const uint8_t*>(std::as_const(*impl_->storage).data());
     return base + impl_->offset * static_cast<int64_t>(dtype_size(impl_->dtype));
 }
 
-auto Tensor::data_ptr() const noexcept -> const void*
+auto Tensor::const_data_ptr() const noexcept -> const void*
+{
+    return data_ptr();
+}
+
+auto Tensor::scoped_data_ptr() noexcept -> void*
 {
     BEE_CHECK(impl_ != nullptr);
-    const auto* base = static_cast<const uint8_t*>(impl_->storage->data());
+    auto* base = static_cast<uint8_t*>(impl_->storage->data());
     return base + impl_->offset * static_cast<int64_t>(dtype_size(impl_->dtype));
 }
 
+auto Tensor::materialize() -> Result<void>
+{
+    if (!defined())
+        return std::unexpected(make_error("不能物化未定义的 Tensor", Severity::Recoverable));
+    return impl_->storage->materialize();
+}
+
 auto Tensor::storage() const noexcept -> const std::shared_ptr<Storage>&
 {
     BEE_CHECK(impl_ != nullptr);
@@ -391,7 +391,7 @@ auto Tensor::clone() const -> Result<Tensor>
             return std::unexpected(std::move(storage_result.error()));
 
         if (nbytes > 0)
-            BEE_TRY(tensor::cuda::memcpy_d2d((*storage_result)->data(), data_ptr(), nbytes));
+            BEE_TRY(tensor::cuda::memcpy_d2d((*storage_result)->data(), const_data_ptr(), nbytes));
 
         auto ti     = std::make_shared<TensorImpl>();
         ti->storage = std::move(*storage_result);
@@ -402,13 +402,25 @@ auto Tensor::clone() const -> Result<Tensor>
         return Tensor(std::move(ti));
     }
 
+    // 连续且恰好覆盖整块 storage（offset 必为 0）：写时复制，推迟到首次写入再拷贝。
+    // 部分视图不共享，避免小切片的 clone 长期钉住整块大内存；已交给外部写入的内存也不共享
+    if (is_contiguous() && nbytes == impl_->storage->nbytes() && impl_->storage->shareable()) {
+        auto ti     = std::make_shared<TensorImpl>();
+        ti->storage = impl_->storage->share();
+        ti->dtype   = impl_->dtype;
+        ti->shape   = impl_->shape;
+        ti->strides = compute_contiguous_strides(impl_->shape);
+        ti->offset  = 0;
+        return Tensor(std::move(ti));
+    }
+
     auto storage_result = Storage::allocate(nbytes, impl_->storage->allocator());
     if (!storage_result)
         return std::unexpected(std::move(storage_result.error()));
 
     if (is_contiguous()) {
         // 连续：直接内存块拷贝
-        std::memcpy((*storage_result)->data(), data_ptr(), nbytes);
+        std::memcpy((*storage_result)->data(), const_data_ptr(), nbytes);
     } else {
         // 非连续：stride-loop 拷贝，避免中间临时 contiguous 分配
         contiguous_copy_into((*storage_result)->data(), *impl_, elem_sz);
@@ -449,11 +461,11 @@ auto Tensor::to(Device target) const -> Result<Tensor>
         const Device from = src.device();
         const Device to   = target;
         if (from == Device::CPU && to == Device::CUDA) {
-            BEE_TRY(tensor::cuda::memcpy_h2d(dst.data_ptr(), src.data_ptr(), nbytes));
+            BEE_TRY(tensor::cuda::memcpy_h2d(dst.scoped_data_ptr(), src.const_data_ptr(), nbytes));
         } else if (from == Device::CUDA && to == Device::CPU) {
-            BEE_TRY(tensor::cuda::memcpy_d2h(dst.data_ptr(), src.data_ptr(), nbytes));
+            BEE_TRY(tensor::cuda::memcpy_d2h(dst.scoped_data_ptr(), src.const_data_ptr(), nbytes));
         } else if (from == Device::CUDA && to == Device::CUDA) {
-            BEE_TRY(tensor::cuda::memcpy_d2d(dst.data_ptr(), src.data_ptr(), nbytes));
+            BEE_TRY(tensor::cuda::memcpy_d2d(dst.scoped_data_ptr(), src.const_data_ptr(), nbytes));
         } else {
             // CPU→CPU 在 device == target 时已处理；此处不可达
             return std::unexpected(make_error("Tensor::to 遇到未支持的设备组合", Severity::Recoverable));
@@ -484,8 +496,8 @@ auto Tensor::contiguous() const -> Result<Tensor>
             if (!storage_result)
                 return std::unexpected(std::move(storage_result.error()));
 
-            auto rc =
-                tensor::cuda::transpose_2d(static_cast<int>(impl_->dtype), impl_->storage->data(), (*storage_result)->data(), rows_src, cols_src);
+            const void* src = std::as_const(*impl_->storage).data();
+            auto        rc  = tensor::cuda::transpose_2d(static_cast<int>(impl_->dtype), src, (*storage_result)->data(), rows_src, cols_src);
             if (!rc)
                 return std::unexpected(std::move(rc.error()));
 
@@ -516,24 +528,8 @@ auto Tensor::contiguous() const -> Result<Tensor>
     if (!storage_result)
         return std::unexpected(std::move(storage_result.error()));
 
-    // B11 CPU fast-path：2D 情形走 blocked-tile 拷贝（F32 AVX2 还会进 8×8 寄存器转置）
-    if (impl_->shape.size() == 2) {
-        const auto*   src_base  = static_cast<const uint8_t*>(impl_->storage->data());
-        const int64_t off_bytes = impl_->offset * static_cast<int64_t>(elem_sz);
-        BEE_RT_DISPATCH_STMT(
-            tr_copy_2d,
-            src_base + off_bytes,
-            (*storage_result)->data(),
-            impl_->shape[0],
-            impl_->shape[1],
-            impl_->strides[0],
-            impl_->strides[1],
-            elem_sz
-        );
-    } else {
-        // 通用 stride-loop 拷贝
-        contiguous_copy_into((*storage_result)->data(), *impl_, elem_sz);
-    }
+    // 任意维 permute / 切片视图：合并维后走连续段拷贝或分块转置（4 字节元素用 8×8 寄存器转置）
+    contiguous_copy_into((*storage_result)->data(), *impl_, elem_sz);
 
     auto ti     = std::make_shared<TensorImpl>();
     ti->storage = std::move(*storage_result);
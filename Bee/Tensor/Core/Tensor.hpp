@@ -11,6 +11,9 @@
 #include "Tensor/Core/Shape.hpp"
 #include "Tensor/Core/TensorImpl.hpp"
 
+// DLPack 交换结构（定义见 Tensor/Core/dlpack.h）
+struct DLManagedTensor;
+
 namespace bee
 {
 
@@ -52,20 +55,50 @@ public:
     [[nodiscard]] auto storage_offset() const noexcept -> int64_t;
 
     // 原始数据指针（已加上元素偏移）
+    // 非 const 重载视为写访问：storage 处于写时复制共享状态时会先物化私有副本；
+    // 该重载为 noexcept，物化时分配失败只能终止进程。库内算子写入前一律先调用 materialize() 传播错误，
+    // 调用方需要可恢复错误时同样应先 materialize()。只读场景请用 const 重载或 const_data_ptr()，不会触发拷贝
+    //
+    // 可写指针交出后调用方可能一直持有，因此非 const 重载同时禁止该 storage 此后再经 clone 共享
+    // （见 Storage::disable_sharing()）：之后的 clone 立即拷贝，经旧指针的写入不会出现在 clone 中
+    //
+    // 线程安全：写时复制状态不加锁。对同一 storage（含其全部视图），同一时刻只能有一个线程
+    // 取可写指针 / materialize()；多线程写入前请在单线程中先 materialize()，再把可写指针分发给各线程
     [[nodiscard]] auto data_ptr() noexcept -> void*;
     [[nodiscard]] auto data_ptr() const noexcept -> const void*;
+    [[nodiscard]] auto const_data_ptr() const noexcept -> const void*;
+
+    // 库内算子使用的可写指针：同样先结束写时复制共享，但不禁止此后的共享。
+    // 指针只在本次调用内使用，不得保存到调用返回之后（更不能跨 clone() 写入）
+    [[nodiscard]] auto scoped_data_ptr() noexcept -> void*;
+
+    // 写时复制物化：storage 仍与 clone 来源共享时立即复制出私有副本（视图随之共享新副本）。
+    // in-place 算子 / out 参数在写入前调用，以便分配失败时返回错误而非终止
+    [[nodiscard]] auto materialize() -> Result<void>;
 
     // 内部结构访问
     [[nodiscard]] auto storage() const noexcept -> const std::shared_ptr<Storage>&;
     [[nodiscard]] auto impl() const noexcept -> const std::shared_ptr<TensorImpl>&;
 
-    // 深拷贝：始终返回 contiguous 的独立 storage（支持非连续张量）
+    // 深拷贝：始终返回 contiguous 的独立 storage（支持非连续张量）。
+    // CPU 上连续且覆盖整块 storage 的张量走写时复制：先与来源共享内存，任一方首次写入时才真正拷贝
     [[nodiscard]] auto clone() const -> Result<Tensor>;
 
     // 设备迁移：在目标设备上分配等形状张量并搬运数据。
     // 若已在目标设备上则直接返回浅拷贝；非连续张量会先 contiguous() 再搬运。
     [[nodiscard]] auto to(Device target) const -> Result<Tensor>;
 
+    // ── DLPack 互操作（零拷贝）────────────────────────────────────────────
+
+    // 导出为 DLManagedTensor：共享本张量的 storage（引用随 deleter 释放），shape/strides 以元素计。
+    // 消费方用完必须调用 deleter。消费方拿到的是可写指针，因此导出会改变写时复制状态（故为非 const）：
+    // storage 仍与 clone 来源共享时先复制出私有副本（分配失败返回错误），且此后该 storage 不再参与 clone 的共享
+    [[nodiscard]] auto to_dlpack() -> Result<DLManagedTensor*>;
+
+    // 接管 DLManagedTensor：成功后 deleter 在最后一个引用该内存的 Tensor 析构时调用；
+    // 失败时不接管，调用方仍负责 deleter。本库导出的对象直接还原为原 storage
+    [[nodiscard]] static auto from_dlpack(DLManagedTensor* managed) -> Result<Tensor>;
+
     // ── 视图与形状变换（零拷贝，除非另行说明）──────────────────────────────
 
     // 返回新形状的视图；要求当前张量 contiguous；支持一个 -1 占位推断
@@ -75,7 +108,7 @@ public:
     [[nodiscard]] auto reshape(Shape new_shape) const -> Result<Tensor>;
 
     // 返回连续布局张量；若已连续则共享 storage，否则重新排列数据。
-    // 当前 CPU 有 2D 专用快路径；CUDA 仅对部分 2D transpose 形态做设备端物化。
+    // CPU 对任意维 permute / 切片合并维后走连续段拷贝或分块转置；CUDA 仅对部分 2D transpose 形态做设备端物化。
     [[nodiscard]] auto contiguous() const -> Result<Tensor>;
 
     // 维度排列；dims 为 {0..ndim-1} 的一个排列
@@ -0,0 +1,23 @@
+#pragma once
+
+// 融合注意力的几何参数，供 Ops 层、运行期分派与各 ISA 的 GEMM 实现共享
+
+#include <cstdint>
+
+namespace bee::cpu
+{
+
+// q={BH, Lq, D}、k={BH, Lk, D}、v={BH, Lk, Dv}、out={BH, Lq, Dv}，均连续（BH 为 batch·heads 展平）
+// mask 为 Bool {Lq, Lk}，相邻 (batch·head) 之间间隔 mask_stride 个元素（0 表示所有头共享同一个 mask）
+struct AttentionGeom
+{
+    std::int64_t BH          = 0;
+    std::int64_t Lq          = 0;
+    std::int64_t Lk          = 0;
+    std::int64_t D           = 0;
+    std::int64_t Dv          = 0;
+    std::int64_t mask_stride = 0;
+    bool         causal      = false; // 仅允许 key 下标 j ≤ query 下标 i（左上对齐）
+};
+
+} // namespace bee::cpu
@@ -2,10 +2,13 @@
 
 // CPU 类型转换内核：基于 ISA 标签的模板化实现
 // - 常用数值对（F32↔F64/I32/U8）在 AVX2/SSE2 下走 intrinsics
+// - F32↔BF16：SSE2 / AVX2 / AVX-512 移位 + RNE；F32↔F16：AVX2 / AVX-512 走 F16C（SSE2 无 F16C，走标量）
+// - F16/BF16 与其余类型之间经栈上 F32 缓冲分块中转
 // - 其余组合回落到 static_cast 标量循环
 // - 大 n 走 parallel_for 切块
 
 #include "Tensor/Core/DType.hpp"
+#include "Tensor/Core/Half.hpp"
 #include "SIMD/SIMD.hpp"
 #include "Base/Parallel/ParallelFor.hpp"
 
@@ -164,6 +167,44 @@ inline void cast_simd_chunk<float, bool, simd::IsaSse2>(const float* s, bool* d,
         d[i] = (s[i] != 0.0f);
 }
 
+// BF16 → F32：u16 交错到 32 位 lane 的高半部即为 bits << 16
+template <>
+inline void cast_simd_chunk<BFloat16, float, simd::IsaSse2>(const BFloat16* s, float* d, std::int64_t n)
+{
+    std::int64_t  i    = 0;
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= n; i += 8) {
+        __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        _mm_storeu_ps(d + i, _mm_castsi128_ps(_mm_unpacklo_epi16(zero, h)));
+        _mm_storeu_ps(d + i + 4, _mm_castsi128_ps(_mm_unpackhi_epi16(zero, h)));
+    }
+    for (; i < n; ++i)
+        d[i] = static_cast<float>(s[i]);
+}
+
+// F32 → BF16：x + 0x7FFF + 末位奇偶后取高 16 位（RNE），NaN 置 quiet 位
+inline auto f32_to_bf16_sse(__m128 v) -> __m128i
+{
+    const __m128i x   = _mm_castps_si128(v);
+    const __m128i odd = _mm_and_si128(_mm_srli_epi32(x, 16), _mm_set1_epi32(1));
+    const __m128i rne = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(x, _mm_set1_epi32(0x7FFF)), odd), 16);
+    const __m128i qn  = _mm_or_si128(_mm_srli_epi32(x, 16), _mm_set1_epi32(0x40));
+    return _mm_blendv_epi8(rne, qn, _mm_castps_si128(_mm_cmpunord_ps(v, v)));
+}
+
+template <>
+inline void cast_simd_chunk<float, BFloat16, simd::IsaSse2>(const float* s, BFloat16* d, std::int64_t n)
+{
+    std::int64_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m128i lo = f32_to_bf16_sse(_mm_loadu_ps(s + i));
+        const __m128i hi = f32_to_bf16_sse(_mm_loadu_ps(s + i + 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(d + i), _mm_packus_epi32(lo, hi));
+    }
+    for (; i < n; ++i)
+        d[i] = BFloat16(s[i]);
+}
+
 #endif // BEE_SIMD_ENABLE_SSE2
 
 // ─── AVX2 特化 ───────────────────────────────────────────────────────────────
@@ -277,8 +318,127 @@ inline void cast_simd_chunk<float, bool, simd::IsaAvx2>(const float* s, bool* d,
         d[i] = (s[i] != 0.0f);
 }
 
+// BF16 → F32：零扩展到 32 位后左移 16
+template <>
+inline void cast_simd_chunk<BFloat16, float, simd::IsaAvx2>(const BFloat16* s, float* d, std::int64_t n)
+{
+    std::int64_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m256i w = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i)));
+        _mm256_storeu_ps(d + i, _mm256_castsi256_ps(_mm256_slli_epi32(w, 16)));
+    }
+    for (; i < n; ++i)
+        d[i] = static_cast<float>(s[i]);
+}
+
+// F32 → BF16（RNE，NaN 置 quiet 位）：结果落在各 32 位 lane 的低 16 位
+inline auto f32_to_bf16_avx2(__m256 v) -> __m256i
+{
+    const __m256i x   = _mm256_castps_si256(v);
+    const __m256i odd = _mm256_and_si256(_mm256_srli_epi32(x, 16), _mm256_set1_epi32(1));
+    const __m256i rne = _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(x, _mm256_set1_epi32(0x7FFF)), odd), 16);
+    const __m256i qn  = _mm256_or_si256(_mm256_srli_epi32(x, 16), _mm256_set1_epi32(0x40));
+    return _mm256_blendv_epi8(rne, qn, _mm256_castps_si256(_mm256_cmp_ps(v, v, _CMP_UNORD_Q)));
+}
+
+template <>
+inline void cast_simd_chunk<float, BFloat16, simd::IsaAvx2>(const float* s, BFloat16* d, std::int64_t n)
+{
+    std::int64_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        // packus 按 128 位 lane 交错，permute4x64 恢复顺序
+        __m256i p = _mm256_packus_epi32(f32_to_bf16_avx2(_mm256_loadu_ps(s + i)), f32_to_bf16_avx2(_mm256_loadu_ps(s + i + 8)));
+        p         = _mm256_permute4x64_epi64(p, 0b11'01'10'00);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i), p);
+    }
+    for (; i < n; ++i)
+        d[i] = BFloat16(s[i]);
+}
+
+    #if defined(__F16C__)
+// F16 ↔ F32：F16C vcvtph2ps / vcvtps2ph（RNE）
+template <>
+inline void cast_simd_chunk<Half, float, simd::IsaAvx2>(const Half* s, float* d, std::int64_t n)
+{
+    std::int64_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(d + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i))));
+    for (; i < n; ++i)
+        d[i] = static_cast<float>(s[i]);
+}
+
+template <>
+inline void cast_simd_chunk<float, Half, simd::IsaAvx2>(const float* s, Half* d, std::int64_t n)
+{
+    std::int64_t i = 0;
+    for (; i + 8 <= n; i += 8)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(d + i), _mm256_cvtps_ph(_mm256_loadu_ps(s + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    for (; i < n; ++i)
+        d[i] = Half(s[i]);
+}
+    #endif
+
 #endif // BEE_SIMD_ENABLE_AVX2
 
+// ─── AVX-512 特化（仅 16 位浮点；其余组合沿用标量默认）──────────────────────
+#if defined(BEE_SIMD_ENABLE_AVX512)
+
+template <>
+inline void cast_simd_chunk<BFloat16, float, simd::IsaAvx512>(const BFloat16* s, float* d, std::int64_t n)
+{
+    std::int64_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m512i w = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i)));
+        _mm512_storeu_ps(d + i, _mm512_castsi512_ps(_mm512_slli_epi32(w, 16)));
+    }
+    for (; i < n; ++i)
+        d[i] = static_cast<float>(s[i]);
+}
+
+template <>
+inline void cast_simd_chunk<float, BFloat16, simd::IsaAvx512>(const float* s, BFloat16* d, std::int64_t n)
+{
+    std::int64_t  i    = 0;
+    const __m512i one  = _mm512_set1_epi32(1);
+    const __m512i bias = _mm512_set1_epi32(0x7FFF);
+    const __m512i quiet = _mm512_set1_epi32(0x40);
+    for (; i + 16 <= n; i += 16) {
+        const __m512    v   = _mm512_loadu_ps(s + i);
+        const __m512i   x   = _mm512_castps_si512(v);
+        const __m512i   hi  = _mm512_srli_epi32(x, 16);
+        const __m512i   rne = _mm512_srli_epi32(_mm512_add_epi32(_mm512_add_epi32(x, bias), _mm512_and_si512(hi, one)), 16);
+        const __mmask16 nan = _mm512_cmp_ps_mask(v, v, _CMP_UNORD_Q);
+        const __m512i   r   = _mm512_mask_blend_epi32(nan, rne, _mm512_or_si512(hi, quiet));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i), _mm512_cvtepi32_epi16(r));
+    }
+    for (; i < n; ++i)
+        d[i] = BFloat16(s[i]);
+}
+
+template <>
+inline void cast_simd_chunk<Half, float, simd::IsaAvx512>(const Half* s, float* d, std::int64_t n)
+{
+    std::int64_t i = 0;
+    for (; i + 16 <= n; i += 16)
+        _mm512_storeu_ps(d + i, _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i))));
+    for (; i < n; ++i)
+        d[i] = static_cast<float>(s[i]);
+}
+
+template <>
+inline void cast_simd_chunk<float, Half, simd::IsaAvx512>(const float* s, Half* d, std::int64_t n)
+{
+    std::int64_t i = 0;
+    for (; i + 16 <= n; i += 16)
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(d + i), _mm512_cvtps_ph(_mm512_loadu_ps(s + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+        );
+    for (; i < n; ++i)
+        d[i] = Half(s[i]);
+}
+
+#endif // BEE_SIMD_ENABLE_AVX512
+
 // ─── 并行化包装 ──────────────────────────────────────────────────────────────
 inline constexpr std::int64_t kCastParallelElems = 64 * 1024;
 inline constexpr std::int64_t kCastGrainBytes    = 128 * 1024;
@@ -297,6 +457,55 @@ inline void cpu_cast_linear_parallel(const Src* s, Dst* d, std::int64_t n)
     });
 }
 
+// ─── 16 位浮点与非 F32 类型之间：经栈上 F32 缓冲分块中转 ────────────────────
+inline constexpr std::int64_t kCastStageElems = 1024;
+
+template <typename Src, typename Dst, typename ISA>
+inline void cast_via_f32_chunk(const Src* s, Dst* d, std::int64_t n)
+{
+    alignas(64) float buf[kCastStageElems];
+    for (std::int64_t i = 0; i < n; i += kCastStageElems) {
+        const std::int64_t len = std::min(kCastStageElems, n - i);
+        cast_simd_chunk<Src, float, ISA>(s + i, buf, len);
+        cast_simd_chunk<float, Dst, ISA>(buf, d + i, len);
+    }
+}
+
+template <typename Src, typename Dst, typename ISA>
+inline void cpu_cast_via_f32_parallel(const Src* s, Dst* d, std::int64_t n)
+{
+    const std::int64_t grain = std::max<std::int64_t>(kCastStageElems, kCastGrainBytes / static_cast<std::int64_t>(sizeof(Src) + sizeof(Dst)));
+    if (n < kCastParallelElems) {
+        cast_via_f32_chunk<Src, Dst, ISA>(s, d, n);
+        return;
+    }
+    parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(n), static_cast<std::size_t>(grain), [&](std::size_t lo, std::size_t hi) {
+        cast_via_f32_chunk<Src, Dst, ISA>(s + lo, d + lo, static_cast<std::int64_t>(hi - lo));
+    });
+}
+
+// 以 Half / BFloat16 为一端的非 F32 组合；dt 为另一端的 dtype
+template <typename H, typename ISA>
+inline void cpu_cast_half_other(bool half_is_src, DType dt, const void* src, void* dst, std::int64_t n)
+{
+    const auto run = [&]<typename O>() {
+        if (half_is_src)
+            cpu_cast_via_f32_parallel<H, O, ISA>(static_cast<const H*>(src), static_cast<O*>(dst), n);
+        else
+            cpu_cast_via_f32_parallel<O, H, ISA>(static_cast<const O*>(src), static_cast<H*>(dst), n);
+    };
+    switch (dt) {
+    case DType::Bool: run.template operator()<bool>(); break;
+    case DType::U8: run.template operator()<std::uint8_t>(); break;
+    case DType::I32: run.template operator()<std::int32_t>(); break;
+    case DType::I64: run.template operator()<std::int64_t>(); break;
+    case DType::F64: run.template operator()<double>(); break;
+    case DType::F16: run.template operator()<Half>(); break;
+    case DType::BF16: run.template operator()<BFloat16>(); break;
+    default: break;
+    }
+}
+
 // ─── 顶层分派：根据运行期 (src_dt, dst_dt) 选择内核 ──────────────────────────
 template <typename ISA>
 inline void cpu_cast_dispatch(DType src_dt, DType dst_dt, const void* src, void* dst, std::int64_t n)
@@ -344,8 +553,23 @@ inline void cpu_cast_dispatch(DType src_dt, DType dst_dt, const void* src, void*
     BEE_CAST_CASE(F64, I64, double, std::int64_t)
     BEE_CAST_CASE(F64, F32, double, float)
 
+    BEE_CAST_CASE(F32, F16, float, Half)
+    BEE_CAST_CASE(F16, F32, Half, float)
+    BEE_CAST_CASE(F32, BF16, float, BFloat16)
+    BEE_CAST_CASE(BF16, F32, BFloat16, float)
+
 #undef BEE_CAST_CASE
-    // 未覆盖组合（如 F16/BF16 占位类型）：静默返回
+
+    // 16 位浮点与其余类型（含 F16 ↔ BF16）：经 F32 中转
+    if (src_dt == DType::F16)
+        return cpu_cast_half_other<Half, ISA>(true, dst_dt, src, dst, n);
+    if (src_dt == DType::BF16)
+        return cpu_cast_half_other<BFloat16, ISA>(true, dst_dt, src, dst, n);
+    if (dst_dt == DType::F16)
+        return cpu_cast_half_other<Half, ISA>(false, src_dt, src, dst, n);
+    if (dst_dt == DType::BF16)
+        return cpu_cast_half_other<BFloat16, ISA>(false, src_dt, src, dst, n);
+    // 未覆盖组合（如 FP8 占位类型）：静默返回
 }
 
 } // namespace bee::cpu
@@ -0,0 +1,100 @@
+#pragma once
+
+// CPU cat 拷贝内核：按 CatSegment 计划把各输入的连续字节段写入输出
+// - 输出的 outer · row_bytes 字节被均分为若干任务，每个任务覆盖一段输出字节区间，
+//   逐段与计划求交后整段拷贝；输出行很少（dim = 0）或段很短（dim = ndim-1）都能均衡并行
+// - 输出不小于 kCatStreamBytes 时用对齐的 NT-store 绕过缓存，结束后 sfence
+
+#include "SIMD/SIMD.hpp"
+#include "Base/Parallel/ParallelFor.hpp"
+#include "Tensor/Cpu/ConcatPlan.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace bee::cpu
+{
+
+inline constexpr std::int64_t kCatGrainBytes  = 256 * 1024;      // 每个并行任务拷贝的输出字节数
+inline constexpr std::int64_t kCatStreamBytes = 4 * 1024 * 1024; // 输出不小于该值时改用 NT-store
+inline constexpr std::int64_t kCatStreamRun   = 1024;            // 短于该值的片段仍用普通 store（避免与 NT-store 混写同一缓存行）
+
+// [src, src + n) → dst：dst 推进到寄存器宽度对齐后 NT-store，首尾 memcpy
+template <typename ISA>
+inline void copy_bytes_stream(std::uint8_t* dst, const std::uint8_t* src, std::int64_t n)
+{
+    if constexpr (std::is_same_v<ISA, simd::IsaScalar>) {
+        std::memcpy(dst, src, static_cast<std::size_t>(n));
+    } else {
+        using B = simd::SimdBackend<std::int64_t, ISA>;
+
+        constexpr auto kReg     = static_cast<std::int64_t>(sizeof(std::int64_t) * B::width);
+        const auto     misalign = static_cast<std::int64_t>(reinterpret_cast<std::uintptr_t>(dst) % kReg);
+        const auto     head     = std::min(n, misalign != 0 ? kReg - misalign : std::int64_t{0});
+        std::memcpy(dst, src, static_cast<std::size_t>(head));
+        std::int64_t i = head;
+        for (; i + kReg <= n; i += kReg) {
+            const auto v = B::loadu(reinterpret_cast<const std::int64_t*>(src + i));
+            simd::simd_stream<std::int64_t, ISA>(reinterpret_cast<std::int64_t*>(dst + i), v);
+        }
+        std::memcpy(dst + i, src + i, static_cast<std::size_t>(n - i));
+    }
+}
+
+// 拷贝输出字节区间 [lo, hi)
+template <typename ISA>
+inline void cat_copy_range(
+    const CatSegment* segs, std::int64_t nseg, std::int64_t row_bytes, std::uint8_t* dst, std::int64_t lo, std::int64_t hi, bool stream
+)
+{
+    // 起点用一次二分定位所在段，之后顺序推进；段间空隙与行尾直接跳到下一段起点
+    std::int64_t o   = lo / row_bytes;
+    std::int64_t w   = lo - o * row_bytes;
+    std::int64_t idx = std::upper_bound(segs, segs + nseg, w, [](std::int64_t x, const CatSegment& s) { return x < s.dst_off; }) - segs - 1;
+    std::int64_t pos = lo;
+    while (pos < hi) {
+        if (idx < 0 || w >= segs[idx].dst_off + segs[idx].bytes) {
+            if (++idx == nseg) {
+                ++o;
+                idx = 0;
+            }
+            w   = segs[idx].dst_off;
+            pos = o * row_bytes + w;
+            continue;
+        }
+        const CatSegment&  seg = segs[idx];
+        const std::int64_t in  = w - seg.dst_off;
+        const std::int64_t len = std::min(seg.bytes - in, hi - pos);
+        const auto*        src = static_cast<const std::uint8_t*>(seg.src) + o * seg.bytes + in;
+        if (stream && len >= kCatStreamRun)
+            copy_bytes_stream<ISA>(dst + pos, src, len);
+        else
+            std::memcpy(dst + pos, src, static_cast<std::size_t>(len));
+        pos += len;
+        w   += len;
+    }
+}
+
+template <typename ISA>
+inline void cpu_cat_copy(const CatSegment* segs, std::int64_t nseg, std::int64_t outer, std::int64_t row_bytes, void* dst)
+{
+    const std::int64_t total = outer * row_bytes;
+    if (total <= 0 || nseg <= 0)
+        return;
+
+    auto*             out    = static_cast<std::uint8_t*>(dst);
+    const bool        stream = total >= kCatStreamBytes;
+    const std::size_t tasks  = static_cast<std::size_t>((total + kCatGrainBytes - 1) / kCatGrainBytes);
+    parallel::parallel_for(std::size_t{0}, tasks, std::size_t{1}, [&](std::size_t lo, std::size_t hi) {
+        const std::int64_t b = static_cast<std::int64_t>(lo) * kCatGrainBytes;
+        const std::int64_t e = std::min(total, static_cast<std::int64_t>(hi) * kCatGrainBytes);
+        cat_copy_range<ISA>(segs, nseg, row_bytes, out, b, e, stream);
+    });
+    if (stream)
+        simd::sfence();
+}
+
+} // namespace bee::cpu
@@ -0,0 +1,20 @@
+#pragma once
+
+// cat 的拷贝计划，供 Ops 层、运行期分派与 CPU 内核共享
+
+#include <cstdint>
+
+namespace bee::cpu
+{
+
+// 输出视作 outer 行、每行 row_bytes 字节；每个输入在每行中占据一段连续字节：
+//   dst[o · row_bytes + dst_off, + bytes) ← src[o · bytes, + bytes)，o ∈ [0, outer)
+// 各段非空、按 dst_off 升序且互不重叠；段之间的空隙不由计划写入（调用方另行填充）
+struct CatSegment
+{
+    const void*  src     = nullptr; // 连续输入
+    std::int64_t bytes   = 0;       // 每行字节数
+    std::int64_t dst_off = 0;       // 在输出行内的字节偏移
+};
+
+} // namespace bee::cpu
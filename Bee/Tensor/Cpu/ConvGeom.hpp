@@ -0,0 +1,59 @@
+#pragma once
+
+// 2D 卷积 / 池化的几何参数（NCHW），供 Ops 层、运行期分派与各 ISA 的 GEMM 实现共享
+
+#include <cstdint>
+
+namespace bee::cpu
+{
+
+// conv2d：x={N, C, H, W}，w={Cout, C / groups, KH, KW}，y={N, Cout, OH, OW}
+// 视为 N × groups 个 GEMM：y[n, g] = w[g]({Cout/groups, K}) × im2col(x[n, g])({K, OH·OW})，K = C/groups·KH·KW
+struct Conv2dGeom
+{
+    std::int64_t C      = 0;
+    std::int64_t H      = 0;
+    std::int64_t W      = 0;
+    std::int64_t Cout   = 0;
+    std::int64_t KH     = 1;
+    std::int64_t KW     = 1;
+    std::int64_t SH     = 1;
+    std::int64_t SW     = 1;
+    std::int64_t PH     = 0;
+    std::int64_t PW     = 0;
+    std::int64_t DH     = 1;
+    std::int64_t DW     = 1;
+    std::int64_t groups = 1;
+    std::int64_t OH     = 0;
+    std::int64_t OW     = 0;
+
+    [[nodiscard]] constexpr auto cin_g() const noexcept -> std::int64_t { return C / groups; }
+
+    [[nodiscard]] constexpr auto cout_g() const noexcept -> std::int64_t { return Cout / groups; }
+
+    // GEMM 的 K 维：每个输出元素的感受野大小
+    [[nodiscard]] constexpr auto k_dim() const noexcept -> std::int64_t { return cin_g() * KH * KW; }
+
+    // GEMM 的 N 维：输出平面大小
+    [[nodiscard]] constexpr auto spatial() const noexcept -> std::int64_t { return OH * OW; }
+};
+
+// max_pool2d / avg_pool2d：x={N, C, H, W} 视为 planes = N·C 个独立平面
+struct Pool2dGeom
+{
+    std::int64_t planes = 0;
+    std::int64_t H      = 0;
+    std::int64_t W      = 0;
+    std::int64_t KH     = 1;
+    std::int64_t KW     = 1;
+    std::int64_t SH     = 1;
+    std::int64_t SW     = 1;
+    std::int64_t PH     = 0;
+    std::int64_t PW     = 0;
+    std::int64_t DH     = 1;
+    std::int64_t DW     = 1;
+    std::int64_t OH     = 0;
+    std::int64_t OW     = 0;
+};
+
+} // namespace bee::cpu
@@ -5,6 +5,14 @@
 // 分别以 BEE_DISPATCH_ISA_{Scalar,Sse2,Avx2,Avx512} 宏选择命名空间与 ISA 标签
 
 #include "Tensor/Core/Tensor.hpp"
+#include "Tensor/Cpu/AttentionGeom.hpp"
+#include "Tensor/Cpu/ConcatPlan.hpp"
+#include "Tensor/Cpu/ConvGeom.hpp"
+#include "Tensor/Cpu/IndexGeom.hpp"
+#include "Tensor/Cpu/SparseGeom.hpp"
+#include "Tensor/Cpu/MaskGeom.hpp"
+#include "Tensor/Cpu/SortGeom.hpp"
+#include "Tensor/Cpu/Gemm/Epilogue.hpp"
 #include "SIMD/Detect.hpp"
 
 #include <cstdint>
@@ -12,6 +20,17 @@
 namespace bee::cpu
 {
 
+// 融合 GEMM 的 epilogue 参数：C = act(alpha·A·B + beta·C + bias) + residual
+// bias / residual 与 C 同 dtype 且连续；nullptr 表示不参与
+struct FusedGemmArgs
+{
+    double        alpha    = 1.0;
+    double        beta     = 0.0;
+    const void*   bias     = nullptr; // [N]
+    const void*   residual = nullptr; // [M, N]
+    gemm::GemmAct act      = gemm::GemmAct::None;
+};
+
 // 每个 ISA 命名空间都声明同一组函数原型；
 // 链接期选择由运行期 switch 决定
 #define BEE_DECL_DISPATCH_NS(NS)                                                                                                            \
@@ -33,23 +52,347 @@ namespace bee::cpu
         auto rd_min_global(const Tensor& a, Tensor& out) -> void;                                                                           \
         auto rd_max_global(const Tensor& a, Tensor& out) -> void;                                                                           \
         auto rd_prod_global(const Tensor& a, Tensor& out) -> void;                                                                          \
-        /* matmul（仅 F32/F64/I32/I64）*/                                                                                                   \
-        auto mm_f32(std::int64_t M, std::int64_t K, std::int64_t N, const float* A, const float* B, float* C) -> void;                      \
-        auto mm_f64(std::int64_t M, std::int64_t K, std::int64_t N, const double* A, const double* B, double* C) -> void;                   \
-        auto mm_i32(std::int64_t M, std::int64_t K, std::int64_t N, const std::int32_t* A, const std::int32_t* B, std::int32_t* C) -> void; \
+        /* var/std 与 layer_norm/rms_norm（F32/F64，连续输入）*/                                                                            \
+        auto rd_var_global(const Tensor& a, Tensor& out, std::int64_t correction, bool take_sqrt) -> void;                                  \
+        auto rd_var_axis(const Tensor& a, std::int64_t dim, Tensor& out, std::int64_t correction, bool take_sqrt) -> void;                  \
+        auto nm_layer_norm(const Tensor& x, std::int64_t N, const Tensor& weight, const Tensor& bias, double eps, Tensor& out) -> void;     \
+        auto nm_rms_norm(const Tensor& x, std::int64_t N, const Tensor& weight, double eps, Tensor& out) -> void;                           \
+        /* 沿单一维度的前缀扫描（连续输入）*/                                                                                               \
+        auto sc_cumsum(const Tensor& a, std::int64_t dim, Tensor& out) -> void;                                                             \
+        auto sc_cumprod(const Tensor& a, std::int64_t dim, Tensor& out) -> void;                                                            \
+        auto sc_cummax(const Tensor& a, std::int64_t dim, Tensor& out) -> void;                                                             \
+        auto sc_cummin(const Tensor& a, std::int64_t dim, Tensor& out) -> void;                                                             \
+        /* matmul：A / B 以 (行步长, 列步长) 描述，可直接传入转置 / 切片视图；C 为连续 [M, N]（内部清零）*/                                 \
+        auto mm_f32(                                                                                                                        \
+            std::int64_t M,                                                                                                                 \
+            std::int64_t K,                                                                                                                 \
+            std::int64_t N,                                                                                                                 \
+            const float* A,                                                                                                                 \
+            std::int64_t rsa,                                                                                                               \
+            std::int64_t csa,                                                                                                               \
+            const float* B,                                                                                                                 \
+            std::int64_t rsb,                                                                                                               \
+            std::int64_t csb,                                                                                                               \
+            float*       C                                                                                                                  \
+        ) -> void;                                                                                                                          \
+        auto mm_f64(                                                                                                                        \
+            std::int64_t  M,                                                                                                                \
+            std::int64_t  K,                                                                                                                \
+            std::int64_t  N,                                                                                                                \
+            const double* A,                                                                                                                \
+            std::int64_t  rsa,                                                                                                              \
+            std::int64_t  csa,                                                                                                              \
+            const double* B,                                                                                                                \
+            std::int64_t  rsb,                                                                                                              \
+            std::int64_t  csb,                                                                                                              \
+            double*       C                                                                                                                 \
+        ) -> void;                                                                                                                          \
+        auto mm_i32(                                                                                                                        \
+            std::int64_t        M,                                                                                                          \
+            std::int64_t        K,                                                                                                          \
+            std::int64_t        N,                                                                                                          \
+            const std::int32_t* A,                                                                                                          \
+            std::int64_t        rsa,                                                                                                        \
+            std::int64_t        csa,                                                                                                        \
+            const std::int32_t* B,                                                                                                          \
+            std::int64_t        rsb,                                                                                                        \
+            std::int64_t        csb,                                                                                                        \
+            std::int32_t*       C                                                                                                           \
+        ) -> void;                                                                                                                          \
+        /* I64 走模板内核，要求 A / B 连续 */                                                                                               \
         auto mm_i64(std::int64_t M, std::int64_t K, std::int64_t N, const std::int64_t* A, const std::int64_t* B, std::int64_t* C) -> void; \
-        auto mm_i8(std::int64_t M, std::int64_t K, std::int64_t N, const std::int8_t* A, const std::int8_t* B, std::int32_t* C) -> void;    \
+        auto mm_i8(                                                                                                                         \
+            std::int64_t       M,                                                                                                           \
+            std::int64_t       K,                                                                                                           \
+            std::int64_t       N,                                                                                                           \
+            const std::int8_t* A,                                                                                                           \
+            std::int64_t       rsa,                                                                                                         \
+            std::int64_t       csa,                                                                                                         \
+            const std::int8_t* B,                                                                                                           \
+            std::int64_t       rsb,                                                                                                         \
+            std::int64_t       csb,                                                                                                         \
+            std::int32_t*      C                                                                                                            \
+        ) -> void;                                                                                                                          \
+        /* F16 / BF16：pack / 加载时展开为 F32，C 为 F32（内部清零）*/                                                                      \
+        auto mm_f16(                                                                                                                        \
+            std::int64_t       M,                                                                                                           \
+            std::int64_t       K,                                                                                                           \
+            std::int64_t       N,                                                                                                           \
+            const ::bee::Half* A,                                                                                                           \
+            std::int64_t       rsa,                                                                                                         \
+            std::int64_t       csa,                                                                                                         \
+            const ::bee::Half* B,                                                                                                           \
+            std::int64_t       rsb,                                                                                                         \
+            std::int64_t       csb,                                                                                                         \
+            float*             C                                                                                                            \
+        ) -> void;                                                                                                                          \
+        auto mm_bf16(                                                                                                                       \
+            std::int64_t           M,                                                                                                       \
+            std::int64_t           K,                                                                                                       \
+            std::int64_t           N,                                                                                                       \
+            const ::bee::BFloat16* A,                                                                                                       \
+            std::int64_t           rsa,                                                                                                     \
+            std::int64_t           csa,                                                                                                     \
+            const ::bee::BFloat16* B,                                                                                                       \
+            std::int64_t           rsb,                                                                                                     \
+            std::int64_t           csb,                                                                                                     \
+            float*                 C                                                                                                        \
+        ) -> void;                                                                                                                          \
+        /* 批量 matmul：A/B 为逐 batch slice 指针（slice 间共用行 / 列步长），C 为连续 [batch, M, N]（内部清零）*/                          \
+        auto bmm_f32(                                                                                                                       \
+            std::int64_t        batch,                                                                                                      \
+            std::int64_t        M,                                                                                                          \
+            std::int64_t        K,                                                                                                          \
+            std::int64_t        N,                                                                                                          \
+            const float* const* A,                                                                                                          \
+            std::int64_t        rsa,                                                                                                        \
+            std::int64_t        csa,                                                                                                        \
+            const float* const* B,                                                                                                          \
+            std::int64_t        rsb,                                                                                                        \
+            std::int64_t        csb,                                                                                                        \
+            float*              C                                                                                                           \
+        ) -> void;                                                                                                                          \
+        auto bmm_f64(                                                                                                                       \
+            std::int64_t         batch,                                                                                                     \
+            std::int64_t         M,                                                                                                         \
+            std::int64_t         K,                                                                                                         \
+            std::int64_t         N,                                                                                                         \
+            const double* const* A,                                                                                                         \
+            std::int64_t         rsa,                                                                                                       \
+            std::int64_t         csa,                                                                                                       \
+            const double* const* B,                                                                                                         \
+            std::int64_t         rsb,                                                                                                       \
+            std::int64_t         csb,                                                                                                       \
+            double*              C                                                                                                          \
+        ) -> void;                                                                                                                          \
+        auto bmm_i32(                                                                                                                       \
+            std::int64_t               batch,                                                                                               \
+            std::int64_t               M,                                                                                                   \
+            std::int64_t               K,                                                                                                   \
+            std::int64_t               N,                                                                                                   \
+            const std::int32_t* const* A,                                                                                                   \
+            std::int64_t               rsa,                                                                                                 \
+            std::int64_t               csa,                                                                                                 \
+            const std::int32_t* const* B,                                                                                                   \
+            std::int64_t               rsb,                                                                                                 \
+            std::int64_t               csb,                                                                                                 \
+            std::int32_t*              C                                                                                                    \
+        ) -> void;                                                                                                                          \
+        auto bmm_i64(                                                                                                                       \
+            std::int64_t               batch,                                                                                               \
+            std::int64_t               M,                                                                                                   \
+            std::int64_t               K,                                                                                                   \
+            std::int64_t               N,                                                                                                   \
+            const std::int64_t* const* A,                                                                                                   \
+            const std::int64_t* const* B,                                                                                                   \
+            std::int64_t*              C                                                                                                    \
+        ) -> void;                                                                                                                          \
+        auto bmm_i8(                                                                                                                        \
+            std::int64_t              batch,                                                                                                \
+            std::int64_t              M,                                                                                                    \
+            std::int64_t              K,                                                                                                    \
+            std::int64_t              N,                                                                                                    \
+            const std::int8_t* const* A,                                                                                                    \
+            std::int64_t              rsa,                                                                                                  \
+            std::int64_t              csa,                                                                                                  \
+            const std::int8_t* const* B,                                                                                                    \
+            std::int64_t              rsb,                                                                                                  \
+            std::int64_t              csb,                                                                                                  \
+            std::int32_t*             C                                                                                                     \
+        ) -> void;                                                                                                                          \
+        auto bmm_f16(                                                                                                                       \
+            std::int64_t              batch,                                                                                                \
+            std::int64_t              M,                                                                                                    \
+            std::int64_t              K,                                                                                                    \
+            std::int64_t              N,                                                                                                    \
+            const ::bee::Half* const* A,                                                                                                    \
+            std::int64_t              rsa,                                                                                                  \
+            std::int64_t              csa,                                                                                                  \
+            const ::bee::Half* const* B,                                                                                                    \
+            std::int64_t              rsb,                                                                                                  \
+            std::int64_t              csb,                                                                                                  \
+            float*                    C                                                                                                     \
+        ) -> void;                                                                                                                          \
+        auto bmm_bf16(                                                                                                                      \
+            std::int64_t                  batch,                                                                                            \
+            std::int64_t                  M,                                                                                                \
+            std::int64_t                  K,                                                                                                \
+            std::int64_t                  N,                                                                                                \
+            const ::bee::BFloat16* const* A,                                                                                                \
+            std::int64_t                  rsa,                                                                                              \
+            std::int64_t                  csa,                                                                                              \
+            const ::bee::BFloat16* const* B,                                                                                                \
+            std::int64_t                  rsb,                                                                                              \
+            std::int64_t                  csb,                                                                                              \
+            float*                        C                                                                                                 \
+        ) -> void;                                                                                                                          \
+        /* 预打包权重：pk_pack_b 写出本 ISA 的整块 pack（pk_packed_elems 个元素，B 可为任意步长）；                                         \
+           pk_mm 消费之，C 内部清零（I64 要求 A 连续）*/                                                                                    \
+        auto pk_packed_elems(::bee::DType dt, std::int64_t K, std::int64_t N) -> std::int64_t;                                              \
+        auto pk_pack_b(                                                                                                                     \
+            ::bee::DType dt,                                                                                                                \
+            std::int64_t K,                                                                                                                 \
+            std::int64_t N,                                                                                                                 \
+            const void*  B,                                                                                                                 \
+            std::int64_t rsb,                                                                                                               \
+            std::int64_t csb,                                                                                                               \
+            void*        dst                                                                                                                \
+        ) -> void;                                                                                                                          \
+        auto pk_mm(                                                                                                                         \
+            ::bee::DType dt,                                                                                                                \
+            std::int64_t M,                                                                                                                 \
+            std::int64_t K,                                                                                                                 \
+            std::int64_t N,                                                                                                                 \
+            const void*  A,                                                                                                                 \
+            std::int64_t rsa,                                                                                                               \
+            std::int64_t csa,                                                                                                               \
+            const void*  B_packed,                                                                                                          \
+            void*        C                                                                                                                  \
+        ) -> void;                                                                                                                          \
+        /* 本 ISA 下 dt 的 GEMM 缓存分块（MC/KC/NC）；无分块 GEMM 的 ISA / dtype 输出 0 */                                                  \
+        auto mm_blocking(::bee::DType dt, std::int64_t& mc, std::int64_t& kc, std::int64_t& nc) -> void;                                    \
+        /* 融合 GEMM（F32/F64）：B 为任意步长的 [K,N]（b_packed=false）或本 ISA 的预打包布局；C 为输入输出 */                               \
+        auto mm_fused(                                                                                                                      \
+            ::bee::DType         dt,                                                                                                        \
+            std::int64_t         M,                                                                                                         \
+            std::int64_t         K,                                                                                                         \
+            std::int64_t         N,                                                                                                         \
+            const void*          A,                                                                                                         \
+            std::int64_t         rsa,                                                                                                       \
+            std::int64_t         csa,                                                                                                       \
+            const void*          B,                                                                                                         \
+            std::int64_t         rsb,                                                                                                       \
+            std::int64_t         csb,                                                                                                       \
+            bool                 b_packed,                                                                                                  \
+            void*                C,                                                                                                         \
+            const FusedGemmArgs& args                                                                                                       \
+        ) -> void;                                                                                                                          \
+        /* 量化 GEMM（u8 激活 × s8 权重）：qmm_pack_b 写出 qmm_packed_bytes 字节的本 ISA 布局（B 可为任意步长）；                           \
+           qmm_u8s8 按 ep 在写回时再量化，C 为连续 [M, N]（F32 / I8 / U8，由 ep.out 决定）*/                                                \
+        auto qmm_packed_bytes(std::int64_t K, std::int64_t N) -> std::int64_t;                                                              \
+        auto qmm_pack_b(std::int64_t K, std::int64_t N, const std::int8_t* B, std::int64_t rsb, std::int64_t csb, void* dst) -> void;       \
+        auto qmm_u8s8(                                                                                                                      \
+            std::int64_t               M,                                                                                                   \
+            std::int64_t               K,                                                                                                   \
+            std::int64_t               N,                                                                                                   \
+            const std::uint8_t*        A,                                                                                                   \
+            std::int64_t               rsa,                                                                                                 \
+            std::int64_t               csa,                                                                                                 \
+            const void*                B_packed,                                                                                            \
+            const gemm::QGemmEpilogue& ep,                                                                                                  \
+            void*                      C                                                                                                    \
+        ) -> void;                                                                                                                          \
+        /* 仿射量化 / 反量化（F32 ↔ U8 / I8，连续）：数据视为 [outer, C, inner]，通道 c 使用 scales[c] / zero_points[c] */                  \
+        auto qt_quantize(                                                                                                                   \
+            const float*        x,                                                                                                          \
+            ::bee::DType        qdt,                                                                                                        \
+            void*               q,                                                                                                          \
+            std::int64_t        outer,                                                                                                      \
+            std::int64_t        C,                                                                                                          \
+            std::int64_t        inner,                                                                                                      \
+            const float*        scales,                                                                                                     \
+            const std::int32_t* zero_points                                                                                                 \
+        ) -> void;                                                                                                                          \
+        auto qt_dequantize(                                                                                                                 \
+            const void*         q,                                                                                                          \
+            ::bee::DType        qdt,                                                                                                        \
+            float*              x,                                                                                                          \
+            std::int64_t        outer,                                                                                                      \
+            std::int64_t        C,                                                                                                          \
+            std::int64_t        inner,                                                                                                      \
+            const float*        scales,                                                                                                     \
+            const std::int32_t* zero_points                                                                                                 \
+        ) -> void;                                                                                                                          \
+        /* conv2d：x={n, C, H, W}、w={Cout, C/groups, KH, KW}、y={n, Cout, OH, OW} 均连续，bias 为 [Cout] 或 nullptr */                     \
+        auto cv_conv2d(::bee::DType dt, const Conv2dGeom& g, std::int64_t n, const void* x, const void* w, const void* bias, void* y) -> void;\
+        /* 2D 池化：x={planes, H, W} → y={planes, OH, OW}，连续 F32/F64 */                                                                  \
+        auto pl_pool2d(::bee::DType dt, const Pool2dGeom& g, bool is_max, bool count_include_pad, const void* x, void* y) -> void;          \
+        /* 融合注意力：q={BH, Lq, D}、k={BH, Lk, D}、v={BH, Lk, Dv} → out={BH, Lq, Dv}，连续 F32/F64；mask 为 Bool 或 nullptr */            \
+        auto at_attention(                                                                                                                  \
+            ::bee::DType         dt,                                                                                                        \
+            const AttentionGeom& g,                                                                                                         \
+            const void*          q,                                                                                                         \
+            const void*          k,                                                                                                         \
+            const void*          v,                                                                                                         \
+            const bool*          mask,                                                                                                      \
+            double               scale,                                                                                                     \
+            void*                out                                                                                                        \
+        ) -> void;                                                                                                                          \
         /* Cast（B11）*/                                                                                                                    \
         auto ct_cast(::bee::DType src_dt, ::bee::DType dst_dt, const void* src, void* dst, std::int64_t n) -> void;                         \
-        /* 2D strided→contiguous 拷贝（B11 transpose 物化）*/                                                                               \
-        auto tr_copy_2d(                                                                                                                    \
-            const void*  src,                                                                                                               \
-            void*        dst,                                                                                                               \
-            std::int64_t rows,                                                                                                              \
-            std::int64_t cols,                                                                                                              \
-            std::int64_t src_row_stride_elems,                                                                                              \
-            std::int64_t src_col_stride_elems,                                                                                              \
-            std::size_t  elem_sz                                                                                                            \
+        /* cat：按计划拷贝各输入的连续字节段 */                                                                                             \
+        auto cc_cat(const CatSegment* segs, std::int64_t nseg, std::int64_t outer, std::int64_t row_bytes, void* dst) -> void;              \
+        /* 索引类：数据 {O, N, I}、索引 {O, J, I}（index_select 为 {J}）均连续，索引为已校验的 I64 */                                       \
+        auto ix_index_select(std::size_t elem_sz, const IndexGeom& g, const void* src, const std::int64_t* idx, void* dst) -> void;         \
+        auto ix_gather(std::size_t elem_sz, const IndexGeom& g, const void* src, const std::int64_t* idx, void* dst) -> void;               \
+        /* scatter(_add)：dst 已是数据张量的副本，原地写入 */                                                                               \
+        auto ix_scatter(std::size_t elem_sz, const IndexGeom& g, const std::int64_t* idx, const void* src, void* dst) -> void;              \
+        auto ix_scatter_add(::bee::DType dt, const IndexGeom& g, const std::int64_t* idx, const void* src, void* dst) -> void;              \
+        /* embedding_bag：weight={N, D}，F32/F64；per_sample_weights 可为 nullptr */                                                        \
+        auto ix_embedding_bag(                                                                                                              \
+            ::bee::DType            dt,                                                                                                     \
+            const EmbeddingBagGeom& g,                                                                                                      \
+            const void*             weight,                                                                                                 \
+            const std::int64_t*     idx,                                                                                                    \
+            const std::int64_t*     offsets,                                                                                                \
+            const void*             psw,                                                                                                    \
+            void*                   out                                                                                                     \
+        ) -> void;                                                                                                                          \
+        /* 稀疏 CSR（F32/F64）：spmv x={cols} → y={rows}；spmm b={cols, n} → c={rows, n}，稠密侧均连续 */                                   \
+        auto sp_spmv(::bee::DType dt, const CsrView& a, const void* x, void* y) -> void;                                                    \
+        auto sp_spmm(::bee::DType dt, const CsrView& a, std::int64_t n, const void* b, void* c) -> void;                                    \
+        /* 掩码压缩：m 为连续 1 字节掩码（非 0 即选中），按 kMaskChunk 分块；offsets 为块计数的独占前缀和 */                                \
+        auto mk_chunk_counts(const std::uint8_t* m, std::int64_t n, std::int64_t* counts) -> void;                                          \
+        auto mk_nonzero(                                                                                                                    \
+            const std::uint8_t* m,                                                                                                          \
+            std::int64_t        n,                                                                                                          \
+            const std::int64_t* offsets,                                                                                                    \
+            int                 ndim,                                                                                                       \
+            const std::int64_t* shape,                                                                                                      \
+            std::int64_t*       out                                                                                                         \
+        ) -> void;                                                                                                                          \
+        auto mk_select(                                                                                                                     \
+            const std::uint8_t* m,                                                                                                          \
+            std::int64_t        n,                                                                                                          \
+            const std::int64_t* offsets,                                                                                                    \
+            const void*         src,                                                                                                        \
+            std::size_t         es,                                                                                                         \
+            void*               dst                                                                                                         \
+        ) -> void;                                                                                                                          \
+        /* 沿轴排序（F32/F64/I32/I64/U8）：{O, N, I} 连续，稳定；values 为 nullptr 时只写 indices（argsort） */                             \
+        auto so_sort(::bee::DType dt, const SortGeom& g, const void* src, void* values, std::int64_t* indices) -> void;                     \
+        /* 随机数（Philox4x32-10，与 CUDA 同流）：uniform / normal 为 F32/F64；randint 为 U8/I32/I64，取值 [low, low + range) */            \
+        auto rn_uniform(::bee::DType dt, std::uint64_t seed, void* out, std::int64_t n) -> void;                                            \
+        auto rn_normal(::bee::DType dt, std::uint64_t seed, void* out, std::int64_t n) -> void;                                             \
+        auto rn_randint(::bee::DType dt, std::uint64_t seed, std::int64_t low, std::uint64_t range, void* out, std::int64_t n) -> void;     \
+        /* bernoulli / dropout：与 rn_uniform 同流，(u32 >> 8) < threshold 记为 1（dropout 中为丢弃）；mask 为位压缩掩码或 nullptr */       \
+        auto rn_bernoulli(::bee::DType dt, std::uint64_t seed, std::uint32_t threshold, void* out, std::int64_t n) -> void;                 \
+        auto rn_dropout(                                                                                                                    \
+            ::bee::DType  dt,                                                                                                               \
+            std::uint64_t seed,                                                                                                             \
+            std::uint32_t threshold,                                                                                                        \
+            double        scale,                                                                                                            \
+            const void*   x,                                                                                                                \
+            void*         out,                                                                                                              \
+            std::uint8_t* mask,                                                                                                             \
+            std::int64_t  n                                                                                                                 \
+        ) -> void;                                                                                                                          \
+        auto rn_dropout_apply_mask(                                                                                                         \
+            ::bee::DType        dt,                                                                                                         \
+            const std::uint8_t* mask,                                                                                                       \
+            double              scale,                                                                                                      \
+            const void*         x,                                                                                                          \
+            void*               out,                                                                                                        \
+            std::int64_t        n                                                                                                           \
+        ) -> void;                                                                                                                          \
+        /* N 维 strided→contiguous 拷贝（permute / transpose / 切片视图物化）*/                                                             \
+        auto tr_copy_nd(                                                                                                                    \
+            const void*         src,                                                                                                        \
+            void*               dst,                                                                                                        \
+            std::int64_t        ndim,                                                                                                       \
+            const std::int64_t* shape,                                                                                                      \
+            const std::int64_t* strides,                                                                                                    \
+            std::size_t         elem_sz                                                                                                     \
         ) -> void;                                                                                                                          \
     }
 
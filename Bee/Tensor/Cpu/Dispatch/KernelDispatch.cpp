@@ -4,9 +4,20 @@
 #include "Tensor/Cpu/Dispatch/Dispatch.hpp"
 #include "Tensor/Cpu/ElementWiseCpu.hpp"
 #include "Tensor/Cpu/ReduceCpu.hpp"
+#include "Tensor/Cpu/NormCpu.hpp"
+#include "Tensor/Cpu/ScanCpu.hpp"
 #include "Tensor/Cpu/MatmulCpu.hpp"
 #include "Tensor/Cpu/CastCpu.hpp"
 #include "Tensor/Cpu/TransposeCpu.hpp"
+#include "Tensor/Cpu/ConcatCpu.hpp"
+#include "Tensor/Cpu/IndexCpu.hpp"
+#include "Tensor/Cpu/RandomCpu.hpp"
+#include "Tensor/Cpu/SparseCpu.hpp"
+#include "Tensor/Cpu/MaskCpu.hpp"
+#include "Tensor/Cpu/SortCpu.hpp"
+#include "Tensor/Cpu/QuantizeCpu.hpp"
+#include "Tensor/Cpu/PoolCpu.hpp"
+#include "Tensor/Cpu/Gemm/GemmCommon.hpp"
 #include "Tensor/Cpu/Gemm/GemmDispatch.hpp"
 
 #include "SIMD/SIMD.hpp"
@@ -49,30 +60,36 @@ namespace BEE_CURRENT_NS
 
     // ─── 辅助宏：按 dtype switch 分派到模板化内核 ────────────────────────────────
 
-#define BEE_EW_BIN_DTYPE_DISPATCH(OP, A, B, OUT)                                                \
-    switch ((OUT).dtype()) {                                                                    \
-    case ::bee::DType::F32: cpu_elementwise_binary<float, _ISA, OP>((A), (B), (OUT)); return;   \
-    case ::bee::DType::F64: cpu_elementwise_binary<double, _ISA, OP>((A), (B), (OUT)); return;  \
-    case ::bee::DType::I32: cpu_elementwise_binary<int32_t, _ISA, OP>((A), (B), (OUT)); return; \
-    case ::bee::DType::I64: cpu_elementwise_binary<int64_t, _ISA, OP>((A), (B), (OUT)); return; \
-    case ::bee::DType::U8: cpu_elementwise_binary<uint8_t, _ISA, OP>((A), (B), (OUT)); return;  \
-    default: return;                                                                            \
+#define BEE_EW_BIN_DTYPE_DISPATCH(OP, A, B, OUT)                                                         \
+    switch ((OUT).dtype()) {                                                                             \
+    case ::bee::DType::F32: cpu_elementwise_binary<float, _ISA, OP>((A), (B), (OUT)); return;            \
+    case ::bee::DType::F64: cpu_elementwise_binary<double, _ISA, OP>((A), (B), (OUT)); return;           \
+    case ::bee::DType::I32: cpu_elementwise_binary<int32_t, _ISA, OP>((A), (B), (OUT)); return;          \
+    case ::bee::DType::I64: cpu_elementwise_binary<int64_t, _ISA, OP>((A), (B), (OUT)); return;          \
+    case ::bee::DType::U8: cpu_elementwise_binary<uint8_t, _ISA, OP>((A), (B), (OUT)); return;           \
+    case ::bee::DType::F16: cpu_elementwise_binary<::bee::Half, _ISA, OP>((A), (B), (OUT)); return;      \
+    case ::bee::DType::BF16: cpu_elementwise_binary<::bee::BFloat16, _ISA, OP>((A), (B), (OUT)); return; \
+    default: return;                                                                                     \
     }
 
-#define BEE_EW_UN_FLOAT_DTYPE_DISPATCH(OP, A, OUT)                                       \
-    switch ((OUT).dtype()) {                                                             \
-    case ::bee::DType::F32: cpu_elementwise_unary<float, _ISA, OP>((A), (OUT)); return;  \
-    case ::bee::DType::F64: cpu_elementwise_unary<double, _ISA, OP>((A), (OUT)); return; \
-    default: return;                                                                     \
+#define BEE_EW_UN_FLOAT_DTYPE_DISPATCH(OP, A, OUT)                                                 \
+    switch ((OUT).dtype()) {                                                                       \
+    case ::bee::DType::F32: cpu_elementwise_unary<float, _ISA, OP>((A), (OUT)); return;            \
+    case ::bee::DType::F64: cpu_elementwise_unary<double, _ISA, OP>((A), (OUT)); return;           \
+    case ::bee::DType::F16: cpu_elementwise_unary<::bee::Half, _ISA, OP>((A), (OUT)); return;      \
+    case ::bee::DType::BF16: cpu_elementwise_unary<::bee::BFloat16, _ISA, OP>((A), (OUT)); return; \
+    default: return;                                                                               \
     }
 
-#define BEE_EW_UN_ANY_DTYPE_DISPATCH(OP, A, OUT)                                          \
-    switch ((OUT).dtype()) {                                                              \
-    case ::bee::DType::F32: cpu_elementwise_unary<float, _ISA, OP>((A), (OUT)); return;   \
-    case ::bee::DType::F64: cpu_elementwise_unary<double, _ISA, OP>((A), (OUT)); return;  \
-    case ::bee::DType::I32: cpu_elementwise_unary<int32_t, _ISA, OP>((A), (OUT)); return; \
-    case ::bee::DType::I64: cpu_elementwise_unary<int64_t, _ISA, OP>((A), (OUT)); return; \
-    default: return;                                                                      \
+#define BEE_EW_UN_ANY_DTYPE_DISPATCH(OP, A, OUT)                                                   \
+    switch ((OUT).dtype()) {                                                                       \
+    case ::bee::DType::F32: cpu_elementwise_unary<float, _ISA, OP>((A), (OUT)); return;            \
+    case ::bee::DType::F64: cpu_elementwise_unary<double, _ISA, OP>((A), (OUT)); return;           \
+    case ::bee::DType::I32: cpu_elementwise_unary<int32_t, _ISA, OP>((A), (OUT)); return;          \
+    case ::bee::DType::I64: cpu_elementwise_unary<int64_t, _ISA, OP>((A), (OUT)); return;          \
+    case ::bee::DType::F16: cpu_elementwise_unary<::bee::Half, _ISA, OP>((A), (OUT)); return;      \
+    case ::bee::DType::BF16: cpu_elementwise_unary<::bee::BFloat16, _ISA, OP>((A), (OUT)); return; \
+    default: return;                                                                               \
     }
 
     // ─── 二元 elementwise ────────────────────────────────────────────────────────
@@ -118,14 +135,16 @@ namespace BEE_CURRENT_NS
     }
 
 // ─── 全局 reduce ─────────────────────────────────────────────────────────────
-#define BEE_RD_GLOBAL_DTYPE_DISPATCH(OP, A, OUT)                                               \
-    switch ((A).dtype()) {                                                                     \
-    case ::bee::DType::F32: cpu_reduce_global_dispatch<float, _ISA, OP>((A), (OUT)); return;   \
-    case ::bee::DType::F64: cpu_reduce_global_dispatch<double, _ISA, OP>((A), (OUT)); return;  \
-    case ::bee::DType::I32: cpu_reduce_global_dispatch<int32_t, _ISA, OP>((A), (OUT)); return; \
-    case ::bee::DType::I64: cpu_reduce_global_dispatch<int64_t, _ISA, OP>((A), (OUT)); return; \
-    case ::bee::DType::U8: cpu_reduce_global_dispatch<uint8_t, _ISA, OP>((A), (OUT)); return;  \
-    default: return;                                                                           \
+#define BEE_RD_GLOBAL_DTYPE_DISPATCH(OP, A, OUT)                                                        \
+    switch ((A).dtype()) {                                                                              \
+    case ::bee::DType::F32: cpu_reduce_global_dispatch<float, _ISA, OP>((A), (OUT)); return;            \
+    case ::bee::DType::F64: cpu_reduce_global_dispatch<double, _ISA, OP>((A), (OUT)); return;           \
+    case ::bee::DType::I32: cpu_reduce_global_dispatch<int32_t, _ISA, OP>((A), (OUT)); return;          \
+    case ::bee::DType::I64: cpu_reduce_global_dispatch<int64_t, _ISA, OP>((A), (OUT)); return;          \
+    case ::bee::DType::U8: cpu_reduce_global_dispatch<uint8_t, _ISA, OP>((A), (OUT)); return;           \
+    case ::bee::DType::F16: cpu_reduce_global_dispatch<::bee::Half, _ISA, OP>((A), (OUT)); return;      \
+    case ::bee::DType::BF16: cpu_reduce_global_dispatch<::bee::BFloat16, _ISA, OP>((A), (OUT)); return; \
+    default: return;                                                                                    \
     }
 
     auto rd_sum_global(const Tensor& a, Tensor& out) -> void
@@ -145,6 +164,65 @@ namespace BEE_CURRENT_NS
         BEE_RD_GLOBAL_DTYPE_DISPATCH(OpReduceProd, a, out);
     }
 
+    // ─── var/std 与 layer_norm/rms_norm ──────────────────────────────────────────
+#define BEE_NM_FLOAT_DTYPE_DISPATCH(DT, CALL_F32, CALL_F64) \
+    switch (DT) {                                           \
+    case ::bee::DType::F32: CALL_F32; return;               \
+    case ::bee::DType::F64: CALL_F64; return;               \
+    default: return;                                        \
+    }
+
+    auto rd_var_global(const Tensor& a, Tensor& out, int64_t correction, bool take_sqrt) -> void
+    {
+        BEE_NM_FLOAT_DTYPE_DISPATCH(
+            a.dtype(), (cpu_var_global<float, _ISA>(a, out, correction, take_sqrt)), (cpu_var_global<double, _ISA>(a, out, correction, take_sqrt))
+        );
+    }
+    auto rd_var_axis(const Tensor& a, int64_t dim, Tensor& out, int64_t correction, bool take_sqrt) -> void
+    {
+        BEE_NM_FLOAT_DTYPE_DISPATCH(
+            a.dtype(), (cpu_var_axis<float, _ISA>(a, dim, out, correction, take_sqrt)), (cpu_var_axis<double, _ISA>(a, dim, out, correction, take_sqrt))
+        );
+    }
+    auto nm_layer_norm(const Tensor& x, int64_t N, const Tensor& weight, const Tensor& bias, double eps, Tensor& out) -> void
+    {
+        BEE_NM_FLOAT_DTYPE_DISPATCH(
+            x.dtype(), (cpu_layer_norm<float, _ISA>(x, N, weight, bias, eps, out)), (cpu_layer_norm<double, _ISA>(x, N, weight, bias, eps, out))
+        );
+    }
+    auto nm_rms_norm(const Tensor& x, int64_t N, const Tensor& weight, double eps, Tensor& out) -> void
+    {
+        BEE_NM_FLOAT_DTYPE_DISPATCH(x.dtype(), (cpu_rms_norm<float, _ISA>(x, N, weight, eps, out)), (cpu_rms_norm<double, _ISA>(x, N, weight, eps, out)));
+    }
+
+    // ─── 前缀扫描 ────────────────────────────────────────────────────────────────
+#define BEE_SC_DTYPE_DISPATCH(OP, A, DIM, OUT)                                               \
+    switch ((A).dtype()) {                                                                   \
+    case ::bee::DType::F32: cpu_scan_dispatch<float, _ISA, OP>((A), (DIM), (OUT)); return;   \
+    case ::bee::DType::F64: cpu_scan_dispatch<double, _ISA, OP>((A), (DIM), (OUT)); return;  \
+    case ::bee::DType::I32: cpu_scan_dispatch<int32_t, _ISA, OP>((A), (DIM), (OUT)); return; \
+    case ::bee::DType::I64: cpu_scan_dispatch<int64_t, _ISA, OP>((A), (DIM), (OUT)); return; \
+    case ::bee::DType::U8: cpu_scan_dispatch<uint8_t, _ISA, OP>((A), (DIM), (OUT)); return;  \
+    default: return;                                                                         \
+    }
+
+    auto sc_cumsum(const Tensor& a, int64_t dim, Tensor& out) -> void
+    {
+        BEE_SC_DTYPE_DISPATCH(OpReduceSum, a, dim, out);
+    }
+    auto sc_cumprod(const Tensor& a, int64_t dim, Tensor& out) -> void
+    {
+        BEE_SC_DTYPE_DISPATCH(OpReduceProd, a, dim, out);
+    }
+    auto sc_cummax(const Tensor& a, int64_t dim, Tensor& out) -> void
+    {
+        BEE_SC_DTYPE_DISPATCH(OpReduceMax, a, dim, out);
+    }
+    auto sc_cummin(const Tensor& a, int64_t dim, Tensor& out) -> void
+    {
+        BEE_SC_DTYPE_DISPATCH(OpReduceMin, a, dim, out);
+    }
+
     // ─── matmul ──────────────────────────────────────────────────────────────────
     // 选择 GEMM 实现命名空间：AVX512 复用 AVX2（x86 下 AVX512F 蕴含 AVX2）
 #if defined(BEE_DISPATCH_ISA_AVX512)
@@ -157,30 +235,548 @@ namespace BEE_CURRENT_NS
     namespace gemm_impl = ::bee::cpu::gemm::scalar;
 #endif
 
-    auto mm_f32(int64_t M, int64_t K, int64_t N, const float* A, const float* B, float* C) -> void
+    auto mm_f32(
+        int64_t      M,
+        int64_t      K,
+        int64_t      N,
+        const float* A,
+        int64_t      rsa,
+        int64_t      csa,
+        const float* B,
+        int64_t      rsb,
+        int64_t      csb,
+        float*       C
+    ) -> void
     {
         std::memset(C, 0, static_cast<size_t>(M) * N * sizeof(float));
-        gemm_impl::gemm_f32(M, K, N, A, B, C);
+        gemm_impl::gemm_f32(M, K, N, A, rsa, csa, B, rsb, csb, C);
     }
-    auto mm_f64(int64_t M, int64_t K, int64_t N, const double* A, const double* B, double* C) -> void
+    auto mm_f64(
+        int64_t       M,
+        int64_t       K,
+        int64_t       N,
+        const double* A,
+        int64_t       rsa,
+        int64_t       csa,
+        const double* B,
+        int64_t       rsb,
+        int64_t       csb,
+        double*       C
+    ) -> void
     {
         std::memset(C, 0, static_cast<size_t>(M) * N * sizeof(double));
-        gemm_impl::gemm_f64(M, K, N, A, B, C);
+        gemm_impl::gemm_f64(M, K, N, A, rsa, csa, B, rsb, csb, C);
     }
-    auto mm_i32(int64_t M, int64_t K, int64_t N, const int32_t* A, const int32_t* B, int32_t* C) -> void
+    auto mm_i32(
+        int64_t        M,
+        int64_t        K,
+        int64_t        N,
+        const int32_t* A,
+        int64_t        rsa,
+        int64_t        csa,
+        const int32_t* B,
+        int64_t        rsb,
+        int64_t        csb,
+        int32_t*       C
+    ) -> void
     {
         std::memset(C, 0, static_cast<size_t>(M) * N * sizeof(int32_t));
-        gemm_impl::gemm_i32(M, K, N, A, B, C);
+        gemm_impl::gemm_i32(M, K, N, A, rsa, csa, B, rsb, csb, C);
     }
     auto mm_i64(int64_t M, int64_t K, int64_t N, const int64_t* A, const int64_t* B, int64_t* C) -> void
     {
         // I64 无 SIMD GEMM 实现，沿用原模板化内核（它自身初始化 C）
         cpu_matmul_kernel<int64_t, _ISA>(M, K, N, A, B, C);
     }
-    auto mm_i8(int64_t M, int64_t K, int64_t N, const int8_t* A, const int8_t* B, int32_t* C) -> void
+    auto mm_i8(
+        int64_t       M,
+        int64_t       K,
+        int64_t       N,
+        const int8_t* A,
+        int64_t       rsa,
+        int64_t       csa,
+        const int8_t* B,
+        int64_t       rsb,
+        int64_t       csb,
+        int32_t*      C
+    ) -> void
     {
         std::memset(C, 0, static_cast<size_t>(M) * N * sizeof(int32_t));
-        gemm_impl::gemm_i8_i32(M, K, N, A, B, C);
+        gemm_impl::gemm_i8_i32(M, K, N, A, rsa, csa, B, rsb, csb, C);
+    }
+    // F16 / BF16 输入以 F32 累加：转换在 pack（或 GEMV 的向量加载）中完成，不另建 F32 副本
+    auto mm_f16(
+        int64_t            M,
+        int64_t            K,
+        int64_t            N,
+        const ::bee::Half* A,
+        int64_t            rsa,
+        int64_t            csa,
+        const ::bee::Half* B,
+        int64_t            rsb,
+        int64_t            csb,
+        float*             C
+    ) -> void
+    {
+        std::memset(C, 0, static_cast<size_t>(M) * N * sizeof(float));
+        gemm_impl::gemm_f16_f32(M, K, N, A, rsa, csa, B, rsb, csb, C);
+    }
+    auto mm_bf16(
+        int64_t                M,
+        int64_t                K,
+        int64_t                N,
+        const ::bee::BFloat16* A,
+        int64_t                rsa,
+        int64_t                csa,
+        const ::bee::BFloat16* B,
+        int64_t                rsb,
+        int64_t                csb,
+        float*                 C
+    ) -> void
+    {
+        std::memset(C, 0, static_cast<size_t>(M) * N * sizeof(float));
+        gemm_impl::gemm_bf16_f32(M, K, N, A, rsa, csa, B, rsb, csb, C);
+    }
+
+    // 批量 matmul：C 整体清零后交给批量 driver（B 去重 pack + batch × ic 单次 parallel_for）
+    auto bmm_f32(
+        int64_t             batch,
+        int64_t             M,
+        int64_t             K,
+        int64_t             N,
+        const float* const* A,
+        int64_t             rsa,
+        int64_t             csa,
+        const float* const* B,
+        int64_t             rsb,
+        int64_t             csb,
+        float*              C
+    ) -> void
+    {
+        std::memset(C, 0, static_cast<size_t>(batch * M * N) * sizeof(float));
+        gemm_impl::gemm_batched_f32(batch, M, K, N, A, rsa, csa, B, rsb, csb, C);
+    }
+    auto bmm_f64(
+        int64_t              batch,
+        int64_t              M,
+        int64_t              K,
+        int64_t              N,
+        const double* const* A,
+        int64_t              rsa,
+        int64_t              csa,
+        const double* const* B,
+        int64_t              rsb,
+        int64_t              csb,
+        double*              C
+    ) -> void
+    {
+        std::memset(C, 0, static_cast<size_t>(batch * M * N) * sizeof(double));
+        gemm_impl::gemm_batched_f64(batch, M, K, N, A, rsa, csa, B, rsb, csb, C);
+    }
+    auto bmm_i32(
+        int64_t               batch,
+        int64_t               M,
+        int64_t               K,
+        int64_t               N,
+        const int32_t* const* A,
+        int64_t               rsa,
+        int64_t               csa,
+        const int32_t* const* B,
+        int64_t               rsb,
+        int64_t               csb,
+        int32_t*              C
+    ) -> void
+    {
+        std::memset(C, 0, static_cast<size_t>(batch * M * N) * sizeof(int32_t));
+        gemm_impl::gemm_batched_i32(batch, M, K, N, A, rsa, csa, B, rsb, csb, C);
+    }
+    auto bmm_i64(
+        int64_t               batch,
+        int64_t               M,
+        int64_t               K,
+        int64_t               N,
+        const int64_t* const* A,
+        const int64_t* const* B,
+        int64_t*              C
+    ) -> void
+    {
+        // I64 无 SIMD GEMM，逐 slice 调模板内核，跨 batch 并行
+        parallel::parallel_for(size_t{0}, static_cast<size_t>(batch), size_t{1}, [&](size_t lo, size_t hi) {
+            for (size_t b = lo; b < hi; ++b)
+                cpu_matmul_kernel<int64_t, _ISA>(M, K, N, A[b], B[b], C + static_cast<int64_t>(b) * M * N);
+        });
+    }
+    auto bmm_i8(
+        int64_t              batch,
+        int64_t              M,
+        int64_t              K,
+        int64_t              N,
+        const int8_t* const* A,
+        int64_t              rsa,
+        int64_t              csa,
+        const int8_t* const* B,
+        int64_t              rsb,
+        int64_t              csb,
+        int32_t*             C
+    ) -> void
+    {
+        std::memset(C, 0, static_cast<size_t>(batch * M * N) * sizeof(int32_t));
+        gemm_impl::gemm_batched_i8_i32(batch, M, K, N, A, rsa, csa, B, rsb, csb, C);
+    }
+    auto bmm_f16(
+        int64_t                   batch,
+        int64_t                   M,
+        int64_t                   K,
+        int64_t                   N,
+        const ::bee::Half* const* A,
+        int64_t                   rsa,
+        int64_t                   csa,
+        const ::bee::Half* const* B,
+        int64_t                   rsb,
+        int64_t                   csb,
+        float*                    C
+    ) -> void
+    {
+        std::memset(C, 0, static_cast<size_t>(batch * M * N) * sizeof(float));
+        gemm_impl::gemm_batched_f16_f32(batch, M, K, N, A, rsa, csa, B, rsb, csb, C);
+    }
+    auto bmm_bf16(
+        int64_t                       batch,
+        int64_t                       M,
+        int64_t                       K,
+        int64_t                       N,
+        const ::bee::BFloat16* const* A,
+        int64_t                       rsa,
+        int64_t                       csa,
+        const ::bee::BFloat16* const* B,
+        int64_t                       rsb,
+        int64_t                       csb,
+        float*                        C
+    ) -> void
+    {
+        std::memset(C, 0, static_cast<size_t>(batch * M * N) * sizeof(float));
+        gemm_impl::gemm_batched_bf16_f32(batch, M, K, N, A, rsa, csa, B, rsb, csb, C);
+    }
+
+    // 预打包权重：布局由当前 ISA 的 gemm_impl 决定；I64 无 SIMD GEMM，布局即行主序副本
+    // SIMD GEMM 的列条带补零到 NR，元素数按 NR 向上取整；标量 ISA 与 I64 为行主序副本
+    auto pk_packed_elems(::bee::DType dt, int64_t K, int64_t N) -> int64_t
+    {
+#if defined(BEE_DISPATCH_ISA_AVX512) || defined(BEE_DISPATCH_ISA_AVX2) || defined(BEE_DISPATCH_ISA_SSE2)
+    #if defined(BEE_DISPATCH_ISA_SSE2)
+        using BS = ::bee::cpu::gemm::Sse2BlockSize;
+    #else
+        using BS = ::bee::cpu::gemm::Avx2BlockSize;
+    #endif
+        switch (dt) {
+        case ::bee::DType::F32:
+        case ::bee::DType::I32: return ::bee::cpu::gemm::packed_b_elems<BS::NR_F>(K, N);
+        case ::bee::DType::F64: return ::bee::cpu::gemm::packed_b_elems<BS::NR_D>(K, N);
+        case ::bee::DType::I8: return ::bee::cpu::gemm::packed_b_elems<BS::NR_I8>(K, N);
+        default: return K * N;
+        }
+#else
+        (void)dt;
+        return K * N;
+#endif
+    }
+    auto pk_pack_b(::bee::DType dt, int64_t K, int64_t N, const void* B, int64_t rsb, int64_t csb, void* dst) -> void
+    {
+        switch (dt) {
+        case ::bee::DType::F32: gemm_impl::pack_b_f32(K, N, static_cast<const float*>(B), rsb, csb, static_cast<float*>(dst)); break;
+        case ::bee::DType::F64: gemm_impl::pack_b_f64(K, N, static_cast<const double*>(B), rsb, csb, static_cast<double*>(dst)); break;
+        case ::bee::DType::I32: gemm_impl::pack_b_i32(K, N, static_cast<const int32_t*>(B), rsb, csb, static_cast<int32_t*>(dst)); break;
+        case ::bee::DType::I8: gemm_impl::pack_b_i8(K, N, static_cast<const int8_t*>(B), rsb, csb, static_cast<int8_t*>(dst)); break;
+        case ::bee::DType::I64: {
+            const auto* src = static_cast<const int64_t*>(B);
+            auto*       out = static_cast<int64_t*>(dst);
+            for (int64_t k = 0; k < K; ++k)
+                for (int64_t j = 0; j < N; ++j)
+                    out[k * N + j] = src[k * rsb + j * csb];
+            break;
+        }
+        default: break;
+        }
+    }
+    auto pk_mm(::bee::DType dt, int64_t M, int64_t K, int64_t N, const void* A, int64_t rsa, int64_t csa, const void* B_packed, void* C) -> void
+    {
+        switch (dt) {
+        case ::bee::DType::F32:
+            std::memset(C, 0, static_cast<size_t>(M * N) * sizeof(float));
+            gemm_impl::gemm_packed_f32(
+                M, K, N, static_cast<const float*>(A), rsa, csa, static_cast<const float*>(B_packed), static_cast<float*>(C)
+            );
+            break;
+        case ::bee::DType::F64:
+            std::memset(C, 0, static_cast<size_t>(M * N) * sizeof(double));
+            gemm_impl::gemm_packed_f64(
+                M, K, N, static_cast<const double*>(A), rsa, csa, static_cast<const double*>(B_packed), static_cast<double*>(C)
+            );
+            break;
+        case ::bee::DType::I32:
+            std::memset(C, 0, static_cast<size_t>(M * N) * sizeof(int32_t));
+            gemm_impl::gemm_packed_i32(
+                M, K, N, static_cast<const int32_t*>(A), rsa, csa, static_cast<const int32_t*>(B_packed), static_cast<int32_t*>(C)
+            );
+            break;
+        case ::bee::DType::I8:
+            std::memset(C, 0, static_cast<size_t>(M * N) * sizeof(int32_t));
+            gemm_impl::gemm_packed_i8_i32(
+                M, K, N, static_cast<const int8_t*>(A), rsa, csa, static_cast<const int8_t*>(B_packed), static_cast<int32_t*>(C)
+            );
+            break;
+        case ::bee::DType::I64:
+            cpu_matmul_kernel<int64_t, _ISA>(M, K, N, static_cast<const int64_t*>(A), static_cast<const int64_t*>(B_packed), static_cast<int64_t*>(C));
+            break;
+        default: break;
+        }
+    }
+    auto mm_blocking(::bee::DType dt, int64_t& mc, int64_t& kc, int64_t& nc) -> void
+    {
+        mc = kc = nc = 0;
+#if defined(BEE_DISPATCH_ISA_AVX512) || defined(BEE_DISPATCH_ISA_AVX2) || defined(BEE_DISPATCH_ISA_SSE2)
+    #if defined(BEE_DISPATCH_ISA_SSE2)
+        using BS = ::bee::cpu::gemm::Sse2BlockSize;
+    #else
+        using BS = ::bee::cpu::gemm::Avx2BlockSize;
+    #endif
+        const ::bee::cpu::gemm::GemmBlocking* bk = nullptr;
+        switch (dt) {
+        case ::bee::DType::F32: bk = &::bee::cpu::gemm::gemm_blocking<float, BS::MR, BS::NR_F>(); break;
+        case ::bee::DType::F64: bk = &::bee::cpu::gemm::gemm_blocking<double, BS::MR, BS::NR_D>(); break;
+        case ::bee::DType::I32: bk = &::bee::cpu::gemm::gemm_blocking<int32_t, BS::MR, BS::NR_F>(); break;
+        case ::bee::DType::I8: bk = &::bee::cpu::gemm::gemm_blocking<int8_t, BS::MR, BS::NR_I8>(); break;
+        default: break;
+        }
+        if (bk != nullptr) {
+            mc = bk->mc;
+            kc = bk->kc;
+            nc = bk->nc;
+        }
+#else
+        (void)dt;
+#endif
+    }
+
+    // beta·C 就地预处理：按 kEWiseGrainBytes 分块并行，块内 SIMD 乘标量；beta == 0 直接清零（不读 C，NaN 不传播）
+    template <typename T>
+    auto mm_scale_c(int64_t n, T beta, T* C) -> void
+    {
+        using B                 = simd::SimdBackend<T, _ISA>;
+        constexpr auto    W     = static_cast<int64_t>(B::width);
+        const std::size_t grain = static_cast<std::size_t>(kEWiseGrainBytes / static_cast<int64_t>(sizeof(T)));
+        parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(n), grain, [&](std::size_t lo, std::size_t hi) {
+            T*            p   = C + lo;
+            const int64_t len = static_cast<int64_t>(hi - lo);
+            if (beta == T{0}) {
+                std::memset(p, 0, static_cast<std::size_t>(len) * sizeof(T));
+                return;
+            }
+            const auto vb = B::set1(beta);
+            int64_t    i  = 0;
+            for (; i + W <= len; i += W)
+                B::storeu(p + i, B::mul(B::loadu(p + i), vb));
+            for (; i < len; ++i)
+                p[i] *= beta;
+        });
+    }
+
+    // 融合 GEMM：先就地完成 beta·C，再以按列分片 pack 的 B 跑带 epilogue 的 driver
+    template <typename T>
+    auto mm_fused_typed(
+        int64_t              M,
+        int64_t              K,
+        int64_t              N,
+        const T*             A,
+        int64_t              rsa,
+        int64_t              csa,
+        const T*             B,
+        int64_t              rsb,
+        int64_t              csb,
+        bool                 b_packed,
+        T*                   C,
+        const FusedGemmArgs& args,
+        auto                 gemm_fused
+    ) -> void
+    {
+        const auto beta = static_cast<T>(args.beta);
+        if (beta != T{1})
+            mm_scale_c<T>(M * N, beta, C);
+
+        const ::bee::cpu::gemm::GemmEpilogue<T> ep{
+            static_cast<T>(args.alpha), args.act, static_cast<const T*>(args.bias), static_cast<const T*>(args.residual), N
+        };
+        if (K == 0) {
+            for (int64_t i = 0; i < M; ++i)
+                for (int64_t j = 0; j < N; ++j)
+                    ep.apply(C[i * N + j], T{0}, i, j, true);
+            return;
+        }
+        gemm_fused(M, K, N, A, rsa, csa, B, rsb, csb, b_packed, C, ep);
+    }
+
+    auto mm_fused(
+        ::bee::DType         dt,
+        int64_t              M,
+        int64_t              K,
+        int64_t              N,
+        const void*          A,
+        int64_t              rsa,
+        int64_t              csa,
+        const void*          B,
+        int64_t              rsb,
+        int64_t              csb,
+        bool                 b_packed,
+        void*                C,
+        const FusedGemmArgs& args
+    ) -> void
+    {
+        switch (dt) {
+        case ::bee::DType::F32:
+            mm_fused_typed<float>(
+                M,
+                K,
+                N,
+                static_cast<const float*>(A),
+                rsa,
+                csa,
+                static_cast<const float*>(B),
+                rsb,
+                csb,
+                b_packed,
+                static_cast<float*>(C),
+                args,
+                &gemm_impl::gemm_fused_f32
+            );
+            break;
+        case ::bee::DType::F64:
+            mm_fused_typed<double>(
+                M,
+                K,
+                N,
+                static_cast<const double*>(A),
+                rsa,
+                csa,
+                static_cast<const double*>(B),
+                rsb,
+                csb,
+                b_packed,
+                static_cast<double*>(C),
+                args,
+                &gemm_impl::gemm_fused_f64
+            );
+            break;
+        default: break;
+        }
+    }
+
+    // ─── 量化 GEMM 与仿射量化 ─────────────────────────────────────────────────────
+    auto qmm_packed_bytes(int64_t K, int64_t N) -> int64_t
+    {
+        return gemm_impl::qgemm_packed_bytes(K, N);
+    }
+    auto qmm_pack_b(int64_t K, int64_t N, const int8_t* B, int64_t rsb, int64_t csb, void* dst) -> void
+    {
+        gemm_impl::qgemm_pack_b_s8(K, N, B, rsb, csb, dst);
+    }
+    auto qmm_u8s8(
+        int64_t                                M,
+        int64_t                                K,
+        int64_t                                N,
+        const uint8_t*                         A,
+        int64_t                                rsa,
+        int64_t                                csa,
+        const void*                            B_packed,
+        const ::bee::cpu::gemm::QGemmEpilogue& ep,
+        void*                                  C
+    ) -> void
+    {
+        gemm_impl::qgemm_u8s8(M, K, N, A, rsa, csa, B_packed, ep, C);
+    }
+    auto qt_quantize(
+        const float*   x,
+        ::bee::DType   qdt,
+        void*          q,
+        int64_t        outer,
+        int64_t        C,
+        int64_t        inner,
+        const float*   scales,
+        const int32_t* zero_points
+    ) -> void
+    {
+        switch (qdt) {
+        case ::bee::DType::U8: cpu_quantize<uint8_t, _ISA>(x, static_cast<uint8_t*>(q), outer, C, inner, scales, zero_points); break;
+        case ::bee::DType::I8: cpu_quantize<int8_t, _ISA>(x, static_cast<int8_t*>(q), outer, C, inner, scales, zero_points); break;
+        default: break;
+        }
+    }
+    auto qt_dequantize(
+        const void*    q,
+        ::bee::DType   qdt,
+        float*         x,
+        int64_t        outer,
+        int64_t        C,
+        int64_t        inner,
+        const float*   scales,
+        const int32_t* zero_points
+    ) -> void
+    {
+        switch (qdt) {
+        case ::bee::DType::U8: cpu_dequantize<uint8_t, _ISA>(static_cast<const uint8_t*>(q), x, outer, C, inner, scales, zero_points); break;
+        case ::bee::DType::I8: cpu_dequantize<int8_t, _ISA>(static_cast<const int8_t*>(q), x, outer, C, inner, scales, zero_points); break;
+        default: break;
+        }
+    }
+
+    // ─── conv2d 与 2D 池化（NCHW，连续 F32/F64）────────────────────────────────────
+    auto cv_conv2d(::bee::DType dt, const Conv2dGeom& g, int64_t n, const void* x, const void* w, const void* bias, void* y) -> void
+    {
+        switch (dt) {
+        case ::bee::DType::F32:
+            gemm_impl::conv2d_f32(
+                g, n, static_cast<const float*>(x), static_cast<const float*>(w), static_cast<const float*>(bias), static_cast<float*>(y)
+            );
+            break;
+        case ::bee::DType::F64:
+            gemm_impl::conv2d_f64(
+                g, n, static_cast<const double*>(x), static_cast<const double*>(w), static_cast<const double*>(bias), static_cast<double*>(y)
+            );
+            break;
+        default: break;
+        }
+    }
+    auto pl_pool2d(::bee::DType dt, const Pool2dGeom& g, bool is_max, bool count_include_pad, const void* x, void* y) -> void
+    {
+        const bool f32 = dt == ::bee::DType::F32;
+        if (is_max && f32)
+            cpu_pool2d<float, _ISA, true>(g, count_include_pad, static_cast<const float*>(x), static_cast<float*>(y));
+        else if (is_max)
+            cpu_pool2d<double, _ISA, true>(g, count_include_pad, static_cast<const double*>(x), static_cast<double*>(y));
+        else if (f32)
+            cpu_pool2d<float, _ISA, false>(g, count_include_pad, static_cast<const float*>(x), static_cast<float*>(y));
+        else
+            cpu_pool2d<double, _ISA, false>(g, count_include_pad, static_cast<const double*>(x), static_cast<double*>(y));
+    }
+
+    // ─── 融合注意力（连续 F32/F64）─────────────────────────────────────────────────
+    auto at_attention(
+        ::bee::DType dt, const AttentionGeom& g, const void* q, const void* k, const void* v, const bool* mask, double scale, void* out
+    ) -> void
+    {
+        if (dt == ::bee::DType::F32)
+            gemm_impl::attention_f32(
+                g,
+                static_cast<const float*>(q),
+                static_cast<const float*>(k),
+                static_cast<const float*>(v),
+                mask,
+                static_cast<float>(scale),
+                static_cast<float*>(out)
+            );
+        else
+            gemm_impl::attention_f64(
+                g, static_cast<const double*>(q), static_cast<const double*>(k), static_cast<const double*>(v), mask, scale, static_cast<double*>(out)
+            );
     }
 
     // ─── Cast（B11）───────────────────────────────────────────────────────────────
@@ -189,18 +785,179 @@ namespace BEE_CURRENT_NS
         cpu_cast_dispatch<_ISA>(src_dt, dst_dt, src, dst, n);
     }
 
-    // ─── 2D strided→contiguous 拷贝（B11）────────────────────────────────────────
-    auto tr_copy_2d(
-        const void* src,
-        void*       dst,
-        int64_t     rows,
-        int64_t     cols,
-        int64_t     src_row_stride_elems,
-        int64_t     src_col_stride_elems,
-        std::size_t elem_sz
+    // ─── cat ─────────────────────────────────────────────────────────────────────
+    auto cc_cat(const CatSegment* segs, int64_t nseg, int64_t outer, int64_t row_bytes, void* dst) -> void
+    {
+        cpu_cat_copy<_ISA>(segs, nseg, outer, row_bytes, dst);
+    }
+
+    // ─── 索引类：index_select / gather / scatter / embedding_bag ──────────────────
+    // 按位搬运的算子只按元素宽度分派；scatter_add / embedding_bag 按 dtype 分派
+    auto ix_index_select(std::size_t elem_sz, const IndexGeom& g, const void* src, const int64_t* idx, void* dst) -> void
+    {
+        tr_visit_elem(elem_sz, [&]<typename U>(U) { cpu_index_select<U>(g, static_cast<const U*>(src), idx, static_cast<U*>(dst)); });
+    }
+
+    auto ix_gather(std::size_t elem_sz, const IndexGeom& g, const void* src, const int64_t* idx, void* dst) -> void
+    {
+        tr_visit_elem(elem_sz, [&]<typename U>(U) { cpu_gather<U>(g, static_cast<const U*>(src), idx, static_cast<U*>(dst)); });
+    }
+
+    auto ix_scatter(std::size_t elem_sz, const IndexGeom& g, const int64_t* idx, const void* src, void* dst) -> void
+    {
+        tr_visit_elem(elem_sz, [&]<typename U>(U) { cpu_scatter<U>(g, idx, static_cast<const U*>(src), static_cast<U*>(dst)); });
+    }
+
+    auto ix_scatter_add(::bee::DType dt, const IndexGeom& g, const int64_t* idx, const void* src, void* dst) -> void
+    {
+        switch (dt) {
+        case ::bee::DType::F32: cpu_scatter_add<float, _ISA>(g, idx, static_cast<const float*>(src), static_cast<float*>(dst)); break;
+        case ::bee::DType::F64: cpu_scatter_add<double, _ISA>(g, idx, static_cast<const double*>(src), static_cast<double*>(dst)); break;
+        case ::bee::DType::I32: cpu_scatter_add<int32_t, _ISA>(g, idx, static_cast<const int32_t*>(src), static_cast<int32_t*>(dst)); break;
+        case ::bee::DType::I64: cpu_scatter_add<int64_t, _ISA>(g, idx, static_cast<const int64_t*>(src), static_cast<int64_t*>(dst)); break;
+        default: break;
+        }
+    }
+
+    auto ix_embedding_bag(
+        ::bee::DType dt, const EmbeddingBagGeom& g, const void* weight, const int64_t* idx, const int64_t* offsets, const void* psw, void* out
+    ) -> void
+    {
+        if (dt == ::bee::DType::F32)
+            cpu_embedding_bag<float, _ISA>(
+                g, static_cast<const float*>(weight), idx, offsets, static_cast<const float*>(psw), static_cast<float*>(out)
+            );
+        else
+            cpu_embedding_bag<double, _ISA>(
+                g, static_cast<const double*>(weight), idx, offsets, static_cast<const double*>(psw), static_cast<double*>(out)
+            );
+    }
+
+    // ─── 稀疏 CSR ─────────────────────────────────────────────────────────────────
+    auto sp_spmv(::bee::DType dt, const CsrView& a, const void* x, void* y) -> void
+    {
+        if (dt == ::bee::DType::F32)
+            cpu_spmv<float, _ISA>(a, static_cast<const float*>(x), static_cast<float*>(y));
+        else
+            cpu_spmv<double, _ISA>(a, static_cast<const double*>(x), static_cast<double*>(y));
+    }
+
+    auto sp_spmm(::bee::DType dt, const CsrView& a, std::int64_t n, const void* b, void* c) -> void
+    {
+        if (dt == ::bee::DType::F32)
+            cpu_spmm<float, _ISA>(a, n, static_cast<const float*>(b), static_cast<float*>(c));
+        else
+            cpu_spmm<double, _ISA>(a, n, static_cast<const double*>(b), static_cast<double*>(c));
+    }
+
+    // ─── 掩码压缩 ────────────────────────────────────────────────────────────────
+    auto mk_chunk_counts(const std::uint8_t* m, std::int64_t n, std::int64_t* counts) -> void
+    {
+        cpu_mask_chunk_counts<_ISA>(m, n, counts);
+    }
+
+    auto mk_nonzero(
+        const std::uint8_t* m,
+        std::int64_t        n,
+        const std::int64_t* offsets,
+        int                 ndim,
+        const std::int64_t* shape,
+        std::int64_t*       out
+    ) -> void
+    {
+        cpu_mask_nonzero<_ISA>(m, n, offsets, ndim, shape, out);
+    }
+
+    auto mk_select(const std::uint8_t* m, std::int64_t n, const std::int64_t* offsets, const void* src, std::size_t es, void* dst) -> void
+    {
+        cpu_mask_select<_ISA>(m, n, offsets, src, es, dst);
+    }
+
+    // ─── 排序 ────────────────────────────────────────────────────────────────────
+    auto so_sort(::bee::DType dt, const SortGeom& g, const void* src, void* values, std::int64_t* indices) -> void
+    {
+        auto run = [&]<typename T>() { cpu_sort<T, _ISA>(g, static_cast<const T*>(src), static_cast<T*>(values), indices); };
+        switch (dt) {
+        case ::bee::DType::F32: run.template operator()<float>(); break;
+        case ::bee::DType::F64: run.template operator()<double>(); break;
+        case ::bee::DType::I32: run.template operator()<std::int32_t>(); break;
+        case ::bee::DType::I64: run.template operator()<std::int64_t>(); break;
+        case ::bee::DType::U8: run.template operator()<std::uint8_t>(); break;
+        default: break;
+        }
+    }
+
+    // ─── 随机数（Philox4x32-10）──────────────────────────────────────────────────
+    auto rn_uniform(::bee::DType dt, uint64_t seed, void* out, int64_t n) -> void
+    {
+        if (dt == ::bee::DType::F32)
+            cpu_rand_uniform<float, _ISA>(seed, static_cast<float*>(out), n);
+        else
+            cpu_rand_uniform<double, _ISA>(seed, static_cast<double*>(out), n);
+    }
+
+    auto rn_normal(::bee::DType dt, uint64_t seed, void* out, int64_t n) -> void
+    {
+        if (dt == ::bee::DType::F32)
+            cpu_rand_normal<float, _ISA>(seed, static_cast<float*>(out), n);
+        else
+            cpu_rand_normal<double, _ISA>(seed, static_cast<double*>(out), n);
+    }
+
+    auto rn_randint(::bee::DType dt, uint64_t seed, int64_t low, uint64_t range, void* out, int64_t n) -> void
+    {
+        switch (dt) {
+        case ::bee::DType::U8: cpu_randint<uint8_t, _ISA>(seed, low, range, static_cast<uint8_t*>(out), n); break;
+        case ::bee::DType::I32: cpu_randint<int32_t, _ISA>(seed, low, range, static_cast<int32_t*>(out), n); break;
+        case ::bee::DType::I64: cpu_randint<int64_t, _ISA>(seed, low, range, static_cast<int64_t*>(out), n); break;
+        default: break;
+        }
+    }
+
+    auto rn_bernoulli(::bee::DType dt, uint64_t seed, uint32_t threshold, void* out, int64_t n) -> void
+    {
+        switch (dt) {
+        case ::bee::DType::Bool: cpu_bernoulli<bool, _ISA>(seed, threshold, static_cast<bool*>(out), n); break;
+        case ::bee::DType::U8: cpu_bernoulli<uint8_t, _ISA>(seed, threshold, static_cast<uint8_t*>(out), n); break;
+        case ::bee::DType::I32: cpu_bernoulli<int32_t, _ISA>(seed, threshold, static_cast<int32_t*>(out), n); break;
+        case ::bee::DType::I64: cpu_bernoulli<int64_t, _ISA>(seed, threshold, static_cast<int64_t*>(out), n); break;
+        case ::bee::DType::F32: cpu_bernoulli<float, _ISA>(seed, threshold, static_cast<float*>(out), n); break;
+        case ::bee::DType::F64: cpu_bernoulli<double, _ISA>(seed, threshold, static_cast<double*>(out), n); break;
+        default: break;
+        }
+    }
+
+    auto rn_dropout(
+        ::bee::DType dt,
+        uint64_t     seed,
+        uint32_t     threshold,
+        double       scale,
+        const void*  x,
+        void*        out,
+        uint8_t*     mask,
+        int64_t      n
     ) -> void
     {
-        cpu_transpose_2d_dispatch<_ISA>(src, dst, rows, cols, src_row_stride_elems, src_col_stride_elems, elem_sz);
+        if (dt == ::bee::DType::F32)
+            cpu_dropout<float, _ISA>(
+                seed, threshold, static_cast<float>(scale), static_cast<const float*>(x), static_cast<float*>(out), mask, n
+            );
+        else
+            cpu_dropout<double, _ISA>(seed, threshold, scale, static_cast<const double*>(x), static_cast<double*>(out), mask, n);
+    }
+
+    auto rn_dropout_apply_mask(::bee::DType dt, const uint8_t* mask, double scale, const void* x, void* out, int64_t n) -> void
+    {
+        if (dt == ::bee::DType::F32)
+            cpu_dropout_apply_mask<float, _ISA>(mask, static_cast<float>(scale), static_cast<const float*>(x), static_cast<float*>(out), n);
+        else
+            cpu_dropout_apply_mask<double, _ISA>(mask, scale, static_cast<const double*>(x), static_cast<double*>(out), n);
+    }
+
+    // ─── N 维 strided→contiguous 拷贝 ────────────────────────────────────────────
+    auto tr_copy_nd(const void* src, void* dst, int64_t ndim, const int64_t* shape, const int64_t* strides, std::size_t elem_sz) -> void
+    {
+        cpu_strided_copy_nd<_ISA>(src, dst, ndim, shape, strides, elem_sz);
     }
 
 } // namespace BEE_CURRENT_NS
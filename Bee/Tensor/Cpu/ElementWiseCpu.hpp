@@ -2,13 +2,16 @@
 
 // CPU 元素级算子内核：fast-path（连续 SIMD）与 slow-path（广播 stride 迭代）
 // B2：大规模连续路径支持 parallel_for + non-temporal store。
+// F16 / BF16：按块展开为 F32 走同一套 SIMD 内核，结果按 RNE 收窄写回。
 
 #include "Tensor/Core/DType.hpp"
 #include "Tensor/Core/Shape.hpp"
 #include "Tensor/Core/Tensor.hpp"
+#include "Tensor/Cpu/CastCpu.hpp"
 #include "SIMD/SIMD.hpp"
 #include "Base/Parallel/ParallelFor.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <cstddef>
@@ -650,10 +653,68 @@ auto cpu_unary_linear_parallel(int64_t n, const T* a, T* out) -> void
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
-// 广播 slow-path
+// 16 位浮点连续路径：每块转换进栈上 F32 缓冲（L1 驻留），复用 F32 内核后收窄写回
 // ─────────────────────────────────────────────────────────────────────────────
 
-template <typename T, typename Op>
+inline constexpr int64_t kHalfBlockElems = 512;
+
+template <typename H, typename ISA, typename Op>
+auto cpu_binary_linear_half(int64_t n, const H* a, const H* b, H* out) -> void
+{
+    alignas(64) float fa[kHalfBlockElems];
+    alignas(64) float fb[kHalfBlockElems];
+    for (int64_t i = 0; i < n; i += kHalfBlockElems) {
+        const int64_t len = std::min(kHalfBlockElems, n - i);
+        cast_simd_chunk<H, float, ISA>(a + i, fa, len);
+        cast_simd_chunk<H, float, ISA>(b + i, fb, len);
+        cpu_binary_linear_chunk<float, ISA, Op, false>(len, fa, fb, fa);
+        cast_simd_chunk<float, H, ISA>(fa, out + i, len);
+    }
+}
+
+template <typename H, typename ISA, typename Op>
+auto cpu_unary_linear_half(int64_t n, const H* a, H* out) -> void
+{
+    alignas(64) float fa[kHalfBlockElems];
+    for (int64_t i = 0; i < n; i += kHalfBlockElems) {
+        const int64_t len = std::min(kHalfBlockElems, n - i);
+        cast_simd_chunk<H, float, ISA>(a + i, fa, len);
+        cpu_unary_linear_chunk<float, ISA, Op, false>(len, fa, fa);
+        cast_simd_chunk<float, H, ISA>(fa, out + i, len);
+    }
+}
+
+template <typename H, typename ISA, typename Op>
+auto cpu_binary_linear_half_parallel(int64_t n, const H* a, const H* b, H* out) -> void
+{
+    if (n < kSerialFallbackElems) {
+        cpu_binary_linear_half<H, ISA, Op>(n, a, b, out);
+        return;
+    }
+    const std::size_t grain = static_cast<std::size_t>(kEWiseGrainBytes / static_cast<int64_t>(sizeof(H)));
+    parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(n), grain, [&](std::size_t lo, std::size_t hi) {
+        cpu_binary_linear_half<H, ISA, Op>(static_cast<int64_t>(hi - lo), a + lo, b + lo, out + lo);
+    });
+}
+
+template <typename H, typename ISA, typename Op>
+auto cpu_unary_linear_half_parallel(int64_t n, const H* a, H* out) -> void
+{
+    if (n < kSerialFallbackElems) {
+        cpu_unary_linear_half<H, ISA, Op>(n, a, out);
+        return;
+    }
+    const std::size_t grain = static_cast<std::size_t>(kEWiseGrainBytes / static_cast<int64_t>(sizeof(H)));
+    parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(n), grain, [&](std::size_t lo, std::size_t hi) {
+        cpu_unary_linear_half<H, ISA, Op>(static_cast<int64_t>(hi - lo), a + lo, out + lo);
+    });
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 广播 slow-path（C 为计算类型：16 位浮点以 F32 计算）
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <typename T, typename Op, typename C = T>
 auto cpu_binary_strided(
     int64_t        ndim,
     const int64_t* out_shape,
@@ -677,7 +738,7 @@ auto cpu_binary_strided(
             off_b   += idx[static_cast<std::size_t>(d)] * bstrides_b[d];
             off_out += idx[static_cast<std::size_t>(d)] * out_strides[d];
         }
-        out_ptr[off_out] = Op::template scalar<T>(a_ptr[off_a], b_ptr[off_b]);
+        out_ptr[off_out] = static_cast<T>(Op::template scalar<C>(static_cast<C>(a_ptr[off_a]), static_cast<C>(b_ptr[off_b])));
 
         for (int64_t d = ndim - 1; d >= 0; --d) {
             ++idx[static_cast<std::size_t>(d)];
@@ -688,7 +749,7 @@ auto cpu_binary_strided(
     }
 }
 
-template <typename T, typename Op>
+template <typename T, typename Op, typename C = T>
 auto cpu_unary_strided(int64_t ndim, const int64_t* shape, const int64_t* strides_a, const int64_t* out_strides, const T* a_ptr, T* out_ptr) -> void
 {
     int64_t total = 1;
@@ -702,7 +763,7 @@ auto cpu_unary_strided(int64_t ndim, const int64_t* shape, const int64_t* stride
             off_a   += idx[static_cast<std::size_t>(d)] * strides_a[d];
             off_out += idx[static_cast<std::size_t>(d)] * out_strides[d];
         }
-        out_ptr[off_out] = Op::template scalar<T>(a_ptr[off_a]);
+        out_ptr[off_out] = static_cast<T>(Op::template scalar<C>(static_cast<C>(a_ptr[off_a])));
 
         for (int64_t d = ndim - 1; d >= 0; --d) {
             ++idx[static_cast<std::size_t>(d)];
@@ -736,12 +797,15 @@ auto cpu_elementwise_binary(const Tensor& a, const Tensor& b, Tensor& out) -> vo
     const int64_t n    = out.numel();
     const int64_t ndim = out.ndim();
 
-    const auto* a_ptr   = static_cast<const T*>(a.data_ptr());
-    const auto* b_ptr   = static_cast<const T*>(b.data_ptr());
-    auto*       out_ptr = static_cast<T*>(out.data_ptr());
+    const auto* a_ptr   = static_cast<const T*>(a.const_data_ptr());
+    const auto* b_ptr   = static_cast<const T*>(b.const_data_ptr());
+    auto*       out_ptr = static_cast<T*>(out.scoped_data_ptr());
 
     if (a.is_contiguous() && b.is_contiguous() && a.shape() == out.shape() && b.shape() == out.shape()) {
-        cpu_binary_linear_parallel<T, ISA, Op>(n, a_ptr, b_ptr, out_ptr);
+        if constexpr (is_half_float_v<T>)
+            cpu_binary_linear_half_parallel<T, ISA, Op>(n, a_ptr, b_ptr, out_ptr);
+        else
+            cpu_binary_linear_parallel<T, ISA, Op>(n, a_ptr, b_ptr, out_ptr);
         return;
     }
 
@@ -750,7 +814,8 @@ auto cpu_elementwise_binary(const Tensor& a, const Tensor& b, Tensor& out) -> vo
     const auto& osh   = out.shape();
     const auto& ost   = out.strides();
 
-    cpu_binary_strided<T, Op>(ndim, osh.data(), bst_a.data(), bst_b.data(), ost.data(), a_ptr, b_ptr, out_ptr);
+    using C = std::conditional_t<is_half_float_v<T>, float, T>;
+    cpu_binary_strided<T, Op, C>(ndim, osh.data(), bst_a.data(), bst_b.data(), ost.data(), a_ptr, b_ptr, out_ptr);
 }
 
 template <typename T, typename ISA, typename Op>
@@ -759,11 +824,14 @@ auto cpu_elementwise_unary(const Tensor& a, Tensor& out) -> void
     const int64_t n    = out.numel();
     const int64_t ndim = out.ndim();
 
-    const auto* a_ptr   = static_cast<const T*>(a.data_ptr());
-    auto*       out_ptr = static_cast<T*>(out.data_ptr());
+    const auto* a_ptr   = static_cast<const T*>(a.const_data_ptr());
+    auto*       out_ptr = static_cast<T*>(out.scoped_data_ptr());
 
     if (a.is_contiguous() && a.shape() == out.shape()) {
-        cpu_unary_linear_parallel<T, ISA, Op>(n, a_ptr, out_ptr);
+        if constexpr (is_half_float_v<T>)
+            cpu_unary_linear_half_parallel<T, ISA, Op>(n, a_ptr, out_ptr);
+        else
+            cpu_unary_linear_parallel<T, ISA, Op>(n, a_ptr, out_ptr);
         return;
     }
 
@@ -771,7 +839,8 @@ auto cpu_elementwise_unary(const Tensor& a, Tensor& out) -> void
     const auto& osh = out.shape();
     const auto& ost = out.strides();
 
-    cpu_unary_strided<T, Op>(ndim, osh.data(), ast.data(), ost.data(), a_ptr, out_ptr);
+    using C = std::conditional_t<is_half_float_v<T>, float, T>;
+    cpu_unary_strided<T, Op, C>(ndim, osh.data(), ast.data(), ost.data(), a_ptr, out_ptr);
 }
 
 } // namespace bee::cpu
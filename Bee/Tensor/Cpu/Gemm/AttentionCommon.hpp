@@ -0,0 +1,232 @@
+/**
+ * @File Cpu/Gemm/AttentionCommon.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Brief This file is part of Bee.
+ *
+ * 融合 scaled-dot-product attention（FlashAttention 式分块 + online softmax）。
+ *
+ * 每个任务负责一个 (batch·head, Br 行 query 块)，并行网格为 BH × ceil(Lq / Br)：
+ *   pack Q 块（顺带乘上 scale）
+ *   for 每个 Bc 列 key 块（causal 时跳过完全位于对角线右侧的块）：
+ *     pack K 块 → S = Q·Kᵀ（GEMM 微内核，Br×Bc 全 tile，补零部分不读）
+ *     逐行 online softmax：m' = max(m, max S)，P = exp(S - m')，l = l·exp(m - m') + ΣP，O *= exp(m - m')
+ *     pack P、V 块 → O += P·V（同一微内核）
+ *   out = O / l
+ * 不物化 {Lq, Lk} 分数矩阵：工作集为一个 K 块 + 一个 V 块（按 L2 的一半选 Bc）与 Br×Bc 的 S / P。
+ *
+ * 被 mask 或 causal 屏蔽的位置视为 -inf；整行都被屏蔽时输出 0。
+ * F32 的 exp 用无分支的 Cody-Waite + 多项式（attn_exp），可被编译器按当前 ISA 向量化。
+ */
+
+#pragma once
+
+#include "Base/Parallel/ParallelFor.hpp"
+#include "SIMD/Detect.hpp"
+#include "Tensor/Cpu/AttentionGeom.hpp"
+#include "Tensor/Cpu/Gemm/GemmCommon.hpp"
+#include "Tensor/Cpu/Gemm/GemmDriver.hpp"
+#include "Tensor/Cpu/Gemm/PackCommon.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace bee::cpu::gemm
+{
+
+// query 块行数 Br（须为各 ISA MR 的整数倍）
+inline constexpr std::int64_t kAttnBlockQ = 64;
+
+// key 块列数 Bc：pack 后的一个 K 块与一个 V 块合计约占 L2 的一半，取 NR 的整数倍并限制在 [4·NR, 256]
+template <typename T, int NR>
+inline auto attn_block_k(std::int64_t D, std::int64_t Dv) -> std::int64_t
+{
+    static const std::size_t l2 = [] {
+        const auto caches = ::bee::simd::detect_cache_sizes();
+        return caches.l2 != 0 ? caches.l2 : kGemmDefaultL2;
+    }();
+    const std::int64_t cols = static_cast<std::int64_t>(l2 / 2) / (std::max<std::int64_t>(1, D + Dv) * static_cast<std::int64_t>(sizeof(T)));
+    return std::clamp<std::int64_t>(cols / NR * NR, 4 * NR, 256);
+}
+
+// exp(x)，要求 x ≤ 0（online softmax 中恒成立）；x < -87 时返回 0
+// round(x·log2e) 用 1.5·2^23 魔数取整，Cody-Waite 约简后以 Cephes 多项式逼近，相对误差约 2 ulp
+inline auto attn_exp(float x) -> float
+{
+    const float xc = x < -87.0f ? -87.0f : x;
+    const float r  = (xc * 1.44269504f + 12582912.0f) - 12582912.0f;
+    const float f  = (xc - r * 0.693359375f) + r * 2.12194440e-4f;
+
+    float p = 1.9875691500e-4f;
+    p       = p * f + 1.3981999507e-3f;
+    p       = p * f + 8.3334519073e-3f;
+    p       = p * f + 4.1665795894e-2f;
+    p       = p * f + 1.6666665459e-1f;
+    p       = p * f + 5.0000001201e-1f;
+    p       = p * (f * f) + f + 1.0f;
+
+    const float pow2 = std::bit_cast<float>((static_cast<std::int32_t>(r) + 127) << 23);
+    return x < -87.0f ? 0.0f : p * pow2;
+}
+
+inline auto attn_exp(double x) -> double
+{
+    return std::exp(x);
+}
+
+// 行最大值：8 路独立累加，便于向量化且不依赖浮点重结合
+template <typename T>
+inline auto attn_row_max(const T* s, std::int64_t n, T init) -> T
+{
+    T            acc[8] = {init, init, init, init, init, init, init, init};
+    std::int64_t j      = 0;
+    for (; j + 8 <= n; j += 8)
+        for (int u = 0; u < 8; ++u)
+            acc[u] = s[j + u] > acc[u] ? s[j + u] : acc[u];
+    T mx = init;
+    for (int u = 0; u < 8; ++u)
+        mx = acc[u] > mx ? acc[u] : mx;
+    for (; j < n; ++j)
+        mx = s[j] > mx ? s[j] : mx;
+    return mx;
+}
+
+// s[j] ← exp(s[j] - mx)，返回 Σ s[j]
+template <typename T>
+inline auto attn_exp_sum(T* s, std::int64_t n, T mx) -> T
+{
+    for (std::int64_t j = 0; j < n; ++j)
+        s[j] = attn_exp(s[j] - mx);
+
+    T            acc[8] = {};
+    std::int64_t j      = 0;
+    for (; j + 8 <= n; j += 8)
+        for (int u = 0; u < 8; ++u)
+            acc[u] += s[j + u];
+    T sum = T{0};
+    for (int u = 0; u < 8; ++u)
+        sum += acc[u];
+    for (; j < n; ++j)
+        sum += s[j];
+    return sum;
+}
+
+// 标量 ISA 的参考微内核：C[MR×NR] += A_pack · B_pack（布局同 pack_A_mr / pack_B_nr）
+template <typename T, int MR, int NR>
+inline auto micro_kernel_ref(const T* A_pack, const T* B_pack, std::int64_t K, T* C, std::int64_t ldc) -> void
+{
+    T acc[MR * NR] = {};
+    for (std::int64_t k = 0; k < K; ++k)
+        for (int i = 0; i < MR; ++i)
+            for (int j = 0; j < NR; ++j)
+                acc[i * NR + j] += A_pack[k * MR + i] * B_pack[k * NR + j];
+    for (int i = 0; i < MR; ++i)
+        for (int j = 0; j < NR; ++j)
+            C[i * ldc + j] += acc[i * NR + j];
+}
+
+template <typename T, int MR, int NR, typename MicroK>
+inline auto attention_flash(const AttentionGeom& g, const T* q, const T* k, const T* v, const bool* mask, T scale, T* out, MicroK micro) -> void
+{
+    static_assert(kAttnBlockQ % MR == 0);
+
+    const std::int64_t Br       = kAttnBlockQ;
+    const std::int64_t Bc       = attn_block_k<T, NR>(g.D, g.Dv);
+    const std::int64_t dv_pad   = (g.Dv + NR - 1) / NR * NR;
+    const std::int64_t q_blocks = (g.Lq + Br - 1) / Br;
+    const auto         tasks    = static_cast<std::size_t>(g.BH * q_blocks);
+    constexpr T        kNegInf  = -std::numeric_limits<T>::infinity();
+
+    ::bee::parallel::parallel_for(std::size_t{0}, tasks, std::size_t{1}, [&](std::size_t lo, std::size_t hi) {
+        std::vector<T> qp(static_cast<std::size_t>(Br * g.D));
+        std::vector<T> kp(static_cast<std::size_t>(Bc * g.D));
+        std::vector<T> vp(static_cast<std::size_t>(Bc * dv_pad));
+        std::vector<T> s(static_cast<std::size_t>(Br * Bc));
+        std::vector<T> pp(static_cast<std::size_t>(Br * Bc));
+        std::vector<T> o(static_cast<std::size_t>(Br * dv_pad));
+        std::vector<T> m(static_cast<std::size_t>(Br));
+        std::vector<T> l(static_cast<std::size_t>(Br));
+
+        for (std::size_t t = lo; t < hi; ++t) {
+            const std::int64_t bh   = static_cast<std::int64_t>(t) / q_blocks;
+            const std::int64_t i0   = (static_cast<std::int64_t>(t) % q_blocks) * Br;
+            const std::int64_t rows = std::min(Br, g.Lq - i0);
+            const std::int64_t rpad = (rows + MR - 1) / MR * MR;
+            const T*           kb   = k + bh * g.Lk * g.D;
+            const T*           vb   = v + bh * g.Lk * g.Dv;
+            const bool*        mb   = mask ? mask + bh * g.mask_stride : nullptr;
+
+            pack_A_mr<T, MR>(q + (bh * g.Lq + i0) * g.D, g.D, 1, rows, g.D, qp.data());
+            for (std::int64_t e = 0; e < rpad * g.D; ++e)
+                qp[static_cast<std::size_t>(e)] *= scale;
+            std::fill(o.begin(), o.end(), T{0});
+            std::fill(m.begin(), m.end(), kNegInf);
+            std::fill(l.begin(), l.end(), T{0});
+
+            const std::int64_t kend = g.causal ? std::min(g.Lk, i0 + rows) : g.Lk;
+            for (std::int64_t j0 = 0; j0 < kend; j0 += Bc) {
+                const std::int64_t cols = std::min(Bc, kend - j0);
+                const std::int64_t cpad = (cols + NR - 1) / NR * NR;
+
+                // S = (scale·Q)·Kᵀ：B(d, j) = K[j0 + j, d]
+                pack_B_nr<T, NR>(kb + j0 * g.D, 1, g.D, g.D, cols, kp.data());
+                std::fill_n(s.data(), rpad * cpad, T{0});
+                for (std::int64_t ir = 0; ir < rpad; ir += MR)
+                    for (std::int64_t jr = 0; jr < cpad; jr += NR)
+                        detail::invoke_micro<T, T>(micro, qp.data() + ir * g.D, kp.data() + jr * g.D, g.D, s.data() + ir * cpad + jr, cpad);
+
+                // online softmax：S 原地变为 P
+                for (std::int64_t r = 0; r < rows; ++r) {
+                    T*                 sr = s.data() + r * cpad;
+                    const std::int64_t gi = i0 + r;
+                    if (mb != nullptr) {
+                        const bool* mr = mb + gi * g.Lk + j0;
+                        for (std::int64_t j = 0; j < cols; ++j)
+                            sr[j] = mr[j] ? sr[j] : kNegInf;
+                    }
+                    if (g.causal)
+                        for (std::int64_t j = std::max<std::int64_t>(0, gi + 1 - j0); j < cols; ++j)
+                            sr[j] = kNegInf;
+
+                    const T mx = attn_row_max(sr, cols, m[static_cast<std::size_t>(r)]);
+                    if (mx == kNegInf) {
+                        std::fill_n(sr, cols, T{0});
+                        continue;
+                    }
+                    const T alpha = attn_exp(m[static_cast<std::size_t>(r)] - mx);
+                    const T sum   = attn_exp_sum(sr, cols, mx);
+
+                    l[static_cast<std::size_t>(r)] = l[static_cast<std::size_t>(r)] * alpha + sum;
+                    m[static_cast<std::size_t>(r)] = mx;
+                    if (alpha != T{1}) {
+                        T* orow = o.data() + r * dv_pad;
+                        for (std::int64_t c = 0; c < g.Dv; ++c)
+                            orow[c] *= alpha;
+                    }
+                }
+
+                // O += P·V
+                pack_A_mr<T, MR>(s.data(), cpad, 1, rows, cols, pp.data());
+                pack_B_nr<T, NR>(vb + j0 * g.Dv, g.Dv, 1, cols, g.Dv, vp.data());
+                for (std::int64_t ir = 0; ir < rpad; ir += MR)
+                    for (std::int64_t jr = 0; jr < dv_pad; jr += NR)
+                        detail::invoke_micro<T, T>(micro, pp.data() + ir * cols, vp.data() + jr * cols, cols, o.data() + ir * dv_pad + jr, dv_pad);
+            }
+
+            T* ob = out + (bh * g.Lq + i0) * g.Dv;
+            for (std::int64_t r = 0; r < rows; ++r) {
+                const T  lr   = l[static_cast<std::size_t>(r)];
+                const T  inv  = lr > T{0} ? T{1} / lr : T{0};
+                const T* orow = o.data() + r * dv_pad;
+                for (std::int64_t c = 0; c < g.Dv; ++c)
+                    ob[r * g.Dv + c] = orow[c] * inv;
+            }
+        }
+    });
+}
+
+} // namespace bee::cpu::gemm
@@ -0,0 +1,209 @@
+/**
+ * @File Cpu/Gemm/ConvCommon.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Brief This file is part of Bee.
+ *
+ * conv2d 的 implicit im2col GEMM（NCHW）。
+ *
+ * 每个 (样本 n, 分组 g) 是一个 GEMM：y[n, g]({Cout_g, OH·OW}) = w[g]({Cout_g, K}) × B，
+ * B[k, p] = x[n, g·Cin_g + c, oh·SH - PH + r·DH, ow·SW - PW + s·DW]（k = (c, r, s)，p = (oh, ow)，越界为 0）。
+ * B 从不整块物化：gemm_driver_implicit_b 在 pack 时经 im2col_block 逐 [kc × NR] 条带直接从 x 生成，
+ * 权重整块 pack 一次后由全部 (n, 列块) 任务共享。SW == 1 时条带的每一行由若干段连续拷贝组成。
+ *
+ * 输出先按 bias（或 0）初始化，GEMM 在其上累加。标量 ISA 走 conv2d_ref：按列块 im2col 到
+ * 线程私有缓冲后做 i-k-j 朴素乘加，同样不物化完整的 im2col 矩阵。每组仅 1 个输入通道（depthwise）时
+ * 两者都改走 conv2d_depthwise 的直接累加。
+ */
+
+#pragma once
+
+#include "Base/Parallel/ParallelFor.hpp"
+#include "Tensor/Cpu/ConvGeom.hpp"
+#include "Tensor/Cpu/Gemm/GemmCommon.hpp"
+#include "Tensor/Cpu/Gemm/GemmDriver.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace bee::cpu::gemm
+{
+
+// 生成 B 的 [k0, k0+kc) × [j0, j0+cols) 子块到 dst（行步长 ld ≥ cols，cols..ld 补零）
+// x 指向本 (样本, 分组) 的第一个输入通道
+template <typename T>
+inline auto im2col_block(
+    const Conv2dGeom& g, const T* x, std::int64_t k0, std::int64_t kc, std::int64_t j0, std::int64_t cols, T* dst, std::int64_t ld
+) -> void
+{
+    const std::int64_t khw = g.KH * g.KW;
+    const std::int64_t pe  = j0 + cols;
+    for (std::int64_t kk = 0; kk < kc; ++kk) {
+        const std::int64_t k      = k0 + kk;
+        const std::int64_t c      = k / khw;
+        const std::int64_t r      = (k / g.KW) % g.KH;
+        const std::int64_t s      = k % g.KW;
+        const std::int64_t ih_off = r * g.DH - g.PH;
+        const std::int64_t iw_off = s * g.DW - g.PW;
+        const T*           xc     = x + c * g.H * g.W;
+        T*                 out    = dst + kk * ld;
+
+        // 本 (r, s) 下有效的 ow 区间 [vlo, vhi)：0 ≤ ow·SW + iw_off < W
+        const std::int64_t vlo = iw_off >= 0 ? 0 : (-iw_off + g.SW - 1) / g.SW;
+        const std::int64_t vhi = iw_off >= g.W ? 0 : (g.W - 1 - iw_off) / g.SW + 1;
+
+        // 指针只在区间内形成：越界的行首 / 列偏移先以整数表示，钳制到有效区间后再取地址
+        for (std::int64_t p = j0; p < pe;) {
+            const std::int64_t oh  = p / g.OW;
+            const std::int64_t ow0 = p % g.OW;
+            const std::int64_t ow1 = std::min(g.OW, ow0 + (pe - p));
+            const std::int64_t ih  = oh * g.SH + ih_off;
+            T*                 o   = out + (p - j0); // o[i] 对应 ow = ow0 + i
+            if (ih < 0 || ih >= g.H) {
+                std::fill(o, o + (ow1 - ow0), T{0});
+            } else {
+                const std::int64_t row = ih * g.W + iw_off; // xc[row + ow·SW] 即 (ih, ow) 处的输入，仅对 [a, e) 有效
+                const std::int64_t a   = std::clamp(vlo, ow0, ow1);
+                const std::int64_t e   = std::clamp(vhi, a, ow1);
+                std::fill(o, o + (a - ow0), T{0});
+                if (g.SW == 1) {
+                    if (e > a)
+                        std::memcpy(o + (a - ow0), xc + (row + a), static_cast<std::size_t>(e - a) * sizeof(T));
+                } else {
+                    for (std::int64_t ow = a; ow < e; ++ow)
+                        o[ow - ow0] = xc[row + ow * g.SW];
+                }
+                std::fill(o + (e - ow0), o + (ow1 - ow0), T{0});
+            }
+            p += ow1 - ow0;
+        }
+        std::fill(out + cols, out + ld, T{0});
+    }
+}
+
+// y={n, Cout, OH·OW} 按 bias[co]（bias 为 nullptr 时为 0）初始化
+template <typename T>
+inline auto conv2d_init_output(const Conv2dGeom& g, std::int64_t n, const T* bias, T* y) -> void
+{
+    const std::int64_t S = g.spatial();
+    ::bee::parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(n * g.Cout), std::size_t{1}, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t p = lo; p < hi; ++p) {
+            const T v = bias ? bias[static_cast<std::int64_t>(p) % g.Cout] : T{0};
+            std::fill_n(y + static_cast<std::int64_t>(p) * S, S, v);
+        }
+    });
+}
+
+// depthwise（每组 1 个输入通道）：GEMM 退化为 M = cout_g、K = KH·KW 的极小问题，pack 开销远大于计算，
+// 改为逐 (输出通道, 输出行) 直接累加；SW == 1 时最内层是对连续行段的 axpy，可由编译器向量化
+template <typename T>
+inline auto conv2d_depthwise(const Conv2dGeom& g, std::int64_t n, const T* x, const T* w, T* y) -> void
+{
+    const std::int64_t mult = g.cout_g();
+    const std::int64_t rows = n * g.Cout * g.OH;
+    ::bee::parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(rows), std::size_t{16}, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t t = lo; t < hi; ++t) {
+            const std::int64_t oh  = static_cast<std::int64_t>(t) % g.OH;
+            const std::int64_t nco = static_cast<std::int64_t>(t) / g.OH; // n·Cout + co
+            const std::int64_t co  = nco % g.Cout;
+            const T*           xc  = x + (nco / g.Cout * g.C + co / mult) * g.H * g.W;
+            const T*           wc  = w + co * g.KH * g.KW;
+            T*                 out = y + static_cast<std::int64_t>(t) * g.OW;
+            for (std::int64_t r = 0; r < g.KH; ++r) {
+                const std::int64_t ih = oh * g.SH - g.PH + r * g.DH;
+                if (ih < 0 || ih >= g.H)
+                    continue;
+                const T* xr = xc + ih * g.W;
+                for (std::int64_t s = 0; s < g.KW; ++s) {
+                    const std::int64_t iw_off = s * g.DW - g.PW;
+                    const std::int64_t a      = std::min(g.OW, iw_off >= 0 ? 0 : (-iw_off + g.SW - 1) / g.SW);
+                    const std::int64_t e      = std::clamp(iw_off >= g.W ? 0 : (g.W - 1 - iw_off) / g.SW + 1, a, g.OW);
+                    const T            wv     = wc[r * g.KW + s];
+                    if (a >= e)
+                        continue;
+                    if (g.SW == 1) {
+                        // 从第一个有效列取地址，iw_off < 0 时不形成行首之前的指针
+                        const T* src = xr + (a + iw_off);
+                        T*       dst = out + a;
+                        for (std::int64_t i = 0; i < e - a; ++i)
+                            dst[i] += wv * src[i];
+                    } else {
+                        for (std::int64_t ow = a; ow < e; ++ow)
+                            out[ow] += wv * xr[ow * g.SW + iw_off];
+                    }
+                }
+            }
+        }
+    });
+}
+
+// SIMD ISA：implicit im2col 喂给 GEMM driver 的 pack
+template <typename T, int MR, int NR, typename MicroK>
+inline auto conv2d_gemm(const Conv2dGeom& g, std::int64_t n, const T* x, const T* w, const T* bias, T* y, MicroK micro) -> void
+{
+    conv2d_init_output(g, n, bias, y);
+    if (g.cin_g() == 1) {
+        conv2d_depthwise(g, n, x, w, y);
+        return;
+    }
+
+    const std::int64_t M = g.cout_g();
+    const std::int64_t K = g.k_dim();
+
+    std::vector<const T*> a(static_cast<std::size_t>(g.groups));
+    for (std::int64_t gi = 0; gi < g.groups; ++gi)
+        a[static_cast<std::size_t>(gi)] = w + gi * M * K;
+
+    const std::int64_t in_g   = g.cin_g() * g.H * g.W;
+    auto               pack_b = [&](std::int64_t b, std::int64_t pc, std::int64_t kc, std::int64_t j, std::int64_t cols, T* dst) {
+        im2col_block(g, x + b * in_g, pc, kc, j, cols, dst, static_cast<std::int64_t>(NR));
+    };
+    detail::gemm_driver_implicit_b<T, T, MR, NR>(n * g.groups, M, K, g.spatial(), a.data(), g.groups, K, 1, pack_b, y, micro);
+}
+
+// 标量 ISA：每个任务负责一个 (样本, 分组) 的一段输出列，列块 im2col 到私有缓冲后逐行乘加
+inline constexpr std::int64_t kConvRefCols = 256;
+
+template <typename T>
+inline auto conv2d_ref(const Conv2dGeom& g, std::int64_t n, const T* x, const T* w, const T* bias, T* y) -> void
+{
+    conv2d_init_output(g, n, bias, y);
+    if (g.cin_g() == 1) {
+        conv2d_depthwise(g, n, x, w, y);
+        return;
+    }
+
+    const std::int64_t M     = g.cout_g();
+    const std::int64_t K     = g.k_dim();
+    const std::int64_t S     = g.spatial();
+    const std::int64_t in_g  = g.cin_g() * g.H * g.W;
+    const std::int64_t tiles = (S + kConvRefCols - 1) / kConvRefCols;
+    if (M == 0 || K == 0 || S == 0)
+        return;
+
+    const auto tasks = static_cast<std::size_t>(n * g.groups * tiles);
+    ::bee::parallel::parallel_for(std::size_t{0}, tasks, std::size_t{1}, [&](std::size_t lo, std::size_t hi) {
+        std::vector<T> col(static_cast<std::size_t>(K * kConvRefCols));
+        for (std::size_t t = lo; t < hi; ++t) {
+            const std::int64_t b  = static_cast<std::int64_t>(t) / tiles;
+            const std::int64_t j0 = (static_cast<std::int64_t>(t) % tiles) * kConvRefCols;
+            const std::int64_t cw = std::min(kConvRefCols, S - j0);
+            im2col_block(g, x + b * in_g, 0, K, j0, cw, col.data(), cw);
+
+            const T* wg = w + (b % g.groups) * M * K;
+            for (std::int64_t i = 0; i < M; ++i) {
+                T* yr = y + (b * M + i) * S + j0;
+                for (std::int64_t k = 0; k < K; ++k) {
+                    const T  a  = wg[i * K + k];
+                    const T* cr = col.data() + k * cw;
+                    for (std::int64_t j = 0; j < cw; ++j)
+                        yr[j] += a * cr[j];
+                }
+            }
+        }
+    });
+}
+
+} // namespace bee::cpu::gemm
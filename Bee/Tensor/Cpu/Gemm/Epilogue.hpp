@@ -0,0 +1,156 @@
+/**
+ * @File Cpu/Gemm/Epilogue.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Brief This file is part of Bee.
+ *
+ * GEMM 写回阶段的融合 epilogue：C = act(alpha·A·B + beta·C + bias) + residual。
+ *
+ * 约定：
+ *  - beta·C 由调用方在 GEMM 前完成（beta == 0 时直接清零），之后 C 仍作为 K 块间的累加器；
+ *  - 每个 K 块写回时做 C += alpha·acc；仅最后一个 K 块（last）再叠加 bias、激活与 residual；
+ *  - 微内核拿到的是 TileEpilogue（已偏移到本 tile 的局部视图），由 GemmEpilogue::tile 生成。
+ *
+ * 量化 GEMM 的再量化参数（QGemmEpilogue / QTileEpilogue）也在此定义，见 QGemmCommon.hpp。
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+namespace bee::cpu::gemm
+{
+
+// 融合激活
+enum class GemmAct : std::uint8_t
+{
+    None = 0,
+    ReLU = 1,
+    GELU = 2, // erf 精确形式
+    SiLU = 3,
+};
+
+template <typename T>
+inline auto gemm_act_scalar(GemmAct act, T x) -> T
+{
+    switch (act) {
+    case GemmAct::ReLU: return x > T{0} ? x : T{0};
+    case GemmAct::GELU: return static_cast<T>(0.5) * x * (T{1} + std::erf(x * static_cast<T>(0.70710678118654752440)));
+    case GemmAct::SiLU: return x / (T{1} + std::exp(-x));
+    default: return x;
+    }
+}
+
+// ReLU 可在寄存器内向量化完成；GELU / SiLU 写回后在 L1 内逐元素处理
+inline auto gemm_act_is_vector(GemmAct act) -> bool
+{
+    return act == GemmAct::None || act == GemmAct::ReLU;
+}
+
+// 微内核看到的 tile 局部 epilogue
+template <typename T>
+struct TileEpilogue
+{
+    T            alpha    = T{1};
+    bool         last     = false;
+    GemmAct      act      = GemmAct::None;
+    const T*     bias     = nullptr; // 本 tile 首列处的 bias
+    const T*     residual = nullptr; // 本 tile 首元素处的 residual
+    std::int64_t ldr      = 0;
+};
+
+// 最后一个 K 块写回后的逐元素收尾：标量激活（GELU / SiLU）与 residual
+template <typename T>
+inline auto tile_epilogue_finish(T* c, int n, const TileEpilogue<T>& ep, int row) -> void
+{
+    const bool scalar_act = !gemm_act_is_vector(ep.act);
+    const T*   res        = ep.residual != nullptr ? ep.residual + row * ep.ldr : nullptr;
+    for (int j = 0; j < n; ++j) {
+        T v = c[j];
+        if (scalar_act)
+            v = gemm_act_scalar(ep.act, v);
+        if (res != nullptr)
+            v += res[j];
+        c[j] = v;
+    }
+}
+
+// driver 持有的整体 epilogue 参数（C 为 [M, N]，bias 为 [N]，residual 为 [M, N] 行距 ldr）
+template <typename T>
+struct GemmEpilogue
+{
+    T            alpha    = T{1};
+    GemmAct      act      = GemmAct::None;
+    const T*     bias     = nullptr;
+    const T*     residual = nullptr;
+    std::int64_t ldr      = 0;
+
+    [[nodiscard]] auto tile(std::int64_t row, std::int64_t col, bool last) const -> TileEpilogue<T>
+    {
+        return TileEpilogue<T>{
+            alpha, last, act, bias != nullptr ? bias + col : nullptr, residual != nullptr ? residual + row * ldr + col : nullptr, ldr
+        };
+    }
+
+    // 标量写回（边界 tile 的有效部分）：语义与微内核写回一致
+    auto apply(T& c, T acc, std::int64_t row, std::int64_t col, bool last) const -> void
+    {
+        T v = c + alpha * acc;
+        if (last) {
+            if (bias != nullptr)
+                v += bias[col];
+            v = gemm_act_scalar(act, v);
+            if (residual != nullptr)
+                v += residual[row * ldr + col];
+        }
+        c = v;
+    }
+};
+
+// 无 epilogue：普通 C += acc
+struct NoEpilogue
+{
+    template <typename T>
+    auto apply(T& c, T acc, std::int64_t, std::int64_t, bool) const -> void
+    {
+        c += acc;
+    }
+};
+
+// ── 量化 GEMM（u8 × s8 → i32 累加）的再量化 epilogue ─────────────────────────
+// y = a_scale · b_scale[j] · (acc - a_zp · Σ_k B[k, j]) + bias[j]；
+// 输出 F32 时直接写 y，输出 int8 / uint8 时写 clamp(round(y / out_scale) + out_zp)。
+
+enum class QGemmOut : std::uint8_t
+{
+    F32,
+    S8,
+    U8,
+};
+
+// 微内核看到的 tile 局部视图（已偏移到本 tile 首列）：y = float(acc - comp[j]) · mul[j] + add[j]，
+// 整型输出先 clamp 到 [lo, hi] 再按当前舍入模式（默认就近偶数）取整，out_zp 已并入 add
+struct QTileEpilogue
+{
+    const std::int32_t* comp = nullptr;
+    const float*        mul  = nullptr;
+    const float*        add  = nullptr;
+    float               lo   = 0.0f;
+    float               hi   = 0.0f;
+    QGemmOut            out  = QGemmOut::F32;
+};
+
+// driver 持有的整体参数；b_scale 为 per-tensor（b_scale_stride = 0）或 per-channel [N]（stride = 1）
+struct QGemmEpilogue
+{
+    float        a_scale        = 1.0f;
+    std::int32_t a_zero_point   = 0;
+    const float* b_scale        = nullptr;
+    std::int64_t b_scale_stride = 0;
+    const float* bias           = nullptr; // [N]，浮点域；nullptr 表示无
+    QGemmOut     out            = QGemmOut::F32;
+    float        out_scale      = 1.0f;
+    std::int32_t out_zero_point = 0;
+};
+
+} // namespace bee::cpu::gemm
@@ -4,7 +4,7 @@
  * @Date 2026/4/23
  * @Brief This file is part of Bee.
  *
- * GEMM 内核共用的分块常量、对齐分配、软件预取宏。
+ * GEMM 内核共用的寄存器 tile 常量、运行期分块参数、对齐分配、软件预取宏。
  *
  * 约定：所有 GEMM 采用 **行主序**，行距 = 列数 N（A: [M,K] → lda=K；B: [K,N] → ldb=N；
  * C: [M,N] → ldc=N）。C 在调用前已 memset 为 0，内核只做 += 累加。
@@ -12,6 +12,9 @@
 
 #pragma once
 
+#include "SIMD/Detect.hpp"
+#include "Base/Diagnostics/Check.hpp"
+
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
@@ -32,12 +35,9 @@
 namespace bee::cpu::gemm
 {
 
-// ── 分块常量 ─────────────────────────────────────────────────────────────────
+// ── 寄存器 tile 常量（缓存分块 MC/KC/NC 见下方 GemmBlocking，运行期推导）────────────
 struct Avx2BlockSize
 {
-    static constexpr int MC    = 192;
-    static constexpr int KC    = 384;
-    static constexpr int NC    = 2048;
     static constexpr int MR    = 8;
     static constexpr int NR_F  = 8; // SGEMM / I32 列方向 tile
     static constexpr int NR_D  = 4; // DGEMM 列方向 tile
@@ -46,9 +46,6 @@ struct Avx2BlockSize
 
 struct Sse2BlockSize
 {
-    static constexpr int MC    = 128;
-    static constexpr int KC    = 256;
-    static constexpr int NC    = 1024;
     static constexpr int MR    = 4;
     static constexpr int NR_F  = 4;
     static constexpr int NR_D  = 2;
@@ -82,10 +79,12 @@ struct AlignedBuffer
     void*       ptr{nullptr};
     std::size_t bytes{0};
 
+    // 分配失败直接终止：pack 缓冲是内核内部的工作区，空指针继续写入只会变成更隐蔽的崩溃
     AlignedBuffer(std::size_t b, std::size_t alignment = 64)
         : bytes(b)
     {
         ptr = aligned_malloc(b, alignment);
+        BEE_CHECK_MSG(ptr != nullptr || b == 0, "GEMM: pack 缓冲分配失败");
     }
 
     ~AlignedBuffer()
@@ -104,6 +103,89 @@ struct AlignedBuffer
     }
 };
 
+// ── 缓存分块 ─────────────────────────────────────────────────────────────────
+// Goto 三层分块：B 微条带 [KC × NR] 驻留 L1，A 块 [MC × KC] 驻留 L2，B 块 [KC × NC] 驻留 L3。
+struct GemmBlocking
+{
+    std::int64_t mc = 0;
+    std::int64_t kc = 0;
+    std::int64_t nc = 0;
+};
+
+// 缓存容量未检测到时的保守取值
+inline constexpr std::size_t kGemmDefaultL1d = 32 * 1024;
+inline constexpr std::size_t kGemmDefaultL2  = 1024 * 1024;
+inline constexpr std::size_t kGemmDefaultL3  = 8 * 1024 * 1024;
+
+// 由缓存容量推导分块（elem 为 A/B 元素字节数）：
+//  - KC：B 微条带占 L1d 的 1/4（其余留给 A 微条带与 C tile），取 16 的倍数；
+//  - MC：A 块占 L2 的 1/8（L2 同时缓存流过的 B 条带），取 MR 的倍数；
+//  - NC：B 块占 L3 的 1/8（L3 为多核共享），取 NR 的倍数。
+// 例：L1d 48 KB / L2 2 MB，F32（MR = NR = 8）→ KC = 384，MC = 168。
+inline auto derive_gemm_blocking(std::size_t l1d, std::size_t l2, std::size_t l3, int MR, int NR, std::size_t elem) -> GemmBlocking
+{
+    l1d = l1d != 0 ? l1d : kGemmDefaultL1d;
+    l2  = l2 != 0 ? l2 : kGemmDefaultL2;
+    l3  = l3 != 0 ? l3 : kGemmDefaultL3;
+
+    auto clamp = [](std::int64_t v, std::int64_t lo, std::int64_t hi) {
+        return v < lo ? lo : (v > hi ? hi : v);
+    };
+    const auto e = static_cast<std::int64_t>(elem);
+
+    GemmBlocking bk;
+    bk.kc = clamp(static_cast<std::int64_t>(l1d / 4) / (NR * e) / 16 * 16, 64, 1024);
+    bk.mc = clamp(static_cast<std::int64_t>(l2 / 8) / (bk.kc * e) / MR * MR, MR, 1024 / MR * MR);
+    bk.nc = clamp(static_cast<std::int64_t>(l3 / 8) / (bk.kc * e) / NR * NR, 16 * NR, 4096 / NR * NR);
+    return bk;
+}
+
+// 读取非负整数环境变量；未设置或非法时返回 0
+inline auto gemm_env_int(const char* name) -> std::int64_t
+{
+#if defined(_MSC_VER)
+    char*       v = nullptr;
+    std::size_t n = 0;
+    if (_dupenv_s(&v, &n, name) != 0 || v == nullptr)
+        return 0;
+    const long long r = std::strtoll(v, nullptr, 10);
+    std::free(v);
+#else
+    const char* v = std::getenv(name);
+    if (v == nullptr)
+        return 0;
+    const long long r = std::strtoll(v, nullptr, 10);
+#endif
+    return r > 0 ? static_cast<std::int64_t>(r) : 0;
+}
+
+// 每种 (元素类型, MR, NR) 的分块在首次使用时确定并缓存，进程内不再变化
+// （预打包权重的布局依赖 KC/NC，须在整个进程内保持一致）。
+// 环境变量 BEE_GEMM_MC / BEE_GEMM_KC / BEE_GEMM_NC 可逐项覆盖推导值，MC / NC 向下取整到 MR / NR 的倍数。
+template <typename T, int MR, int NR>
+inline auto gemm_blocking() -> const GemmBlocking&
+{
+    static const GemmBlocking kBlocking = [] {
+        const auto   caches = ::bee::simd::detect_cache_sizes();
+        GemmBlocking bk     = derive_gemm_blocking(caches.l1d, caches.l2, caches.l3, MR, NR, sizeof(T));
+        if (const auto v = gemm_env_int("BEE_GEMM_KC"); v > 0)
+            bk.kc = v;
+        if (const auto v = gemm_env_int("BEE_GEMM_MC"); v >= MR)
+            bk.mc = v / MR * MR;
+        if (const auto v = gemm_env_int("BEE_GEMM_NC"); v >= NR)
+            bk.nc = v / NR * NR;
+        return bk;
+    }();
+    return kBlocking;
+}
+
+// 整块 B pack 的元素数：N 向上取整到 NR（最后一个列条带补零）
+template <int NR>
+inline auto packed_b_elems(std::int64_t K, std::int64_t N) -> std::int64_t
+{
+    return K * ((N + NR - 1) / NR * NR);
+}
+
 template <typename T>
 inline auto min_i(T a, T b) -> T
 {
@@ -8,10 +8,29 @@
  * 行主序，C += A·B（调用者负责 C 的初始化 / 清零）。
  * I8GEMM：A/B 为 int8，C 为 int32（累加到 int32，输出 dtype=I32）。
  * I64 未提供 SIMD 版本。
+ * gemm_batched_*：A/B 为逐 batch 的 slice 指针数组（各自行主序连续），C 为连续 [batch, M, N]；
+ * 指针相同的 B slice 只 pack 一次（广播场景）。
+ * gemm_f16_f32 / gemm_bf16_f32（及 batched）：A/B 为 16 位浮点存储，packing / GEMV 加载时展开为 F32，
+ * 沿用 F32 微内核，C 为 F32。
+ * pack_b_* / gemm_packed_*：预打包权重。pack_b 把 [K,N] 的 B 写成本 ISA 的整块 pack 布局
+ * （N 向上取整到 NR 后的 K*N_pad 个元素，见 GemmDriver.hpp），gemm_packed 直接消费该布局、不再 pack B。
+ * 布局与 ISA 及本进程的分块参数（KC / NC）绑定：必须由同一进程内同一 ISA 的 pack_b 生成。
+ * gemm_fused_*：在微内核写回时融合 epilogue（见 Epilogue.hpp）；b_packed 为 true 时 B 为 pack_b 的结果，
+ * 否则为行主序 [K,N]，由 driver 临时整块 pack。调用方负责先把 C 处理为 beta·C。
+ * conv2d_*：NCHW 卷积，权重整块 pack、输入经 implicit im2col 在 pack 时生成（见 ConvCommon.hpp）；
+ * y 由 bias（可为 nullptr）初始化，不需要预先清零。
+ * attention_*：分块 + online softmax 的融合注意力（见 AttentionCommon.hpp），mask 为 Bool 或 nullptr；out 不需要预先清零。
+ * qgemm_*：u8 激活 × s8 权重的量化 GEMM（见 QGemmCommon.hpp）。qgemm_pack_b_s8 写出 qgemm_packed_bytes 字节的
+ * 整块 pack（含列和与条带标志），qgemm_u8s8 消费之并在写回时按 ep 再量化；C 不需要预先清零。
  */
 
 #pragma once
 
+#include "Tensor/Core/Half.hpp"
+#include "Tensor/Cpu/AttentionGeom.hpp"
+#include "Tensor/Cpu/ConvGeom.hpp"
+#include "Tensor/Cpu/Gemm/Epilogue.hpp"
+
 #include <cstdint>
 
 namespace bee::cpu::gemm
@@ -20,10 +39,310 @@ namespace bee::cpu::gemm
 #define BEE_GEMM_DECL_NS(NS)                                                                                                                   \
     namespace NS                                                                                                                               \
     {                                                                                                                                          \
-        auto gemm_f32(std::int64_t M, std::int64_t K, std::int64_t N, const float* A, const float* B, float* C) -> void;                       \
-        auto gemm_f64(std::int64_t M, std::int64_t K, std::int64_t N, const double* A, const double* B, double* C) -> void;                    \
-        auto gemm_i32(std::int64_t M, std::int64_t K, std::int64_t N, const std::int32_t* A, const std::int32_t* B, std::int32_t* C) -> void;  \
-        auto gemm_i8_i32(std::int64_t M, std::int64_t K, std::int64_t N, const std::int8_t* A, const std::int8_t* B, std::int32_t* C) -> void; \
+        auto gemm_f32(                                                                                                                         \
+            std::int64_t M,                                                                                                                    \
+            std::int64_t K,                                                                                                                    \
+            std::int64_t N,                                                                                                                    \
+            const float* A,                                                                                                                    \
+            std::int64_t rsa,                                                                                                                  \
+            std::int64_t csa,                                                                                                                  \
+            const float* B,                                                                                                                    \
+            std::int64_t rsb,                                                                                                                  \
+            std::int64_t csb,                                                                                                                  \
+            float*       C                                                                                                                     \
+        ) -> void;                                                                                                                             \
+        auto gemm_f64(                                                                                                                         \
+            std::int64_t  M,                                                                                                                   \
+            std::int64_t  K,                                                                                                                   \
+            std::int64_t  N,                                                                                                                   \
+            const double* A,                                                                                                                   \
+            std::int64_t  rsa,                                                                                                                 \
+            std::int64_t  csa,                                                                                                                 \
+            const double* B,                                                                                                                   \
+            std::int64_t  rsb,                                                                                                                 \
+            std::int64_t  csb,                                                                                                                 \
+            double*       C                                                                                                                    \
+        ) -> void;                                                                                                                             \
+        auto gemm_i32(                                                                                                                         \
+            std::int64_t        M,                                                                                                             \
+            std::int64_t        K,                                                                                                             \
+            std::int64_t        N,                                                                                                             \
+            const std::int32_t* A,                                                                                                             \
+            std::int64_t        rsa,                                                                                                           \
+            std::int64_t        csa,                                                                                                           \
+            const std::int32_t* B,                                                                                                             \
+            std::int64_t        rsb,                                                                                                           \
+            std::int64_t        csb,                                                                                                           \
+            std::int32_t*       C                                                                                                              \
+        ) -> void;                                                                                                                             \
+        auto gemm_i8_i32(                                                                                                                      \
+            std::int64_t       M,                                                                                                              \
+            std::int64_t       K,                                                                                                              \
+            std::int64_t       N,                                                                                                              \
+            const std::int8_t* A,                                                                                                              \
+            std::int64_t       rsa,                                                                                                            \
+            std::int64_t       csa,                                                                                                            \
+            const std::int8_t* B,                                                                                                              \
+            std::int64_t       rsb,                                                                                                            \
+            std::int64_t       csb,                                                                                                            \
+            std::int32_t*      C                                                                                                               \
+        ) -> void;                                                                                                                             \
+        auto gemm_f16_f32(                                                                                                                     \
+            std::int64_t M,                                                                                                                    \
+            std::int64_t K,                                                                                                                    \
+            std::int64_t N,                                                                                                                    \
+            const Half*  A,                                                                                                                    \
+            std::int64_t rsa,                                                                                                                  \
+            std::int64_t csa,                                                                                                                  \
+            const Half*  B,                                                                                                                    \
+            std::int64_t rsb,                                                                                                                  \
+            std::int64_t csb,                                                                                                                  \
+            float*       C                                                                                                                     \
+        ) -> void;                                                                                                                             \
+        auto gemm_bf16_f32(                                                                                                                    \
+            std::int64_t    M,                                                                                                                 \
+            std::int64_t    K,                                                                                                                 \
+            std::int64_t    N,                                                                                                                 \
+            const BFloat16* A,                                                                                                                 \
+            std::int64_t    rsa,                                                                                                               \
+            std::int64_t    csa,                                                                                                               \
+            const BFloat16* B,                                                                                                                 \
+            std::int64_t    rsb,                                                                                                               \
+            std::int64_t    csb,                                                                                                               \
+            float*          C                                                                                                                  \
+        ) -> void;                                                                                                                             \
+        auto gemm_batched_f32(                                                                                                                 \
+            std::int64_t        batch,                                                                                                         \
+            std::int64_t        M,                                                                                                             \
+            std::int64_t        K,                                                                                                             \
+            std::int64_t        N,                                                                                                             \
+            const float* const* A,                                                                                                             \
+            std::int64_t        rsa,                                                                                                           \
+            std::int64_t        csa,                                                                                                           \
+            const float* const* B,                                                                                                             \
+            std::int64_t        rsb,                                                                                                           \
+            std::int64_t        csb,                                                                                                           \
+            float*              C                                                                                                              \
+        ) -> void;                                                                                                                             \
+        auto gemm_batched_f64(                                                                                                                 \
+            std::int64_t         batch,                                                                                                        \
+            std::int64_t         M,                                                                                                            \
+            std::int64_t         K,                                                                                                            \
+            std::int64_t         N,                                                                                                            \
+            const double* const* A,                                                                                                            \
+            std::int64_t         rsa,                                                                                                          \
+            std::int64_t         csa,                                                                                                          \
+            const double* const* B,                                                                                                            \
+            std::int64_t         rsb,                                                                                                          \
+            std::int64_t         csb,                                                                                                          \
+            double*              C                                                                                                             \
+        ) -> void;                                                                                                                             \
+        auto gemm_batched_i32(                                                                                                                 \
+            std::int64_t               batch,                                                                                                  \
+            std::int64_t               M,                                                                                                      \
+            std::int64_t               K,                                                                                                      \
+            std::int64_t               N,                                                                                                      \
+            const std::int32_t* const* A,                                                                                                      \
+            std::int64_t               rsa,                                                                                                    \
+            std::int64_t               csa,                                                                                                    \
+            const std::int32_t* const* B,                                                                                                      \
+            std::int64_t               rsb,                                                                                                    \
+            std::int64_t               csb,                                                                                                    \
+            std::int32_t*              C                                                                                                       \
+        ) -> void;                                                                                                                             \
+        auto gemm_batched_i8_i32(                                                                                                              \
+            std::int64_t              batch,                                                                                                   \
+            std::int64_t              M,                                                                                                       \
+            std::int64_t              K,                                                                                                       \
+            std::int64_t              N,                                                                                                       \
+            const std::int8_t* const* A,                                                                                                       \
+            std::int64_t              rsa,                                                                                                     \
+            std::int64_t              csa,                                                                                                     \
+            const std::int8_t* const* B,                                                                                                       \
+            std::int64_t              rsb,                                                                                                     \
+            std::int64_t              csb,                                                                                                     \
+            std::int32_t*             C                                                                                                        \
+        ) -> void;                                                                                                                             \
+        auto gemm_batched_f16_f32(                                                                                                             \
+            std::int64_t       batch,                                                                                                          \
+            std::int64_t       M,                                                                                                              \
+            std::int64_t       K,                                                                                                              \
+            std::int64_t       N,                                                                                                              \
+            const Half* const* A,                                                                                                              \
+            std::int64_t       rsa,                                                                                                            \
+            std::int64_t       csa,                                                                                                            \
+            const Half* const* B,                                                                                                              \
+            std::int64_t       rsb,                                                                                                            \
+            std::int64_t       csb,                                                                                                            \
+            float*             C                                                                                                               \
+        ) -> void;                                                                                                                             \
+        auto gemm_batched_bf16_f32(                                                                                                            \
+            std::int64_t           batch,                                                                                                      \
+            std::int64_t           M,                                                                                                          \
+            std::int64_t           K,                                                                                                          \
+            std::int64_t           N,                                                                                                          \
+            const BFloat16* const* A,                                                                                                          \
+            std::int64_t           rsa,                                                                                                        \
+            std::int64_t           csa,                                                                                                        \
+            const BFloat16* const* B,                                                                                                          \
+            std::int64_t           rsb,                                                                                                        \
+            std::int64_t           csb,                                                                                                        \
+            float*                 C                                                                                                           \
+        ) -> void;                                                                                                                             \
+        auto pack_b_f32(                                                                                                                       \
+            std::int64_t K,                                                                                                                    \
+            std::int64_t N,                                                                                                                    \
+            const float* B,                                                                                                                    \
+            std::int64_t rsb,                                                                                                                  \
+            std::int64_t csb,                                                                                                                  \
+            float*       dst                                                                                                                   \
+        ) -> void;                                                                                                                             \
+        auto pack_b_f64(                                                                                                                       \
+            std::int64_t  K,                                                                                                                   \
+            std::int64_t  N,                                                                                                                   \
+            const double* B,                                                                                                                   \
+            std::int64_t  rsb,                                                                                                                 \
+            std::int64_t  csb,                                                                                                                 \
+            double*       dst                                                                                                                  \
+        ) -> void;                                                                                                                             \
+        auto pack_b_i32(                                                                                                                       \
+            std::int64_t        K,                                                                                                             \
+            std::int64_t        N,                                                                                                             \
+            const std::int32_t* B,                                                                                                             \
+            std::int64_t        rsb,                                                                                                           \
+            std::int64_t        csb,                                                                                                           \
+            std::int32_t*       dst                                                                                                            \
+        ) -> void;                                                                                                                             \
+        auto pack_b_i8(                                                                                                                        \
+            std::int64_t       K,                                                                                                              \
+            std::int64_t       N,                                                                                                              \
+            const std::int8_t* B,                                                                                                              \
+            std::int64_t       rsb,                                                                                                            \
+            std::int64_t       csb,                                                                                                            \
+            std::int8_t*       dst                                                                                                             \
+        ) -> void;                                                                                                                             \
+        auto gemm_packed_f32(                                                                                                                  \
+            std::int64_t M,                                                                                                                    \
+            std::int64_t K,                                                                                                                    \
+            std::int64_t N,                                                                                                                    \
+            const float* A,                                                                                                                    \
+            std::int64_t rsa,                                                                                                                  \
+            std::int64_t csa,                                                                                                                  \
+            const float* B_packed,                                                                                                             \
+            float*       C                                                                                                                     \
+        ) -> void;                                                                                                                             \
+        auto gemm_packed_f64(                                                                                                                  \
+            std::int64_t  M,                                                                                                                   \
+            std::int64_t  K,                                                                                                                   \
+            std::int64_t  N,                                                                                                                   \
+            const double* A,                                                                                                                   \
+            std::int64_t  rsa,                                                                                                                 \
+            std::int64_t  csa,                                                                                                                 \
+            const double* B_packed,                                                                                                            \
+            double*       C                                                                                                                    \
+        ) -> void;                                                                                                                             \
+        auto gemm_packed_i32(                                                                                                                  \
+            std::int64_t        M,                                                                                                             \
+            std::int64_t        K,                                                                                                             \
+            std::int64_t        N,                                                                                                             \
+            const std::int32_t* A,                                                                                                             \
+            std::int64_t        rsa,                                                                                                           \
+            std::int64_t        csa,                                                                                                           \
+            const std::int32_t* B_packed,                                                                                                      \
+            std::int32_t*       C                                                                                                              \
+        ) -> void;                                                                                                                             \
+        auto gemm_packed_i8_i32(                                                                                                               \
+            std::int64_t       M,                                                                                                              \
+            std::int64_t       K,                                                                                                              \
+            std::int64_t       N,                                                                                                              \
+            const std::int8_t* A,                                                                                                              \
+            std::int64_t       rsa,                                                                                                            \
+            std::int64_t       csa,                                                                                                            \
+            const std::int8_t* B_packed,                                                                                                       \
+            std::int32_t*      C                                                                                                               \
+        ) -> void;                                                                                                                             \
+        auto gemm_fused_f32(                                                                                                                   \
+            std::int64_t               M,                                                                                                      \
+            std::int64_t               K,                                                                                                      \
+            std::int64_t               N,                                                                                                      \
+            const float*               A,                                                                                                      \
+            std::int64_t               rsa,                                                                                                    \
+            std::int64_t               csa,                                                                                                    \
+            const float*               B,                                                                                                      \
+            std::int64_t               rsb,                                                                                                    \
+            std::int64_t               csb,                                                                                                    \
+            bool                       b_packed,                                                                                               \
+            float*                     C,                                                                                                      \
+            const GemmEpilogue<float>& ep                                                                                                      \
+        ) -> void;                                                                                                                             \
+        auto gemm_fused_f64(                                                                                                                   \
+            std::int64_t                M,                                                                                                     \
+            std::int64_t                K,                                                                                                     \
+            std::int64_t                N,                                                                                                     \
+            const double*               A,                                                                                                     \
+            std::int64_t                rsa,                                                                                                   \
+            std::int64_t                csa,                                                                                                   \
+            const double*               B,                                                                                                     \
+            std::int64_t                rsb,                                                                                                   \
+            std::int64_t                csb,                                                                                                   \
+            bool                        b_packed,                                                                                              \
+            double*                     C,                                                                                                     \
+            const GemmEpilogue<double>& ep                                                                                                 \
+        ) -> void;                                                                                                                         \
+        auto conv2d_f32(                                                                                                                       \
+            const Conv2dGeom& g,                                                                                                               \
+            std::int64_t      n,                                                                                                               \
+            const float*      x,                                                                                                               \
+            const float*      w,                                                                                                               \
+            const float*      bias,                                                                                                            \
+            float*            y                                                                                                                \
+        ) -> void;                                                                                                                             \
+        auto conv2d_f64(                                                                                                                       \
+            const Conv2dGeom& g,                                                                                                               \
+            std::int64_t      n,                                                                                                               \
+            const double*     x,                                                                                                               \
+            const double*     w,                                                                                                               \
+            const double*     bias,                                                                                                            \
+            double*           y                                                                                                                \
+        ) -> void;                                                                                                                             \
+        auto attention_f32(                                                                                                                \
+            const AttentionGeom& g,                                                                                                        \
+            const float*         q,                                                                                                        \
+            const float*         k,                                                                                                        \
+            const float*         v,                                                                                                        \
+            const bool*          mask,                                                                                                     \
+            float                scale,                                                                                                    \
+            float*               out                                                                                                       \
+        ) -> void;                                                                                                                         \
+        auto attention_f64(                                                                                                                \
+            const AttentionGeom& g,                                                                                                        \
+            const double*        q,                                                                                                        \
+            const double*        k,                                                                                                        \
+            const double*        v,                                                                                                        \
+            const bool*          mask,                                                                                                     \
+            double               scale,                                                                                                    \
+            double*              out                                                                                                       \
+        ) -> void;                                                                                                                         \
+        auto qgemm_packed_bytes(std::int64_t K, std::int64_t N) -> std::int64_t;                                                           \
+        auto qgemm_pack_b_s8(                                                                                                              \
+            std::int64_t       K,                                                                                                          \
+            std::int64_t       N,                                                                                                          \
+            const std::int8_t* B,                                                                                                          \
+            std::int64_t       rsb,                                                                                                        \
+            std::int64_t       csb,                                                                                                        \
+            void*              dst                                                                                                         \
+        ) -> void;                                                                                                                         \
+        auto qgemm_u8s8(                                                                                                                   \
+            std::int64_t         M,                                                                                                        \
+            std::int64_t         K,                                                                                                        \
+            std::int64_t         N,                                                                                                        \
+            const std::uint8_t*  A,                                                                                                        \
+            std::int64_t         rsa,                                                                                                      \
+            std::int64_t         csa,                                                                                                      \
+            const void*          B_packed,                                                                                                 \
+            const QGemmEpilogue& ep,                                                                                                       \
+            void*                C                                                                                                         \
+        ) -> void;                                                                                                                         \
     }
 
 BEE_GEMM_DECL_NS(scalar)
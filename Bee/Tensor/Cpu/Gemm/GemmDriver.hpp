@@ -3,28 +3,52 @@
  * @Author dfnzhc (https://github.com/dfnzhc)
  * @Brief AVX2/SSE2 共用的 Goto 三层分块 GEMM driver（支持外层 parallel_for）。
  *
- * 拓扑：
- *   for jc in 0..N_main by NC:
+ * 串行拓扑（M*N*K < kGemmParallelFlops，或只有单个 worker）：
+ *   for jc in 0..N by NC:
  *     for pc in 0..K by KC:
- *       pack B[pc..pc+kc, jc..jc+nc]                     —— 主线程串行
- *       parallel_for(chunk in 0..num_ic_chunks):         —— 并行 ic 方向
- *         thread_local A_pack[MC * KC]
- *         for each ic in chunk:
- *            pack A[ic..ic+mc, pc..pc+kc]
- *            for jr, ir: microkernel
+ *       pack B[pc..pc+kc, jc..jc+nc]
+ *       for ic in 0..M by MC:
+ *         pack A[ic..ic+mc, pc..pc+kc]
+ *         for jr, ir: microkernel
  *
- *  并行度：num_ic_chunks = ceil(M_main / MC)，由 parallel_for 内部再按 grain 汇聚。
- *  阈值：M*N*K < kGemmParallelFlops 时走单线程路径，避免 fork-join 开销压过收益。
+ * 边界：M / N 不是 MR / NR 整数倍时，A / B 的最后一个条带补零 pack，边界 tile 仍由同一个微内核
+ * 在栈上的 MR×NR 缓冲里算完，写回时只取有效的 rows×cols 部分（store_edge_tile）。
+ * 因此不存在单独的标量尾巴，边界 tile 与主体 tile 一起参与行块 × 列组的并行划分。
+ *
+ * 并行拓扑：B 按 NC 宽的列分片处理，每片由全部 worker 协同 pack 全部 K（一次 parallel_for），随后在
+ * ic 行块 × 列组的二维网格上再做一次 parallel_for：每片两次 fork-join，而不是每个 (jc, pc) 一次，
+ * pack 缓冲只需 K × NC 而非整个 B。列组数由 gemm_col_groups 按形状与线程数选取：小 M 时沿 N 切分。
+ *
+ * 缓存分块 MC / KC / NC 不再是编译期常量：由 gemm_blocking<TA, MR, NR>()（GemmCommon.hpp）按检测到的
+ * L1d / L2 / L3 容量在首次调用时推导并缓存，可用环境变量覆盖。
+ *
+ * 加载策略 Ld（PackCommon.hpp）：A / B 的源元素类型为 Ld::Src，packing 时经 Ld 转换为 TA；
+ * 默认 PackCopy<TA> 原样拷贝，F16 / BF16 输入用 PackHalf 在 pack 时展开为 F32（panel 与微内核仍为 F32）。
+ *
+ * 列分片 B pack 路径（gemm_driver / gemm_driver_batched / gemm_driver_fused；gemm_driver_prepacked 为整块）：
+ *   1. 对每个 NC 宽的列分片 [n0, n0 + NC)：B 在该分片上 pack 全部 K（批量时一轮 pack 若干个不同 slice，
+ *      总量受 kGemmPackBudgetElems 约束；预打包时整个 B 已由调用方 pack 好，视为单一分片 [0, N)）
+ *   2. parallel_for(task in 0..batch * num_ic_chunks * num_col_groups)：每个任务负责一个 slice 的
+ *      一个 MC 行块 × 分片内一段列条带，遍历全部 pc（边界 tile 落在哪个任务就由哪个任务处理）
+ *
+ * 隐式 B 路径（gemm_driver_implicit_b，供 conv2d 的 implicit im2col 使用）：A 整块 pack 一次，
+ * B 不存在于内存中，由调用方的 pack_b 回调在每个 (slice, 列块, pc) 上直接生成 [kc × NR] 条带。
  */
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include "Base/Parallel/ParallelFor.hpp"
+#include "Tensor/Cpu/Gemm/Epilogue.hpp"
 #include "Tensor/Cpu/Gemm/GemmCommon.hpp"
+#include "Tensor/Cpu/Gemm/GemvCommon.hpp"
 #include "Tensor/Cpu/Gemm/PackCommon.hpp"
 
 namespace bee::cpu::gemm::detail
@@ -33,142 +57,675 @@ namespace bee::cpu::gemm::detail
 // 并行阈值：约 4 M FLOPs（例如 128×128×128 ≈ 2 MF 走串行，256×256×256 ≈ 33 MF 走并行）。
 inline constexpr std::int64_t kGemmParallelFlops = 4LL * 1024 * 1024;
 
-// 边界标量累加：处理 gemm 主干之外的余数行/列 / K 余数。
-template <typename TA, typename TC>
-inline auto scalar_gemm_add(
-    std::int64_t M,
-    std::int64_t K,
-    std::int64_t N,
-    const TA*    A,
-    std::int64_t lda,
-    const TA*    B,
-    std::int64_t ldb,
-    TC*          C,
-    std::int64_t ldc
-) -> void
+// 返回当前线程用的 A_pack 缓冲区指针（thread_local，每线程 1 份）：容量按 MC*KC*sizeof(TA) 取本次所需，
+// 不足时重新分配，之后同一线程上的调用直接复用。
+inline auto thread_local_a_pack_buffer(std::size_t bytes) -> void*
 {
-    for (std::int64_t i = 0; i < M; ++i) {
-        for (std::int64_t k = 0; k < K; ++k) {
-            const TC aik = static_cast<TC>(A[i * lda + k]);
-            for (std::int64_t j = 0; j < N; ++j) {
-                C[i * ldc + j] += aik * static_cast<TC>(B[k * ldb + j]);
-            }
+    struct Holder
+    {
+        void*       ptr = nullptr;
+        std::size_t cap = 0;
+
+        ~Holder()
+        {
+            if (ptr)
+                aligned_free(ptr);
         }
+    };
+    thread_local Holder buf;
+    if (buf.cap < bytes) {
+        if (buf.ptr)
+            aligned_free(buf.ptr);
+        buf.ptr = aligned_malloc(bytes, 64);
+        BEE_CHECK_MSG(buf.ptr != nullptr, "GEMM: A pack 缓冲分配失败");
+        buf.cap = bytes;
     }
+    return buf.ptr;
 }
 
-// 返回当前线程用的 A_pack 缓冲区指针（thread_local，每线程 1 份，按需懒初始化）。
-// 容量按 `(MC_MAX * KC_MAX * sizeof(std::int64_t))` 预留，足够覆盖所有 ISA × dtype 组合
-// （AVX2 MC=192 KC=384 → 288 KB × 8B = 576 KB；SSE2 MC=128 KC=256 → 32 KB × 8B = 256 KB）。
-inline auto thread_local_a_pack_buffer() -> void*
+// 调用微内核：浮点内核带可选 TileEpilogue 形参；整型内核无此形参（融合入口仅开放浮点）
+template <typename TA, typename TC, typename MicroK>
+inline auto invoke_micro(MicroK micro, const TA* Ap, const TA* Bp, std::int64_t kc, TC* C, std::int64_t ldc, const TileEpilogue<TC>* ep = nullptr)
+    -> void
 {
-    static constexpr std::size_t kBytes = 192 * 384 * sizeof(std::int64_t); // 576 KB
-    thread_local AlignedBuffer   buf(kBytes, 64);
-    return buf.ptr;
+    if constexpr (std::is_invocable_v<MicroK, const TA*, const TA*, std::int64_t, TC*, std::int64_t, const TileEpilogue<TC>*>)
+        micro(Ap, Bp, kc, C, ldc, ep);
+    else
+        micro(Ap, Bp, kc, C, ldc);
 }
 
-// 单线程 driver（并行阈值之下、尾巴处理之前用）。
-template <typename TA, typename TC, int MR, int NR, int MC, int KC, int NC, typename MicroK>
-inline auto gemm_driver_serial(std::int64_t M, std::int64_t K, std::int64_t N, const TA* A, const TA* B, TC* C, MicroK micro) -> void
+// 计算一个 tile 并写回 C 的 rows×cols 部分（row0 / col0 为 epilogue 坐标）。
+// 满 tile 直接写 C；边界 tile 先在栈上累加补零后的 MR×NR 结果，再逐元素经 epi 写回有效部分。
+template <typename TA, typename TC, int MR, int NR, typename MicroK, typename Epi>
+inline auto gemm_tile(
+    MicroK       micro,
+    const TA*    Ap,
+    const TA*    Bp,
+    std::int64_t kc,
+    TC*          C,
+    std::int64_t ldc,
+    std::int64_t rows,
+    std::int64_t cols,
+    std::int64_t row0,
+    std::int64_t col0,
+    bool         last,
+    const Epi&   epi
+) -> void
 {
-    const std::int64_t lda    = K;
-    const std::int64_t ldb    = N;
-    const std::int64_t ldc    = N;
-    const std::int64_t M_main = (M / MR) * MR;
-    const std::int64_t N_main = (N / NR) * NR;
+    if (rows == MR && cols == NR) {
+        if constexpr (std::is_same_v<Epi, NoEpilogue>) {
+            invoke_micro<TA, TC>(micro, Ap, Bp, kc, C, ldc);
+        } else {
+            const TileEpilogue<TC> te = epi.tile(row0, col0, last);
+            invoke_micro<TA, TC>(micro, Ap, Bp, kc, C, ldc, &te);
+        }
+        return;
+    }
+    alignas(64) TC tile[MR * NR] = {};
+    invoke_micro<TA, TC>(micro, Ap, Bp, kc, tile, static_cast<std::int64_t>(NR));
+    for (std::int64_t r = 0; r < rows; ++r)
+        for (std::int64_t c = 0; c < cols; ++c)
+            epi.apply(C[r * ldc + c], tile[r * NR + c], row0 + r, col0 + c, last);
+}
 
-    AlignedBuffer a_pack_buf(static_cast<std::size_t>(MC) * KC * sizeof(TA), 64);
-    AlignedBuffer b_pack_buf(static_cast<std::size_t>(KC) * NC * sizeof(TA), 64);
+// 单线程 driver（并行阈值之下或只有单个 worker 时用）
+template <typename TA, typename TC, int MR, int NR, typename Ld = PackCopy<TA>, typename MicroK>
+inline auto gemm_driver_serial(
+    std::int64_t            M,
+    std::int64_t            K,
+    std::int64_t            N,
+    const typename Ld::Src* A,
+    std::int64_t            rsa,
+    std::int64_t            csa,
+    const typename Ld::Src* B,
+    std::int64_t            rsb,
+    std::int64_t            csb,
+    TC*                     C,
+    MicroK                  micro
+) -> void
+{
+    const GemmBlocking& bk  = gemm_blocking<TA, MR, NR>();
+    const std::int64_t  ldc = N;
+
+    AlignedBuffer a_pack_buf(static_cast<std::size_t>(bk.mc * bk.kc) * sizeof(TA), 64);
+    AlignedBuffer b_pack_buf(static_cast<std::size_t>(bk.kc * bk.nc) * sizeof(TA), 64);
     TA*           A_pack = a_pack_buf.template as<TA>();
     TA*           B_pack = b_pack_buf.template as<TA>();
 
-    for (std::int64_t jc = 0; jc < N_main; jc += NC) {
-        const std::int64_t nc = min_i<std::int64_t>(N_main - jc, NC);
-        for (std::int64_t pc = 0; pc < K; pc += KC) {
-            const std::int64_t kc = min_i<std::int64_t>(K - pc, KC);
-            pack_B_nr<TA, NR>(B + pc * ldb + jc, ldb, kc, nc, B_pack);
+    for (std::int64_t jc = 0; jc < N; jc += bk.nc) {
+        const std::int64_t nc = min_i<std::int64_t>(N - jc, bk.nc);
+        for (std::int64_t pc = 0; pc < K; pc += bk.kc) {
+            const std::int64_t kc = min_i<std::int64_t>(K - pc, bk.kc);
+            pack_B_nr<TA, NR, Ld>(B + pc * rsb + jc * csb, rsb, csb, kc, nc, B_pack);
 
-            for (std::int64_t ic = 0; ic < M_main; ic += MC) {
-                const std::int64_t mc = min_i<std::int64_t>(M_main - ic, MC);
-                pack_A_mr<TA, MR>(A + ic * lda + pc, lda, mc, kc, A_pack);
+            for (std::int64_t ic = 0; ic < M; ic += bk.mc) {
+                const std::int64_t mc = min_i<std::int64_t>(M - ic, bk.mc);
+                pack_A_mr<TA, MR, Ld>(A + ic * rsa + pc * csa, rsa, csa, mc, kc, A_pack);
 
                 for (std::int64_t jr = 0; jr < nc; jr += NR) {
-                    const TA* Bp = B_pack + (jr / NR) * kc * NR;
+                    const TA*          Bp   = B_pack + (jr / NR) * kc * NR;
+                    const std::int64_t cols = min_i<std::int64_t>(nc - jr, NR);
                     for (std::int64_t ir = 0; ir < mc; ir += MR) {
-                        const TA* Ap = A_pack + (ir / MR) * kc * MR;
-                        micro(Ap, Bp, kc, C + (ic + ir) * ldc + (jc + jr), ldc);
+                        const TA*          Ap   = A_pack + (ir / MR) * kc * MR;
+                        const std::int64_t rows = min_i<std::int64_t>(mc - ir, MR);
+                        gemm_tile<TA, TC, MR, NR>(
+                            micro, Ap, Bp, kc, C + (ic + ir) * ldc + (jc + jr), ldc, rows, cols, ic + ir, jc + jr, false, NoEpilogue{}
+                        );
                     }
                 }
             }
         }
     }
+}
+
+// ── 整块 B pack 与共享执行器 ───────────────────────────────────────────────
+// 整块 B pack 布局（packed_b_elems<NR>(K, N) 个元素，N 向上取整到 NR 记为 N_pad）：
+//   按 (jc, pc) 块依次排布，块 (jc, pc) 起点 = jc*K + pc*nc（nc = min(N_pad - jc, NC)），
+//   块内为 nc/NR 个 [kc × NR] 条带，与 pack_B_nr 的单块布局一致；最后一个条带的补零列参与计算但不写回。
+// 批量 driver 与预打包权重（pack_b_* / gemm_packed_*）共用此布局。
+
+// 整块 pack 的最小并行规模（元素数）
+inline constexpr std::int64_t kGemmPackParallelElems = 256LL * 1024;
+// 批量 driver 一轮列分片 pack 的缓冲上限（元素数）：单个 slice 的 K × NC 超出时每轮只 pack 一个
+inline constexpr std::int64_t kGemmPackBudgetElems = 4LL * 1024 * 1024;
+
+// 整块 pack 的第 t 个任务：打包第 t 个 NR 列条带（覆盖全部 K；最后一个条带不足 NR 列时补零）
+template <typename T, int NR, typename Ld = PackCopy<T>>
+inline auto pack_B_full_task(
+    const GemmBlocking&     bk,
+    const typename Ld::Src* B,
+    std::int64_t            rsb,
+    std::int64_t            csb,
+    std::int64_t            K,
+    std::int64_t            N,
+    std::int64_t            t,
+    T*                      dst
+) -> void
+{
+    const std::int64_t N_pad = (N + NR - 1) / NR * NR;
+    const std::int64_t j     = t * NR;
+    const std::int64_t jc    = (j / bk.nc) * bk.nc;
+    const std::int64_t nc    = min_i<std::int64_t>(N_pad - jc, bk.nc);
+    const std::int64_t cols  = min_i<std::int64_t>(N - j, NR);
+    for (std::int64_t pc = 0; pc < K; pc += bk.kc) {
+        const std::int64_t kc = min_i<std::int64_t>(K - pc, bk.kc);
+        pack_B_nr<T, NR, Ld>(B + pc * rsb + j * csb, rsb, csb, kc, cols, dst + jc * K + pc * nc + ((j - jc) / NR) * kc * NR);
+    }
+}
+
+// 整块 pack 一个 [K, N] 矩阵（元素 (k, j) 位于 B[k * rsb + j * csb]）到 dst（packed_b_elems<NR>(K, N) 个元素）
+template <typename T, int MR, int NR, typename Ld = PackCopy<T>>
+inline auto pack_B_full(const typename Ld::Src* B, std::int64_t rsb, std::int64_t csb, std::int64_t K, std::int64_t N, T* dst) -> void
+{
+    const GemmBlocking& bk    = gemm_blocking<T, MR, NR>();
+    const auto          tasks = static_cast<std::size_t>((N + NR - 1) / NR);
+    auto                run   = [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t t = lo; t < hi; ++t)
+            pack_B_full_task<T, NR, Ld>(bk, B, rsb, csb, K, N, static_cast<std::int64_t>(t), dst);
+    };
+    if (K * N >= kGemmPackParallelElems)
+        ::bee::parallel::parallel_for(std::size_t{0}, tasks, std::size_t{1}, run);
+    else
+        run(0, tasks);
+}
+
+// 用 B pack 计算 C[ic..ic+mc, j0..j1)（j0 为 NR 整数倍；mc / j1 可落在边界上，末尾条带按补零处理）
+// B_full 为列区间 [n0, ...) 的整块 pack（n0 为 NC 整数倍，块 jc 起点 = (jc - n0)*K）；[j0, j1) 须落在其中
+// 带 epilogue 时，最后一个 K 块的写回在微内核内完成 bias / 激活 / residual
+template <typename TA, typename TC, int MR, int NR, typename Ld, typename MicroK, typename Epi>
+inline auto gemm_block_packed_b(
+    const GemmBlocking&     bk,
+    std::int64_t            ic,
+    std::int64_t            mc,
+    std::int64_t            j0,
+    std::int64_t            j1,
+    std::int64_t            n0,
+    std::int64_t            K,
+    std::int64_t            N,
+    const typename Ld::Src* A,
+    std::int64_t            rsa,
+    std::int64_t            csa,
+    const TA*               B_full,
+    TC*                     C,
+    std::int64_t            ldc,
+    TA*                     A_pack,
+    MicroK                  micro,
+    const Epi&              epi
+) -> void
+{
+    const std::int64_t N_pad = (N + NR - 1) / NR * NR;
+    for (std::int64_t jc = (j0 / bk.nc) * bk.nc; jc < j1; jc += bk.nc) {
+        const std::int64_t nc = min_i<std::int64_t>(N_pad - jc, bk.nc);
+        const std::int64_t jb = (j0 > jc ? j0 : jc) - jc;
+        const std::int64_t je = min_i<std::int64_t>(j1, jc + nc) - jc;
+        for (std::int64_t pc = 0; pc < K; pc += bk.kc) {
+            const std::int64_t kc   = min_i<std::int64_t>(K - pc, bk.kc);
+            const bool         last = pc + kc >= K;
+            pack_A_mr<TA, MR, Ld>(A + ic * rsa + pc * csa, rsa, csa, mc, kc, A_pack);
 
-    if (N_main < N) {
-        scalar_gemm_add<TA, TC>(M, K, N - N_main, A, lda, B + N_main, ldb, C + N_main, ldc);
+            const TA* B_blk = B_full + (jc - n0) * K + pc * nc;
+            for (std::int64_t jr = jb; jr < je; jr += NR) {
+                const TA*          Bp   = B_blk + (jr / NR) * kc * NR;
+                const std::int64_t cols = min_i<std::int64_t>(je - jr, NR);
+                for (std::int64_t ir = 0; ir < mc; ir += MR) {
+                    const TA*          Ap   = A_pack + (ir / MR) * kc * MR;
+                    const std::int64_t rows = min_i<std::int64_t>(mc - ir, MR);
+                    gemm_tile<TA, TC, MR, NR>(micro, Ap, Bp, kc, C + (ic + ir) * ldc + (jc + jr), ldc, rows, cols, ic + ir, jc + jr, last, epi);
+                }
+            }
+        }
     }
-    if (M_main < M && N_main > 0) {
-        scalar_gemm_add<TA, TC>(M - M_main, K, N_main, A + M_main * lda, lda, B, ldb, C + M_main * ldc, ldc);
+}
+
+// 二维划分：row_tasks 个行任务、panels 个 NR 列条带、workers 个执行槽时选取列组数 g。
+// 每个任务的代价 ≈ 本组列条带数 + 1（A 块按列组重复 pack，约合一个条带的开销），
+// parallel_for 按 workers 等分任务，完工时间 ≈ ceil(row_tasks * g / workers) × 单任务代价；
+// 取代价最小的 g，相同时取较小者（少切列即少重复 pack A）。
+inline auto gemm_col_groups(std::int64_t row_tasks, std::int64_t panels, std::int64_t workers) -> std::int64_t
+{
+    if (workers <= 1 || panels <= 1)
+        return 1;
+    const std::int64_t g_max     = min_i<std::int64_t>(panels, 2 * workers);
+    std::int64_t       best      = 1;
+    std::int64_t       best_cost = -1;
+    for (std::int64_t g = 1; g <= g_max; ++g) {
+        const std::int64_t waves = (row_tasks * g + workers - 1) / workers;
+        const std::int64_t cost  = waves * ((panels + g - 1) / g + 1);
+        if (best_cost < 0 || cost < best_cost) {
+            best      = g;
+            best_cost = cost;
+        }
     }
+    return best;
+}
+
+// 共享执行器：A[b] 为 [M,K] slice（各 slice 共用行 / 列步长 rsa / csa），C[b] 为连续 [M, N]。
+// B_full[b] 为第 b 个 slice 在列区间 [n0, n1) 上的 pack（n0 为 NC 整数倍；n0 = 0、n1 = N 即整块 pack），
+// 本次只计算 C[b] 的这些列。任务 = batch × ic 块 × 列组；行方向任务不足以喂满 worker 时（小 M）再沿 N 切列组。
+// 边界 tile（M 余数行、N 余数列）随所在的行块 / 列组一起划分，不再串行补算。
+// epi 的行列坐标以单个 slice 为准（融合入口只以 batch == 1 调用）。
+template <typename TA, typename TC, int MR, int NR, typename Ld = PackCopy<TA>, typename MicroK, typename Epi = NoEpilogue>
+inline auto gemm_run_packed_b(
+    std::int64_t                   batch,
+    std::int64_t                   M,
+    std::int64_t                   K,
+    std::int64_t                   N,
+    std::int64_t                   n0,
+    std::int64_t                   n1,
+    const typename Ld::Src* const* A,
+    std::int64_t                   rsa,
+    std::int64_t                   csa,
+    const TA* const*               B_full,
+    TC* const*                     C,
+    MicroK                         micro,
+    const Epi&                     epi = {}
+) -> void
+{
+    const GemmBlocking& bk  = gemm_blocking<TA, MR, NR>();
+    const std::int64_t  ldc = N;
+    const bool          par = batch * M * K * N >= kGemmParallelFlops;
+
+    const std::int64_t num_ic_chunks = (M + bk.mc - 1) / bk.mc;
+    const std::int64_t row_tasks     = batch * num_ic_chunks;
+    const std::int64_t panels        = (n1 - n0 + NR - 1) / NR;
+    std::int64_t       num_groups    = 1;
+    if (par)
+        num_groups = gemm_col_groups(row_tasks, panels, static_cast<std::int64_t>(::bee::parallel::available_parallelism()));
+    const std::int64_t group_panels = std::max<std::int64_t>(1, (panels + num_groups - 1) / num_groups);
+    num_groups                      = std::max<std::int64_t>(1, (panels + group_panels - 1) / group_panels);
+
+    auto run = [&](std::size_t lo, std::size_t hi) {
+        TA* A_pack = static_cast<TA*>(thread_local_a_pack_buffer(static_cast<std::size_t>(bk.mc * bk.kc) * sizeof(TA)));
+        for (std::size_t t = lo; t < hi; ++t) {
+            const std::int64_t g  = static_cast<std::int64_t>(t) % num_groups;
+            const std::int64_t r  = static_cast<std::int64_t>(t) / num_groups;
+            const std::int64_t b  = r / num_ic_chunks;
+            const std::int64_t ic = (r % num_ic_chunks) * bk.mc;
+            const std::int64_t mc = min_i<std::int64_t>(M - ic, bk.mc);
+            const std::int64_t j0 = min_i<std::int64_t>(n1, n0 + g * group_panels * NR);
+            const std::int64_t j1 = min_i<std::int64_t>(n1, j0 + group_panels * NR);
+            if (j1 > j0)
+                gemm_block_packed_b<TA, TC, MR, NR, Ld>(bk, ic, mc, j0, j1, n0, K, N, A[b], rsa, csa, B_full[b], C[b], ldc, A_pack, micro, epi);
+        }
+    };
+
+    const auto tasks = static_cast<std::size_t>(row_tasks * num_groups);
+    if (par)
+        ::bee::parallel::parallel_for(std::size_t{0}, tasks, std::size_t{1}, run);
+    else
+        run(0, tasks);
+}
+
+// 预打包 B 的 driver：B_full 为 pack_B_full 的结果，整个调用不再触碰 B 的原始布局
+template <typename TA, typename TC, int MR, int NR, typename MicroK, typename Epi = NoEpilogue>
+inline auto gemm_driver_prepacked(
+    std::int64_t M,
+    std::int64_t K,
+    std::int64_t N,
+    const TA*    A,
+    std::int64_t rsa,
+    std::int64_t csa,
+    const TA*    B_full,
+    TC*          C,
+    MicroK       micro,
+    const Epi&   epi = {}
+) -> void
+{
+    if (M == 0 || N == 0 || K == 0)
+        return;
+    gemm_run_packed_b<TA, TC, MR, NR>(1, M, K, N, 0, N, &A, rsa, csa, &B_full, &C, micro, epi);
 }
 
-// 通用 driver：超过并行阈值时在 ic 方向走 parallel_for，每个 worker 用 thread_local
-// A_pack；否则退化到 serial 版本避免 fork-join 开销。
-template <typename TA, typename TC, int MR, int NR, int MC, int KC, int NC, typename MicroK>
-inline auto gemm_driver(std::int64_t M, std::int64_t K, std::int64_t N, const TA* A, const TA* B, TC* C, MicroK micro) -> void
+// 融合 driver：b_packed 为 false 时 B（任意步长）逐个 NC 列分片 pack 到 K × NC 的临时缓冲，每片与预打包路径共用执行器
+// b_packed 时 B 已是 TA 的整块 pack，仅默认加载策略可用
+template <typename TA, typename TC, int MR, int NR, typename Ld = PackCopy<TA>, typename MicroK, typename Epi>
+inline auto gemm_driver_fused(
+    std::int64_t            M,
+    std::int64_t            K,
+    std::int64_t            N,
+    const typename Ld::Src* A,
+    std::int64_t            rsa,
+    std::int64_t            csa,
+    const typename Ld::Src* B,
+    std::int64_t            rsb,
+    std::int64_t            csb,
+    bool                    b_packed,
+    TC*                     C,
+    MicroK                  micro,
+    const Epi&              epi
+) -> void
 {
-    // 并行阈值判定
-    if (M * K * N < kGemmParallelFlops) {
-        gemm_driver_serial<TA, TC, MR, NR, MC, KC, NC>(M, K, N, A, B, C, micro);
+    if (M == 0 || N == 0 || K == 0)
         return;
+    if constexpr (std::is_same_v<Ld, PackCopy<TA>>) {
+        if (b_packed) {
+            gemm_run_packed_b<TA, TC, MR, NR>(1, M, K, N, 0, N, &A, rsa, csa, &B, &C, micro, epi);
+            return;
+        }
+    }
+    const GemmBlocking& bk   = gemm_blocking<TA, MR, NR>();
+    const std::int64_t  slab = min_i<std::int64_t>((N + NR - 1) / NR * NR, bk.nc);
+    AlignedBuffer       b_pack_buf(static_cast<std::size_t>(K * slab) * sizeof(TA), 64);
+    TA*                 B_slab = b_pack_buf.template as<TA>();
+    const TA*           Bs     = B_slab;
+    for (std::int64_t n0 = 0; n0 < N; n0 += bk.nc) {
+        const std::int64_t w = min_i<std::int64_t>(N - n0, bk.nc);
+        pack_B_full<TA, MR, NR, Ld>(B + n0 * csb, rsb, csb, K, w, B_slab);
+        gemm_run_packed_b<TA, TC, MR, NR, Ld>(1, M, K, N, n0, n0 + w, &A, rsa, csa, &Bs, &C, micro, epi);
     }
+}
 
-    const std::int64_t lda    = K;
-    const std::int64_t ldb    = N;
-    const std::int64_t ldc    = N;
-    const std::int64_t M_main = (M / MR) * MR;
-    const std::int64_t N_main = (N / NR) * NR;
+// ── 隐式 B（卷积的 implicit im2col）──────────────────────────────────────
+// 整块 pack A（各 (pc, ic) 块依次排布：块起点 = pc * M_pad + ic * kc，M_pad 为 M 向上取整到 MR）
+template <typename TA, int MR>
+inline auto pack_A_full(const GemmBlocking& bk, const TA* A, std::int64_t rsa, std::int64_t csa, std::int64_t M, std::int64_t K, TA* dst) -> void
+{
+    const std::int64_t M_pad = (M + MR - 1) / MR * MR;
+    for (std::int64_t pc = 0; pc < K; pc += bk.kc) {
+        const std::int64_t kc = min_i<std::int64_t>(K - pc, bk.kc);
+        for (std::int64_t ic = 0; ic < M; ic += bk.mc)
+            pack_A_mr<TA, MR>(A + ic * rsa + pc * csa, rsa, csa, min_i<std::int64_t>(M - ic, bk.mc), kc, dst + pc * M_pad + ic * kc);
+    }
+}
 
-    AlignedBuffer b_pack_buf(static_cast<std::size_t>(KC) * NC * sizeof(TA), 64);
-    TA*           B_pack = b_pack_buf.template as<TA>();
+// batch 个 GEMM：C[b]（C + b*M*N 处的连续 [M, N]）+= A[b % na] × B[b]。
+// B 不以矩阵形式存在：pack_b(b, pc, kc, j, cols, dst) 直接生成 B[b] 在 [pc, pc+kc) × [j, j+cols) 上的一个
+// [kc × NR] 条带（cols < NR 时补零，布局同 pack_B_nr）。na 份 A 先整块 pack 一次，随后
+// 任务 = batch × 列块，每个任务在线程私有缓冲里逐 KC 生成本列块的 B panel，整个调用从不物化完整的 B。
+// 小 batch 且并行时收窄列块，使任务数不少于 2 × worker。C 由调用方初始化（例如预填 bias）。
+template <typename TA, typename TC, int MR, int NR, typename MicroK, typename PackB>
+inline auto gemm_driver_implicit_b(
+    std::int64_t     batch,
+    std::int64_t     M,
+    std::int64_t     K,
+    std::int64_t     N,
+    const TA* const* A,
+    std::int64_t     na,
+    std::int64_t     rsa,
+    std::int64_t     csa,
+    const PackB&     pack_b,
+    TC*              C,
+    MicroK           micro
+) -> void
+{
+    if (batch == 0 || M == 0 || N == 0 || K == 0)
+        return;
+    const GemmBlocking& bk    = gemm_blocking<TA, MR, NR>();
+    const std::int64_t  M_pad = (M + MR - 1) / MR * MR;
+
+    AlignedBuffer a_pack_buf(static_cast<std::size_t>(na * M_pad * K) * sizeof(TA), 64);
+    TA*           A_full = a_pack_buf.template as<TA>();
+    for (std::int64_t a = 0; a < na; ++a)
+        pack_A_full<TA, MR>(bk, A[a], rsa, csa, M, K, A_full + a * M_pad * K);
 
-    // M_main 方向按 MC 切 chunk；每个 chunk 一个 worker 负责，内部复用 thread_local A_pack
-    const std::int64_t num_ic_chunks = (M_main + MC - 1) / MC;
-
-    for (std::int64_t jc = 0; jc < N_main; jc += NC) {
-        const std::int64_t nc = min_i<std::int64_t>(N_main - jc, NC);
-        for (std::int64_t pc = 0; pc < K; pc += KC) {
-            const std::int64_t kc = min_i<std::int64_t>(K - pc, KC);
-            // 串行 pack B（共享）
-            pack_B_nr<TA, NR>(B + pc * ldb + jc, ldb, kc, nc, B_pack);
-
-            // 并行 ic 循环：grain=1（1 chunk/worker），num_ic_chunks 通常 6-16
-            ::bee::parallel::parallel_for(
-                std::size_t{0}, static_cast<std::size_t>(num_ic_chunks), std::size_t{1}, [&](std::size_t lo, std::size_t hi) {
-                    TA* A_pack = static_cast<TA*>(thread_local_a_pack_buffer());
-                    for (std::size_t ci = lo; ci < hi; ++ci) {
-                        const std::int64_t ic = static_cast<std::int64_t>(ci) * MC;
-                        const std::int64_t mc = min_i<std::int64_t>(M_main - ic, MC);
-                        pack_A_mr<TA, MR>(A + ic * lda + pc, lda, mc, kc, A_pack);
-
-                        for (std::int64_t jr = 0; jr < nc; jr += NR) {
-                            const TA* Bp = B_pack + (jr / NR) * kc * NR;
-                            for (std::int64_t ir = 0; ir < mc; ir += MR) {
-                                const TA* Ap = A_pack + (ir / MR) * kc * MR;
-                                micro(Ap, Bp, kc, C + (ic + ir) * ldc + (jc + jr), ldc);
-                            }
+    const bool         par         = batch * M * K * N >= kGemmParallelFlops;
+    const std::int64_t panels      = (N + NR - 1) / NR;
+    std::int64_t       tile_panels = std::max<std::int64_t>(1, bk.nc / NR);
+    if (par) {
+        const auto         workers = static_cast<std::int64_t>(::bee::parallel::available_parallelism());
+        const std::int64_t want    = (2 * workers + batch - 1) / batch;
+        tile_panels                = min_i<std::int64_t>(tile_panels, std::max<std::int64_t>(1, (panels + want - 1) / want));
+    }
+    const std::int64_t tiles = (panels + tile_panels - 1) / tile_panels;
+
+    auto run = [&](std::size_t lo, std::size_t hi) {
+        AlignedBuffer b_pack_buf(static_cast<std::size_t>(bk.kc * tile_panels * NR) * sizeof(TA), 64);
+        TA*           B_pack = b_pack_buf.template as<TA>();
+        for (std::size_t t = lo; t < hi; ++t) {
+            const std::int64_t b  = static_cast<std::int64_t>(t) / tiles;
+            const std::int64_t j0 = (static_cast<std::int64_t>(t) % tiles) * tile_panels * NR;
+            const std::int64_t j1 = min_i<std::int64_t>(N, j0 + tile_panels * NR);
+            const TA*          Ab = A_full + (b % na) * M_pad * K;
+            TC*                Cb = C + b * M * N;
+            for (std::int64_t pc = 0; pc < K; pc += bk.kc) {
+                const std::int64_t kc = min_i<std::int64_t>(K - pc, bk.kc);
+                for (std::int64_t j = j0; j < j1; j += NR)
+                    pack_b(b, pc, kc, j, min_i<std::int64_t>(j1 - j, NR), B_pack + ((j - j0) / NR) * kc * NR);
+
+                for (std::int64_t ic = 0; ic < M; ic += bk.mc) {
+                    const std::int64_t mc    = min_i<std::int64_t>(M - ic, bk.mc);
+                    const TA*          A_blk = Ab + pc * M_pad + ic * kc;
+                    for (std::int64_t jr = 0; jr < j1 - j0; jr += NR) {
+                        const TA*          Bp   = B_pack + (jr / NR) * kc * NR;
+                        const std::int64_t cols = min_i<std::int64_t>(j1 - j0 - jr, NR);
+                        for (std::int64_t ir = 0; ir < mc; ir += MR) {
+                            const TA*          Ap   = A_blk + (ir / MR) * kc * MR;
+                            const std::int64_t rows = min_i<std::int64_t>(mc - ir, MR);
+                            gemm_tile<TA, TC, MR, NR>(
+                                micro, Ap, Bp, kc, Cb + (ic + ir) * N + (j0 + jr), N, rows, cols, ic + ir, j0 + jr, false, NoEpilogue{}
+                            );
                         }
                     }
                 }
-            );
+            }
+        }
+    };
+
+    const auto tasks = static_cast<std::size_t>(batch * tiles);
+    if (par)
+        ::bee::parallel::parallel_for(std::size_t{0}, tasks, std::size_t{1}, run);
+    else
+        run(0, tasks);
+}
+
+// ── 窄形状（GEMV / M ≤ MR）────────────────────────────────────────────────
+// 不 pack，直接以 GemvCommon 的 dot / axpy 内核流式读取一遍 B（或 A）。
+enum class SkinnyKind
+{
+    None,
+    DotA,   // N == 1，A 行主序：C[i] = A[i, :] · b
+    AxpyB,  // M ≤ MR，B 行主序：C[r, :] = Σ_k A[r, k] · B[k, :]
+    DotB,   // M == 1，B 为转置视图：C[j] = a · B[:, j]
+    AxpyAT, // N == 1，A 为转置视图：C = Σ_k b[k] · A[:, k]
+};
+
+inline auto skinny_kind(
+    std::int64_t M,
+    std::int64_t N,
+    int          MR,
+    std::int64_t rsa,
+    std::int64_t csa,
+    std::int64_t rsb,
+    std::int64_t csb
+) -> SkinnyKind
+{
+    if (N == 1 && csa == 1 && rsb == 1)
+        return SkinnyKind::DotA;
+    if (M <= MR && csb == 1)
+        return SkinnyKind::AxpyB;
+    if (M == 1 && rsb == 1 && csa == 1)
+        return SkinnyKind::DotB;
+    if (N == 1 && rsa == 1)
+        return SkinnyKind::AxpyAT;
+    return SkinnyKind::None;
+}
+
+// 窄形状 driver：par 为 true 时按输出行（dot）或 64 列一段（axpy）切分，各段独立读取自己那部分输入
+// TS 为 A / B 的存储类型，T 为累加 / 输出类型（F16 / BF16 输入时 TS ≠ T，由 Vec::load 展开）
+template <typename Vec, int MR, typename TS, typename T>
+inline auto gemm_skinny(
+    SkinnyKind   kind,
+    std::int64_t M,
+    std::int64_t K,
+    std::int64_t N,
+    const TS*    A,
+    std::int64_t rsa,
+    std::int64_t csa,
+    const TS*    B,
+    std::int64_t rsb,
+    std::int64_t csb,
+    T*           C,
+    bool         par
+) -> void
+{
+    constexpr std::int64_t kColBlock = 64;
+
+    // dot：rows 行（行距 ldr）各与 x 做点积，写入 C[0..rows)
+    auto dot = [&](std::int64_t rows, const TS* R, std::int64_t ldr, const TS* x) {
+        auto run = [&](std::size_t lo, std::size_t hi) {
+            const auto r0 = static_cast<std::int64_t>(lo);
+            gemv_dot_rows<Vec>(static_cast<std::int64_t>(hi) - r0, K, R + r0 * ldr, ldr, x, C + r0, 1);
+        };
+        if (par)
+            ::bee::parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(rows), std::size_t{4}, run);
+        else
+            run(0, static_cast<std::size_t>(rows));
+    };
+    // axpy：C[r, 0..cols) += Σ_k X[r, k] · Y[k, 0..cols)，按 64 列一段切分
+    auto axpy = [&](std::int64_t rows, std::int64_t cols, const TS* X, std::int64_t rsx, std::int64_t csx, const TS* Y, std::int64_t ldy) {
+        auto run = [&](std::size_t lo, std::size_t hi) {
+            const std::int64_t j0 = static_cast<std::int64_t>(lo) * kColBlock;
+            const std::int64_t j1 = min_i<std::int64_t>(cols, static_cast<std::int64_t>(hi) * kColBlock);
+            gemv_axpy_rows_n<Vec, MR>(rows, K, j1 - j0, X, rsx, csx, Y + j0, ldy, C + j0, cols);
+        };
+        const auto blocks = static_cast<std::size_t>((cols + kColBlock - 1) / kColBlock);
+        if (par)
+            ::bee::parallel::parallel_for(std::size_t{0}, blocks, std::size_t{1}, run);
+        else
+            run(0, blocks);
+    };
+
+    switch (kind) {
+    case SkinnyKind::DotA: dot(M, A, rsa, B); break;
+    case SkinnyKind::AxpyB: axpy(M, N, A, rsa, csa, B, rsb); break;
+    case SkinnyKind::DotB: dot(N, B, csb, A); break;
+    case SkinnyKind::AxpyAT: axpy(1, M, B, 0, rsb, A, csa); break;
+    case SkinnyKind::None: break;
+    }
+}
+
+// 通用 driver：低于并行阈值或只有单个 worker 时走 serial 版本；否则逐个 NC 列分片由全部 worker 协同 pack，
+// 再在 ic 行块 × 列组网格上单次 parallel_for（见 gemm_col_groups），小 M 大 N 也能铺满所有核。
+// A / B 可为任意步长的视图（行主序时 rsa = K, csa = 1；转置时 rsa = 1），C 为连续 [M, N]。
+// Vec 非 void 时（浮点），M ≤ MR 或 N == 1 的窄形状改走 gemm_skinny。
+template <typename TA, typename TC, int MR, int NR, typename Vec = void, typename Ld = PackCopy<TA>, typename MicroK>
+inline auto gemm_driver(
+    std::int64_t            M,
+    std::int64_t            K,
+    std::int64_t            N,
+    const typename Ld::Src* A,
+    std::int64_t            rsa,
+    std::int64_t            csa,
+    const typename Ld::Src* B,
+    std::int64_t            rsb,
+    std::int64_t            csb,
+    TC*                     C,
+    MicroK                  micro
+) -> void
+{
+    if constexpr (!std::is_void_v<Vec>) {
+        if (const auto kind = skinny_kind(M, N, MR, rsa, csa, rsb, csb); kind != SkinnyKind::None) {
+            const bool par = M * K * N >= kGemmParallelFlops;
+            gemm_skinny<Vec, MR>(kind, M, K, N, A, rsa, csa, B, rsb, csb, C, par);
+            return;
+        }
+    }
+    // 单 worker 时整块 pack 只会多一次 B 的读写，逐 (jc, pc) 块 pack 的缓存局部性更好
+    if (M * K * N < kGemmParallelFlops || ::bee::parallel::available_parallelism() <= 1) {
+        gemm_driver_serial<TA, TC, MR, NR, Ld>(M, K, N, A, rsa, csa, B, rsb, csb, C, micro);
+        return;
+    }
+    gemm_driver_fused<TA, TC, MR, NR, Ld>(M, K, N, A, rsa, csa, B, rsb, csb, false, C, micro, NoEpilogue{});
+}
+
+// 批量 driver：A[b] 为 [M,K]、B[b] 为 [K,N] 的 slice（各 slice 共用同一组行 / 列步长），C 为连续 [batch, M, N]。
+// B 指针相同的 batch 共享同一份 pack（广播 B 只 pack 一次）；逐 NC 列分片处理，每轮 pack 若干个不同 slice
+// 的该分片（缓冲不超过 max(K × NC, kGemmPackBudgetElems)），再在这些 slice 的 batch × ic 块（× 列组）上
+// 展开为单次 parallel_for，避免逐 slice fork-join。
+// Vec 非 void 时窄形状逐 slice 走 gemm_skinny：batch 足以喂满 worker 时沿 batch 并行，否则 slice 内并行。
+template <typename TA, typename TC, int MR, int NR, typename Vec = void, typename Ld = PackCopy<TA>, typename MicroK>
+inline auto gemm_driver_batched(
+    std::int64_t                   batch,
+    std::int64_t                   M,
+    std::int64_t                   K,
+    std::int64_t                   N,
+    const typename Ld::Src* const* A,
+    std::int64_t                   rsa,
+    std::int64_t                   csa,
+    const typename Ld::Src* const* B,
+    std::int64_t                   rsb,
+    std::int64_t                   csb,
+    TC*                            C,
+    MicroK                         micro
+) -> void
+{
+    using S = typename Ld::Src;
+
+    if (batch <= 0 || M == 0 || N == 0 || K == 0)
+        return;
+
+    if constexpr (!std::is_void_v<Vec>) {
+        if (const auto kind = skinny_kind(M, N, MR, rsa, csa, rsb, csb); kind != SkinnyKind::None) {
+            const bool par_batch = batch >= static_cast<std::int64_t>(::bee::parallel::available_parallelism());
+            const bool par       = batch * M * K * N >= kGemmParallelFlops;
+            auto       run       = [&](std::size_t lo, std::size_t hi) {
+                for (std::size_t b = lo; b < hi; ++b)
+                    gemm_skinny<Vec, MR>(kind, M, K, N, A[b], rsa, csa, B[b], rsb, csb, C + static_cast<std::int64_t>(b) * M * N, par && !par_batch);
+            };
+            if (par && par_batch)
+                ::bee::parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(batch), std::size_t{1}, run);
+            else
+                run(0, static_cast<std::size_t>(batch));
+            return;
         }
     }
 
-    // 尾巴处理（单线程即可，占比 < 1%）
-    if (N_main < N) {
-        scalar_gemm_add<TA, TC>(M, K, N - N_main, A, lda, B + N_main, ldb, C + N_main, ldc);
+    // B slice 去重：同一指针只 pack 一次
+    std::vector<const S*>                      uniq_b;
+    std::vector<std::int64_t>                  slot(static_cast<std::size_t>(batch));
+    std::unordered_map<const S*, std::int64_t> seen;
+    for (std::int64_t b = 0; b < batch; ++b) {
+        auto [it, inserted] = seen.try_emplace(B[b], static_cast<std::int64_t>(uniq_b.size()));
+        if (inserted)
+            uniq_b.push_back(B[b]);
+        slot[static_cast<std::size_t>(b)] = it->second;
     }
-    if (M_main < M && N_main > 0) {
-        scalar_gemm_add<TA, TC>(M - M_main, K, N_main, A + M_main * lda, lda, B, ldb, C + M_main * ldc, ldc);
+
+    const GemmBlocking& bk         = gemm_blocking<TA, MR, NR>();
+    const std::int64_t  slab_elems = K * min_i<std::int64_t>((N + NR - 1) / NR * NR, bk.nc);
+    const std::int64_t  num_uniq   = static_cast<std::int64_t>(uniq_b.size());
+    const std::int64_t  per_pass   = std::clamp<std::int64_t>(kGemmPackBudgetElems / slab_elems, 1, num_uniq);
+    AlignedBuffer       b_pack_buf(static_cast<std::size_t>(per_pass * slab_elems) * sizeof(TA), 64);
+    TA*                 B_pack = b_pack_buf.template as<TA>();
+
+    std::vector<const S*>  A_pass;
+    std::vector<const TA*> B_pass;
+    std::vector<TC*>       C_pass;
+    for (std::int64_t n0 = 0; n0 < N; n0 += bk.nc) {
+        const std::int64_t w      = min_i<std::int64_t>(N - n0, bk.nc);
+        const std::int64_t strips = (w + NR - 1) / NR;
+        for (std::int64_t u0 = 0; u0 < num_uniq; u0 += per_pass) {
+            const std::int64_t u1 = min_i<std::int64_t>(num_uniq, u0 + per_pass);
+
+            // 本轮各 slice 的打包任务合并为一次 parallel_for
+            auto pack = [&](std::size_t lo, std::size_t hi) {
+                for (std::size_t t = lo; t < hi; ++t) {
+                    const std::int64_t u  = static_cast<std::int64_t>(t) / strips;
+                    const std::int64_t p  = static_cast<std::int64_t>(t) % strips;
+                    const S*           Bu = uniq_b[static_cast<std::size_t>(u0 + u)] + n0 * csb;
+                    pack_B_full_task<TA, NR, Ld>(bk, Bu, rsb, csb, K, w, p, B_pack + u * slab_elems);
+                }
+            };
+            const auto pack_tasks = static_cast<std::size_t>((u1 - u0) * strips);
+            if ((u1 - u0) * K * w >= kGemmPackParallelElems)
+                ::bee::parallel::parallel_for(std::size_t{0}, pack_tasks, std::size_t{1}, pack);
+            else
+                pack(0, pack_tasks);
+
+            A_pass.clear();
+            B_pass.clear();
+            C_pass.clear();
+            for (std::int64_t b = 0; b < batch; ++b) {
+                const std::int64_t u = slot[static_cast<std::size_t>(b)];
+                if (u < u0 || u >= u1)
+                    continue;
+                A_pass.push_back(A[b]);
+                B_pass.push_back(B_pack + (u - u0) * slab_elems);
+                C_pass.push_back(C + b * M * N);
+            }
+            const auto count = static_cast<std::int64_t>(A_pass.size());
+            gemm_run_packed_b<TA, TC, MR, NR, Ld>(count, M, K, N, n0, n0 + w, A_pass.data(), rsa, csa, B_pass.data(), C_pass.data(), micro);
+        }
     }
 }
 
@@ -6,11 +6,21 @@
  *
  * 标量兜底 GEMM：朴素 i-k-j 三重循环 + 分块，不依赖任何 SIMD。
  * 对非 SSE2 机器以及单元测试基线提供可参考实现。
+ * 预打包布局即 B 的行主序副本；A / B 均可为任意步长的视图。
+ * 量化 GEMM 例外：沿用 QGemmCommon.hpp 的分组布局与参考微内核。
  */
 
+#include "Tensor/Cpu/Gemm/AttentionCommon.hpp"
+#include "Tensor/Cpu/Gemm/ConvCommon.hpp"
 #include "Tensor/Cpu/Gemm/GemmDispatch.hpp"
+#include "Tensor/Cpu/Gemm/QGemmCommon.hpp"
+#include "Base/Parallel/ParallelFor.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <vector>
 
 namespace bee::cpu::gemm::scalar
 {
@@ -18,39 +28,502 @@ namespace bee::cpu::gemm::scalar
 namespace
 {
 
+    // A / B 以 (行步长, 列步长) 寻址，C 为行主序 [M, N]
     template <typename TA, typename TC>
-    inline auto mm_kernel_ikj(std::int64_t M, std::int64_t K, std::int64_t N, const TA* A, const TA* B, TC* C) -> void
+    inline auto mm_kernel_ikj(
+        std::int64_t M,
+        std::int64_t K,
+        std::int64_t N,
+        const TA*    A,
+        std::int64_t rsa,
+        std::int64_t csa,
+        const TA*    B,
+        std::int64_t rsb,
+        std::int64_t csb,
+        TC*          C
+    ) -> void
     {
         for (std::int64_t i = 0; i < M; ++i) {
             for (std::int64_t k = 0; k < K; ++k) {
-                const TC a_ik = static_cast<TC>(A[i * K + k]);
+                const TC a_ik = static_cast<TC>(A[i * rsa + k * csa]);
                 for (std::int64_t j = 0; j < N; ++j) {
-                    C[i * N + j] += a_ik * static_cast<TC>(B[k * N + j]);
+                    C[i * N + j] += a_ik * static_cast<TC>(B[k * rsb + j * csb]);
                 }
             }
         }
     }
 
+    // 批量版本：逐 slice 朴素内核，跨 batch 并行
+    template <typename TA, typename TC>
+    inline auto mm_batched_ikj(
+        std::int64_t     batch,
+        std::int64_t     M,
+        std::int64_t     K,
+        std::int64_t     N,
+        const TA* const* A,
+        std::int64_t     rsa,
+        std::int64_t     csa,
+        const TA* const* B,
+        std::int64_t     rsb,
+        std::int64_t     csb,
+        TC*              C
+    ) -> void
+    {
+        ::bee::parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(batch), std::size_t{1}, [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t b = lo; b < hi; ++b)
+                mm_kernel_ikj<TA, TC>(M, K, N, A[b], rsa, csa, B[b], rsb, csb, C + static_cast<std::int64_t>(b) * M * N);
+        });
+    }
+
+    // 预打包：复制为行主序 [K, N]
+    template <typename T>
+    inline auto pack_rows(std::int64_t K, std::int64_t N, const T* B, std::int64_t rsb, std::int64_t csb, T* dst) -> void
+    {
+        for (std::int64_t k = 0; k < K; ++k) {
+            if (csb == 1) {
+                std::memcpy(dst + k * N, B + k * rsb, static_cast<std::size_t>(N) * sizeof(T));
+                continue;
+            }
+            for (std::int64_t j = 0; j < N; ++j)
+                dst[k * N + j] = B[k * rsb + j * csb];
+        }
+    }
+
+    // 融合 epilogue：逐行累加完整 K 后一次性写回
+    template <typename T>
+    inline auto mm_fused_rows(
+        std::int64_t           M,
+        std::int64_t           K,
+        std::int64_t           N,
+        const T*               A,
+        std::int64_t           rsa,
+        std::int64_t           csa,
+        const T*               B,
+        std::int64_t           rsb,
+        std::int64_t           csb,
+        T*                     C,
+        const GemmEpilogue<T>& ep
+    ) -> void
+    {
+        std::vector<T> acc(static_cast<std::size_t>(N));
+        for (std::int64_t i = 0; i < M; ++i) {
+            std::fill(acc.begin(), acc.end(), T{0});
+            for (std::int64_t k = 0; k < K; ++k) {
+                const T a_ik = A[i * rsa + k * csa];
+                for (std::int64_t j = 0; j < N; ++j)
+                    acc[static_cast<std::size_t>(j)] += a_ik * B[k * rsb + j * csb];
+            }
+            for (std::int64_t j = 0; j < N; ++j)
+                ep.apply(C[i * N + j], acc[static_cast<std::size_t>(j)], i, j, true);
+        }
+    }
+
 } // namespace
 
-auto gemm_f32(std::int64_t M, std::int64_t K, std::int64_t N, const float* A, const float* B, float* C) -> void
+auto gemm_f32(
+    std::int64_t M,
+    std::int64_t K,
+    std::int64_t N,
+    const float* A,
+    std::int64_t rsa,
+    std::int64_t csa,
+    const float* B,
+    std::int64_t rsb,
+    std::int64_t csb,
+    float*       C
+) -> void
+{
+    mm_kernel_ikj<float, float>(M, K, N, A, rsa, csa, B, rsb, csb, C);
+}
+
+auto gemm_f64(
+    std::int64_t  M,
+    std::int64_t  K,
+    std::int64_t  N,
+    const double* A,
+    std::int64_t  rsa,
+    std::int64_t  csa,
+    const double* B,
+    std::int64_t  rsb,
+    std::int64_t  csb,
+    double*       C
+) -> void
+{
+    mm_kernel_ikj<double, double>(M, K, N, A, rsa, csa, B, rsb, csb, C);
+}
+
+auto gemm_i32(
+    std::int64_t        M,
+    std::int64_t        K,
+    std::int64_t        N,
+    const std::int32_t* A,
+    std::int64_t        rsa,
+    std::int64_t        csa,
+    const std::int32_t* B,
+    std::int64_t        rsb,
+    std::int64_t        csb,
+    std::int32_t*       C
+) -> void
+{
+    mm_kernel_ikj<std::int32_t, std::int32_t>(M, K, N, A, rsa, csa, B, rsb, csb, C);
+}
+
+auto gemm_i8_i32(
+    std::int64_t       M,
+    std::int64_t       K,
+    std::int64_t       N,
+    const std::int8_t* A,
+    std::int64_t       rsa,
+    std::int64_t       csa,
+    const std::int8_t* B,
+    std::int64_t       rsb,
+    std::int64_t       csb,
+    std::int32_t*      C
+) -> void
+{
+    mm_kernel_ikj<std::int8_t, std::int32_t>(M, K, N, A, rsa, csa, B, rsb, csb, C);
+}
+
+auto gemm_f16_f32(
+    std::int64_t M,
+    std::int64_t K,
+    std::int64_t N,
+    const Half*  A,
+    std::int64_t rsa,
+    std::int64_t csa,
+    const Half*  B,
+    std::int64_t rsb,
+    std::int64_t csb,
+    float*       C
+) -> void
+{
+    mm_kernel_ikj<Half, float>(M, K, N, A, rsa, csa, B, rsb, csb, C);
+}
+
+auto gemm_bf16_f32(
+    std::int64_t    M,
+    std::int64_t    K,
+    std::int64_t    N,
+    const BFloat16* A,
+    std::int64_t    rsa,
+    std::int64_t    csa,
+    const BFloat16* B,
+    std::int64_t    rsb,
+    std::int64_t    csb,
+    float*          C
+) -> void
+{
+    mm_kernel_ikj<BFloat16, float>(M, K, N, A, rsa, csa, B, rsb, csb, C);
+}
+
+auto gemm_batched_f32(
+    std::int64_t        batch,
+    std::int64_t        M,
+    std::int64_t        K,
+    std::int64_t        N,
+    const float* const* A,
+    std::int64_t        rsa,
+    std::int64_t        csa,
+    const float* const* B,
+    std::int64_t        rsb,
+    std::int64_t        csb,
+    float*              C
+) -> void
+{
+    mm_batched_ikj<float, float>(batch, M, K, N, A, rsa, csa, B, rsb, csb, C);
+}
+
+auto gemm_batched_f64(
+    std::int64_t         batch,
+    std::int64_t         M,
+    std::int64_t         K,
+    std::int64_t         N,
+    const double* const* A,
+    std::int64_t         rsa,
+    std::int64_t         csa,
+    const double* const* B,
+    std::int64_t         rsb,
+    std::int64_t         csb,
+    double*              C
+) -> void
+{
+    mm_batched_ikj<double, double>(batch, M, K, N, A, rsa, csa, B, rsb, csb, C);
+}
+
+auto gemm_batched_i32(
+    std::int64_t               batch,
+    std::int64_t               M,
+    std::int64_t               K,
+    std::int64_t               N,
+    const std::int32_t* const* A,
+    std::int64_t               rsa,
+    std::int64_t               csa,
+    const std::int32_t* const* B,
+    std::int64_t               rsb,
+    std::int64_t               csb,
+    std::int32_t*              C
+) -> void
+{
+    mm_batched_ikj<std::int32_t, std::int32_t>(batch, M, K, N, A, rsa, csa, B, rsb, csb, C);
+}
+
+auto gemm_batched_i8_i32(
+    std::int64_t              batch,
+    std::int64_t              M,
+    std::int64_t              K,
+    std::int64_t              N,
+    const std::int8_t* const* A,
+    std::int64_t              rsa,
+    std::int64_t              csa,
+    const std::int8_t* const* B,
+    std::int64_t              rsb,
+    std::int64_t              csb,
+    std::int32_t*             C
+) -> void
+{
+    mm_batched_ikj<std::int8_t, std::int32_t>(batch, M, K, N, A, rsa, csa, B, rsb, csb, C);
+}
+
+auto gemm_batched_f16_f32(
+    std::int64_t       batch,
+    std::int64_t       M,
+    std::int64_t       K,
+    std::int64_t       N,
+    const Half* const* A,
+    std::int64_t       rsa,
+    std::int64_t       csa,
+    const Half* const* B,
+    std::int64_t       rsb,
+    std::int64_t       csb,
+    float*             C
+) -> void
+{
+    mm_batched_ikj<Half, float>(batch, M, K, N, A, rsa, csa, B, rsb, csb, C);
+}
+
+auto gemm_batched_bf16_f32(
+    std::int64_t           batch,
+    std::int64_t           M,
+    std::int64_t           K,
+    std::int64_t           N,
+    const BFloat16* const* A,
+    std::int64_t           rsa,
+    std::int64_t           csa,
+    const BFloat16* const* B,
+    std::int64_t           rsb,
+    std::int64_t           csb,
+    float*                 C
+) -> void
+{
+    mm_batched_ikj<BFloat16, float>(batch, M, K, N, A, rsa, csa, B, rsb, csb, C);
+}
+
+auto pack_b_f32(
+    std::int64_t K,
+    std::int64_t N,
+    const float* B,
+    std::int64_t rsb,
+    std::int64_t csb,
+    float*       dst
+) -> void
+{
+    pack_rows<float>(K, N, B, rsb, csb, dst);
+}
+
+auto pack_b_f64(
+    std::int64_t  K,
+    std::int64_t  N,
+    const double* B,
+    std::int64_t  rsb,
+    std::int64_t  csb,
+    double*       dst
+) -> void
+{
+    pack_rows<double>(K, N, B, rsb, csb, dst);
+}
+
+auto pack_b_i32(
+    std::int64_t        K,
+    std::int64_t        N,
+    const std::int32_t* B,
+    std::int64_t        rsb,
+    std::int64_t        csb,
+    std::int32_t*       dst
+) -> void
+{
+    pack_rows<std::int32_t>(K, N, B, rsb, csb, dst);
+}
+
+auto pack_b_i8(
+    std::int64_t       K,
+    std::int64_t       N,
+    const std::int8_t* B,
+    std::int64_t       rsb,
+    std::int64_t       csb,
+    std::int8_t*       dst
+) -> void
+{
+    pack_rows<std::int8_t>(K, N, B, rsb, csb, dst);
+}
+
+auto gemm_packed_f32(
+    std::int64_t M,
+    std::int64_t K,
+    std::int64_t N,
+    const float* A,
+    std::int64_t rsa,
+    std::int64_t csa,
+    const float* B_packed,
+    float*       C
+) -> void
+{
+    mm_kernel_ikj<float, float>(M, K, N, A, rsa, csa, B_packed, N, 1, C);
+}
+
+auto gemm_packed_f64(
+    std::int64_t  M,
+    std::int64_t  K,
+    std::int64_t  N,
+    const double* A,
+    std::int64_t  rsa,
+    std::int64_t  csa,
+    const double* B_packed,
+    double*       C
+) -> void
+{
+    mm_kernel_ikj<double, double>(M, K, N, A, rsa, csa, B_packed, N, 1, C);
+}
+
+auto gemm_packed_i32(
+    std::int64_t        M,
+    std::int64_t        K,
+    std::int64_t        N,
+    const std::int32_t* A,
+    std::int64_t        rsa,
+    std::int64_t        csa,
+    const std::int32_t* B_packed,
+    std::int32_t*       C
+) -> void
 {
-    mm_kernel_ikj<float, float>(M, K, N, A, B, C);
+    mm_kernel_ikj<std::int32_t, std::int32_t>(M, K, N, A, rsa, csa, B_packed, N, 1, C);
 }
 
-auto gemm_f64(std::int64_t M, std::int64_t K, std::int64_t N, const double* A, const double* B, double* C) -> void
+auto gemm_packed_i8_i32(
+    std::int64_t       M,
+    std::int64_t       K,
+    std::int64_t       N,
+    const std::int8_t* A,
+    std::int64_t       rsa,
+    std::int64_t       csa,
+    const std::int8_t* B_packed,
+    std::int32_t*      C
+) -> void
+{
+    mm_kernel_ikj<std::int8_t, std::int32_t>(M, K, N, A, rsa, csa, B_packed, N, 1, C);
+}
+
+auto gemm_fused_f32(
+    std::int64_t               M,
+    std::int64_t               K,
+    std::int64_t               N,
+    const float*               A,
+    std::int64_t               rsa,
+    std::int64_t               csa,
+    const float*               B,
+    std::int64_t               rsb,
+    std::int64_t               csb,
+    bool                       b_packed,
+    float*                     C,
+    const GemmEpilogue<float>& ep
+) -> void
+{
+    // 预打包布局即行主序副本
+    if (b_packed) {
+        rsb = N;
+        csb = 1;
+    }
+    mm_fused_rows<float>(M, K, N, A, rsa, csa, B, rsb, csb, C, ep);
+}
+
+auto gemm_fused_f64(
+    std::int64_t                M,
+    std::int64_t                K,
+    std::int64_t                N,
+    const double*               A,
+    std::int64_t                rsa,
+    std::int64_t                csa,
+    const double*               B,
+    std::int64_t                rsb,
+    std::int64_t                csb,
+    bool                        b_packed,
+    double*                     C,
+    const GemmEpilogue<double>& ep
+) -> void
+{
+    // 预打包布局即行主序副本
+    if (b_packed) {
+        rsb = N;
+        csb = 1;
+    }
+    mm_fused_rows<double>(M, K, N, A, rsa, csa, B, rsb, csb, C, ep);
+}
+
+auto conv2d_f32(const Conv2dGeom& g, std::int64_t n, const float* x, const float* w, const float* bias, float* y) -> void
+{
+    conv2d_ref(g, n, x, w, bias, y);
+}
+
+auto conv2d_f64(const Conv2dGeom& g, std::int64_t n, const double* x, const double* w, const double* bias, double* y) -> void
+{
+    conv2d_ref(g, n, x, w, bias, y);
+}
+
+// 融合注意力：与 SIMD ISA 相同的分块流程，块乘积用 4×4 参考微内核
+auto attention_f32(const AttentionGeom& g, const float* q, const float* k, const float* v, const bool* mask, float scale, float* out) -> void
+{
+    attention_flash<float, 4, 4>(g, q, k, v, mask, scale, out, &micro_kernel_ref<float, 4, 4>);
+}
+
+auto attention_f64(const AttentionGeom& g, const double* q, const double* k, const double* v, const bool* mask, double scale, double* out) -> void
+{
+    attention_flash<double, 4, 4>(g, q, k, v, mask, scale, out, &micro_kernel_ref<double, 4, 4>);
+}
+
+// 量化 GEMM：与 SIMD ISA 相同的 K 分组布局，参考微内核做精确 i32 累加（4×4 tile）
+inline constexpr int kQGemmScalarTile = 4;
+
+auto qgemm_packed_bytes(std::int64_t K, std::int64_t N) -> std::int64_t
 {
-    mm_kernel_ikj<double, double>(M, K, N, A, B, C);
+    return ::bee::cpu::gemm::qgemm_packed_bytes<kQGemmScalarTile>(K, N);
 }
 
-auto gemm_i32(std::int64_t M, std::int64_t K, std::int64_t N, const std::int32_t* A, const std::int32_t* B, std::int32_t* C) -> void
+auto qgemm_pack_b_s8(
+    std::int64_t       K,
+    std::int64_t       N,
+    const std::int8_t* B,
+    std::int64_t       rsb,
+    std::int64_t       csb,
+    void*              dst
+) -> void
 {
-    mm_kernel_ikj<std::int32_t, std::int32_t>(M, K, N, A, B, C);
+    ::bee::cpu::gemm::pack_B_s8_full<kQGemmScalarTile>(B, rsb, csb, K, N, dst);
 }
 
-auto gemm_i8_i32(std::int64_t M, std::int64_t K, std::int64_t N, const std::int8_t* A, const std::int8_t* B, std::int32_t* C) -> void
+auto qgemm_u8s8(
+    std::int64_t         M,
+    std::int64_t         K,
+    std::int64_t         N,
+    const std::uint8_t*  A,
+    std::int64_t         rsa,
+    std::int64_t         csa,
+    const void*          B_packed,
+    const QGemmEpilogue& ep,
+    void*                C
+) -> void
 {
-    mm_kernel_ikj<std::int8_t, std::int32_t>(M, K, N, A, B, C);
+    constexpr int T     = kQGemmScalarTile;
+    auto*         micro = &micro_kernel_u8s8_ref<T, T>;
+    ::bee::cpu::gemm::detail::qgemm_driver<T, T>(M, K, N, A, rsa, csa, B_packed, ep, C, micro, micro);
 }
 
 } // namespace bee::cpu::gemm::scalar
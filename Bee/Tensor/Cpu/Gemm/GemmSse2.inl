@@ -4,38 +4,472 @@
  * @Brief SSE2 GEMM 入口：委托 GemmDriver（带 parallel_for）+ SSE2 microkernel。
  */
 
+#include "Tensor/Cpu/Gemm/AttentionCommon.hpp"
+#include "Tensor/Cpu/Gemm/ConvCommon.hpp"
 #include "Tensor/Cpu/Gemm/GemmCommon.hpp"
 #include "Tensor/Cpu/Gemm/GemmDispatch.hpp"
 #include "Tensor/Cpu/Gemm/GemmDriver.hpp"
 #include "Tensor/Cpu/Gemm/KernelSse2.hpp"
+#include "Tensor/Cpu/Gemm/QGemmCommon.hpp"
 
 #include <cstdint>
 
 namespace bee::cpu::gemm::sse2
 {
 
-auto gemm_f32(std::int64_t M, std::int64_t K, std::int64_t N, const float* A, const float* B, float* C) -> void
+auto gemm_f32(
+    std::int64_t M,
+    std::int64_t K,
+    std::int64_t N,
+    const float* A,
+    std::int64_t rsa,
+    std::int64_t csa,
+    const float* B,
+    std::int64_t rsb,
+    std::int64_t csb,
+    float*       C
+) -> void
 {
     using BS = Sse2BlockSize;
-    ::bee::cpu::gemm::detail::gemm_driver<float, float, BS::MR, BS::NR_F, BS::MC, BS::KC, BS::NC>(M, K, N, A, B, C, &micro_kernel_sgemm_4x4);
+    ::bee::cpu::gemm::detail::gemm_driver<float, float, BS::MR, BS::NR_F, VecF32>(
+        M, K, N, A, rsa, csa, B, rsb, csb, C, &micro_kernel_sgemm_4x4
+    );
 }
 
-auto gemm_f64(std::int64_t M, std::int64_t K, std::int64_t N, const double* A, const double* B, double* C) -> void
+auto gemm_f64(
+    std::int64_t  M,
+    std::int64_t  K,
+    std::int64_t  N,
+    const double* A,
+    std::int64_t  rsa,
+    std::int64_t  csa,
+    const double* B,
+    std::int64_t  rsb,
+    std::int64_t  csb,
+    double*       C
+) -> void
 {
     using BS = Sse2BlockSize;
-    ::bee::cpu::gemm::detail::gemm_driver<double, double, BS::MR, BS::NR_D, BS::MC, BS::KC, BS::NC>(M, K, N, A, B, C, &micro_kernel_dgemm_4x2);
+    ::bee::cpu::gemm::detail::gemm_driver<double, double, BS::MR, BS::NR_D, VecF64>(
+        M, K, N, A, rsa, csa, B, rsb, csb, C, &micro_kernel_dgemm_4x2
+    );
 }
 
-auto gemm_i32(std::int64_t M, std::int64_t K, std::int64_t N, const std::int32_t* A, const std::int32_t* B, std::int32_t* C) -> void
+auto gemm_i32(
+    std::int64_t        M,
+    std::int64_t        K,
+    std::int64_t        N,
+    const std::int32_t* A,
+    std::int64_t        rsa,
+    std::int64_t        csa,
+    const std::int32_t* B,
+    std::int64_t        rsb,
+    std::int64_t        csb,
+    std::int32_t*       C
+) -> void
 {
     using BS = Sse2BlockSize;
-    ::bee::cpu::gemm::detail::gemm_driver<std::int32_t, std::int32_t, BS::MR, BS::NR_F, BS::MC, BS::KC, BS::NC>(M, K, N, A, B, C, &micro_kernel_i32_4x4);
+    ::bee::cpu::gemm::detail::gemm_driver<std::int32_t, std::int32_t, BS::MR, BS::NR_F>(
+        M, K, N, A, rsa, csa, B, rsb, csb, C, &micro_kernel_i32_4x4
+    );
 }
 
-auto gemm_i8_i32(std::int64_t M, std::int64_t K, std::int64_t N, const std::int8_t* A, const std::int8_t* B, std::int32_t* C) -> void
+auto gemm_i8_i32(
+    std::int64_t       M,
+    std::int64_t       K,
+    std::int64_t       N,
+    const std::int8_t* A,
+    std::int64_t       rsa,
+    std::int64_t       csa,
+    const std::int8_t* B,
+    std::int64_t       rsb,
+    std::int64_t       csb,
+    std::int32_t*      C
+) -> void
 {
     using BS = Sse2BlockSize;
-    ::bee::cpu::gemm::detail::gemm_driver<std::int8_t, std::int32_t, BS::MR, BS::NR_I8, BS::MC, BS::KC, BS::NC>(M, K, N, A, B, C, &micro_kernel_i8_i32_4x4);
+    ::bee::cpu::gemm::detail::gemm_driver<std::int8_t, std::int32_t, BS::MR, BS::NR_I8>(
+        M, K, N, A, rsa, csa, B, rsb, csb, C, &micro_kernel_i8_i32_4x4
+    );
+}
+
+auto gemm_f16_f32(
+    std::int64_t M,
+    std::int64_t K,
+    std::int64_t N,
+    const Half*  A,
+    std::int64_t rsa,
+    std::int64_t csa,
+    const Half*  B,
+    std::int64_t rsb,
+    std::int64_t csb,
+    float*       C
+) -> void
+{
+    using BS = Sse2BlockSize;
+    ::bee::cpu::gemm::detail::gemm_driver<float, float, BS::MR, BS::NR_F, VecF32, PackHalf<Half>>(
+        M, K, N, A, rsa, csa, B, rsb, csb, C, &micro_kernel_sgemm_4x4
+    );
+}
+
+auto gemm_bf16_f32(
+    std::int64_t    M,
+    std::int64_t    K,
+    std::int64_t    N,
+    const BFloat16* A,
+    std::int64_t    rsa,
+    std::int64_t    csa,
+    const BFloat16* B,
+    std::int64_t    rsb,
+    std::int64_t    csb,
+    float*          C
+) -> void
+{
+    using BS = Sse2BlockSize;
+    ::bee::cpu::gemm::detail::gemm_driver<float, float, BS::MR, BS::NR_F, VecF32, PackHalf<BFloat16>>(
+        M, K, N, A, rsa, csa, B, rsb, csb, C, &micro_kernel_sgemm_4x4
+    );
+}
+
+auto gemm_batched_f32(
+    std::int64_t        batch,
+    std::int64_t        M,
+    std::int64_t        K,
+    std::int64_t        N,
+    const float* const* A,
+    std::int64_t        rsa,
+    std::int64_t        csa,
+    const float* const* B,
+    std::int64_t        rsb,
+    std::int64_t        csb,
+    float*              C
+) -> void
+{
+    using BS = Sse2BlockSize;
+    ::bee::cpu::gemm::detail::gemm_driver_batched<float, float, BS::MR, BS::NR_F, VecF32>(
+        batch, M, K, N, A, rsa, csa, B, rsb, csb, C, &micro_kernel_sgemm_4x4
+    );
+}
+
+auto gemm_batched_f64(
+    std::int64_t         batch,
+    std::int64_t         M,
+    std::int64_t         K,
+    std::int64_t         N,
+    const double* const* A,
+    std::int64_t         rsa,
+    std::int64_t         csa,
+    const double* const* B,
+    std::int64_t         rsb,
+    std::int64_t         csb,
+    double*              C
+) -> void
+{
+    using BS = Sse2BlockSize;
+    ::bee::cpu::gemm::detail::gemm_driver_batched<double, double, BS::MR, BS::NR_D, VecF64>(
+        batch, M, K, N, A, rsa, csa, B, rsb, csb, C, &micro_kernel_dgemm_4x2
+    );
+}
+
+auto gemm_batched_i32(
+    std::int64_t               batch,
+    std::int64_t               M,
+    std::int64_t               K,
+    std::int64_t               N,
+    const std::int32_t* const* A,
+    std::int64_t               rsa,
+    std::int64_t               csa,
+    const std::int32_t* const* B,
+    std::int64_t               rsb,
+    std::int64_t               csb,
+    std::int32_t*              C
+) -> void
+{
+    using BS = Sse2BlockSize;
+    ::bee::cpu::gemm::detail::gemm_driver_batched<std::int32_t, std::int32_t, BS::MR, BS::NR_F>(
+        batch, M, K, N, A, rsa, csa, B, rsb, csb, C, &micro_kernel_i32_4x4
+    );
+}
+
+auto gemm_batched_i8_i32(
+    std::int64_t              batch,
+    std::int64_t              M,
+    std::int64_t              K,
+    std::int64_t              N,
+    const std::int8_t* const* A,
+    std::int64_t              rsa,
+    std::int64_t              csa,
+    const std::int8_t* const* B,
+    std::int64_t              rsb,
+    std::int64_t              csb,
+    std::int32_t*             C
+) -> void
+{
+    using BS = Sse2BlockSize;
+    ::bee::cpu::gemm::detail::gemm_driver_batched<std::int8_t, std::int32_t, BS::MR, BS::NR_I8>(
+        batch, M, K, N, A, rsa, csa, B, rsb, csb, C, &micro_kernel_i8_i32_4x4
+    );
+}
+
+auto gemm_batched_f16_f32(
+    std::int64_t       batch,
+    std::int64_t       M,
+    std::int64_t       K,
+    std::int64_t       N,
+    const Half* const* A,
+    std::int64_t       rsa,
+    std::int64_t       csa,
+    const Half* const* B,
+    std::int64_t       rsb,
+    std::int64_t       csb,
+    float*             C
+) -> void
+{
+    using BS = Sse2BlockSize;
+    ::bee::cpu::gemm::detail::gemm_driver_batched<float, float, BS::MR, BS::NR_F, VecF32, PackHalf<Half>>(
+        batch, M, K, N, A, rsa, csa, B, rsb, csb, C, &micro_kernel_sgemm_4x4
+    );
+}
+
+auto gemm_batched_bf16_f32(
+    std::int64_t           batch,
+    std::int64_t           M,
+    std::int64_t           K,
+    std::int64_t           N,
+    const BFloat16* const* A,
+    std::int64_t           rsa,
+    std::int64_t           csa,
+    const BFloat16* const* B,
+    std::int64_t           rsb,
+    std::int64_t           csb,
+    float*                 C
+) -> void
+{
+    using BS = Sse2BlockSize;
+    ::bee::cpu::gemm::detail::gemm_driver_batched<float, float, BS::MR, BS::NR_F, VecF32, PackHalf<BFloat16>>(
+        batch, M, K, N, A, rsa, csa, B, rsb, csb, C, &micro_kernel_sgemm_4x4
+    );
+}
+
+auto pack_b_f32(
+    std::int64_t K,
+    std::int64_t N,
+    const float* B,
+    std::int64_t rsb,
+    std::int64_t csb,
+    float*       dst
+) -> void
+{
+    using BS = Sse2BlockSize;
+    ::bee::cpu::gemm::detail::pack_B_full<float, BS::MR, BS::NR_F>(B, rsb, csb, K, N, dst);
+}
+
+auto pack_b_f64(
+    std::int64_t  K,
+    std::int64_t  N,
+    const double* B,
+    std::int64_t  rsb,
+    std::int64_t  csb,
+    double*       dst
+) -> void
+{
+    using BS = Sse2BlockSize;
+    ::bee::cpu::gemm::detail::pack_B_full<double, BS::MR, BS::NR_D>(B, rsb, csb, K, N, dst);
+}
+
+auto pack_b_i32(
+    std::int64_t        K,
+    std::int64_t        N,
+    const std::int32_t* B,
+    std::int64_t        rsb,
+    std::int64_t        csb,
+    std::int32_t*       dst
+) -> void
+{
+    using BS = Sse2BlockSize;
+    ::bee::cpu::gemm::detail::pack_B_full<std::int32_t, BS::MR, BS::NR_F>(B, rsb, csb, K, N, dst);
+}
+
+auto pack_b_i8(
+    std::int64_t       K,
+    std::int64_t       N,
+    const std::int8_t* B,
+    std::int64_t       rsb,
+    std::int64_t       csb,
+    std::int8_t*       dst
+) -> void
+{
+    using BS = Sse2BlockSize;
+    ::bee::cpu::gemm::detail::pack_B_full<std::int8_t, BS::MR, BS::NR_I8>(B, rsb, csb, K, N, dst);
+}
+
+auto gemm_packed_f32(
+    std::int64_t M,
+    std::int64_t K,
+    std::int64_t N,
+    const float* A,
+    std::int64_t rsa,
+    std::int64_t csa,
+    const float* B_packed,
+    float*       C
+) -> void
+{
+    using BS = Sse2BlockSize;
+    ::bee::cpu::gemm::detail::gemm_driver_prepacked<float, float, BS::MR, BS::NR_F>(
+        M, K, N, A, rsa, csa, B_packed, C, &micro_kernel_sgemm_4x4
+    );
+}
+
+auto gemm_packed_f64(
+    std::int64_t  M,
+    std::int64_t  K,
+    std::int64_t  N,
+    const double* A,
+    std::int64_t  rsa,
+    std::int64_t  csa,
+    const double* B_packed,
+    double*       C
+) -> void
+{
+    using BS = Sse2BlockSize;
+    ::bee::cpu::gemm::detail::gemm_driver_prepacked<double, double, BS::MR, BS::NR_D>(
+        M, K, N, A, rsa, csa, B_packed, C, &micro_kernel_dgemm_4x2
+    );
+}
+
+auto gemm_packed_i32(
+    std::int64_t        M,
+    std::int64_t        K,
+    std::int64_t        N,
+    const std::int32_t* A,
+    std::int64_t        rsa,
+    std::int64_t        csa,
+    const std::int32_t* B_packed,
+    std::int32_t*       C
+) -> void
+{
+    using BS = Sse2BlockSize;
+    ::bee::cpu::gemm::detail::gemm_driver_prepacked<std::int32_t, std::int32_t, BS::MR, BS::NR_F>(
+        M, K, N, A, rsa, csa, B_packed, C, &micro_kernel_i32_4x4
+    );
+}
+
+auto gemm_packed_i8_i32(
+    std::int64_t       M,
+    std::int64_t       K,
+    std::int64_t       N,
+    const std::int8_t* A,
+    std::int64_t       rsa,
+    std::int64_t       csa,
+    const std::int8_t* B_packed,
+    std::int32_t*      C
+) -> void
+{
+    using BS = Sse2BlockSize;
+    ::bee::cpu::gemm::detail::gemm_driver_prepacked<std::int8_t, std::int32_t, BS::MR, BS::NR_I8>(
+        M, K, N, A, rsa, csa, B_packed, C, &micro_kernel_i8_i32_4x4
+    );
+}
+
+auto gemm_fused_f32(
+    std::int64_t               M,
+    std::int64_t               K,
+    std::int64_t               N,
+    const float*               A,
+    std::int64_t               rsa,
+    std::int64_t               csa,
+    const float*               B,
+    std::int64_t               rsb,
+    std::int64_t               csb,
+    bool                       b_packed,
+    float*                     C,
+    const GemmEpilogue<float>& ep
+) -> void
+{
+    using BS = Sse2BlockSize;
+    ::bee::cpu::gemm::detail::gemm_driver_fused<float, float, BS::MR, BS::NR_F>(
+        M, K, N, A, rsa, csa, B, rsb, csb, b_packed, C, &micro_kernel_sgemm_4x4, ep
+    );
+}
+
+auto gemm_fused_f64(
+    std::int64_t                M,
+    std::int64_t                K,
+    std::int64_t                N,
+    const double*               A,
+    std::int64_t                rsa,
+    std::int64_t                csa,
+    const double*               B,
+    std::int64_t                rsb,
+    std::int64_t                csb,
+    bool                        b_packed,
+    double*                     C,
+    const GemmEpilogue<double>& ep
+) -> void
+{
+    using BS = Sse2BlockSize;
+    ::bee::cpu::gemm::detail::gemm_driver_fused<double, double, BS::MR, BS::NR_D>(
+        M, K, N, A, rsa, csa, B, rsb, csb, b_packed, C, &micro_kernel_dgemm_4x2, ep
+    );
+}
+
+auto conv2d_f32(const Conv2dGeom& g, std::int64_t n, const float* x, const float* w, const float* bias, float* y) -> void
+{
+    using BS = Sse2BlockSize;
+    conv2d_gemm<float, BS::MR, BS::NR_F>(g, n, x, w, bias, y, &micro_kernel_sgemm_4x4);
+}
+
+auto conv2d_f64(const Conv2dGeom& g, std::int64_t n, const double* x, const double* w, const double* bias, double* y) -> void
+{
+    using BS = Sse2BlockSize;
+    conv2d_gemm<double, BS::MR, BS::NR_D>(g, n, x, w, bias, y, &micro_kernel_dgemm_4x2);
+}
+
+auto attention_f32(const AttentionGeom& g, const float* q, const float* k, const float* v, const bool* mask, float scale, float* out) -> void
+{
+    using BS = Sse2BlockSize;
+    attention_flash<float, BS::MR, BS::NR_F>(g, q, k, v, mask, scale, out, &micro_kernel_sgemm_4x4);
+}
+
+auto attention_f64(const AttentionGeom& g, const double* q, const double* k, const double* v, const bool* mask, double scale, double* out) -> void
+{
+    using BS = Sse2BlockSize;
+    attention_flash<double, BS::MR, BS::NR_D>(g, q, k, v, mask, scale, out, &micro_kernel_dgemm_4x2);
+}
+
+auto qgemm_packed_bytes(std::int64_t K, std::int64_t N) -> std::int64_t
+{
+    return ::bee::cpu::gemm::qgemm_packed_bytes<Sse2BlockSize::NR_I8>(K, N);
+}
+
+auto qgemm_pack_b_s8(
+    std::int64_t       K,
+    std::int64_t       N,
+    const std::int8_t* B,
+    std::int64_t       rsb,
+    std::int64_t       csb,
+    void*              dst
+) -> void
+{
+    ::bee::cpu::gemm::pack_B_s8_full<Sse2BlockSize::NR_I8>(B, rsb, csb, K, N, dst);
+}
+
+auto qgemm_u8s8(
+    std::int64_t         M,
+    std::int64_t         K,
+    std::int64_t         N,
+    const std::uint8_t*  A,
+    std::int64_t         rsa,
+    std::int64_t         csa,
+    const void*          B_packed,
+    const QGemmEpilogue& ep,
+    void*                C
+) -> void
+{
+    using BS = Sse2BlockSize;
+    ::bee::cpu::gemm::detail::qgemm_driver<BS::MR, BS::NR_I8>(
+        M, K, N, A, rsa, csa, B_packed, ep, C, &micro_kernel_u8s8_4x4, &micro_kernel_u8s8_4x4
+    );
 }
 
 } // namespace bee::cpu::gemm::sse2
@@ -0,0 +1,184 @@
+/**
+ * @File Cpu/Gemm/GemvCommon.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Brief This file is part of Bee.
+ *
+ * 窄形状 GEMM（GEMV / M ≤ MR）的通用内核，按向量特征 Vec 实例化（见 KernelAvx2 / KernelSse2 的 VecF32 / VecF64）。
+ *
+ * 这类形状访存受限：Goto 路径整块 pack B 再以 MR×NR 微内核跑 1 行，计算与带宽都浪费。这里不做 pack：
+ *  - dot 形式：y[i] += A[i, :] · x，A 行与 x 均为单位步长；一次处理 4 行共享 x 的加载，
+ *    每行 2 个向量累加器，打破 FMA 依赖链；
+ *  - axpy 形式：C[r, :] += Σ_k A[r, k] · B[k, :]，B 行为单位步长；C 的一段常驻 L1，
+ *    B 按行连续流式读取恰好一遍。
+ *
+ * Vec 需提供：类型 V、宽度 W、zero / set1 / load / add / fmadd / hsum / store_add。
+ * A / B（x）的存储类型 TS 可与累加类型 T 不同：F16 / BF16 输入由 Vec::load 的重载在加载时展开为 F32，
+ * 标量尾部经 static_cast 展开。
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace bee::cpu::gemm
+{
+
+// ── dot 形式：y[i * incy] += Σ_k A[i * lda + k] · x[k] ─────────────────────────
+template <typename Vec, typename TS, typename T>
+inline auto gemv_dot_rows(std::int64_t rows, std::int64_t K, const TS* A, std::int64_t lda, const TS* x, T* y, std::int64_t incy) -> void
+{
+    using V         = typename Vec::V;
+    constexpr int W = Vec::W;
+
+    const std::int64_t K2 = K / (2 * W) * (2 * W);
+
+    std::int64_t i = 0;
+    for (; i + 4 <= rows; i += 4) {
+        const TS* a0 = A + (i + 0) * lda;
+        const TS* a1 = A + (i + 1) * lda;
+        const TS* a2 = A + (i + 2) * lda;
+        const TS* a3 = A + (i + 3) * lda;
+        V         s00 = Vec::zero(), s01 = Vec::zero(), s10 = Vec::zero(), s11 = Vec::zero();
+        V         s20 = Vec::zero(), s21 = Vec::zero(), s30 = Vec::zero(), s31 = Vec::zero();
+        for (std::int64_t k = 0; k < K2; k += 2 * W) {
+            const V x0 = Vec::load(x + k);
+            const V x1 = Vec::load(x + k + W);
+            s00        = Vec::fmadd(Vec::load(a0 + k), x0, s00);
+            s01        = Vec::fmadd(Vec::load(a0 + k + W), x1, s01);
+            s10        = Vec::fmadd(Vec::load(a1 + k), x0, s10);
+            s11        = Vec::fmadd(Vec::load(a1 + k + W), x1, s11);
+            s20        = Vec::fmadd(Vec::load(a2 + k), x0, s20);
+            s21        = Vec::fmadd(Vec::load(a2 + k + W), x1, s21);
+            s30        = Vec::fmadd(Vec::load(a3 + k), x0, s30);
+            s31        = Vec::fmadd(Vec::load(a3 + k + W), x1, s31);
+        }
+        T r0 = Vec::hsum(Vec::add(s00, s01));
+        T r1 = Vec::hsum(Vec::add(s10, s11));
+        T r2 = Vec::hsum(Vec::add(s20, s21));
+        T r3 = Vec::hsum(Vec::add(s30, s31));
+        for (std::int64_t k = K2; k < K; ++k) {
+            const T xk  = static_cast<T>(x[k]);
+            r0         += static_cast<T>(a0[k]) * xk;
+            r1         += static_cast<T>(a1[k]) * xk;
+            r2         += static_cast<T>(a2[k]) * xk;
+            r3         += static_cast<T>(a3[k]) * xk;
+        }
+        y[(i + 0) * incy] += r0;
+        y[(i + 1) * incy] += r1;
+        y[(i + 2) * incy] += r2;
+        y[(i + 3) * incy] += r3;
+    }
+
+    // 余数行：单行 4 个累加器
+    const std::int64_t K4 = K / (4 * W) * (4 * W);
+    for (; i < rows; ++i) {
+        const TS* a  = A + i * lda;
+        V         s0 = Vec::zero(), s1 = Vec::zero(), s2 = Vec::zero(), s3 = Vec::zero();
+        for (std::int64_t k = 0; k < K4; k += 4 * W) {
+            s0 = Vec::fmadd(Vec::load(a + k), Vec::load(x + k), s0);
+            s1 = Vec::fmadd(Vec::load(a + k + W), Vec::load(x + k + W), s1);
+            s2 = Vec::fmadd(Vec::load(a + k + 2 * W), Vec::load(x + k + 2 * W), s2);
+            s3 = Vec::fmadd(Vec::load(a + k + 3 * W), Vec::load(x + k + 3 * W), s3);
+        }
+        T r = Vec::hsum(Vec::add(Vec::add(s0, s1), Vec::add(s2, s3)));
+        for (std::int64_t k = K4; k < K; ++k)
+            r += static_cast<T>(a[k]) * static_cast<T>(x[k]);
+        y[i * incy] += r;
+    }
+}
+
+// ── axpy 形式：C[r, 0..N) += Σ_k A[r * rsa + k * csa] · B[k * ldb + 0..N)，r < RM ──────
+// C 的 RM 行按 2 KB 一段常驻 L1，K 方向 4 行一组：每组 4 条 B 行流各读一段连续内存，
+// 对硬件预取友好（按列条带遍历时 ldb 跨页，每行都是一次冷缺失）。
+template <typename Vec, int RM, typename TS, typename T>
+inline auto gemv_axpy_rows(
+    std::int64_t K,
+    std::int64_t N,
+    const TS*    A,
+    std::int64_t rsa,
+    std::int64_t csa,
+    const TS*    B,
+    std::int64_t ldb,
+    T*           C,
+    std::int64_t ldc
+) -> void
+{
+    using V         = typename Vec::V;
+    constexpr int W = Vec::W;
+
+    constexpr std::int64_t kStrip = 2048 / sizeof(T);
+    const std::int64_t     K4     = K / 4 * 4;
+
+    for (std::int64_t j0 = 0; j0 < N; j0 += kStrip) {
+        const std::int64_t n  = N - j0 < kStrip ? N - j0 : kStrip;
+        const std::int64_t nv = n / W * W;
+        for (std::int64_t k = 0; k < K4; k += 4) {
+            const TS* b0 = B + (k + 0) * ldb + j0;
+            const TS* b1 = B + (k + 1) * ldb + j0;
+            const TS* b2 = B + (k + 2) * ldb + j0;
+            const TS* b3 = B + (k + 3) * ldb + j0;
+            T         a[RM][4];
+            for (int r = 0; r < RM; ++r)
+                for (int q = 0; q < 4; ++q)
+                    a[r][q] = static_cast<T>(A[r * rsa + (k + q) * csa]);
+            for (std::int64_t j = 0; j < nv; j += W) {
+                const V x0 = Vec::load(b0 + j);
+                const V x1 = Vec::load(b1 + j);
+                const V x2 = Vec::load(b2 + j);
+                const V x3 = Vec::load(b3 + j);
+                for (int r = 0; r < RM; ++r) {
+                    V acc = Vec::fmadd(Vec::set1(a[r][0]), x0, Vec::zero());
+                    acc   = Vec::fmadd(Vec::set1(a[r][1]), x1, acc);
+                    acc   = Vec::fmadd(Vec::set1(a[r][2]), x2, acc);
+                    acc   = Vec::fmadd(Vec::set1(a[r][3]), x3, acc);
+                    Vec::store_add(C + r * ldc + j0 + j, acc);
+                }
+            }
+            for (std::int64_t j = nv; j < n; ++j) {
+                const T x0 = static_cast<T>(b0[j]);
+                const T x1 = static_cast<T>(b1[j]);
+                const T x2 = static_cast<T>(b2[j]);
+                const T x3 = static_cast<T>(b3[j]);
+                for (int r = 0; r < RM; ++r)
+                    C[r * ldc + j0 + j] += a[r][0] * x0 + a[r][1] * x1 + a[r][2] * x2 + a[r][3] * x3;
+            }
+        }
+        for (std::int64_t k = K4; k < K; ++k) {
+            const TS* bk = B + k * ldb + j0;
+            for (int r = 0; r < RM; ++r) {
+                const T ar = static_cast<T>(A[r * rsa + k * csa]);
+                const V av = Vec::set1(ar);
+                for (std::int64_t j = 0; j < nv; j += W)
+                    Vec::store_add(C + r * ldc + j0 + j, Vec::fmadd(av, Vec::load(bk + j), Vec::zero()));
+                for (std::int64_t j = nv; j < n; ++j)
+                    C[r * ldc + j0 + j] += ar * static_cast<T>(bk[j]);
+            }
+        }
+    }
+}
+
+// 运行期行数 rows ∈ [1, MaxRM] 分派到编译期 RM
+template <typename Vec, int MaxRM, int RM = 1, typename TS, typename T>
+inline auto gemv_axpy_rows_n(
+    std::int64_t rows,
+    std::int64_t K,
+    std::int64_t N,
+    const TS*    A,
+    std::int64_t rsa,
+    std::int64_t csa,
+    const TS*    B,
+    std::int64_t ldb,
+    T*           C,
+    std::int64_t ldc
+) -> void
+{
+    if constexpr (RM <= MaxRM) {
+        if (rows == RM) {
+            gemv_axpy_rows<Vec, RM>(K, N, A, rsa, csa, B, ldb, C, ldc);
+            return;
+        }
+        gemv_axpy_rows_n<Vec, MaxRM, RM + 1>(rows, K, N, A, rsa, csa, B, ldb, C, ldc);
+    }
+}
+
+} // namespace bee::cpu::gemm
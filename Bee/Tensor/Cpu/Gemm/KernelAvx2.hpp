@@ -8,18 +8,61 @@
  * 所有 micro-kernel 写法均对齐：A_pack 按 MR 条带（每条 MR 个元素 × K 列），
  * B_pack 按 NR 条带（每条 NR 个元素 × K 行）。K 循环做 rank-1 外积累加。
  *
- * C 是行主序原始矩阵，micro-kernel 通过 ldc 写回。
+ * C 是行主序原始矩阵，micro-kernel 通过 ldc 写回；浮点内核可选带 TileEpilogue（见 Epilogue.hpp）。
+ * 量化 u8 × s8 内核使用 K 方向 4 个一组的布局（见 QGemmCommon.hpp），写回时完成再量化。
+ * F16 / BF16 输入不另设微内核：PackHalf 在 packing 时展开为 F32，窄形状经 VecF32::load 的重载展开。
  */
 
 #pragma once
 
 #include <immintrin.h>
 
+#include "Tensor/Core/Half.hpp"
+#include "Tensor/Cpu/Gemm/Epilogue.hpp"
+
 #include <cstdint>
+#include <cstring>
 
 namespace bee::cpu::gemm::avx2
 {
 
+// ─── 写回：C += acc，或带 epilogue 的 C += alpha·acc（最后 K 块再叠加 bias / 激活 / residual）
+inline auto store_row_ep(float* __restrict c, __m256 acc, const TileEpilogue<float>* ep, int row) -> void
+{
+    if (ep == nullptr) {
+        _mm256_storeu_ps(c, _mm256_add_ps(_mm256_loadu_ps(c), acc));
+        return;
+    }
+    __m256 v = _mm256_fmadd_ps(_mm256_set1_ps(ep->alpha), acc, _mm256_loadu_ps(c));
+    if (ep->last) {
+        if (ep->bias != nullptr)
+            v = _mm256_add_ps(v, _mm256_loadu_ps(ep->bias));
+        if (ep->act == GemmAct::ReLU)
+            v = _mm256_max_ps(v, _mm256_setzero_ps());
+    }
+    _mm256_storeu_ps(c, v);
+    if (ep->last && (ep->residual != nullptr || !gemm_act_is_vector(ep->act)))
+        tile_epilogue_finish(c, 8, *ep, row);
+}
+
+inline auto store_row_ep(double* __restrict c, __m256d acc, const TileEpilogue<double>* ep, int row) -> void
+{
+    if (ep == nullptr) {
+        _mm256_storeu_pd(c, _mm256_add_pd(_mm256_loadu_pd(c), acc));
+        return;
+    }
+    __m256d v = _mm256_fmadd_pd(_mm256_set1_pd(ep->alpha), acc, _mm256_loadu_pd(c));
+    if (ep->last) {
+        if (ep->bias != nullptr)
+            v = _mm256_add_pd(v, _mm256_loadu_pd(ep->bias));
+        if (ep->act == GemmAct::ReLU)
+            v = _mm256_max_pd(v, _mm256_setzero_pd());
+    }
+    _mm256_storeu_pd(c, v);
+    if (ep->last && (ep->residual != nullptr || !gemm_act_is_vector(ep->act)))
+        tile_epilogue_finish(c, 4, *ep, row);
+}
+
 // ─── SGEMM 8×8 微内核（行主序 C）──────────────────────────────────────────────
 // A_pack: 8 元素/列 × K → 布局 [k=0 a0..a7, k=1 a0..a7, ...]，连续 8*K floats
 // B_pack: 8 元素/行 × K → 布局 [k=0 b0..b7, k=1 b0..b7, ...]，连续 K*8 floats
@@ -31,7 +74,8 @@ inline auto micro_kernel_sgemm_8x8(
     const float* __restrict B_pack,
     std::int64_t K,
     float* __restrict C,
-    std::int64_t ldc
+    std::int64_t ldc,
+    const TileEpilogue<float>* ep = nullptr
 ) -> void
 {
     __m256 c0 = _mm256_setzero_ps();
@@ -74,14 +118,14 @@ inline auto micro_kernel_sgemm_8x8(
         pb += 8;
     }
 
-    _mm256_storeu_ps(C + 0 * ldc, _mm256_add_ps(_mm256_loadu_ps(C + 0 * ldc), c0));
-    _mm256_storeu_ps(C + 1 * ldc, _mm256_add_ps(_mm256_loadu_ps(C + 1 * ldc), c1));
-    _mm256_storeu_ps(C + 2 * ldc, _mm256_add_ps(_mm256_loadu_ps(C + 2 * ldc), c2));
-    _mm256_storeu_ps(C + 3 * ldc, _mm256_add_ps(_mm256_loadu_ps(C + 3 * ldc), c3));
-    _mm256_storeu_ps(C + 4 * ldc, _mm256_add_ps(_mm256_loadu_ps(C + 4 * ldc), c4));
-    _mm256_storeu_ps(C + 5 * ldc, _mm256_add_ps(_mm256_loadu_ps(C + 5 * ldc), c5));
-    _mm256_storeu_ps(C + 6 * ldc, _mm256_add_ps(_mm256_loadu_ps(C + 6 * ldc), c6));
-    _mm256_storeu_ps(C + 7 * ldc, _mm256_add_ps(_mm256_loadu_ps(C + 7 * ldc), c7));
+    store_row_ep(C + 0 * ldc, c0, ep, 0);
+    store_row_ep(C + 1 * ldc, c1, ep, 1);
+    store_row_ep(C + 2 * ldc, c2, ep, 2);
+    store_row_ep(C + 3 * ldc, c3, ep, 3);
+    store_row_ep(C + 4 * ldc, c4, ep, 4);
+    store_row_ep(C + 5 * ldc, c5, ep, 5);
+    store_row_ep(C + 6 * ldc, c6, ep, 6);
+    store_row_ep(C + 7 * ldc, c7, ep, 7);
 }
 
 // ─── DGEMM 8×4 微内核 ───────────────────────────────────────────────────────
@@ -94,7 +138,8 @@ inline auto micro_kernel_dgemm_8x4(
     const double* __restrict B_pack,
     std::int64_t K,
     double* __restrict C,
-    std::int64_t ldc
+    std::int64_t ldc,
+    const TileEpilogue<double>* ep = nullptr
 ) -> void
 {
     // c[i] = i 行的 4 列（一条 __m256d）
@@ -136,14 +181,14 @@ inline auto micro_kernel_dgemm_8x4(
         pb += 4;
     }
 
-    _mm256_storeu_pd(C + 0 * ldc, _mm256_add_pd(_mm256_loadu_pd(C + 0 * ldc), c0));
-    _mm256_storeu_pd(C + 1 * ldc, _mm256_add_pd(_mm256_loadu_pd(C + 1 * ldc), c1));
-    _mm256_storeu_pd(C + 2 * ldc, _mm256_add_pd(_mm256_loadu_pd(C + 2 * ldc), c2));
-    _mm256_storeu_pd(C + 3 * ldc, _mm256_add_pd(_mm256_loadu_pd(C + 3 * ldc), c3));
-    _mm256_storeu_pd(C + 4 * ldc, _mm256_add_pd(_mm256_loadu_pd(C + 4 * ldc), c4));
-    _mm256_storeu_pd(C + 5 * ldc, _mm256_add_pd(_mm256_loadu_pd(C + 5 * ldc), c5));
-    _mm256_storeu_pd(C + 6 * ldc, _mm256_add_pd(_mm256_loadu_pd(C + 6 * ldc), c6));
-    _mm256_storeu_pd(C + 7 * ldc, _mm256_add_pd(_mm256_loadu_pd(C + 7 * ldc), c7));
+    store_row_ep(C + 0 * ldc, c0, ep, 0);
+    store_row_ep(C + 1 * ldc, c1, ep, 1);
+    store_row_ep(C + 2 * ldc, c2, ep, 2);
+    store_row_ep(C + 3 * ldc, c3, ep, 3);
+    store_row_ep(C + 4 * ldc, c4, ep, 4);
+    store_row_ep(C + 5 * ldc, c5, ep, 5);
+    store_row_ep(C + 6 * ldc, c6, ep, 6);
+    store_row_ep(C + 7 * ldc, c7, ep, 7);
 }
 
 // ─── I32GEMM 8×8 微内核（AVX2 has vpmulld + vpaddd）──────────────────────────
@@ -272,4 +317,210 @@ inline auto micro_kernel_i8_i32_8x8(
 #undef ST_I32
 }
 
+// ─── u8 × s8 → i32 8×8 微内核（AVX2，vpmaddubsw + vpmaddwd 级联）＋ 寄存器内再量化 ─────────
+// A_pack：每组 [8 行][4 k] 字节，B_pack：每组 [8 列][4 k] 字节（见 QGemmCommon.hpp）。
+// 每组对每行：广播该行 4 个 u8 → vpmaddubsw 得 16 个 int16 成对和 → vpmaddwd(·, 1) 得 8 列 int32。
+// kSplit 为 true 时把 a 拆成 a & 0x7F 与 a >> 7 两部分各做一次，避免 int16 饱和（结果精确）。
+
+// 写回一行：y = float(acc - comp) · mul + add，F32 直接写；整型 clamp 后就近取整并窄化到 8 字节
+inline auto store_row_q(void* C, std::int64_t ldc, int row, __m256i acc, __m256i comp, __m256 mul, __m256 add, const QTileEpilogue& ep) -> void
+{
+    __m256 y = _mm256_fmadd_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(acc, comp)), mul, add);
+    if (ep.out == QGemmOut::F32) {
+        _mm256_storeu_ps(static_cast<float*>(C) + row * ldc, y);
+        return;
+    }
+    y                 = _mm256_min_ps(_mm256_max_ps(y, _mm256_set1_ps(ep.lo)), _mm256_set1_ps(ep.hi));
+    const __m256i q   = _mm256_cvtps_epi32(y);
+    const __m128i w16 = _mm_packs_epi32(_mm256_castsi256_si128(q), _mm256_extracti128_si256(q, 1));
+    const __m128i w8  = ep.out == QGemmOut::S8 ? _mm_packs_epi16(w16, w16) : _mm_packus_epi16(w16, w16);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(static_cast<std::uint8_t*>(C) + row * ldc), w8);
+}
+
+// c += 一行 4 个 u8（广播）与 8 列 × 4 个 s8 的点积
+template <bool kSplit>
+inline auto dot4_u8s8(__m256i c, const std::uint8_t* a, __m256i b) -> __m256i
+{
+    const __m256i ones = _mm256_set1_epi16(1);
+    std::int32_t  a4;
+    std::memcpy(&a4, a, sizeof(a4));
+    const __m256i av = _mm256_set1_epi32(a4);
+    if constexpr (kSplit) {
+        const __m256i lo = _mm256_and_si256(av, _mm256_set1_epi8(0x7F));
+        const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(av, 7), _mm256_set1_epi8(0x01));
+        c                = _mm256_add_epi32(c, _mm256_madd_epi16(_mm256_maddubs_epi16(lo, b), ones));
+        return _mm256_add_epi32(c, _mm256_slli_epi32(_mm256_madd_epi16(_mm256_maddubs_epi16(hi, b), ones), 7));
+    } else {
+        return _mm256_add_epi32(c, _mm256_madd_epi16(_mm256_maddubs_epi16(av, b), ones));
+    }
+}
+
+template <bool kSplit>
+inline auto micro_kernel_u8s8_8x8(
+    const std::uint8_t* __restrict A_pack,
+    const std::int8_t* __restrict B_pack,
+    std::int64_t         groups,
+    const QTileEpilogue& ep,
+    void*                C,
+    std::int64_t         ldc
+) -> void
+{
+    __m256i c0 = _mm256_setzero_si256();
+    __m256i c1 = _mm256_setzero_si256();
+    __m256i c2 = _mm256_setzero_si256();
+    __m256i c3 = _mm256_setzero_si256();
+    __m256i c4 = _mm256_setzero_si256();
+    __m256i c5 = _mm256_setzero_si256();
+    __m256i c6 = _mm256_setzero_si256();
+    __m256i c7 = _mm256_setzero_si256();
+
+    const std::uint8_t* pa = A_pack;
+    const std::int8_t*  pb = B_pack;
+
+    for (std::int64_t g = 0; g < groups; ++g) {
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pb));
+        c0              = dot4_u8s8<kSplit>(c0, pa + 0 * 4, b);
+        c1              = dot4_u8s8<kSplit>(c1, pa + 1 * 4, b);
+        c2              = dot4_u8s8<kSplit>(c2, pa + 2 * 4, b);
+        c3              = dot4_u8s8<kSplit>(c3, pa + 3 * 4, b);
+        c4              = dot4_u8s8<kSplit>(c4, pa + 4 * 4, b);
+        c5              = dot4_u8s8<kSplit>(c5, pa + 5 * 4, b);
+        c6              = dot4_u8s8<kSplit>(c6, pa + 6 * 4, b);
+        c7              = dot4_u8s8<kSplit>(c7, pa + 7 * 4, b);
+
+        pa += 8 * 4;
+        pb += 8 * 4;
+    }
+
+    const __m256i comp = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ep.comp));
+    const __m256  mul  = _mm256_loadu_ps(ep.mul);
+    const __m256  add  = _mm256_loadu_ps(ep.add);
+    store_row_q(C, ldc, 0, c0, comp, mul, add, ep);
+    store_row_q(C, ldc, 1, c1, comp, mul, add, ep);
+    store_row_q(C, ldc, 2, c2, comp, mul, add, ep);
+    store_row_q(C, ldc, 3, c3, comp, mul, add, ep);
+    store_row_q(C, ldc, 4, c4, comp, mul, add, ep);
+    store_row_q(C, ldc, 5, c5, comp, mul, add, ep);
+    store_row_q(C, ldc, 6, c6, comp, mul, add, ep);
+    store_row_q(C, ldc, 7, c7, comp, mul, add, ep);
+}
+
+// ─── 窄形状（GEMV / M ≤ MR）向量特征，供 GemvCommon.hpp 的通用内核实例化 ──────────────
+struct VecF32
+{
+    using V                = __m256;
+    static constexpr int W = 8;
+
+    static auto zero() -> V
+    {
+        return _mm256_setzero_ps();
+    }
+
+    static auto set1(float s) -> V
+    {
+        return _mm256_set1_ps(s);
+    }
+
+    static auto load(const float* p) -> V
+    {
+        return _mm256_loadu_ps(p);
+    }
+
+    // F16：vcvtph2ps（F16C，AVX2 目标 CPU 均具备）
+    static auto load(const Half* p) -> V
+    {
+        return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+    }
+
+    // BF16：零扩展到 32 位后左移 16 即为 F32 位模式
+    static auto load(const BFloat16* p) -> V
+    {
+        return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))), 16));
+    }
+
+    static auto add(V a, V b) -> V
+    {
+        return _mm256_add_ps(a, b);
+    }
+
+    static auto fmadd(V a, V b, V c) -> V
+    {
+        return _mm256_fmadd_ps(a, b, c);
+    }
+
+    static auto store_add(float* p, V v) -> void
+    {
+        _mm256_storeu_ps(p, _mm256_add_ps(_mm256_loadu_ps(p), v));
+    }
+
+    static auto hsum(V v) -> float
+    {
+        __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+        s        = _mm_add_ps(s, _mm_movehl_ps(s, s));
+        s        = _mm_add_ss(s, _mm_shuffle_ps(s, s, 0x1));
+        return _mm_cvtss_f32(s);
+    }
+};
+
+struct VecF64
+{
+    using V                = __m256d;
+    static constexpr int W = 4;
+
+    static auto zero() -> V
+    {
+        return _mm256_setzero_pd();
+    }
+
+    static auto set1(double s) -> V
+    {
+        return _mm256_set1_pd(s);
+    }
+
+    static auto load(const double* p) -> V
+    {
+        return _mm256_loadu_pd(p);
+    }
+
+    static auto add(V a, V b) -> V
+    {
+        return _mm256_add_pd(a, b);
+    }
+
+    static auto fmadd(V a, V b, V c) -> V
+    {
+        return _mm256_fmadd_pd(a, b, c);
+    }
+
+    static auto store_add(double* p, V v) -> void
+    {
+        _mm256_storeu_pd(p, _mm256_add_pd(_mm256_loadu_pd(p), v));
+    }
+
+    static auto hsum(V v) -> double
+    {
+        __m128d s = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+        s         = _mm_add_sd(s, _mm_unpackhi_pd(s, s));
+        return _mm_cvtsd_f64(s);
+    }
+};
+
+// ─── F16 / BF16 → F32 的 packing 加载策略（PackCommon.hpp 的 Ld）────────────────
+template <typename H>
+struct PackHalf
+{
+    using Src = H;
+
+    static auto row(const H* src, float* dst, std::int64_t n) -> void
+    {
+        std::int64_t i = 0;
+        for (; i + VecF32::W <= n; i += VecF32::W)
+            _mm256_storeu_ps(dst + i, VecF32::load(src + i));
+        for (; i < n; ++i)
+            dst[i] = static_cast<float>(src[i]);
+    }
+
+    static auto one(H v) -> float { return static_cast<float>(v); }
+};
+
 } // namespace bee::cpu::gemm::avx2
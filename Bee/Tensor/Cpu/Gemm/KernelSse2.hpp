@@ -11,18 +11,60 @@
  *   - FMA → 用 _mm_mul_ps/pd + _mm_add_ps/pd
  *   - _mm_mullo_epi32 （SSE4.1）→ I32 GEMM 退化为 4 标量乘 × SSE add_epi32 累加
  *   - _mm_cvtepi8_epi32（SSE4.1）→ I8→I32 用 unpack+srai 扩展
+ *   - _mm_maddubs_epi16（SSSE3）→ u8 × s8 量化 GEMM 扩展到 int16 后用 pmaddwd
+ *   - F16C → F16 输入逐元素标量展开为 F32；BF16 仍可用 unpack 移位向量化
  */
 
 #pragma once
 
 #include <emmintrin.h> // SSE2
 
+#include "Tensor/Core/Half.hpp"
+#include "Tensor/Cpu/Gemm/Epilogue.hpp"
+
 #include <cstdint>
 #include <cstring>
 
 namespace bee::cpu::gemm::sse2
 {
 
+// ─── 写回：C += acc，或带 epilogue 的 C += alpha·acc（最后 K 块再叠加 bias / 激活 / residual）
+inline auto store_row_ep(float* __restrict c, __m128 acc, const TileEpilogue<float>* ep, int row) -> void
+{
+    if (ep == nullptr) {
+        _mm_storeu_ps(c, _mm_add_ps(_mm_loadu_ps(c), acc));
+        return;
+    }
+    __m128 v = _mm_add_ps(_mm_loadu_ps(c), _mm_mul_ps(_mm_set1_ps(ep->alpha), acc));
+    if (ep->last) {
+        if (ep->bias != nullptr)
+            v = _mm_add_ps(v, _mm_loadu_ps(ep->bias));
+        if (ep->act == GemmAct::ReLU)
+            v = _mm_max_ps(v, _mm_setzero_ps());
+    }
+    _mm_storeu_ps(c, v);
+    if (ep->last && (ep->residual != nullptr || !gemm_act_is_vector(ep->act)))
+        tile_epilogue_finish(c, 4, *ep, row);
+}
+
+inline auto store_row_ep(double* __restrict c, __m128d acc, const TileEpilogue<double>* ep, int row) -> void
+{
+    if (ep == nullptr) {
+        _mm_storeu_pd(c, _mm_add_pd(_mm_loadu_pd(c), acc));
+        return;
+    }
+    __m128d v = _mm_add_pd(_mm_loadu_pd(c), _mm_mul_pd(_mm_set1_pd(ep->alpha), acc));
+    if (ep->last) {
+        if (ep->bias != nullptr)
+            v = _mm_add_pd(v, _mm_loadu_pd(ep->bias));
+        if (ep->act == GemmAct::ReLU)
+            v = _mm_max_pd(v, _mm_setzero_pd());
+    }
+    _mm_storeu_pd(c, v);
+    if (ep->last && (ep->residual != nullptr || !gemm_act_is_vector(ep->act)))
+        tile_epilogue_finish(c, 2, *ep, row);
+}
+
 // ─── SGEMM 4×4 微内核 ───────────────────────────────────────────────────────
 // A_pack: 4 元素/列 × K；B_pack: 4 元素/行 × K
 inline auto micro_kernel_sgemm_4x4(
@@ -30,7 +72,8 @@ inline auto micro_kernel_sgemm_4x4(
     const float* __restrict B_pack,
     std::int64_t K,
     float* __restrict C,
-    std::int64_t ldc
+    std::int64_t ldc,
+    const TileEpilogue<float>* ep = nullptr
 ) -> void
 {
     __m128 c0 = _mm_setzero_ps();
@@ -55,10 +98,10 @@ inline auto micro_kernel_sgemm_4x4(
         pb        += 4;
     }
 
-    _mm_storeu_ps(C + 0 * ldc, _mm_add_ps(_mm_loadu_ps(C + 0 * ldc), c0));
-    _mm_storeu_ps(C + 1 * ldc, _mm_add_ps(_mm_loadu_ps(C + 1 * ldc), c1));
-    _mm_storeu_ps(C + 2 * ldc, _mm_add_ps(_mm_loadu_ps(C + 2 * ldc), c2));
-    _mm_storeu_ps(C + 3 * ldc, _mm_add_ps(_mm_loadu_ps(C + 3 * ldc), c3));
+    store_row_ep(C + 0 * ldc, c0, ep, 0);
+    store_row_ep(C + 1 * ldc, c1, ep, 1);
+    store_row_ep(C + 2 * ldc, c2, ep, 2);
+    store_row_ep(C + 3 * ldc, c3, ep, 3);
 }
 
 // ─── DGEMM 4×2 微内核 ───────────────────────────────────────────────────────
@@ -67,7 +110,8 @@ inline auto micro_kernel_dgemm_4x2(
     const double* __restrict B_pack,
     std::int64_t K,
     double* __restrict C,
-    std::int64_t ldc
+    std::int64_t ldc,
+    const TileEpilogue<double>* ep = nullptr
 ) -> void
 {
     __m128d c0 = _mm_setzero_pd();
@@ -92,10 +136,10 @@ inline auto micro_kernel_dgemm_4x2(
         pb         += 2;
     }
 
-    _mm_storeu_pd(C + 0 * ldc, _mm_add_pd(_mm_loadu_pd(C + 0 * ldc), c0));
-    _mm_storeu_pd(C + 1 * ldc, _mm_add_pd(_mm_loadu_pd(C + 1 * ldc), c1));
-    _mm_storeu_pd(C + 2 * ldc, _mm_add_pd(_mm_loadu_pd(C + 2 * ldc), c2));
-    _mm_storeu_pd(C + 3 * ldc, _mm_add_pd(_mm_loadu_pd(C + 3 * ldc), c3));
+    store_row_ep(C + 0 * ldc, c0, ep, 0);
+    store_row_ep(C + 1 * ldc, c1, ep, 1);
+    store_row_ep(C + 2 * ldc, c2, ep, 2);
+    store_row_ep(C + 3 * ldc, c3, ep, 3);
 }
 
 // ─── I32 4×4 微内核（SSE2 无 pmulld，用 4 次标量乘 + pack → add_epi32）─────
@@ -173,4 +217,195 @@ inline auto micro_kernel_i8_i32_4x4(
     }
 }
 
+// ─── u8 × s8 → i32 4×4 微内核（SSE2，pmaddwd）＋ 寄存器内再量化 ─────────────────────
+// SSE2 没有 pmaddubsw（SSSE3），改为把 B 的 4 列 × 4 k 符号扩展为两组 int16、A 的 4 个 u8 零扩展后
+// 以 pmaddwd 相乘：每行得到 (列, k 对) 的部分和，最后两两相加。int16 乘积在 int32 内累加，结果精确。
+
+// 写回一行（4 列）：y = float(acc - comp) · mul + add，F32 直接写；整型 clamp 后就近取整并窄化到 4 字节
+inline auto store_row_q(void* C, std::int64_t ldc, int row, __m128i acc, __m128i comp, __m128 mul, __m128 add, const QTileEpilogue& ep) -> void
+{
+    __m128 y = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(acc, comp)), mul), add);
+    if (ep.out == QGemmOut::F32) {
+        _mm_storeu_ps(static_cast<float*>(C) + row * ldc, y);
+        return;
+    }
+    y                  = _mm_min_ps(_mm_max_ps(y, _mm_set1_ps(ep.lo)), _mm_set1_ps(ep.hi));
+    const __m128i q    = _mm_cvtps_epi32(y);
+    const __m128i w16  = _mm_packs_epi32(q, q);
+    const __m128i w8   = ep.out == QGemmOut::S8 ? _mm_packs_epi16(w16, w16) : _mm_packus_epi16(w16, w16);
+    const auto    bits = _mm_cvtsi128_si32(w8);
+    std::memcpy(static_cast<std::uint8_t*>(C) + row * ldc, &bits, sizeof(bits));
+}
+
+// 一行的两个部分和 (c0 k01, c0 k23, c1 k01, c1 k23) / (c2 …, c3 …) → 4 列
+inline auto hsum_pairs_q(__m128i lo, __m128i hi) -> __m128i
+{
+    const __m128 even = _mm_shuffle_ps(_mm_castsi128_ps(lo), _mm_castsi128_ps(hi), _MM_SHUFFLE(2, 0, 2, 0));
+    const __m128 odd  = _mm_shuffle_ps(_mm_castsi128_ps(lo), _mm_castsi128_ps(hi), _MM_SHUFFLE(3, 1, 3, 1));
+    return _mm_add_epi32(_mm_castps_si128(even), _mm_castps_si128(odd));
+}
+
+inline auto micro_kernel_u8s8_4x4(
+    const std::uint8_t* __restrict A_pack,
+    const std::int8_t* __restrict B_pack,
+    std::int64_t         groups,
+    const QTileEpilogue& ep,
+    void*                C,
+    std::int64_t         ldc
+) -> void
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i       l0 = zero, h0 = zero, l1 = zero, h1 = zero, l2 = zero, h2 = zero, l3 = zero, h3 = zero;
+
+    const std::uint8_t* pa = A_pack;
+    const std::int8_t*  pb = B_pack;
+
+    for (std::int64_t g = 0; g < groups; ++g) {
+        const __m128i b   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pb));
+        const __m128i sgn = _mm_cmpgt_epi8(zero, b);
+        const __m128i blo = _mm_unpacklo_epi8(b, sgn); // 列 0、1
+        const __m128i bhi = _mm_unpackhi_epi8(b, sgn); // 列 2、3
+
+#define DOT_U8S8(row)                                                             \
+    do {                                                                          \
+        std::int32_t a4;                                                          \
+        std::memcpy(&a4, pa + (row) * 4, sizeof(a4));                             \
+        __m128i av = _mm_unpacklo_epi8(_mm_cvtsi32_si128(a4), zero);              \
+        av         = _mm_unpacklo_epi64(av, av);                                  \
+        l##row     = _mm_add_epi32(l##row, _mm_madd_epi16(av, blo));              \
+        h##row     = _mm_add_epi32(h##row, _mm_madd_epi16(av, bhi));              \
+    } while (0)
+        DOT_U8S8(0);
+        DOT_U8S8(1);
+        DOT_U8S8(2);
+        DOT_U8S8(3);
+#undef DOT_U8S8
+
+        pa += 4 * 4;
+        pb += 4 * 4;
+    }
+
+    const __m128i comp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ep.comp));
+    const __m128  mul  = _mm_loadu_ps(ep.mul);
+    const __m128  add  = _mm_loadu_ps(ep.add);
+    store_row_q(C, ldc, 0, hsum_pairs_q(l0, h0), comp, mul, add, ep);
+    store_row_q(C, ldc, 1, hsum_pairs_q(l1, h1), comp, mul, add, ep);
+    store_row_q(C, ldc, 2, hsum_pairs_q(l2, h2), comp, mul, add, ep);
+    store_row_q(C, ldc, 3, hsum_pairs_q(l3, h3), comp, mul, add, ep);
+}
+
+// ─── 窄形状（GEMV / M ≤ MR）向量特征，供 GemvCommon.hpp 的通用内核实例化（fmadd 为 mul+add）
+struct VecF32
+{
+    using V                = __m128;
+    static constexpr int W = 4;
+
+    static auto zero() -> V
+    {
+        return _mm_setzero_ps();
+    }
+
+    static auto set1(float s) -> V
+    {
+        return _mm_set1_ps(s);
+    }
+
+    static auto load(const float* p) -> V
+    {
+        return _mm_loadu_ps(p);
+    }
+
+    static auto load(const Half* p) -> V
+    {
+        return _mm_setr_ps(static_cast<float>(p[0]), static_cast<float>(p[1]), static_cast<float>(p[2]), static_cast<float>(p[3]));
+    }
+
+    // BF16：与 0 交错后各 16 位落在 32 位 lane 的高半部
+    static auto load(const BFloat16* p) -> V
+    {
+        return _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))));
+    }
+
+    static auto add(V a, V b) -> V
+    {
+        return _mm_add_ps(a, b);
+    }
+
+    static auto fmadd(V a, V b, V c) -> V
+    {
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+    }
+
+    static auto store_add(float* p, V v) -> void
+    {
+        _mm_storeu_ps(p, _mm_add_ps(_mm_loadu_ps(p), v));
+    }
+
+    static auto hsum(V v) -> float
+    {
+        __m128 s = _mm_add_ps(v, _mm_movehl_ps(v, v));
+        s        = _mm_add_ss(s, _mm_shuffle_ps(s, s, 0x1));
+        return _mm_cvtss_f32(s);
+    }
+};
+
+struct VecF64
+{
+    using V                = __m128d;
+    static constexpr int W = 2;
+
+    static auto zero() -> V
+    {
+        return _mm_setzero_pd();
+    }
+
+    static auto set1(double s) -> V
+    {
+        return _mm_set1_pd(s);
+    }
+
+    static auto load(const double* p) -> V
+    {
+        return _mm_loadu_pd(p);
+    }
+
+    static auto add(V a, V b) -> V
+    {
+        return _mm_add_pd(a, b);
+    }
+
+    static auto fmadd(V a, V b, V c) -> V
+    {
+        return _mm_add_pd(_mm_mul_pd(a, b), c);
+    }
+
+    static auto store_add(double* p, V v) -> void
+    {
+        _mm_storeu_pd(p, _mm_add_pd(_mm_loadu_pd(p), v));
+    }
+
+    static auto hsum(V v) -> double
+    {
+        return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v)));
+    }
+};
+
+// ─── F16 / BF16 → F32 的 packing 加载策略（PackCommon.hpp 的 Ld）────────────────
+template <typename H>
+struct PackHalf
+{
+    using Src = H;
+
+    static auto row(const H* src, float* dst, std::int64_t n) -> void
+    {
+        std::int64_t i = 0;
+        for (; i + VecF32::W <= n; i += VecF32::W)
+            _mm_storeu_ps(dst + i, VecF32::load(src + i));
+        for (; i < n; ++i)
+            dst[i] = static_cast<float>(src[i]);
+    }
+
+    static auto one(H v) -> float { return static_cast<float>(v); }
+};
+
 } // namespace bee::cpu::gemm::sse2
@@ -12,6 +12,16 @@
  *  - B pack：把 B 的 kc×nc 子块重排为 (nc / NR) 个条带，每条带布局为
  *    [(k=0 的 NR 个元素)(k=1 的 NR 个元素)...]，供微内核逐 k 连续加载 B 向量。
  *
+ * 余数不足 MR 行 / NR 列的最后一个条带补零到满宽，边界 tile 因此与主体走同一个微内核，
+ * 只在写回时截掉补零部分（见 GemmDriver.hpp）。
+ *
+ * 源矩阵以 (行步长, 列步长) 描述，可直接消费转置 / 切片视图而无需先连续化：
+ *  - 列步长为 1（行主序）与行步长为 1（转置）各有一条连续读的快路径；
+ *  - 其余步长逐元素收集。
+ *
+ * 源元素经加载策略 Ld 读入：默认 PackCopy 原样拷贝；16 位浮点源（F16 / BF16）由各 ISA 的
+ * PackHalf 在 packing 时展开为 F32，微内核因此只见 F32 panel。
+ *
  * 若后续某个 ISA 需要专门的交织、转置或预取友好布局，也统一在此文件中扩展。
  */
 
@@ -24,37 +34,97 @@
 namespace bee::cpu::gemm
 {
 
+// ── 加载策略：源元素类型 Src → panel 元素类型 ─────────────────────────────
+// row(src, dst, n)：n 个连续源元素写入 dst；one(v)：单个源元素转换
+template <typename T>
+struct PackCopy
+{
+    using Src = T;
+
+    static auto row(const T* src, T* dst, std::int64_t n) -> void { std::memcpy(dst, src, static_cast<std::size_t>(n) * sizeof(T)); }
+
+    static auto one(T v) -> T { return v; }
+};
+
 // ── A pack（通用模板 T，MR 模板参数）──────────────────────────────────────
-// 源：A[m0..m0+mc, k0..k0+kc]，行距 lda
-// 目标：dst，连续 (mc / MR) 条带 × (kc*MR 元素)
-// 要求 mc 能被 MR 整除；调用方确保或自行处理余数。
-template <typename T, int MR>
-inline auto pack_A_mr(const T* __restrict A, std::int64_t lda, std::int64_t mc, std::int64_t kc, T* __restrict dst) -> void
+// 源：A[m0..m0+mc, k0..k0+kc]，元素 (i, k) 位于 A[i * rsa + k * csa]
+// 目标：dst，连续 ceil(mc / MR) 条带 × (kc*MR 元素)；mc 非 MR 整数倍时最后一个条带补零
+template <typename T, int MR, typename Ld = PackCopy<T>>
+inline auto pack_A_mr(
+    const typename Ld::Src* __restrict A, std::int64_t rsa, std::int64_t csa, std::int64_t mc, std::int64_t kc, T* __restrict dst
+) -> void
 {
-    T* out = dst;
-    for (std::int64_t mi = 0; mi + MR <= mc; mi += MR) {
-        const T* a_base = A + mi * lda;
+    using S = typename Ld::Src;
+
+    T*           out = dst;
+    std::int64_t mi  = 0;
+    for (; mi + MR <= mc; mi += MR) {
+        const S* a_base = A + mi * rsa;
+        if (rsa == 1) {
+            // 转置 A：同一 k 的 MR 个元素在内存中相邻
+            for (std::int64_t k = 0; k < kc; ++k) {
+                Ld::row(a_base + k * csa, out, MR);
+                out += MR;
+            }
+            continue;
+        }
         for (std::int64_t k = 0; k < kc; ++k) {
             for (int r = 0; r < MR; ++r) {
-                out[r] = a_base[r * lda + k];
+                out[r] = Ld::one(a_base[r * rsa + k * csa]);
             }
             out += MR;
         }
     }
+    if (const std::int64_t rows = mc - mi; rows > 0) {
+        const S* a_base = A + mi * rsa;
+        for (std::int64_t k = 0; k < kc; ++k) {
+            for (int r = 0; r < MR; ++r)
+                out[r] = r < rows ? Ld::one(a_base[r * rsa + k * csa]) : T{};
+            out += MR;
+        }
+    }
 }
 
 // ── B pack（通用模板 T，NR 模板参数）──────────────────────────────────────
-// 源：B[k0..k0+kc, n0..n0+nc]，行距 ldb
-// 目标：dst，连续 (nc / NR) 条带 × (kc*NR 元素)
-// 要求 nc 能被 NR 整除。
-template <typename T, int NR>
-inline auto pack_B_nr(const T* __restrict B, std::int64_t ldb, std::int64_t kc, std::int64_t nc, T* __restrict dst) -> void
+// 源：B[k0..k0+kc, n0..n0+nc]，元素 (k, j) 位于 B[k * rsb + j * csb]
+// 目标：dst，连续 ceil(nc / NR) 条带 × (kc*NR 元素)；nc 非 NR 整数倍时最后一个条带补零
+template <typename T, int NR, typename Ld = PackCopy<T>>
+inline auto pack_B_nr(
+    const typename Ld::Src* __restrict B, std::int64_t rsb, std::int64_t csb, std::int64_t kc, std::int64_t nc, T* __restrict dst
+) -> void
 {
-    T* out = dst;
-    for (std::int64_t nj = 0; nj + NR <= nc; nj += NR) {
-        const T* b_base = B + nj;
+    using S = typename Ld::Src;
+
+    T*           out = dst;
+    std::int64_t nj  = 0;
+    for (; nj + NR <= nc; nj += NR) {
+        const S* b_base = B + nj * csb;
+        if (csb == 1) {
+            for (std::int64_t k = 0; k < kc; ++k) {
+                Ld::row(b_base + k * rsb, out, NR);
+                out += NR;
+            }
+        } else if (rsb == 1) {
+            // 转置 B：逐列沿 k 连续读，按 NR 步长写入条带
+            for (int c = 0; c < NR; ++c) {
+                const S* col = b_base + c * csb;
+                for (std::int64_t k = 0; k < kc; ++k)
+                    out[k * NR + c] = Ld::one(col[k]);
+            }
+            out += kc * NR;
+        } else {
+            for (std::int64_t k = 0; k < kc; ++k) {
+                for (int c = 0; c < NR; ++c)
+                    out[c] = Ld::one(b_base[k * rsb + c * csb]);
+                out += NR;
+            }
+        }
+    }
+    if (const std::int64_t cols = nc - nj; cols > 0) {
+        const S* b_base = B + nj * csb;
         for (std::int64_t k = 0; k < kc; ++k) {
-            std::memcpy(out, b_base + k * ldb, static_cast<std::size_t>(NR) * sizeof(T));
+            for (int c = 0; c < NR; ++c)
+                out[c] = c < cols ? Ld::one(b_base[k * rsb + c * csb]) : T{};
             out += NR;
         }
     }
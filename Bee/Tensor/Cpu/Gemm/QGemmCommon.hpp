@@ -0,0 +1,331 @@
+/**
+ * @File Cpu/Gemm/QGemmCommon.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Brief This file is part of Bee.
+ *
+ * 量化 GEMM：A 为 uint8（非对称激活，带 zero point），B 为 int8（对称权重），i32 累加，
+ * 写回时在寄存器内完成再量化（见 Epilogue.hpp 的 QGemmEpilogue），输出 F32 / int8 / uint8。
+ *
+ * 布局：K 方向按 4 个一组（K 补零到 4 的倍数，记 G = ceil(K / 4) 组），对应 vpmaddubsw 一次
+ * 处理的相邻 4 字节：
+ *  - A 条带：[G][MR][4]，每行同一组的 4 个 k 相邻，微内核以 32-bit 广播；
+ *  - B 条带：[G][NR][4]，每列同一组的 4 个 k 相邻，一个寄存器恰好装下 NR 列 × 4 个 k。
+ * 整块 B pack（qgemm_packed_bytes<NR>(K, N) 字节）：
+ *   [P 个列条带，P = ceil(N / NR)][N_pad 个 int32 列和 Σ_k B[k, j]][P 个字节的条带标志]
+ * 列和用于 zero point 补偿：Σ (a - za) · b = acc - za · Σ_k b。
+ * 条带标志记录该条带内每对相邻 k 是否满足 |b0| + |b1| ≤ 128：此时 u8 × s8 的成对和不会使
+ * vpmaddubsw 的 int16 饱和，快速内核结果精确；否则只有 A 块全部 ≤ 127 时才可走快速内核，
+ * 其余情况改用把 A 拆成低 7 位与最高位的精确内核（AVX2）。
+ *
+ * K 方向不分块（再量化只能在完整累加后进行）：A 块行数按 int8 分块的 L2 预算 / K 推导。
+ * i32 累加要求 K ≤ 65793（255 · 128 · K < 2^31）。
+ */
+
+#pragma once
+
+#include "Base/Parallel/ParallelFor.hpp"
+#include "Tensor/Cpu/Gemm/Epilogue.hpp"
+#include "Tensor/Cpu/Gemm/GemmCommon.hpp"
+#include "Tensor/Cpu/Gemm/GemmDriver.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace bee::cpu::gemm
+{
+
+// K 方向分组宽度
+inline constexpr int kQGemmGroup = 4;
+
+inline auto qgemm_groups(std::int64_t K) -> std::int64_t
+{
+    return (K + kQGemmGroup - 1) / kQGemmGroup;
+}
+
+// 整块 B pack 的字节数（布局见文件头）
+template <int NR>
+inline auto qgemm_packed_bytes(std::int64_t K, std::int64_t N) -> std::int64_t
+{
+    const std::int64_t P = (N + NR - 1) / NR;
+    return P * qgemm_groups(K) * NR * kQGemmGroup + P * NR * static_cast<std::int64_t>(sizeof(std::int32_t)) + P;
+}
+
+// ── A pack：A[0..mc, 0..K)（元素 (i, k) 位于 A[i * rsa + k * csa]）→ ceil(mc / MR) 个 [G][MR][4] 条带 ──
+// 返回全部源字节的按位或，供 driver 判断本块是否全部 ≤ 127
+template <int MR>
+inline auto pack_A_u8(const std::uint8_t* __restrict A, std::int64_t rsa, std::int64_t csa, std::int64_t mc, std::int64_t K, std::uint8_t* __restrict dst)
+    -> std::uint8_t
+{
+    const std::int64_t G    = qgemm_groups(K);
+    const std::int64_t Kf   = K / kQGemmGroup * kQGemmGroup;
+    std::uint8_t       bits = 0;
+    std::uint8_t*      out  = dst;
+    for (std::int64_t mi = 0; mi < mc; mi += MR) {
+        const std::int64_t rows = min_i<std::int64_t>(mc - mi, MR);
+        for (std::int64_t g = 0; g < G; ++g) {
+            const std::int64_t k0 = g * kQGemmGroup;
+            for (int r = 0; r < MR; ++r) {
+                std::uint8_t* o = out + r * kQGemmGroup;
+                if (r >= rows) {
+                    std::memset(o, 0, kQGemmGroup);
+                    continue;
+                }
+                const std::uint8_t* a = A + (mi + r) * rsa;
+                if (csa == 1 && k0 < Kf) {
+                    std::memcpy(o, a + k0, kQGemmGroup);
+                } else {
+                    for (int q = 0; q < kQGemmGroup; ++q)
+                        o[q] = k0 + q < K ? a[(k0 + q) * csa] : std::uint8_t{0};
+                }
+                bits |= static_cast<std::uint8_t>(o[0] | o[1] | o[2] | o[3]);
+            }
+            out += MR * kQGemmGroup;
+        }
+    }
+    return bits;
+}
+
+// ── 整块 B pack 的第 p 个列条带：同时写出本条带的列和与成对安全标志 ──────────────
+template <int NR>
+inline auto pack_B_s8_panel(
+    const std::int8_t* B,
+    std::int64_t       rsb,
+    std::int64_t       csb,
+    std::int64_t       K,
+    std::int64_t       N,
+    std::int64_t       p,
+    std::int8_t*       panel,
+    std::int32_t*      colsum,
+    std::uint8_t*      safe
+) -> void
+{
+    const std::int64_t G    = qgemm_groups(K);
+    const std::int64_t j0   = p * NR;
+    const std::int64_t cols = min_i<std::int64_t>(N - j0, NR);
+    bool               ok   = true;
+    for (int c = 0; c < NR; ++c) {
+        std::int32_t sum = 0;
+        for (std::int64_t g = 0; g < G; ++g) {
+            std::int8_t* o = panel + (g * NR + c) * kQGemmGroup;
+            for (int q = 0; q < kQGemmGroup; ++q) {
+                const std::int64_t k = g * kQGemmGroup + q;
+                o[q]                 = c < cols && k < K ? B[k * rsb + (j0 + c) * csb] : std::int8_t{0};
+                sum                 += o[q];
+            }
+            const int pair0 = std::abs(static_cast<int>(o[0])) + std::abs(static_cast<int>(o[1]));
+            const int pair1 = std::abs(static_cast<int>(o[2])) + std::abs(static_cast<int>(o[3]));
+            ok              = ok && pair0 <= 128 && pair1 <= 128;
+        }
+        colsum[j0 + c] = sum;
+    }
+    safe[p] = ok ? 1 : 0;
+}
+
+// 整块 pack 一个 [K, N] 的 int8 矩阵（元素 (k, j) 位于 B[k * rsb + j * csb]）到 dst（qgemm_packed_bytes<NR>(K, N) 字节）
+template <int NR>
+inline auto pack_B_s8_full(const std::int8_t* B, std::int64_t rsb, std::int64_t csb, std::int64_t K, std::int64_t N, void* dst) -> void
+{
+    const std::int64_t P      = (N + NR - 1) / NR;
+    const std::int64_t stride = qgemm_groups(K) * NR * kQGemmGroup;
+    auto*              panels = static_cast<std::int8_t*>(dst);
+    auto*              colsum = reinterpret_cast<std::int32_t*>(panels + P * stride);
+    auto*              safe   = reinterpret_cast<std::uint8_t*>(colsum + P * NR);
+    auto               run    = [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t t = lo; t < hi; ++t) {
+            const auto p = static_cast<std::int64_t>(t);
+            pack_B_s8_panel<NR>(B, rsb, csb, K, N, p, panels + p * stride, colsum, safe);
+        }
+    };
+    if (K * N >= detail::kGemmPackParallelElems)
+        ::bee::parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(P), std::size_t{1}, run);
+    else
+        run(0, static_cast<std::size_t>(P));
+}
+
+// ── 标量写回（参考内核与边界 tile 共用）──────────────────────────────────────
+inline auto qgemm_store_scalar(std::int32_t acc, int j, const QTileEpilogue& ep, void* C, std::int64_t idx) -> void
+{
+    float y = static_cast<float>(acc - ep.comp[j]) * ep.mul[j] + ep.add[j];
+    if (ep.out == QGemmOut::F32) {
+        static_cast<float*>(C)[idx] = y;
+        return;
+    }
+    y = y > ep.lo ? y : ep.lo; // NaN 落到 lo，与 SIMD max 一致
+    y = y < ep.hi ? y : ep.hi;
+    const auto q = static_cast<std::int32_t>(std::nearbyint(y));
+    if (ep.out == QGemmOut::S8)
+        static_cast<std::int8_t*>(C)[idx] = static_cast<std::int8_t>(q);
+    else
+        static_cast<std::uint8_t*>(C)[idx] = static_cast<std::uint8_t>(q);
+}
+
+// ── 参考微内核：精确 i32 累加 + 标量写回（标量 ISA 使用）─────────────────────
+template <int MR, int NR>
+inline auto micro_kernel_u8s8_ref(
+    const std::uint8_t* __restrict A_pack,
+    const std::int8_t* __restrict B_pack,
+    std::int64_t         groups,
+    const QTileEpilogue& ep,
+    void*                C,
+    std::int64_t         ldc
+) -> void
+{
+    std::int32_t acc[MR][NR] = {};
+    for (std::int64_t g = 0; g < groups; ++g) {
+        const std::uint8_t* pa = A_pack + g * MR * kQGemmGroup;
+        const std::int8_t*  pb = B_pack + g * NR * kQGemmGroup;
+        for (int r = 0; r < MR; ++r)
+            for (int c = 0; c < NR; ++c)
+                for (int q = 0; q < kQGemmGroup; ++q)
+                    acc[r][c] += static_cast<std::int32_t>(pa[r * kQGemmGroup + q]) * static_cast<std::int32_t>(pb[c * kQGemmGroup + q]);
+    }
+    for (int r = 0; r < MR; ++r)
+        for (int c = 0; c < NR; ++c)
+            qgemm_store_scalar(acc[r][c], c, ep, C, r * ldc + c);
+}
+
+namespace detail
+{
+
+    // 输出元素字节数
+    inline auto qgemm_out_bytes(QGemmOut out) -> std::size_t
+    {
+        return out == QGemmOut::F32 ? sizeof(float) : 1;
+    }
+
+    // 逐列的再量化系数（N_pad 项，补零列为 0）
+    struct QGemmColumns
+    {
+        std::vector<std::int32_t> comp;
+        std::vector<float>        mul;
+        std::vector<float>        add;
+        float                     lo = 0.0f;
+        float                     hi = 0.0f;
+    };
+
+    inline auto qgemm_columns(const QGemmEpilogue& ep, std::int64_t N, std::int64_t N_pad, const std::int32_t* colsum) -> QGemmColumns
+    {
+        QGemmColumns cols;
+        cols.comp.assign(static_cast<std::size_t>(N_pad), 0);
+        cols.mul.assign(static_cast<std::size_t>(N_pad), 0.0f);
+        cols.add.assign(static_cast<std::size_t>(N_pad), 0.0f);
+
+        const bool  quant = ep.out != QGemmOut::F32;
+        const float inv   = quant ? 1.0f / ep.out_scale : 1.0f;
+        const float zp    = quant ? static_cast<float>(ep.out_zero_point) : 0.0f;
+        for (std::int64_t j = 0; j < N; ++j) {
+            const auto  u = static_cast<std::size_t>(j);
+            const float s = ep.a_scale * ep.b_scale[j * ep.b_scale_stride];
+            cols.comp[u]  = ep.a_zero_point * colsum[j];
+            cols.mul[u]   = s * inv;
+            cols.add[u]   = (ep.bias != nullptr ? ep.bias[j] * inv : 0.0f) + zp;
+        }
+        cols.lo = ep.out == QGemmOut::S8 ? -128.0f : 0.0f;
+        cols.hi = ep.out == QGemmOut::S8 ? 127.0f : 255.0f;
+        return cols;
+    }
+
+    // 量化 GEMM driver：C 为行主序 [M, N]（元素类型由 ep.out 决定）。
+    // 任务 = ic 行块 × 列组（与浮点 driver 相同的二维划分）；每个行块 pack 一次 A，
+    // 逐条带按 "B 条带安全 || A 块 ≤ 127" 选择快速内核或精确内核。
+    template <int MR, int NR, typename MicroFast, typename MicroExact>
+    inline auto qgemm_driver(
+        std::int64_t         M,
+        std::int64_t         K,
+        std::int64_t         N,
+        const std::uint8_t*  A,
+        std::int64_t         rsa,
+        std::int64_t         csa,
+        const void*          B_full,
+        const QGemmEpilogue& ep,
+        void*                C,
+        MicroFast            fast,
+        MicroExact           exact
+    ) -> void
+    {
+        if (M == 0 || N == 0)
+            return;
+
+        const std::int64_t G      = qgemm_groups(K);
+        const std::int64_t P      = (N + NR - 1) / NR;
+        const std::int64_t stride = G * NR * kQGemmGroup;
+        const auto*        panels = static_cast<const std::int8_t*>(B_full);
+        const auto*        colsum = reinterpret_cast<const std::int32_t*>(panels + P * stride);
+        const auto*        safe   = reinterpret_cast<const std::uint8_t*>(colsum + P * NR);
+
+        const QGemmColumns cols = qgemm_columns(ep, N, P * NR, colsum);
+        const std::size_t  esz  = qgemm_out_bytes(ep.out);
+        auto*              out  = static_cast<std::uint8_t*>(C);
+
+        // A 块：沿用 int8 分块的 MC × KC 字节预算，K 不分块时按 K 折算行数
+        const GemmBlocking& bk     = gemm_blocking<std::int8_t, MR, NR>();
+        const std::int64_t  Kp     = G * kQGemmGroup;
+        const std::int64_t  budget = bk.mc * bk.kc;
+        const std::int64_t  mc_max = std::max<std::int64_t>(MR, min_i<std::int64_t>(budget / std::max<std::int64_t>(Kp, 1), bk.mc) / MR * MR);
+
+        const bool         par        = M * K * N >= kGemmParallelFlops;
+        const std::int64_t row_tasks  = (M + mc_max - 1) / mc_max;
+        std::int64_t       num_groups = 1;
+        if (par)
+            num_groups = gemm_col_groups(row_tasks, P, static_cast<std::int64_t>(::bee::parallel::available_parallelism()));
+        const std::int64_t group_panels = std::max<std::int64_t>(1, (P + num_groups - 1) / num_groups);
+        num_groups                      = std::max<std::int64_t>(1, (P + group_panels - 1) / group_panels);
+
+        auto run = [&](std::size_t lo, std::size_t hi) {
+            auto* A_pack = static_cast<std::uint8_t*>(thread_local_a_pack_buffer(static_cast<std::size_t>(mc_max * std::max<std::int64_t>(Kp, 1))));
+            for (std::size_t t = lo; t < hi; ++t) {
+                const std::int64_t g  = static_cast<std::int64_t>(t) % num_groups;
+                const std::int64_t ic = static_cast<std::int64_t>(t) / num_groups * mc_max;
+                const std::int64_t mc = min_i<std::int64_t>(M - ic, mc_max);
+                const std::int64_t p0 = g * group_panels;
+                const std::int64_t p1 = min_i<std::int64_t>(P, p0 + group_panels);
+                if (p1 <= p0)
+                    continue;
+                const bool a_small = (pack_A_u8<MR>(A + ic * rsa, rsa, csa, mc, K, A_pack) & 0x80U) == 0;
+
+                for (std::int64_t p = p0; p < p1; ++p) {
+                    const std::int64_t  jr       = p * NR;
+                    const std::int64_t  nc       = min_i<std::int64_t>(N - jr, NR);
+                    const std::int8_t*  Bp       = panels + p * stride;
+                    const bool          use_fast = a_small || safe[p] != 0;
+                    const QTileEpilogue te{cols.comp.data() + jr, cols.mul.data() + jr, cols.add.data() + jr, cols.lo, cols.hi, ep.out};
+                    for (std::int64_t ir = 0; ir < mc; ir += MR) {
+                        const std::uint8_t* Ap   = A_pack + (ir / MR) * G * MR * kQGemmGroup;
+                        const std::int64_t  rows = min_i<std::int64_t>(mc - ir, MR);
+                        std::uint8_t*       Ct   = out + ((ic + ir) * N + jr) * static_cast<std::int64_t>(esz);
+                        if (rows == MR && nc == NR) {
+                            if (use_fast)
+                                fast(Ap, Bp, G, te, Ct, N);
+                            else
+                                exact(Ap, Bp, G, te, Ct, N);
+                            continue;
+                        }
+                        // 边界 tile：在栈上写满 MR × NR，再拷回有效部分
+                        alignas(64) float tile[MR * NR];
+                        if (use_fast)
+                            fast(Ap, Bp, G, te, tile, static_cast<std::int64_t>(NR));
+                        else
+                            exact(Ap, Bp, G, te, tile, static_cast<std::int64_t>(NR));
+                        const auto* src = reinterpret_cast<const std::uint8_t*>(tile);
+                        for (std::int64_t r = 0; r < rows; ++r)
+                            std::memcpy(Ct + r * N * static_cast<std::int64_t>(esz), src + r * NR * esz, static_cast<std::size_t>(nc) * esz);
+                    }
+                }
+            }
+        };
+
+        const auto tasks = static_cast<std::size_t>(row_tasks * num_groups);
+        if (par)
+            ::bee::parallel::parallel_for(std::size_t{0}, tasks, std::size_t{1}, run);
+        else
+            run(0, tasks);
+    }
+
+} // namespace detail
+
+} // namespace bee::cpu::gemm
@@ -0,0 +1,301 @@
+#pragma once
+
+// CPU 索引类内核：index_select / gather / scatter / scatter_add / embedding_bag
+// - 随机访问的源行提前 kIdxPrefetchDist 个位置做软件预取（每行至多 kIdxPrefetchLines 条缓存行）
+// - 行拷贝按元素宽度整行 copy_n；行累加走 SimdBackend
+// - scatter 的写冲突只发生在同一 (o, i) 列内：按 (o, i 块) 切分任务即无冲突，且 j 顺序与串行一致；
+//   列数不足以并行（如 1D scatter_add）而 J 较大时改为沿 j 并行，见 scatter_add_split_column；
+//   是否改走该路径只看形状，同一输入在任意线程数下的浮点求和顺序相同
+
+#include "SIMD/SIMD.hpp"
+#include "Base/Parallel/ParallelFor.hpp"
+#include "Base/Parallel/ThreadPool.hpp"
+#include "Tensor/Cpu/IndexGeom.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define BEE_INDEX_PREFETCH(p) __builtin_prefetch((p), 0, 3)
+#else
+    #define BEE_INDEX_PREFETCH(p) ((void)(p))
+#endif
+
+namespace bee::cpu
+{
+
+inline constexpr std::int64_t kIdxGrainBytes       = 64 * 1024; // 每个并行任务处理的输出字节数
+inline constexpr std::int64_t kIdxPrefetchDist     = 8;         // 预取提前的行（元素）数
+inline constexpr std::int64_t kIdxPrefetchLines    = 4;         // 每行至多预取的缓存行数
+inline constexpr std::int64_t kScatterColBlock     = 256;       // scatter 任务的列块（元素）
+inline constexpr std::int64_t kScatterSplitMinJ    = 4096;      // 列并行不足时，J 不小于该值才沿 j 并行
+inline constexpr std::int64_t kScatterSplitMaxTask = 4;         // 列块任务少于该值视为列并行不足（与线程数无关）
+inline constexpr std::int64_t kScatterPartialBlock = 16 * 1024; // 部分和路径的 j 块大小，同时是该路径的目标数上限
+
+// parallel_for 的 int64 外壳：fn(lo, hi) 处理 [lo, hi)
+template <typename Fn>
+inline void idx_parallel_for(std::int64_t n, std::int64_t grain, Fn&& fn)
+{
+    parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(n), static_cast<std::size_t>(grain), [&](std::size_t lo, std::size_t hi) {
+        fn(static_cast<std::int64_t>(lo), static_cast<std::int64_t>(hi));
+    });
+}
+
+inline void idx_prefetch_row(const void* p, std::int64_t bytes)
+{
+    const auto*        c = static_cast<const char*>(p);
+    const std::int64_t n = std::min(kIdxPrefetchLines * 64, bytes);
+    for (std::int64_t b = 0; b < n; b += 64)
+        BEE_INDEX_PREFETCH(c + b);
+}
+
+template <typename T, typename ISA>
+inline void idx_row_add(T* acc, const T* x, std::int64_t n)
+{
+    using B          = simd::SimdBackend<T, ISA>;
+    constexpr auto V = static_cast<std::int64_t>(B::width);
+    std::int64_t   i = 0;
+    for (; i + V <= n; i += V)
+        B::storeu(acc + i, B::add(B::loadu(acc + i), B::loadu(x + i)));
+    for (; i < n; ++i)
+        acc[i] += x[i];
+}
+
+// acc += w · x（先乘后加，与标量路径舍入一致）
+template <typename T, typename ISA>
+inline void idx_row_axpy(T* acc, T w, const T* x, std::int64_t n)
+{
+    using B           = simd::SimdBackend<T, ISA>;
+    constexpr auto V  = static_cast<std::int64_t>(B::width);
+    const auto     vw = B::set1(w);
+    std::int64_t   i  = 0;
+    for (; i + V <= n; i += V)
+        B::storeu(acc + i, B::add(B::loadu(acc + i), B::mul(vw, B::loadu(x + i))));
+    for (; i < n; ++i)
+        acc[i] += w * x[i];
+}
+
+// ─── index_select ───────────────────────────────────────────────────────────
+
+// 输出 O·J 行、每行 I 个元素，按行并行；预取同一 o 内第 j + dist 个源行
+template <typename U>
+inline void cpu_index_select(const IndexGeom& g, const U* src, const std::int64_t* idx, U* dst)
+{
+    const std::int64_t rows      = g.O * g.J;
+    const auto         row_bytes = static_cast<std::int64_t>(g.I * sizeof(U));
+    const std::int64_t grain     = std::max<std::int64_t>(1, kIdxGrainBytes / std::max<std::int64_t>(1, row_bytes));
+
+    idx_parallel_for(rows, grain, [&](std::int64_t lo, std::int64_t hi) {
+        std::int64_t o = lo / g.J;
+        std::int64_t j = lo - o * g.J;
+        for (std::int64_t r = lo; r < hi; ++r) {
+            const U* base = src + o * g.N * g.I;
+            if (j + kIdxPrefetchDist < g.J)
+                idx_prefetch_row(base + idx[j + kIdxPrefetchDist] * g.I, row_bytes);
+            std::copy_n(base + idx[j] * g.I, g.I, dst + r * g.I);
+            if (++j == g.J) {
+                j = 0;
+                ++o;
+            }
+        }
+    });
+}
+
+// ─── gather ─────────────────────────────────────────────────────────────────
+
+// out[o, j, i] = src[o, idx[o, j, i], i]；I == 1 时每行仅一个元素，改为沿 j 预取
+template <typename U>
+inline void cpu_gather(const IndexGeom& g, const U* src, const std::int64_t* idx, U* dst)
+{
+    const std::int64_t rows  = g.O * g.J;
+    const std::int64_t grain = std::max<std::int64_t>(1, kIdxGrainBytes / static_cast<std::int64_t>(g.I * sizeof(U)));
+
+    idx_parallel_for(rows, grain, [&](std::int64_t lo, std::int64_t hi) {
+        std::int64_t o = lo / g.J;
+        std::int64_t j = lo - o * g.J;
+        for (std::int64_t r = lo; r < hi; ++r) {
+            const U*            base = src + o * g.N * g.I;
+            const std::int64_t* id   = idx + r * g.I;
+            U*                  out  = dst + r * g.I;
+            if (g.I == 1) {
+                if (j + kIdxPrefetchDist < g.J)
+                    BEE_INDEX_PREFETCH(base + id[kIdxPrefetchDist]);
+                out[0] = base[id[0]];
+            } else {
+                for (std::int64_t i = 0; i < g.I; ++i) {
+                    if (i + kIdxPrefetchDist < g.I)
+                        BEE_INDEX_PREFETCH(base + id[i + kIdxPrefetchDist] * g.I + i + kIdxPrefetchDist);
+                    out[i] = base[id[i] * g.I + i];
+                }
+            }
+            if (++j == g.J) {
+                j = 0;
+                ++o;
+            }
+        }
+    });
+}
+
+// ─── scatter / scatter_add ──────────────────────────────────────────────────
+
+// 按 (o, i 块) 切分任务：不同任务写入的列互不相交；fn(o, i0, i1) 处理一个任务内全部 j
+template <typename Fn>
+inline void scatter_for_each_column_block(const IndexGeom& g, Fn&& fn)
+{
+    const std::int64_t iblk  = std::min(g.I, kScatterColBlock);
+    const std::int64_t nblk  = (g.I + iblk - 1) / iblk;
+    const std::int64_t tasks = g.O * nblk;
+    const std::int64_t grain = std::max<std::int64_t>(1, kIdxGrainBytes / std::max<std::int64_t>(1, g.J * iblk * 8));
+
+    idx_parallel_for(tasks, grain, [&](std::int64_t lo, std::int64_t hi) {
+        for (std::int64_t t = lo; t < hi; ++t) {
+            const std::int64_t o  = t / nblk;
+            const std::int64_t i0 = (t - o * nblk) * iblk;
+            fn(o, i0, std::min(g.I, i0 + iblk));
+        }
+    });
+}
+
+// dst 已是 a 的副本；同一位置被多次写入时保留 j 最大者（与串行顺序一致）
+template <typename U>
+inline void cpu_scatter(const IndexGeom& g, const std::int64_t* idx, const U* src, U* dst)
+{
+    scatter_for_each_column_block(g, [&](std::int64_t o, std::int64_t i0, std::int64_t i1) {
+        U* out = dst + o * g.N * g.I;
+        for (std::int64_t j = 0; j < g.J; ++j) {
+            const std::int64_t  r  = (o * g.J + j) * g.I;
+            const std::int64_t* id = idx + r;
+            for (std::int64_t i = i0; i < i1; ++i)
+                out[id[i] * g.I + i] = src[r + i];
+        }
+    });
+}
+
+// 单列 (o, i) 沿 j 的并行归约：J 较大而列数不足以并行时使用
+// - 目标少（N ≤ kScatterPartialBlock）：按固定大小的 j 块累加到各块私有的部分和，再按块序归约到输出；
+//   块划分与线程数无关：每个目标按块号、块内按 j 的顺序求和，结果确定（浮点求和顺序与串行不同）
+// - 目标多：按目标区间划分任务，每个任务扫描全部 j、只处理落在自己区间内的索引；无冲突且保持 j 顺序
+template <typename T>
+inline void scatter_add_split_column(
+    const IndexGeom& g, std::int64_t o, std::int64_t i, const std::int64_t* idx, const T* src, T* dst, std::vector<T>& partial
+)
+{
+    const std::int64_t base = o * g.J * g.I + i;
+    T*                 out  = dst + o * g.N * g.I + i;
+
+    if (g.N <= kScatterPartialBlock) {
+        const std::int64_t nblk = (g.J + kScatterPartialBlock - 1) / kScatterPartialBlock;
+        partial.assign(static_cast<std::size_t>(nblk * g.N), T{0});
+        idx_parallel_for(nblk, 1, [&](std::int64_t lo, std::int64_t hi) {
+            for (std::int64_t b = lo; b < hi; ++b) {
+                T*                 acc = partial.data() + b * g.N;
+                const std::int64_t j1  = std::min(g.J, (b + 1) * kScatterPartialBlock);
+                for (std::int64_t j = b * kScatterPartialBlock; j < j1; ++j)
+                    acc[idx[base + j * g.I]] += src[base + j * g.I];
+            }
+        });
+        const std::int64_t grain = std::max<std::int64_t>(1, kIdxGrainBytes / (nblk * static_cast<std::int64_t>(sizeof(T))));
+        idx_parallel_for(g.N, grain, [&](std::int64_t lo, std::int64_t hi) {
+            for (std::int64_t t = lo; t < hi; ++t) {
+                T acc = out[t * g.I];
+                for (std::int64_t b = 0; b < nblk; ++b)
+                    acc += partial[static_cast<std::size_t>(b * g.N + t)];
+                out[t * g.I] = acc;
+            }
+        });
+        return;
+    }
+
+    const auto         par  = static_cast<std::int64_t>(parallel::available_parallelism());
+    const std::int64_t span = (g.N + par - 1) / par;
+    idx_parallel_for(par, 1, [&](std::int64_t lo, std::int64_t hi) {
+        const std::int64_t t0 = lo * span;
+        const std::int64_t t1 = std::min(g.N, hi * span);
+        for (std::int64_t j = 0; j < g.J; ++j) {
+            const std::int64_t t = idx[base + j * g.I];
+            if (t >= t0 && t < t1)
+                out[t * g.I] += src[base + j * g.I];
+        }
+    });
+}
+
+// dst 已是 a 的副本；out[o, idx[o, j, i], i] += src[o, j, i]，各位置按 j 升序累加
+template <typename T, typename ISA>
+inline void cpu_scatter_add(const IndexGeom& g, const std::int64_t* idx, const T* src, T* dst)
+{
+    const std::int64_t tasks = g.O * ((g.I + kScatterColBlock - 1) / kScatterColBlock);
+    if (tasks < kScatterSplitMaxTask && g.J >= kScatterSplitMinJ) {
+        std::vector<T> partial;
+        for (std::int64_t o = 0; o < g.O; ++o)
+            for (std::int64_t i = 0; i < g.I; ++i)
+                scatter_add_split_column(g, o, i, idx, src, dst, partial);
+        return;
+    }
+
+    // 列块不短于一个寄存器时才检查整段索引是否恒定
+    constexpr auto kRowMin = static_cast<std::int64_t>(simd::SimdBackend<T, ISA>::width);
+    scatter_for_each_column_block(g, [&](std::int64_t o, std::int64_t i0, std::int64_t i1) {
+        T* out = dst + o * g.N * g.I;
+        if (g.I == 1) {
+            const std::int64_t* id = idx + o * g.J;
+            const T*            s  = src + o * g.J;
+            for (std::int64_t j = 0; j < g.J; ++j)
+                out[id[j]] += s[j];
+            return;
+        }
+        for (std::int64_t j = 0; j < g.J; ++j) {
+            const std::int64_t  r  = (o * g.J + j) * g.I;
+            const std::int64_t* id = idx + r;
+            // 常见情形：索引沿 i 恒定（由 index_add 式用法展开而来），整段行累加走 SIMD
+            const bool uniform = i1 - i0 >= kRowMin && std::all_of(id + i0 + 1, id + i1, [&](std::int64_t v) { return v == id[i0]; });
+            if (uniform) {
+                if (j + kIdxPrefetchDist < g.J)
+                    BEE_INDEX_PREFETCH(out + id[i0 + kIdxPrefetchDist * g.I] * g.I + i0);
+                idx_row_add<T, ISA>(out + id[i0] * g.I + i0, src + r + i0, i1 - i0);
+            } else {
+                for (std::int64_t i = i0; i < i1; ++i)
+                    out[id[i] * g.I + i] += src[r + i];
+            }
+        }
+    });
+}
+
+// ─── embedding_bag ──────────────────────────────────────────────────────────
+
+// 按 bag 并行；每个 bag 在输出行上累加所选 weight 行，预取第 k + dist 个索引对应的行
+template <typename T, typename ISA>
+inline void cpu_embedding_bag(
+    const EmbeddingBagGeom& g, const T* weight, const std::int64_t* idx, const std::int64_t* offsets, const T* psw, T* out
+)
+{
+    const std::int64_t row_bytes = g.D * static_cast<std::int64_t>(sizeof(T));
+    const std::int64_t avg_bag   = std::max<std::int64_t>(1, g.L / std::max<std::int64_t>(1, g.B));
+    const std::int64_t grain     = std::max<std::int64_t>(1, kIdxGrainBytes / std::max<std::int64_t>(1, avg_bag * row_bytes));
+
+    idx_parallel_for(g.B, grain, [&](std::int64_t lo, std::int64_t hi) {
+        for (std::int64_t b = lo; b < hi; ++b) {
+            const std::int64_t s   = offsets[b];
+            const std::int64_t e   = b + 1 < g.B ? offsets[b + 1] : g.L;
+            T*                 acc = out + b * g.D;
+            std::fill_n(acc, g.D, T{0});
+            for (std::int64_t k = s; k < e; ++k) {
+                if (k + kIdxPrefetchDist < e)
+                    idx_prefetch_row(weight + idx[k + kIdxPrefetchDist] * g.D, row_bytes);
+                const T* row = weight + idx[k] * g.D;
+                if (psw != nullptr)
+                    idx_row_axpy<T, ISA>(acc, psw[k], row, g.D);
+                else
+                    idx_row_add<T, ISA>(acc, row, g.D);
+            }
+            if (g.mean && e > s) {
+                const auto cnt = static_cast<T>(e - s);
+                for (std::int64_t d = 0; d < g.D; ++d)
+                    acc[d] /= cnt;
+            }
+        }
+    });
+}
+
+} // namespace bee::cpu
@@ -0,0 +1,33 @@
+#pragma once
+
+// 索引类算子（index_select / gather / scatter / embedding_bag）的几何参数，供 Ops 层、运行期分派与 CPU 内核共享
+
+#include <cstdint>
+
+namespace bee::cpu
+{
+
+// 以 dim 为界把张量折叠成三维：数据侧 {O, N, I}，索引侧 {O, J, I}（均连续）
+//   index_select：index 为 {J}，out[o, j, i] = a[o, index[j], i]
+//   gather      ：index 为 {O, J, I}，out[o, j, i] = a[o, index[o, j, i], i]
+//   scatter(_add)：out[o, index[o, j, i], i] (+)= src[o, j, i]
+struct IndexGeom
+{
+    std::int64_t O = 1; // dim 之前各维之积
+    std::int64_t N = 0; // 数据侧 dim 维长度
+    std::int64_t J = 0; // 索引侧 dim 维长度
+    std::int64_t I = 1; // dim 之后各维之积
+};
+
+// embedding_bag：weight={N, D}，indices={L}，offsets={B}（第 b 个 bag 为 [offsets[b], offsets[b+1])，末个到 L）
+// out={B, D}；per_sample_weights 与 indices 同长，仅 sum 模式使用
+struct EmbeddingBagGeom
+{
+    std::int64_t N    = 0;
+    std::int64_t D    = 0;
+    std::int64_t L    = 0;
+    std::int64_t B    = 0;
+    bool         mean = false;
+};
+
+} // namespace bee::cpu
@@ -0,0 +1,188 @@
+#pragma once
+
+// CPU 掩码压缩内核：count_nonzero / nonzero / masked_select 共用的两遍并行压缩
+// - 掩码（1 字节元素，非 0 即选中）按固定 kMaskChunk 字节分块（见 MaskGeom.hpp）
+// - 第一遍：各块独立统计选中数（64 字节一组取位掩码后 popcount）
+// - 调用方对块计数做独占前缀和、一次性分配输出
+// - 第二遍：各块从自身偏移开始写出，组内按位掩码的最低置位逐个遍历
+// - 64 字节位掩码：SSE2 / AVX2 用 cmpeq + movemask，AVX-512 用 test_epi8_mask；其余走标量
+
+#include "SIMD/SIMD.hpp"
+#include "Base/Parallel/ParallelFor.hpp"
+#include "Tensor/Cpu/MaskGeom.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(BEE_SIMD_ENABLE_SSE2)
+    #include <emmintrin.h>
+#endif
+#if defined(BEE_SIMD_ENABLE_AVX2) || defined(BEE_SIMD_ENABLE_AVX512)
+    #include <immintrin.h>
+#endif
+
+namespace bee::cpu
+{
+
+// 64 字节掩码 → 位 i 表示 m[i] != 0
+template <typename ISA>
+inline auto mask_bits64(const std::uint8_t* m) -> std::uint64_t
+{
+    std::uint64_t bits = 0;
+    for (int i = 0; i < 64; ++i)
+        bits |= static_cast<std::uint64_t>(m[i] != 0) << i;
+    return bits;
+}
+
+#if defined(BEE_SIMD_ENABLE_SSE2)
+template <>
+inline auto mask_bits64<simd::IsaSse2>(const std::uint8_t* m) -> std::uint64_t
+{
+    const __m128i z    = _mm_setzero_si128();
+    std::uint64_t zero = 0;
+    for (int i = 0; i < 4; ++i) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(m + 16 * i));
+        zero |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, z)))) << (16 * i);
+    }
+    return ~zero;
+}
+#endif
+
+#if defined(BEE_SIMD_ENABLE_AVX2)
+template <>
+inline auto mask_bits64<simd::IsaAvx2>(const std::uint8_t* m) -> std::uint64_t
+{
+    const __m256i z  = _mm256_setzero_si256();
+    const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(m));
+    const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(m + 32));
+    const auto    lo = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v0, z)));
+    const auto    hi = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v1, z)));
+    return ~(static_cast<std::uint64_t>(hi) << 32 | lo);
+}
+#endif
+
+#if defined(BEE_SIMD_ENABLE_AVX512)
+template <>
+inline auto mask_bits64<simd::IsaAvx512>(const std::uint8_t* m) -> std::uint64_t
+{
+    const __m512i v = _mm512_loadu_si512(m);
+    return _mm512_test_epi8_mask(v, v);
+}
+#endif
+
+// 遍历 [0, n) 内的选中位置：fn(i) 按升序调用
+template <typename ISA, typename Fn>
+inline void mask_for_each(const std::uint8_t* m, std::int64_t n, Fn&& fn)
+{
+    std::int64_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        for (std::uint64_t bits = mask_bits64<ISA>(m + i); bits != 0; bits &= bits - 1)
+            fn(i + std::countr_zero(bits));
+    }
+    for (; i < n; ++i) {
+        if (m[i] != 0)
+            fn(i);
+    }
+}
+
+// 第一遍：counts[c] = 第 c 块的选中数，c ∈ [0, mask_chunk_count(n))
+template <typename ISA>
+auto cpu_mask_chunk_counts(const std::uint8_t* m, std::int64_t n, std::int64_t* counts) -> void
+{
+    const std::int64_t chunks = mask_chunk_count(n);
+    parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(chunks), std::size_t{1}, [&](std::size_t c0, std::size_t c1) {
+        for (auto c = static_cast<std::int64_t>(c0); c < static_cast<std::int64_t>(c1); ++c) {
+            const std::uint8_t* p   = m + c * kMaskChunk;
+            const std::int64_t  len = std::min(kMaskChunk, n - c * kMaskChunk);
+            std::int64_t        cnt = 0;
+            std::int64_t        i   = 0;
+            for (; i + 64 <= len; i += 64)
+                cnt += std::popcount(mask_bits64<ISA>(p + i));
+            for (; i < len; ++i)
+                cnt += p[i] != 0 ? 1 : 0;
+            counts[c] = cnt;
+        }
+    });
+}
+
+// 第二遍的块遍历骨架：fn(c, base, len) 处理第 c 块 [base, base + len)
+template <typename Fn>
+inline void mask_parallel_chunks(std::int64_t n, Fn&& fn)
+{
+    const std::int64_t chunks = mask_chunk_count(n);
+    parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(chunks), std::size_t{1}, [&](std::size_t c0, std::size_t c1) {
+        for (auto c = static_cast<std::int64_t>(c0); c < static_cast<std::int64_t>(c1); ++c)
+            fn(c, c * kMaskChunk, std::min(kMaskChunk, n - c * kMaskChunk));
+    });
+}
+
+// nonzero：第 k 个选中位置的多维坐标写入 out[k * ndim, (k + 1) * ndim)；offsets 为块计数的独占前缀和
+template <typename ISA>
+auto cpu_mask_nonzero(const std::uint8_t* m, std::int64_t n, const std::int64_t* offsets, int ndim, const std::int64_t* shape, std::int64_t* out)
+    -> void
+{
+    if (ndim == 1) {
+        mask_parallel_chunks(n, [&](std::int64_t c, std::int64_t base, std::int64_t len) {
+            std::int64_t* dst = out + offsets[c];
+            mask_for_each<ISA>(m + base, len, [&](std::int64_t i) { *dst++ = base + i; });
+        });
+        return;
+    }
+    // 缓存当前末维行的前缀坐标：只有跨行时才做整数除法展开，行内命中只算末维偏移
+    const std::int64_t last = shape[ndim - 1];
+    mask_parallel_chunks(n, [&](std::int64_t c, std::int64_t base, std::int64_t len) {
+        std::int64_t*             dst = out + offsets[c] * ndim;
+        std::vector<std::int64_t> prefix(static_cast<std::size_t>(ndim - 1));
+        std::int64_t              row_lo = -1;
+        mask_for_each<ISA>(m + base, len, [&](std::int64_t i) {
+            const std::int64_t flat = base + i;
+            if (row_lo < 0 || flat - row_lo >= last) {
+                std::int64_t row = flat / last;
+                row_lo           = row * last;
+                for (int d = ndim - 2; d >= 0; --d) {
+                    prefix[static_cast<std::size_t>(d)] = row % shape[d];
+                    row /= shape[d];
+                }
+            }
+            std::copy(prefix.begin(), prefix.end(), dst);
+            dst[ndim - 1] = flat - row_lo;
+            dst += ndim;
+        });
+    });
+}
+
+// masked_select：按升序拷贝选中元素（es 字节）到 dst；offsets 同上
+template <typename ISA>
+auto cpu_mask_select(const std::uint8_t* m, std::int64_t n, const std::int64_t* offsets, const void* src, std::size_t es, void* dst) -> void
+{
+    auto run = [&]<typename U>() {
+        const auto* s = static_cast<const U*>(src);
+        auto*       d = static_cast<U*>(dst);
+        mask_parallel_chunks(n, [&](std::int64_t c, std::int64_t base, std::int64_t len) {
+            U* out = d + offsets[c];
+            mask_for_each<ISA>(m + base, len, [&](std::int64_t i) { *out++ = s[base + i]; });
+        });
+    };
+    switch (es) {
+    case 1: run.template operator()<std::uint8_t>(); return;
+    case 2: run.template operator()<std::uint16_t>(); return;
+    case 4: run.template operator()<std::uint32_t>(); return;
+    case 8: run.template operator()<std::uint64_t>(); return;
+    default: break;
+    }
+    const auto* s = static_cast<const std::uint8_t*>(src);
+    auto*       d = static_cast<std::uint8_t*>(dst);
+    mask_parallel_chunks(n, [&](std::int64_t c, std::int64_t base, std::int64_t len) {
+        std::uint8_t* out = d + offsets[c] * static_cast<std::int64_t>(es);
+        mask_for_each<ISA>(m + base, len, [&](std::int64_t i) {
+            std::memcpy(out, s + (base + i) * static_cast<std::int64_t>(es), es);
+            out += es;
+        });
+    });
+}
+
+} // namespace bee::cpu
@@ -0,0 +1,17 @@
+#pragma once
+
+// 掩码压缩的固定分块，供 Ops 层（分配块计数 / 做前缀和）与 CPU 内核共享
+
+#include <cstdint>
+
+namespace bee::cpu
+{
+
+inline constexpr std::int64_t kMaskChunk = 64 * 1024; // 每块掩码字节数（亦为并行粒度）；块数与线程数无关，结果确定
+
+inline constexpr auto mask_chunk_count(std::int64_t n) -> std::int64_t
+{
+    return (n + kMaskChunk - 1) / kMaskChunk;
+}
+
+} // namespace bee::cpu
@@ -0,0 +1,355 @@
+#pragma once
+
+// CPU 统计 / 归一化内核：var / std（全局、按轴）与融合 layer_norm / rms_norm
+// - 统计量一次读入：按 L1 大小分块，块内 SIMD 求和 + 平移平方和（4 路累加器），
+//   块间与并行 chunk 间用 Chan 公式合并 (n, mean, M2)，数值上等价于 Welford
+//   并行时块边界固定、按块号顺序合并，结果与线程数无关
+// - 按轴且 inner>1 时，在 inner 方向做 SIMD 的逐列 Welford（所有 lane 共享计数）
+// - 归一化第二遍为纯 SIMD 的 (x - mean) * rstd [* w] [+ b]
+// 仅处理 F32/F64 连续输入；非连续与整型由 Ops 层预先整理
+
+#include "Tensor/Core/Tensor.hpp"
+#include "Tensor/Cpu/ReduceCpu.hpp"
+#include "SIMD/SIMD.hpp"
+#include "Base/Parallel/ParallelFor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace bee::cpu
+{
+
+// 分块统计的块长（元素数）：F64 下 16 KB，二次读取仍命中 L1
+inline constexpr int64_t kWelfordBlockElems = 2048;
+// 按轴（inner>1）路径每个任务处理的列数
+inline constexpr int64_t kWelfordColChunk = 256;
+// 归一化按行并行时，每任务目标字节数
+inline constexpr int64_t kNormGrainBytes = 128 * 1024;
+
+// ─────────────────────────────────────────────────────────────────────────────
+// (n, mean, M2) 统计量与 Chan 合并
+// ─────────────────────────────────────────────────────────────────────────────
+
+struct WelfordStat
+{
+    int64_t n    = 0;
+    double  mean = 0.0;
+    double  m2   = 0.0;
+};
+
+inline auto welford_merge(const WelfordStat& a, const WelfordStat& b) -> WelfordStat
+{
+    if (a.n == 0)
+        return b;
+    if (b.n == 0)
+        return a;
+    const int64_t n     = a.n + b.n;
+    const double  delta = b.mean - a.mean;
+    const double  nb_n  = static_cast<double>(b.n) / static_cast<double>(n);
+    WelfordStat   r;
+    r.n    = n;
+    r.mean = a.mean + delta * nb_n;
+    r.m2   = a.m2 + b.m2 + delta * delta * static_cast<double>(a.n) * nb_n;
+    return r;
+}
+
+// 由 M2 与 correction 得到方差；自由度 <= 0 时返回 NaN
+inline auto welford_variance(const WelfordStat& s, int64_t correction) -> double
+{
+    const int64_t dof = s.n - correction;
+    if (dof <= 0)
+        return std::numeric_limits<double>::quiet_NaN();
+    return s.m2 / static_cast<double>(dof);
+}
+
+// Σ (x - shift)^2：4 路 SIMD 累加器
+template <typename T, typename ISA>
+auto sum_sq_dev_linear(const T* p, int64_t n, T shift) -> T
+{
+    using B            = simd::SimdBackend<T, ISA>;
+    constexpr auto W   = static_cast<int64_t>(B::width);
+    const auto     vs  = B::set1(shift);
+    auto           a0  = B::set1(T{0});
+    auto           a1  = a0;
+    auto           a2  = a0;
+    auto           a3  = a0;
+    int64_t        i   = 0;
+    for (; i + 4 * W <= n; i += 4 * W) {
+        const auto d0 = B::sub(B::loadu(p + i + 0 * W), vs);
+        const auto d1 = B::sub(B::loadu(p + i + 1 * W), vs);
+        const auto d2 = B::sub(B::loadu(p + i + 2 * W), vs);
+        const auto d3 = B::sub(B::loadu(p + i + 3 * W), vs);
+        a0            = B::add(a0, B::mul(d0, d0));
+        a1            = B::add(a1, B::mul(d1, d1));
+        a2            = B::add(a2, B::mul(d2, d2));
+        a3            = B::add(a3, B::mul(d3, d3));
+    }
+    auto acc = B::add(B::add(a0, a1), B::add(a2, a3));
+    for (; i + W <= n; i += W) {
+        const auto d = B::sub(B::loadu(p + i), vs);
+        acc          = B::add(acc, B::mul(d, d));
+    }
+    T r = B::reduce_sum(acc);
+    for (; i < n; ++i) {
+        const T d  = p[i] - shift;
+        r         += d * d;
+    }
+    return r;
+}
+
+// 单线程：n 个连续元素的 (n, mean, M2)
+template <typename T, typename ISA>
+auto welford_linear(const T* p, int64_t n) -> WelfordStat
+{
+    WelfordStat st;
+    for (int64_t b0 = 0; b0 < n; b0 += kWelfordBlockElems) {
+        const int64_t bn  = std::min(kWelfordBlockElems, n - b0);
+        const T*      bp  = p + b0;
+        const T       sum = cpu_global_reduce_linear<T, ISA, OpReduceSum>(bn, bp);
+        const T       bm  = sum / static_cast<T>(bn);
+        WelfordStat   blk;
+        blk.n    = bn;
+        blk.mean = static_cast<double>(bm);
+        blk.m2   = static_cast<double>(sum_sq_dev_linear<T, ISA>(bp, bn, bm));
+        st       = welford_merge(st, blk);
+    }
+    return st;
+}
+
+// 并行统计的固定块长（元素数）：kReduceChunkBytes 对应的元素数，且为 kWelfordBlockElems 的倍数
+template <typename T>
+inline constexpr int64_t kNormParallelBlockElems = std::max<int64_t>(kWelfordBlockElems, kReduceChunkBytes / static_cast<int64_t>(sizeof(T)));
+
+// 多线程：按固定块长切块（块边界与线程数无关），各块统计量写入按块号索引的槽位，再按块号顺序合并，
+// 因此合并次序与舍入都不随线程数变化
+template <typename T, typename ISA>
+auto welford_linear_parallel(const T* p, int64_t n) -> WelfordStat
+{
+    if (n * static_cast<int64_t>(sizeof(T)) < kReduceParallelBytes)
+        return welford_linear<T, ISA>(p, n);
+
+    constexpr int64_t        blk    = kNormParallelBlockElems<T>;
+    const int64_t            blocks = (n + blk - 1) / blk;
+    std::vector<WelfordStat> partials(static_cast<std::size_t>(blocks));
+    parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(blocks), std::size_t{1}, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t c = lo; c < hi; ++c) {
+            const int64_t b0 = static_cast<int64_t>(c) * blk;
+            partials[c]      = welford_linear<T, ISA>(p + b0, std::min(blk, n - b0));
+        }
+    });
+
+    WelfordStat st;
+    for (const auto& s : partials)
+        st = welford_merge(st, s);
+    return st;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// var / std
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <typename T, typename ISA>
+auto cpu_var_global(const Tensor& a, Tensor& out, int64_t correction, bool take_sqrt) -> void
+{
+    const WelfordStat st = welford_linear_parallel<T, ISA>(static_cast<const T*>(a.const_data_ptr()), a.numel());
+    const double      v  = welford_variance(st, correction);
+    static_cast<T*>(out.scoped_data_ptr())[0] = static_cast<T>(take_sqrt ? std::sqrt(v) : v);
+}
+
+// 逐列 Welford：rows 行、每行跨 ld 个元素，统计 [c0, c0+nc) 列；所有 lane 共享计数
+template <typename T, typename ISA>
+auto welford_columns(const T* p, int64_t rows, int64_t ld, int64_t nc, T* mean, T* m2) -> void
+{
+    using B          = simd::SimdBackend<T, ISA>;
+    constexpr auto W = static_cast<int64_t>(B::width);
+
+    for (int64_t j = 0; j < nc; ++j) {
+        mean[j] = T{0};
+        m2[j]   = T{0};
+    }
+    for (int64_t k = 0; k < rows; ++k) {
+        const T*   row = p + k * ld;
+        const T    inv = T{1} / static_cast<T>(k + 1);
+        const auto vi  = B::set1(inv);
+        int64_t    j   = 0;
+        for (; j + W <= nc; j += W) {
+            const auto x  = B::loadu(row + j);
+            auto       m  = B::loadu(mean + j);
+            const auto d  = B::sub(x, m);
+            m             = B::add(m, B::mul(d, vi));
+            B::storeu(mean + j, m);
+            B::storeu(m2 + j, B::add(B::loadu(m2 + j), B::mul(d, B::sub(x, m))));
+        }
+        for (; j < nc; ++j) {
+            const T d  = row[j] - mean[j];
+            mean[j]   += d * inv;
+            m2[j]     += d * (row[j] - mean[j]);
+        }
+    }
+}
+
+// 按轴 var：输入视为连续 [outer, K, inner]，输出 [outer, inner]
+template <typename T, typename ISA>
+auto cpu_var_axis(const Tensor& a, int64_t dim, Tensor& out, int64_t correction, bool take_sqrt) -> void
+{
+    const auto& shape = a.shape();
+    const auto* in    = static_cast<const T*>(a.const_data_ptr());
+    auto*       o_ptr = static_cast<T*>(out.scoped_data_ptr());
+
+    const int64_t K     = shape[static_cast<std::size_t>(dim)];
+    int64_t       outer = 1;
+    for (int64_t d = 0; d < dim; ++d)
+        outer *= shape[static_cast<std::size_t>(d)];
+    int64_t inner = 1;
+    for (int64_t d = dim + 1; d < a.ndim(); ++d)
+        inner *= shape[static_cast<std::size_t>(d)];
+
+    auto finish = [&](const WelfordStat& s) -> T {
+        const double v = welford_variance(s, correction);
+        return static_cast<T>(take_sqrt ? std::sqrt(v) : v);
+    };
+
+    if (inner == 1) {
+        // 每行连续：行数足够时跨行并行，否则行内并行
+        if (outer == 1) {
+            o_ptr[0] = finish(welford_linear_parallel<T, ISA>(in, K));
+            return;
+        }
+        const std::size_t grain = static_cast<std::size_t>(std::max<int64_t>(1, kNormGrainBytes / std::max<int64_t>(1, K * static_cast<int64_t>(sizeof(T)))));
+        parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(outer), grain, [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t o = lo; o < hi; ++o)
+                o_ptr[o] = finish(welford_linear<T, ISA>(in + static_cast<int64_t>(o) * K, K));
+        });
+        return;
+    }
+
+    // inner > 1：任务 = (outer, 列块)，列块内 SIMD 逐列 Welford
+    const int64_t col_chunks = (inner + kWelfordColChunk - 1) / kWelfordColChunk;
+    const int64_t tasks      = outer * col_chunks;
+    const int64_t task_bytes = K * std::min(inner, kWelfordColChunk) * static_cast<int64_t>(sizeof(T));
+    const auto    grain      = static_cast<std::size_t>(std::max<int64_t>(1, kNormGrainBytes / std::max<int64_t>(1, task_bytes)));
+
+    parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(tasks), grain, [&](std::size_t lo, std::size_t hi) {
+        alignas(64) T mean[kWelfordColChunk];
+        alignas(64) T m2[kWelfordColChunk];
+        for (std::size_t t = lo; t < hi; ++t) {
+            const int64_t o  = static_cast<int64_t>(t) / col_chunks;
+            const int64_t c0 = (static_cast<int64_t>(t) % col_chunks) * kWelfordColChunk;
+            const int64_t nc = std::min(kWelfordColChunk, inner - c0);
+            welford_columns<T, ISA>(in + o * K * inner + c0, K, inner, nc, mean, m2);
+            for (int64_t j = 0; j < nc; ++j)
+                o_ptr[o * inner + c0 + j] = finish(WelfordStat{K, static_cast<double>(mean[j]), static_cast<double>(m2[j])});
+        }
+    });
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// layer_norm / rms_norm：输入视为 [rows, N]，按行归一化
+// ─────────────────────────────────────────────────────────────────────────────
+
+// y[i] = (x[i] - mean) * rstd [* w[i]] [+ b[i]]；mean=0 时即 rms_norm 的缩放
+template <typename T, typename ISA>
+auto norm_apply_linear(const T* x, T* y, int64_t n, T mean, T rstd, const T* w, const T* b) -> void
+{
+    using B          = simd::SimdBackend<T, ISA>;
+    constexpr auto W = static_cast<int64_t>(B::width);
+    const auto     vm = B::set1(mean);
+    const auto     vr = B::set1(rstd);
+    int64_t        i  = 0;
+    for (; i + W <= n; i += W) {
+        auto v = B::mul(B::sub(B::loadu(x + i), vm), vr);
+        if (w)
+            v = B::mul(v, B::loadu(w + i));
+        if (b)
+            v = B::add(v, B::loadu(b + i));
+        B::storeu(y + i, v);
+    }
+    for (; i < n; ++i) {
+        T v = (x[i] - mean) * rstd;
+        if (w)
+            v *= w[i];
+        if (b)
+            v += b[i];
+        y[i] = v;
+    }
+}
+
+// 行级驱动：行数足够时跨行并行；行数少而行很长时，行内统计与归一化各自并行
+template <typename T, typename ISA, typename StatFn>
+auto norm_rows_driver(const T* x, T* y, int64_t rows, int64_t N, const T* w, const T* b, StatFn&& stat) -> void
+{
+    const int64_t row_bytes = N * static_cast<int64_t>(sizeof(T));
+    const bool    long_rows = rows < static_cast<int64_t>(parallel::available_parallelism()) && row_bytes >= kReduceParallelBytes;
+
+    if (long_rows) {
+        const std::size_t grain = static_cast<std::size_t>(kNormGrainBytes / static_cast<int64_t>(sizeof(T)));
+        for (int64_t r = 0; r < rows; ++r) {
+            const T* xr            = x + r * N;
+            T*       yr            = y + r * N;
+            const auto [mean, rstd] = stat(xr, N, true);
+            parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(N), grain, [&](std::size_t lo, std::size_t hi) {
+                norm_apply_linear<T, ISA>(xr + lo, yr + lo, static_cast<int64_t>(hi - lo), mean, rstd, w ? w + lo : nullptr, b ? b + lo : nullptr);
+            });
+        }
+        return;
+    }
+
+    const std::size_t grain = static_cast<std::size_t>(std::max<int64_t>(1, kNormGrainBytes / std::max<int64_t>(1, row_bytes)));
+    parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(rows), grain, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t r = lo; r < hi; ++r) {
+            const T* xr            = x + static_cast<int64_t>(r) * N;
+            const auto [mean, rstd] = stat(xr, N, false);
+            norm_apply_linear<T, ISA>(xr, y + static_cast<int64_t>(r) * N, N, mean, rstd, w, b);
+        }
+    });
+}
+
+template <typename T, typename ISA>
+auto cpu_layer_norm(const Tensor& x, int64_t N, const Tensor& weight, const Tensor& bias, double eps, Tensor& out) -> void
+{
+    const int64_t rows = N == 0 ? 0 : x.numel() / N;
+    const T*      w    = weight.defined() ? static_cast<const T*>(weight.const_data_ptr()) : nullptr;
+    const T*      b    = bias.defined() ? static_cast<const T*>(bias.const_data_ptr()) : nullptr;
+
+    auto stat = [eps](const T* xr, int64_t n, bool par) -> std::pair<T, T> {
+        const WelfordStat s = par ? welford_linear_parallel<T, ISA>(xr, n) : welford_linear<T, ISA>(xr, n);
+        return {static_cast<T>(s.mean), static_cast<T>(1.0 / std::sqrt(s.m2 / static_cast<double>(n) + eps))};
+    };
+    norm_rows_driver<T, ISA>(static_cast<const T*>(x.const_data_ptr()), static_cast<T*>(out.scoped_data_ptr()), rows, N, w, b, stat);
+}
+
+template <typename T, typename ISA>
+auto cpu_rms_norm(const Tensor& x, int64_t N, const Tensor& weight, double eps, Tensor& out) -> void
+{
+    const int64_t rows = N == 0 ? 0 : x.numel() / N;
+    const T*      w    = weight.defined() ? static_cast<const T*>(weight.const_data_ptr()) : nullptr;
+
+    auto stat = [eps](const T* xr, int64_t n, bool par) -> std::pair<T, T> {
+        double ss = 0.0;
+        if (par && n * static_cast<int64_t>(sizeof(T)) >= kReduceParallelBytes) {
+            // 与 welford_linear_parallel 相同：固定块长 + 按块号顺序求和，结果与线程数无关
+            constexpr int64_t   blk    = kNormParallelBlockElems<T>;
+            const int64_t       blocks = (n + blk - 1) / blk;
+            std::vector<double> partials(static_cast<std::size_t>(blocks));
+            parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(blocks), std::size_t{1}, [&](std::size_t lo, std::size_t hi) {
+                for (std::size_t c = lo; c < hi; ++c) {
+                    const int64_t b0 = static_cast<int64_t>(c) * blk;
+                    partials[c]      = static_cast<double>(sum_sq_dev_linear<T, ISA>(xr + b0, std::min(blk, n - b0), T{0}));
+                }
+            });
+            for (const double p : partials)
+                ss += p;
+        } else {
+            ss = static_cast<double>(sum_sq_dev_linear<T, ISA>(xr, n, T{0}));
+        }
+        return {T{0}, static_cast<T>(1.0 / std::sqrt(ss / static_cast<double>(n) + eps))};
+    };
+    norm_rows_driver<T, ISA>(static_cast<const T*>(x.const_data_ptr()), static_cast<T*>(out.scoped_data_ptr()), rows, N, w, nullptr, stat);
+}
+
+} // namespace bee::cpu
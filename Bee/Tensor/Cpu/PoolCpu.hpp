@@ -0,0 +1,164 @@
+#pragma once
+
+// CPU 2D 池化内核：max_pool2d / avg_pool2d（NCHW，连续 F32/F64）
+// - 窗口按行列可分：先沿 H 把窗口内的有效输入行逐元素合并到行缓冲（SIMD，任意 SH / DH 都是连续访存），
+//   再沿 W 在行缓冲上合并 KW 个抽头；SW == 1 时内部区间整段 SIMD，边界与 SW > 1 走标量
+// - 越界（padding）位置不参与：max 视为 -inf；avg 在 count_include_pad 时除以 KH·KW，否则除以有效元素数
+// - 并行粒度为 (平面, 输出行)，按字节数合并成任务
+
+#include "Tensor/Cpu/ConvGeom.hpp"
+#include "SIMD/SIMD.hpp"
+#include "Base/Parallel/ParallelFor.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace bee::cpu
+{
+
+// 每个并行任务的目标输入字节数
+inline constexpr int64_t kPoolGrainBytes = 64 * 1024;
+
+template <typename T, bool IsMax>
+struct PoolOp
+{
+    static constexpr auto identity() -> T { return IsMax ? -std::numeric_limits<T>::infinity() : T{0}; }
+
+    static auto apply(T a, T b) -> T
+    {
+        if constexpr (IsMax)
+            return a > b ? a : b;
+        else
+            return a + b;
+    }
+
+    template <typename B>
+    static auto apply_v(typename B::reg a, typename B::reg b) -> typename B::reg
+    {
+        if constexpr (IsMax)
+            return B::max(a, b);
+        else
+            return B::add(a, b);
+    }
+};
+
+// 沿 H 合并：rows 个输入行（起点 row0，行间隔 step 个元素）逐元素合并到 buf[0..W)
+template <typename T, typename ISA, bool IsMax>
+auto pool_merge_rows(const T* row0, int64_t step, int64_t rows, int64_t W, T* buf) -> void
+{
+    using B          = simd::SimdBackend<T, ISA>;
+    using Op         = PoolOp<T, IsMax>;
+    constexpr auto V = static_cast<int64_t>(B::width);
+
+    std::copy(row0, row0 + W, buf);
+    for (int64_t r = 1; r < rows; ++r) {
+        const T* src = row0 + r * step;
+        int64_t  i   = 0;
+        for (; i + V <= W; i += V)
+            B::storeu(buf + i, Op::template apply_v<B>(B::loadu(buf + i), B::loadu(src + i)));
+        for (; i < W; ++i)
+            buf[i] = Op::apply(buf[i], src[i]);
+    }
+}
+
+// 单个输出行：buf 为已沿 H 合并的行缓冲，nr 为有效输入行数
+template <typename T, typename ISA, bool IsMax>
+auto pool_row_from_buffer(const Pool2dGeom& g, bool count_include_pad, const T* buf, int64_t nr, T* out) -> void
+{
+    using B          = simd::SimdBackend<T, ISA>;
+    using Op         = PoolOp<T, IsMax>;
+    constexpr auto V = static_cast<int64_t>(B::width);
+
+    const T full_div = static_cast<T>(g.KH * g.KW);
+
+    // 标量：第 ow 个输出
+    auto scalar_at = [&](int64_t ow) {
+        const int64_t iw0 = ow * g.SW - g.PW;
+        T             acc = Op::identity();
+        int64_t       nc  = 0;
+        for (int64_t s = 0; s < g.KW; ++s) {
+            const int64_t iw = iw0 + s * g.DW;
+            if (iw < 0 || iw >= g.W)
+                continue;
+            acc = Op::apply(acc, buf[iw]);
+            ++nc;
+        }
+        if constexpr (IsMax)
+            out[ow] = acc;
+        else
+            out[ow] = nc == 0 ? T{0} : acc / (count_include_pad ? full_div : static_cast<T>(nr * nc));
+    };
+
+    if (g.SW != 1) {
+        for (int64_t ow = 0; ow < g.OW; ++ow)
+            scalar_at(ow);
+        return;
+    }
+
+    // SW == 1：窗口完全落在 [0, W) 内的输出区间 [lo, hi) 整段 SIMD
+    const int64_t lo = std::min(g.OW, g.PW);
+    const int64_t hi = std::clamp(g.W - (g.KW - 1) * g.DW + g.PW, lo, g.OW);
+    for (int64_t ow = 0; ow < lo; ++ow)
+        scalar_at(ow);
+
+    // 区间内 ow ≥ PW，窗口起点 ow - PW 非负：指针从 buf 向后偏移，不形成缓冲区之前的地址
+    const T    inv  = T{1} / (count_include_pad ? full_div : static_cast<T>(nr * g.KW));
+    const auto vinv = B::set1(inv);
+    int64_t    ow   = lo;
+    for (; ow + V <= hi; ow += V) {
+        const T* win = buf + (ow - g.PW);
+        auto     acc = B::loadu(win);
+        for (int64_t s = 1; s < g.KW; ++s)
+            acc = Op::template apply_v<B>(acc, B::loadu(win + s * g.DW));
+        if constexpr (!IsMax)
+            acc = B::mul(acc, vinv);
+        B::storeu(out + ow, acc);
+    }
+    for (; ow < hi; ++ow) {
+        const T* win = buf + (ow - g.PW);
+        T        acc = win[0];
+        for (int64_t s = 1; s < g.KW; ++s)
+            acc = Op::apply(acc, win[s * g.DW]);
+        if constexpr (IsMax)
+            out[ow] = acc;
+        else
+            out[ow] = acc * inv;
+    }
+    for (ow = hi; ow < g.OW; ++ow)
+        scalar_at(ow);
+}
+
+// x={planes, H, W} → y={planes, OH, OW}，均连续
+template <typename T, typename ISA, bool IsMax>
+auto cpu_pool2d(const Pool2dGeom& g, bool count_include_pad, const T* x, T* y) -> void
+{
+    const int64_t rows       = g.planes * g.OH;
+    const int64_t task_bytes = std::max<int64_t>(1, g.KH * g.W * static_cast<int64_t>(sizeof(T)));
+    const auto    grain      = static_cast<std::size_t>(std::max<int64_t>(1, kPoolGrainBytes / task_bytes));
+
+    parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(rows), grain, [&](std::size_t lo, std::size_t hi) {
+        std::vector<T> buf(static_cast<std::size_t>(g.W));
+        for (std::size_t t = lo; t < hi; ++t) {
+            const int64_t p   = static_cast<int64_t>(t) / g.OH;
+            const int64_t oh  = static_cast<int64_t>(t) % g.OH;
+            T*            out = y + static_cast<int64_t>(t) * g.OW;
+
+            // 有效输入行：ih = oh·SH - PH + r·DH ∈ [0, H)
+            const int64_t ih0 = oh * g.SH - g.PH;
+            const int64_t r0  = ih0 >= 0 ? 0 : (-ih0 + g.DH - 1) / g.DH;
+            const int64_t r1  = ih0 >= g.H ? 0 : std::min(g.KH, (g.H - 1 - ih0) / g.DH + 1);
+            if (r1 <= r0) {
+                std::fill(out, out + g.OW, IsMax ? PoolOp<T, true>::identity() : T{0});
+                continue;
+            }
+            const T* row0 = x + (p * g.H + ih0 + r0 * g.DH) * g.W;
+            pool_merge_rows<T, ISA, IsMax>(row0, g.DH * g.W, r1 - r0, g.W, buf.data());
+            pool_row_from_buffer<T, ISA, IsMax>(g, count_include_pad, buf.data(), r1 - r0, out);
+        }
+    });
+}
+
+} // namespace bee::cpu
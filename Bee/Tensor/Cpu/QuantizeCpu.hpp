@@ -0,0 +1,241 @@
+#pragma once
+
+// CPU 仿射量化 / 反量化内核：基于 ISA 标签的模板化实现
+// - 量化：q = clamp(round(x · (1 / scale) + zero_point), qmin, qmax)，就近偶数舍入（MXCSR 默认模式）
+// - 反量化：x = (q - zero_point) · scale
+// - 数据视为 [outer, C, inner]：inner > 1 时每段 inner 个元素共用通道参数；
+//   inner == 1（通道为最内维）时一行 C 个元素按元素取参数向量
+// - AVX2 / SSE4.1 走 intrinsics（AVX512 复用 AVX2），其余标量；大 n 走 parallel_for 切块
+
+#include "SIMD/SIMD.hpp"
+#include "Base/Parallel/ParallelFor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#if defined(BEE_SIMD_ENABLE_SSE2)
+    #include <emmintrin.h>
+    #include <smmintrin.h>
+#endif
+#if defined(BEE_SIMD_ENABLE_AVX2)
+    #include <immintrin.h>
+#endif
+
+namespace bee::cpu
+{
+
+template <typename Q>
+inline constexpr float kQuantLo = std::is_signed_v<Q> ? -128.0f : 0.0f;
+
+template <typename Q>
+inline constexpr float kQuantHi = std::is_signed_v<Q> ? 127.0f : 255.0f;
+
+// ─── 标量兜底（kVec：参数按元素取，否则整段共用 inv[0] / zp[0]）──────────────────
+template <typename Q, typename ISA, bool kVec>
+struct QuantizeKernel
+{
+    static void quantize(const float* x, Q* q, std::int64_t n, const float* inv, const float* zp)
+    {
+        for (std::int64_t i = 0; i < n; ++i) {
+            float y = x[i] * inv[kVec ? i : 0] + zp[kVec ? i : 0];
+            y       = y > kQuantLo<Q> ? y : kQuantLo<Q>; // NaN 落到 qmin，与 SIMD max 一致
+            y       = y < kQuantHi<Q> ? y : kQuantHi<Q>;
+            q[i]    = static_cast<Q>(static_cast<std::int32_t>(std::nearbyint(y)));
+        }
+    }
+
+    static void dequantize(const Q* q, float* x, std::int64_t n, const float* scale, const float* zp)
+    {
+        for (std::int64_t i = 0; i < n; ++i)
+            x[i] = (static_cast<float>(q[i]) - zp[kVec ? i : 0]) * scale[kVec ? i : 0];
+    }
+};
+
+// ─── SSE4.1 特化：一轮 16 元素 ───────────────────────────────────────────────
+#if defined(BEE_SIMD_ENABLE_SSE2)
+
+template <typename Q, bool kVec>
+struct QuantizeKernel<Q, simd::IsaSse2, kVec>
+{
+    using Scalar = QuantizeKernel<Q, simd::IsaScalar, kVec>;
+
+    static auto quantize4(const float* x, const float* inv, const float* zp, std::int64_t i) -> __m128i
+    {
+        const __m128 vi = kVec ? _mm_loadu_ps(inv + i) : _mm_set1_ps(inv[0]);
+        const __m128 vz = kVec ? _mm_loadu_ps(zp + i) : _mm_set1_ps(zp[0]);
+        __m128       y  = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(x + i), vi), vz);
+        y               = _mm_min_ps(_mm_max_ps(y, _mm_set1_ps(kQuantLo<Q>)), _mm_set1_ps(kQuantHi<Q>));
+        return _mm_cvtps_epi32(y);
+    }
+
+    static void quantize(const float* x, Q* q, std::int64_t n, const float* inv, const float* zp)
+    {
+        std::int64_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            const __m128i p01 = _mm_packs_epi32(quantize4(x, inv, zp, i), quantize4(x, inv, zp, i + 4));
+            const __m128i p23 = _mm_packs_epi32(quantize4(x, inv, zp, i + 8), quantize4(x, inv, zp, i + 12));
+            const __m128i p   = std::is_signed_v<Q> ? _mm_packs_epi16(p01, p23) : _mm_packus_epi16(p01, p23);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(q + i), p);
+        }
+        Scalar::quantize(x + i, q + i, n - i, kVec ? inv + i : inv, kVec ? zp + i : zp);
+    }
+
+    static void dequantize(const Q* q, float* x, std::int64_t n, const float* scale, const float* zp)
+    {
+        std::int64_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            std::int32_t u;
+            std::memcpy(&u, q + i, sizeof(u));
+            const __m128i w  = std::is_signed_v<Q> ? _mm_cvtepi8_epi32(_mm_cvtsi32_si128(u)) : _mm_cvtepu8_epi32(_mm_cvtsi32_si128(u));
+            const __m128  vs = kVec ? _mm_loadu_ps(scale + i) : _mm_set1_ps(scale[0]);
+            const __m128  vz = kVec ? _mm_loadu_ps(zp + i) : _mm_set1_ps(zp[0]);
+            _mm_storeu_ps(x + i, _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(w), vz), vs));
+        }
+        Scalar::dequantize(q + i, x + i, n - i, kVec ? scale + i : scale, kVec ? zp + i : zp);
+    }
+};
+
+#endif // BEE_SIMD_ENABLE_SSE2
+
+// ─── AVX2 特化：一轮 32 元素（AVX512 复用）──────────────────────────────────────
+#if defined(BEE_SIMD_ENABLE_AVX2)
+
+template <typename Q, bool kVec>
+struct QuantizeKernel<Q, simd::IsaAvx2, kVec>
+{
+    using Scalar = QuantizeKernel<Q, simd::IsaScalar, kVec>;
+
+    static auto quantize8(const float* x, const float* inv, const float* zp, std::int64_t i) -> __m256i
+    {
+        const __m256 vi = kVec ? _mm256_loadu_ps(inv + i) : _mm256_set1_ps(inv[0]);
+        const __m256 vz = kVec ? _mm256_loadu_ps(zp + i) : _mm256_set1_ps(zp[0]);
+        __m256       y  = _mm256_fmadd_ps(_mm256_loadu_ps(x + i), vi, vz);
+        y               = _mm256_min_ps(_mm256_max_ps(y, _mm256_set1_ps(kQuantLo<Q>)), _mm256_set1_ps(kQuantHi<Q>));
+        return _mm256_cvtps_epi32(y);
+    }
+
+    static void quantize(const float* x, Q* q, std::int64_t n, const float* inv, const float* zp)
+    {
+        std::int64_t i = 0;
+        for (; i + 32 <= n; i += 32) {
+            // pack 在每个 128-bit lane 内进行，结果按 4 字节为单位交错，最后一次 permute 还原顺序
+            const __m256i p01 = _mm256_packs_epi32(quantize8(x, inv, zp, i), quantize8(x, inv, zp, i + 8));
+            const __m256i p23 = _mm256_packs_epi32(quantize8(x, inv, zp, i + 16), quantize8(x, inv, zp, i + 24));
+            const __m256i p   = std::is_signed_v<Q> ? _mm256_packs_epi16(p01, p23) : _mm256_packus_epi16(p01, p23);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(q + i), _mm256_permutevar8x32_epi32(p, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7)));
+        }
+        Scalar::quantize(x + i, q + i, n - i, kVec ? inv + i : inv, kVec ? zp + i : zp);
+    }
+
+    static void dequantize(const Q* q, float* x, std::int64_t n, const float* scale, const float* zp)
+    {
+        std::int64_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            const __m128i u  = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(q + i));
+            const __m256i w  = std::is_signed_v<Q> ? _mm256_cvtepi8_epi32(u) : _mm256_cvtepu8_epi32(u);
+            const __m256  vs = kVec ? _mm256_loadu_ps(scale + i) : _mm256_set1_ps(scale[0]);
+            const __m256  vz = kVec ? _mm256_loadu_ps(zp + i) : _mm256_set1_ps(zp[0]);
+            _mm256_storeu_ps(x + i, _mm256_mul_ps(_mm256_sub_ps(_mm256_cvtepi32_ps(w), vz), vs));
+        }
+        Scalar::dequantize(q + i, x + i, n - i, kVec ? scale + i : scale, kVec ? zp + i : zp);
+    }
+};
+
+template <typename Q, bool kVec>
+struct QuantizeKernel<Q, simd::IsaAvx512, kVec> : QuantizeKernel<Q, simd::IsaAvx2, kVec>
+{
+};
+
+#endif // BEE_SIMD_ENABLE_AVX2
+
+// ─── 并行化包装 ──────────────────────────────────────────────────────────────
+inline constexpr std::int64_t kQuantParallelElems = 64 * 1024;
+inline constexpr std::int64_t kQuantGrainElems    = 32 * 1024;
+
+// 把 [0, outer · C · inner) 切成共用参数的段并（可能并行地）逐段调用 fn(i, len, p, vec)：
+// vec 为 false 时 p 为通道号、整段共用参数；为 true 时（inner == 1）p 为段首元素的通道号、参数按元素递增
+template <typename Fn>
+inline void quant_for_segments(std::int64_t outer, std::int64_t C, std::int64_t inner, Fn&& fn)
+{
+    if (C == 1) {
+        inner *= outer;
+        outer  = 1;
+    }
+    const std::int64_t n   = outer * C * inner;
+    const bool         vec = inner == 1;
+    auto               run = [&](std::int64_t lo, std::int64_t hi) {
+        for (std::int64_t i = lo; i < hi;) {
+            if (vec) {
+                const std::int64_t p   = i % C;
+                const std::int64_t len = std::min(hi - i, C - p);
+                fn(i, len, p, true);
+                i += len;
+            } else {
+                const std::int64_t len = std::min(hi - i, inner - i % inner);
+                fn(i, len, (i / inner) % C, false);
+                i += len;
+            }
+        }
+    };
+    if (n < kQuantParallelElems) {
+        run(0, n);
+        return;
+    }
+    parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(n), static_cast<std::size_t>(kQuantGrainElems), [&](std::size_t lo, std::size_t hi) {
+        run(static_cast<std::int64_t>(lo), static_cast<std::int64_t>(hi));
+    });
+}
+
+template <typename Q, typename ISA>
+inline void cpu_quantize(
+    const float*        x,
+    Q*                  q,
+    std::int64_t        outer,
+    std::int64_t        C,
+    std::int64_t        inner,
+    const float*        scales,
+    const std::int32_t* zero_points
+)
+{
+    std::vector<float> inv(static_cast<std::size_t>(C));
+    std::vector<float> zp(static_cast<std::size_t>(C));
+    for (std::int64_t c = 0; c < C; ++c) {
+        inv[static_cast<std::size_t>(c)] = 1.0f / scales[c];
+        zp[static_cast<std::size_t>(c)]  = static_cast<float>(zero_points[c]);
+    }
+    quant_for_segments(outer, C, inner, [&](std::int64_t i, std::int64_t len, std::int64_t p, bool vec) {
+        if (vec)
+            QuantizeKernel<Q, ISA, true>::quantize(x + i, q + i, len, inv.data() + p, zp.data() + p);
+        else
+            QuantizeKernel<Q, ISA, false>::quantize(x + i, q + i, len, inv.data() + p, zp.data() + p);
+    });
+}
+
+template <typename Q, typename ISA>
+inline void cpu_dequantize(
+    const Q*            q,
+    float*              x,
+    std::int64_t        outer,
+    std::int64_t        C,
+    std::int64_t        inner,
+    const float*        scales,
+    const std::int32_t* zero_points
+)
+{
+    std::vector<float> zp(static_cast<std::size_t>(C));
+    for (std::int64_t c = 0; c < C; ++c)
+        zp[static_cast<std::size_t>(c)] = static_cast<float>(zero_points[c]);
+    quant_for_segments(outer, C, inner, [&](std::int64_t i, std::int64_t len, std::int64_t p, bool vec) {
+        if (vec)
+            QuantizeKernel<Q, ISA, true>::dequantize(q + i, x + i, len, scales + p, zp.data() + p);
+        else
+            QuantizeKernel<Q, ISA, false>::dequantize(q + i, x + i, len, scales + p, zp.data() + p);
+    });
+}
+
+} // namespace bee::cpu
@@ -0,0 +1,323 @@
+#pragma once
+
+// CPU 计数器式随机数内核：Philox4x32-10，与 CUDA/Ops/Random.cu 产出同一条流
+// - 第 c 个 counter：ctr = {c, subseq, 0, 0}，key = (seed 低 32 位, seed 高 32 位)，一次产出 4 个 u32；
+//   subseq：0 = uniform，1 = normal，2 = randint
+// - 元素 k 只取决于 (seed, subseq, k)：并行任务从自身起始 counter 推导，结果与线程数、任务划分无关
+// - 每批 kRngBatch 个 counter 以 SoA 布局逐轮计算，32×32→64 乘法、u32→浮点转换与 F32 Box-Muller
+//   均为无分支循环，可被编译器按当前 ISA 向量化；F32 的 log / sincos 用多项式（同 attn_exp 的做法），
+//   F64 走 std::log / std::sin / std::cos
+// - uniform / randint 与 CUDA 逐位一致；normal 使用相同的均匀数，仅 log / sincos 的末位舍入可能不同
+// - bernoulli / dropout 复用 uniform 的流（每元素一个 u32）：取 u32 的高 24 位与阈值 ceil(p·2^24) 比较，
+//   即与 F32 rand 的 u < p 逐元素一致，且与输出 dtype 无关
+
+#include "SIMD/SIMD.hpp"
+#include "Base/Parallel/ParallelFor.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+
+namespace bee::cpu
+{
+
+inline constexpr std::uint32_t kPhiloxM0 = 0xD2511F53u;
+inline constexpr std::uint32_t kPhiloxM1 = 0xCD9E8D57u;
+inline constexpr std::uint32_t kPhiloxW0 = 0x9E3779B9u; // Weyl 常量，每轮递增 key
+inline constexpr std::uint32_t kPhiloxW1 = 0xBB67AE85u;
+
+inline constexpr std::uint32_t kRngSubseqUniform = 0;
+inline constexpr std::uint32_t kRngSubseqNormal  = 1;
+inline constexpr std::uint32_t kRngSubseqInt     = 2;
+
+inline constexpr std::int64_t kRngBatch = 64;   // 每批 counter 数（SoA 缓冲 4 × 256B）
+inline constexpr std::int64_t kRngGrain = 2048; // 每个并行任务至少处理的 counter 数（kRngBatch 的整数倍）
+
+// counter [c0, c0 + kRngBatch) 的 Philox4x32-10 输出，按 counter 主序写入 out[4·kRngBatch]
+template <typename ISA>
+inline void philox_batch(std::uint64_t seed, std::uint32_t subseq, std::uint32_t c0, std::uint32_t* out)
+{
+    alignas(64) std::uint32_t x[kRngBatch];
+    alignas(64) std::uint32_t y[kRngBatch];
+    alignas(64) std::uint32_t z[kRngBatch];
+    alignas(64) std::uint32_t w[kRngBatch];
+    for (std::int64_t i = 0; i < kRngBatch; ++i) {
+        x[i] = c0 + static_cast<std::uint32_t>(i);
+        y[i] = subseq;
+        z[i] = 0;
+        w[i] = 0;
+    }
+
+    std::uint32_t k0 = static_cast<std::uint32_t>(seed);
+    std::uint32_t k1 = static_cast<std::uint32_t>(seed >> 32);
+    for (int r = 0; r < 10; ++r) {
+        for (std::int64_t i = 0; i < kRngBatch; ++i) {
+            const std::uint64_t p0 = static_cast<std::uint64_t>(kPhiloxM0) * x[i];
+            const std::uint64_t p1 = static_cast<std::uint64_t>(kPhiloxM1) * z[i];
+            const std::uint32_t nx = static_cast<std::uint32_t>(p1 >> 32) ^ y[i] ^ k0;
+            const std::uint32_t nz = static_cast<std::uint32_t>(p0 >> 32) ^ w[i] ^ k1;
+            y[i]                   = static_cast<std::uint32_t>(p1);
+            w[i]                   = static_cast<std::uint32_t>(p0);
+            x[i]                   = nx;
+            z[i]                   = nz;
+        }
+        k0 += kPhiloxW0;
+        k1 += kPhiloxW1;
+    }
+
+    for (std::int64_t i = 0; i < kRngBatch; ++i) {
+        out[4 * i + 0] = x[i];
+        out[4 * i + 1] = y[i];
+        out[4 * i + 2] = z[i];
+        out[4 * i + 3] = w[i];
+    }
+}
+
+// 每个 counter 产出的元素数：32 位元素 4 个，64 位元素 2 个（两个 u32 拼成一个 u64）
+template <typename T>
+inline constexpr std::int64_t kRngPerCounter = sizeof(T) == 8 ? 2 : 4;
+
+// 按批并行：第 b 批为 counter [b·kRngBatch, (b + 1)·kRngBatch)，即元素 [b·kRngBatch·Per, ..)；
+// fn(bits, base, m) 消费本批从元素 base 起的 m 个元素，仅末批 m 不满
+template <std::int64_t Per, typename ISA, typename Fn>
+inline void rng_for_each_batch(std::uint64_t seed, std::uint32_t subseq, std::int64_t n, Fn&& fn)
+{
+    constexpr std::int64_t batch   = kRngBatch * Per;
+    const auto             batches = static_cast<std::size_t>((n + batch - 1) / batch);
+    parallel::parallel_for(std::size_t{0}, batches, static_cast<std::size_t>(kRngGrain / kRngBatch), [&](std::size_t lo, std::size_t hi) {
+        alignas(64) std::uint32_t bits[4 * kRngBatch];
+        for (std::size_t b = lo; b < hi; ++b) {
+            const auto base = static_cast<std::int64_t>(b) * batch;
+            philox_batch<ISA>(seed, subseq, static_cast<std::uint32_t>(b * kRngBatch), bits);
+            fn(static_cast<const std::uint32_t*>(bits), base, std::min(batch, n - base));
+        }
+    });
+}
+
+// 逐元素生成 n 个 T：fn(bits, vals) 把一整批 bits 转成 kRngBatch·kRngPerCounter<T> 个值，
+// 满批直接写入 out，末批经栈缓冲截断
+template <typename T, typename ISA, typename Fn>
+inline void rng_generate(std::uint64_t seed, std::uint32_t subseq, T* out, std::int64_t n, Fn&& fn)
+{
+    constexpr std::int64_t batch = kRngBatch * kRngPerCounter<T>;
+    rng_for_each_batch<kRngPerCounter<T>, ISA>(seed, subseq, n, [&](const std::uint32_t* bits, std::int64_t base, std::int64_t m) {
+        if (m == batch) {
+            fn(bits, out + base);
+        } else {
+            alignas(64) T tail[batch];
+            fn(bits, tail);
+            std::copy_n(tail, m, out + base);
+        }
+    });
+}
+
+// ─── u32 → [0, 1) ───────────────────────────────────────────────────────────
+
+inline auto rng_u32_to_f32(std::uint32_t x) -> float
+{
+    return static_cast<float>(x >> 8) * (1.0f / 16777216.0f);
+}
+
+inline auto rng_u64_to_f64(std::uint32_t lo, std::uint32_t hi) -> double
+{
+    const std::uint64_t x = (static_cast<std::uint64_t>(hi) << 32) | lo;
+    return static_cast<double>(static_cast<std::int64_t>(x >> 11)) * (1.0 / 9007199254740992.0);
+}
+
+// ─── F32 log / sincos（无分支多项式）─────────────────────────────────────────
+
+// ln(x)，x 为正的正规数：拆成 2^e · m，m ∈ [√½, √2)，再用 Cephes logf 的多项式
+template <typename ISA>
+inline auto rng_logf(float x) -> float
+{
+    // 尾数低于 √½ 的 0x3504F3 时指数借 1、尾数翻倍；全用整数运算，浮点比较加三目会因陷阱语义阻止向量化
+    const auto         bits = std::bit_cast<std::int32_t>(x);
+    const std::int32_t mant = bits & 0x007FFFFF;
+    const std::int32_t lo   = (mant - 0x3504F3) >> 31; // 0 或 -1
+    const float        m    = std::bit_cast<float>(mant | (0x3F000000 - lo * 0x00800000)) - 1.0f;
+    const float        e    = static_cast<float>((bits >> 23) - 126 + lo);
+    const float        z    = m * m;
+
+    float p = 7.0376836292e-2f;
+    p       = p * m - 1.1514610310e-1f;
+    p       = p * m + 1.1676998740e-1f;
+    p       = p * m - 1.2420140846e-1f;
+    p       = p * m + 1.4249322787e-1f;
+    p       = p * m - 1.6668057665e-1f;
+    p       = p * m + 2.0000714765e-1f;
+    p       = p * m - 2.4999993993e-1f;
+    p       = p * m + 3.3333331174e-1f;
+
+    const float y = p * m * z + e * -2.12194440e-4f - 0.5f * z;
+    return (m + y) + e * 0.693359375f;
+}
+
+// sin / cos(2π·u)，u ∈ [0, 1)：按 1/4 周期精确约简（u 为 2^-24 的整数倍，减法无舍入），
+// 余角 ∈ [-π/4, π/4] 上用 Cephes sinf / cosf 多项式，再按象限交换、取负
+template <typename ISA>
+inline void rng_sincos_2pi(float u, float& s, float& c)
+{
+    const float q  = (u * 4.0f + 12582912.0f) - 12582912.0f; // round(4u) ∈ {0, .., 4}
+    const float a  = (u - q * 0.25f) * (2.0f * std::numbers::pi_v<float>);
+    const float a2 = a * a;
+
+    float sp = -1.9515295891e-4f;
+    sp       = sp * a2 + 8.3321608736e-3f;
+    sp       = sp * a2 - 1.6666654611e-1f;
+    sp       = sp * a2 * a + a;
+
+    float cp = 2.443315711809948e-5f;
+    cp       = cp * a2 - 1.388731625493765e-3f;
+    cp       = cp * a2 + 4.166664568298827e-2f;
+    cp       = cp * a2 * a2 - 0.5f * a2 + 1.0f;
+
+    const auto  qi   = static_cast<std::int32_t>(q);
+    const bool  swap = (qi & 1) != 0;
+    const float ss   = swap ? cp : sp;
+    const float cc   = swap ? sp : cp;
+    s                = (qi & 2) != 0 ? -ss : ss;
+    c                = ((qi + 1) & 2) != 0 ? -cc : cc;
+}
+
+// ─── 内核 ───────────────────────────────────────────────────────────────────
+
+template <typename T, typename ISA>
+inline void cpu_rand_uniform(std::uint64_t seed, T* out, std::int64_t n)
+{
+    rng_generate<T, ISA>(seed, kRngSubseqUniform, out, n, [](const std::uint32_t* bits, T* v) {
+        if constexpr (sizeof(T) == 4) {
+            for (std::int64_t k = 0; k < 4 * kRngBatch; ++k)
+                v[k] = rng_u32_to_f32(bits[k]);
+        } else {
+            for (std::int64_t k = 0; k < 2 * kRngBatch; ++k)
+                v[k] = rng_u64_to_f64(bits[2 * k], bits[2 * k + 1]);
+        }
+    });
+}
+
+// Box-Muller：相邻两个均匀数 (u0, u1) → (r·cos 2πu1, r·sin 2πu1)，r = √(-2 ln u0)，u0 钳位到最小正规数
+template <typename T, typename ISA>
+inline void cpu_rand_normal(std::uint64_t seed, T* out, std::int64_t n)
+{
+    rng_generate<T, ISA>(seed, kRngSubseqNormal, out, n, [](const std::uint32_t* bits, T* v) {
+        if constexpr (sizeof(T) == 4) {
+            // 先算 r² 与 sincos，再用 SimdBackend 开方：std::sqrt 的 errno 分支会阻止整个循环向量化
+            using B          = simd::SimdBackend<float, ISA>;
+            constexpr auto V = static_cast<std::int64_t>(B::width);
+            alignas(64) float r2[2 * kRngBatch];
+            alignas(64) float sn[2 * kRngBatch];
+            alignas(64) float cs[2 * kRngBatch];
+            for (std::int64_t k = 0; k < 2 * kRngBatch; ++k) {
+                // 正浮点数的位序即数值序：整数 max 钳位到 FLT_MIN
+                const auto u0 = std::max(std::bit_cast<std::int32_t>(rng_u32_to_f32(bits[2 * k])), 0x00800000);
+                r2[k]         = -2.0f * rng_logf<ISA>(std::bit_cast<float>(u0));
+                rng_sincos_2pi<ISA>(rng_u32_to_f32(bits[2 * k + 1]), sn[k], cs[k]);
+            }
+            for (std::int64_t k = 0; k < 2 * kRngBatch; k += V)
+                B::store(r2 + k, B::sqrt(B::load(r2 + k)));
+            for (std::int64_t k = 0; k < 2 * kRngBatch; ++k) {
+                v[2 * k]     = r2[k] * cs[k];
+                v[2 * k + 1] = r2[k] * sn[k];
+            }
+        } else {
+            for (std::int64_t k = 0; k < kRngBatch; ++k) {
+                const double u0 = std::max(rng_u64_to_f64(bits[4 * k], bits[4 * k + 1]), 2.2250738585072014e-308);
+                const double u1 = rng_u64_to_f64(bits[4 * k + 2], bits[4 * k + 3]);
+                const double r  = std::sqrt(-2.0 * std::log(u0));
+                const double t  = 2.0 * std::numbers::pi * u1;
+                v[2 * k]        = r * std::cos(t);
+                v[2 * k + 1]    = r * std::sin(t);
+            }
+        }
+    });
+}
+
+// [low, low + range)：32 位元素取 u32 % range，I64 取拼成的 u64 % range（与 CUDA 一致）
+template <typename T, typename ISA>
+inline void cpu_randint(std::uint64_t seed, std::int64_t low, std::uint64_t range, T* out, std::int64_t n)
+{
+    rng_generate<T, ISA>(seed, kRngSubseqInt, out, n, [&](const std::uint32_t* bits, T* v) {
+        if constexpr (sizeof(T) == 8) {
+            for (std::int64_t k = 0; k < 2 * kRngBatch; ++k) {
+                const std::uint64_t x = (static_cast<std::uint64_t>(bits[2 * k + 1]) << 32) | bits[2 * k];
+                v[k]                  = static_cast<T>(static_cast<std::uint64_t>(low) + x % range);
+            }
+        } else if (range <= 0xFFFFFFFFull) {
+            // 32 位取模与 64 位取模结果相同，但快得多
+            const auto r32 = static_cast<std::uint32_t>(range);
+            for (std::int64_t k = 0; k < 4 * kRngBatch; ++k)
+                v[k] = static_cast<T>(static_cast<std::int64_t>(bits[k] % r32) + low);
+        } else {
+            for (std::int64_t k = 0; k < 4 * kRngBatch; ++k)
+                v[k] = static_cast<T>(static_cast<std::int64_t>(bits[k]) + low);
+        }
+    });
+}
+
+// 以概率 p 取 1：(u32 >> 8) < threshold
+template <typename T, typename ISA>
+inline void cpu_bernoulli(std::uint64_t seed, std::uint32_t threshold, T* out, std::int64_t n)
+{
+    rng_for_each_batch<4, ISA>(seed, kRngSubseqUniform, n, [&](const std::uint32_t* bits, std::int64_t base, std::int64_t m) {
+        const std::uint32_t t = threshold; // 读到局部：经闭包访问的捕获量可能与 out 别名，会阻止向量化
+        T*                  o = out + base;
+        for (std::int64_t k = 0; k < m; ++k)
+            o[k] = static_cast<T>((bits[k] >> 8) < t);
+    });
+}
+
+// 融合 dropout：一次遍历内生成随机数、判定保留（(u32 >> 8) >= threshold）并缩放；
+// mask 非空时同时写位压缩掩码（每批 4·kRngBatch 个元素恰好对齐到整字节，各任务写不相交的字节）
+template <typename T, typename ISA>
+inline void cpu_dropout(std::uint64_t seed, std::uint32_t threshold, T scale, const T* x, T* out, std::uint8_t* mask, std::int64_t n)
+{
+    rng_for_each_batch<4, ISA>(seed, kRngSubseqUniform, n, [&](const std::uint32_t* bits, std::int64_t base, std::int64_t m) {
+        const std::uint32_t t  = threshold; // 同 cpu_bernoulli，捕获量先读到局部
+        const T             sc = scale;
+        const T*            xb = x + base;
+        T*                  ob = out + base;
+        for (std::int64_t k = 0; k < m; ++k)
+            ob[k] = (bits[k] >> 8) >= t ? xb[k] * sc : T(0); // 选择而非乘 0：被丢弃的 Inf / NaN 也输出 0
+        if (mask == nullptr)
+            return;
+
+        std::uint8_t*      mb    = mask + base / 8;
+        const std::int64_t bytes = (m + 7) / 8;
+        for (std::int64_t j = 0; j < bytes; ++j) {
+            std::uint32_t v = 0;
+            for (int q = 0; q < 8; ++q)
+                v |= static_cast<std::uint32_t>((bits[8 * j + q] >> 8) >= t) << q;
+            mb[j] = static_cast<std::uint8_t>(v);
+        }
+        if (m % 8 != 0)
+            mb[bytes - 1] &= static_cast<std::uint8_t>((1u << (m % 8)) - 1); // 末字节中 n 之后的位清零
+    });
+}
+
+// 用位压缩掩码重放 dropout：out = bit ? x·scale : 0，按 8 元素（1 字节）对齐切分任务
+template <typename T, typename ISA>
+inline void cpu_dropout_apply_mask(const std::uint8_t* mask, T scale, const T* x, T* out, std::int64_t n)
+{
+    const auto bytes = static_cast<std::size_t>((n + 7) / 8);
+    parallel::parallel_for(std::size_t{0}, bytes, static_cast<std::size_t>(kRngGrain), [&](std::size_t lo, std::size_t hi) {
+        const T             sc = scale;
+        const std::uint8_t* mp = mask;
+        for (auto j = static_cast<std::int64_t>(lo); j < static_cast<std::int64_t>(hi); ++j) {
+            const std::uint32_t v  = mp[j];
+            const T*            xb = x + 8 * j;
+            T*                  ob = out + 8 * j;
+            if (8 * j + 8 <= n) {
+                for (int q = 0; q < 8; ++q)
+                    ob[q] = ((v >> q) & 1u) != 0 ? xb[q] * sc : T(0);
+            } else {
+                for (std::int64_t q = 0; q < n - 8 * j; ++q)
+                    ob[q] = ((v >> q) & 1u) != 0 ? xb[q] * sc : T(0);
+            }
+        }
+    });
+}
+
+} // namespace bee::cpu
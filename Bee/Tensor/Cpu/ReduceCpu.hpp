@@ -3,13 +3,16 @@
 // CPU Reduce 算子内核：全局 reduce（SIMD fast-path + scalar slow-path）
 // 与按轴 reduce（连续快速路径 + 通用步长慢速路径）
 // B3：全局 reduce 支持 4 路 SIMD 累加器（打破 FP 依赖链）+ parallel_for。
+// F16 / BF16：以 F32 累加（全局 reduce 分块展开后复用 F32 SIMD 内核），结果收窄写回。
 
 #include "Tensor/Core/DType.hpp"
 #include "Tensor/Core/Shape.hpp"
 #include "Tensor/Core/Tensor.hpp"
+#include "Tensor/Cpu/CastCpu.hpp"
 #include "SIMD/SIMD.hpp"
 #include "Base/Parallel/ParallelFor.hpp"
 
+#include <algorithm>
 #include <climits>
 #include <cstdint>
 #include <cstddef>
@@ -290,6 +293,20 @@ struct OpReduceProd
     }
 };
 
+// 16 位浮点的累加类型为 F32，其余类型累加类型即自身
+template <typename T>
+using ReduceAcc = std::conditional_t<is_half_float_v<T>, float, T>;
+
+// 读取元素并转换为累加类型（16 位浮点先展开为 F32）
+template <typename Acc, typename T>
+inline auto load_as(T v) -> Acc
+{
+    if constexpr (is_half_float_v<T>)
+        return static_cast<Acc>(static_cast<float>(v));
+    else
+        return static_cast<Acc>(v);
+}
+
 // ─────────────────────────────────────────────────────────────────────────────
 // 全局 reduce：连续 SIMD fast-path（4 路累加器打破 FP 依赖链）
 // ─────────────────────────────────────────────────────────────────────────────
@@ -344,24 +361,40 @@ auto cpu_global_reduce_linear(int64_t n, const T* ptr) -> T
     return result;
 }
 
+// 16 位浮点：按块展开到栈上 F32 缓冲，复用 F32 SIMD reduce，块间以 F32 合并
+inline constexpr int64_t kReduceHalfBlockElems = 1024;
+
+template <typename H, typename ISA, typename Op>
+auto cpu_global_reduce_half_linear(int64_t n, const H* ptr) -> float
+{
+    alignas(64) float buf[kReduceHalfBlockElems];
+    float             result = Op::template identity<float>();
+    for (int64_t i = 0; i < n; i += kReduceHalfBlockElems) {
+        const int64_t len = std::min(kReduceHalfBlockElems, n - i);
+        cast_simd_chunk<H, float, ISA>(ptr + i, buf, len);
+        result = Op::template scalar<float>(result, cpu_global_reduce_linear<float, ISA, Op>(len, buf));
+    }
+    return result;
+}
+
 // ─────────────────────────────────────────────────────────────────────────────
 // 全局 reduce：非连续 stride 迭代 slow-path
 // ─────────────────────────────────────────────────────────────────────────────
 
-template <typename T, typename Op>
-auto cpu_global_reduce_strided(const Tensor& a) -> T
+template <typename T, typename Op, typename Acc = T>
+auto cpu_global_reduce_strided(const Tensor& a) -> Acc
 {
     const int64_t ndim    = a.ndim();
     const auto&   shape   = a.shape();
     const auto&   strides = a.strides();
-    const auto*   ptr     = static_cast<const T*>(a.data_ptr());
+    const auto*   ptr     = static_cast<const T*>(a.const_data_ptr());
     const int64_t n       = a.numel();
 
-    T result = Op::template identity<T>();
+    Acc result = Op::template identity<Acc>();
 
     if (ndim == 0) {
         // 0-rank 标量直接读取单元素
-        return Op::template scalar<T>(result, ptr[0]);
+        return Op::template scalar<Acc>(result, load_as<Acc>(ptr[0]));
     }
 
     std::vector<int64_t> idx(static_cast<std::size_t>(ndim), 0);
@@ -369,7 +402,7 @@ auto cpu_global_reduce_strided(const Tensor& a) -> T
         int64_t off = 0;
         for (int64_t d = 0; d < ndim; ++d)
             off += idx[static_cast<std::size_t>(d)] * strides[static_cast<std::size_t>(d)];
-        result = Op::template scalar<T>(result, ptr[off]);
+        result = Op::template scalar<Acc>(result, load_as<Acc>(ptr[off]));
 
         // 推进多维索引（末尾维度最快）
         for (int64_t d = ndim - 1; d >= 0; --d) {
@@ -396,64 +429,73 @@ inline constexpr int64_t kReduceChunkBytes = 64 * 1024;
 template <typename T, typename ISA, typename Op>
 auto cpu_reduce_global_dispatch(const Tensor& a, Tensor& out) -> void
 {
-    const auto*   in_ptr  = static_cast<const T*>(a.data_ptr());
-    auto*         out_ptr = static_cast<T*>(out.data_ptr());
+    using Acc = ReduceAcc<T>;
+
+    const auto*   in_ptr  = static_cast<const T*>(a.const_data_ptr());
+    auto*         out_ptr = static_cast<T*>(out.scoped_data_ptr());
     const int64_t n       = a.numel();
     const int64_t bytes   = n * static_cast<int64_t>(sizeof(T));
 
-    T result;
+    const auto linear = [](int64_t len, const T* p) -> Acc {
+        if constexpr (is_half_float_v<T>)
+            return cpu_global_reduce_half_linear<T, ISA, Op>(len, p);
+        else
+            return cpu_global_reduce_linear<T, ISA, Op>(len, p);
+    };
+
+    Acc result;
     if (!a.is_contiguous()) {
-        result = cpu_global_reduce_strided<T, Op>(a);
+        result = cpu_global_reduce_strided<T, Op, Acc>(a);
     } else if (bytes < kReduceParallelBytes) {
-        result = cpu_global_reduce_linear<T, ISA, Op>(n, in_ptr);
+        result = linear(n, in_ptr);
     } else {
         const std::size_t grain = static_cast<std::size_t>(std::max<int64_t>(1, kReduceChunkBytes / static_cast<int64_t>(sizeof(T))));
         // 工人局部 partial，最终主线程做 N 路合并。
-        std::vector<T> partials;
-        std::mutex     mu;
+        std::vector<Acc> partials;
+        std::mutex       mu;
         parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(n), grain, [&](std::size_t lo, std::size_t hi) {
-            T               p = cpu_global_reduce_linear<T, ISA, Op>(static_cast<int64_t>(hi - lo), in_ptr + lo);
+            Acc             p = linear(static_cast<int64_t>(hi - lo), in_ptr + lo);
             std::lock_guard lk(mu);
             partials.push_back(p);
         });
-        result = Op::template identity<T>();
-        for (const T& p : partials)
-            result = Op::template scalar<T>(result, p);
+        result = Op::template identity<Acc>();
+        for (const Acc& p : partials)
+            result = Op::template scalar<Acc>(result, p);
     }
 
-    out_ptr[0] = result;
+    out_ptr[0] = static_cast<T>(result);
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
 // mean 全局 reduce 的 double 累加特化（供 I32/I64 输入使用）
 // ─────────────────────────────────────────────────────────────────────────────
 
-// Tin 为输入类型（I32/I64 等整型），Tout 为输出类型（F64）
+// Tin 为输入类型（I32/I64 等整型，或 F16/BF16），Tout 为输出类型（F64，或与 16 位浮点输入相同）
 template <typename Tin, typename Tout>
 auto cpu_reduce_mean_global_dispatch(const Tensor& a, Tensor& out) -> void
 {
-    const auto*   in_ptr  = static_cast<const Tin*>(a.data_ptr());
-    auto*         out_ptr = static_cast<Tout*>(out.data_ptr());
+    const auto*   in_ptr  = static_cast<const Tin*>(a.const_data_ptr());
+    auto*         out_ptr = static_cast<Tout*>(out.scoped_data_ptr());
     const int64_t n       = a.numel();
 
     double acc = 0.0;
     if (a.is_contiguous()) {
         for (int64_t i = 0; i < n; ++i)
-            acc += static_cast<double>(in_ptr[i]);
+            acc += load_as<double>(in_ptr[i]);
     } else {
         // 非连续：通过 stride 迭代
         const int64_t ndim    = a.ndim();
         const auto&   shape   = a.shape();
         const auto&   strides = a.strides();
         if (ndim == 0) {
-            acc = static_cast<double>(in_ptr[0]);
+            acc = load_as<double>(in_ptr[0]);
         } else {
             std::vector<int64_t> idx(static_cast<std::size_t>(ndim), 0);
             for (int64_t k = 0; k < n; ++k) {
                 int64_t off = 0;
                 for (int64_t d = 0; d < ndim; ++d)
                     off += idx[static_cast<std::size_t>(d)] * strides[static_cast<std::size_t>(d)];
-                acc += static_cast<double>(in_ptr[off]);
+                acc += load_as<double>(in_ptr[off]);
                 for (int64_t d = ndim - 1; d >= 0; --d) {
                     ++idx[static_cast<std::size_t>(d)];
                     if (idx[static_cast<std::size_t>(d)] < shape[static_cast<std::size_t>(d)])
@@ -473,11 +515,13 @@ auto cpu_reduce_mean_global_dispatch(const Tensor& a, Tensor& out) -> void
 template <typename T, typename Op>
 auto cpu_reduce_axis_dispatch(const Tensor& a, int64_t dim, bool keepdim, Tensor& out) -> void
 {
+    using Acc = ReduceAcc<T>;
+
     const int64_t ndim      = a.ndim();
     const auto&   shape     = a.shape();
     const auto&   strides_a = a.strides();
-    const auto*   in_ptr    = static_cast<const T*>(a.data_ptr());
-    auto*         out_ptr   = static_cast<T*>(out.data_ptr());
+    const auto*   in_ptr    = static_cast<const T*>(a.const_data_ptr());
+    auto*         out_ptr   = static_cast<T*>(out.scoped_data_ptr());
 
     const int64_t K = shape[static_cast<std::size_t>(dim)];
 
@@ -494,10 +538,10 @@ auto cpu_reduce_axis_dispatch(const Tensor& a, int64_t dim, bool keepdim, Tensor
         // 连续快速路径：直接用下标公式访问
         for (int64_t o = 0; o < outer; ++o) {
             for (int64_t i = 0; i < inner; ++i) {
-                T acc = Op::template identity<T>();
+                Acc acc = Op::template identity<Acc>();
                 for (int64_t k = 0; k < K; ++k)
-                    acc = Op::template scalar<T>(acc, in_ptr[o * K * inner + k * inner + i]);
-                out_ptr[o * inner + i] = acc;
+                    acc = Op::template scalar<Acc>(acc, load_as<Acc>(in_ptr[o * K * inner + k * inner + i]));
+                out_ptr[o * inner + i] = static_cast<T>(acc);
             }
         }
     } else {
@@ -522,10 +566,10 @@ auto cpu_reduce_axis_dispatch(const Tensor& a, int64_t dim, bool keepdim, Tensor
 
                 const int64_t in_base = outer_off + inner_off;
 
-                T acc = Op::template identity<T>();
+                Acc acc = Op::template identity<Acc>();
                 for (int64_t k = 0; k < K; ++k)
-                    acc = Op::template scalar<T>(acc, in_ptr[in_base + k * strides_a[static_cast<std::size_t>(dim)]]);
-                out_ptr[o * inner + i] = acc;
+                    acc = Op::template scalar<Acc>(acc, load_as<Acc>(in_ptr[in_base + k * strides_a[static_cast<std::size_t>(dim)]]));
+                out_ptr[o * inner + i] = static_cast<T>(acc);
 
                 // 推进 inner 多维索引
                 for (int64_t d = inner_ndim - 1; d >= 0; --d) {
@@ -557,8 +601,8 @@ auto cpu_reduce_mean_axis_dispatch(const Tensor& a, int64_t dim, bool keepdim, T
     const int64_t ndim      = a.ndim();
     const auto&   shape     = a.shape();
     const auto&   strides_a = a.strides();
-    const auto*   in_ptr    = static_cast<const Tin*>(a.data_ptr());
-    auto*         out_ptr   = static_cast<Tout*>(out.data_ptr());
+    const auto*   in_ptr    = static_cast<const Tin*>(a.const_data_ptr());
+    auto*         out_ptr   = static_cast<Tout*>(out.scoped_data_ptr());
 
     const int64_t K = shape[static_cast<std::size_t>(dim)];
 
@@ -576,7 +620,7 @@ auto cpu_reduce_mean_axis_dispatch(const Tensor& a, int64_t dim, bool keepdim, T
                 // 累加为 double 以保证整型输入的精度
                 double acc = 0.0;
                 for (int64_t k = 0; k < K; ++k)
-                    acc += static_cast<double>(in_ptr[o * K * inner + k * inner + i]);
+                    acc += load_as<double>(in_ptr[o * K * inner + k * inner + i]);
                 out_ptr[o * inner + i] = static_cast<Tout>(acc / static_cast<double>(K));
             }
         }
@@ -601,7 +645,7 @@ auto cpu_reduce_mean_axis_dispatch(const Tensor& a, int64_t dim, bool keepdim, T
 
                 double acc = 0.0;
                 for (int64_t k = 0; k < K; ++k)
-                    acc += static_cast<double>(in_ptr[in_base + k * strides_a[static_cast<std::size_t>(dim)]]);
+                    acc += load_as<double>(in_ptr[in_base + k * strides_a[static_cast<std::size_t>(dim)]]);
                 out_ptr[o * inner + i] = static_cast<Tout>(acc / static_cast<double>(K));
 
                 for (int64_t d = inner_ndim - 1; d >= 0; --d) {
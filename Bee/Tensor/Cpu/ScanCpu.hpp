@@ -0,0 +1,194 @@
+#pragma once
+
+// CPU 前缀扫描内核：cumsum / cumprod / cummax / cummin（沿单一维度）
+// 输入视为连续 [outer, K, inner]，输出同形状：
+// - inner == 1 且行数足够：跨行并行，每行串行扫描 + 单次写出
+// - inner == 1 且行很长：沿 Task/Parallel/Scan.hpp 的三阶段结构
+//     1. 各块局部 inclusive scan 并记录块总和（并行）
+//     2. 串行扫描块总和得到前缀偏移
+//     3. 偏移修正 out = op(offset, out)（并行，SIMD）
+// - inner > 1：逐 k 行推进，在 inner 方向做 SIMD 的 op(prev, cur)；按 (outer, 列块) 并行
+// Op 复用 ReduceCpu.hpp 的 reduce 标签（scalar / simd_acc / has_simd）
+// 有符号整型 sum / prod 的标量步在无符号类型中计算，溢出按补码回绕而非 UB（SIMD 整型加法本身即回绕）
+
+#include "Tensor/Core/Tensor.hpp"
+#include "Tensor/Cpu/ReduceCpu.hpp"
+#include "SIMD/SIMD.hpp"
+#include "Base/Parallel/ParallelFor.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace bee::cpu
+{
+
+// 长轴三阶段扫描的触发阈值（单行字节数）
+inline constexpr int64_t kScanLongAxisBytes = 4 * 1024 * 1024;
+// 每任务目标字节数（跨行 / 跨列块并行的粒度）
+inline constexpr int64_t kScanGrainBytes = 128 * 1024;
+// inner > 1 路径的最小列块宽度
+inline constexpr int64_t kScanMinColChunk = 64;
+
+// 单步 op(a, b)：有符号整型 sum / prod 经无符号类型计算（模 2^N），转回有符号为定义行为
+template <typename T, typename Op>
+inline auto scan_step(T a, T b) -> T
+{
+    constexpr bool wraps = std::is_same_v<Op, OpReduceSum> || std::is_same_v<Op, OpReduceProd>;
+    if constexpr (wraps && std::is_integral_v<T> && std::is_signed_v<T>) {
+        using U = std::make_unsigned_t<T>;
+        return static_cast<T>(Op::template scalar<U>(static_cast<U>(a), static_cast<U>(b)));
+    } else {
+        return Op::template scalar<T>(a, b);
+    }
+}
+
+// 单行串行 inclusive scan：y[i] = op(y[i-1], x[i])
+template <typename T, typename Op>
+auto scan_row_serial(const T* x, T* y, int64_t n) -> T
+{
+    if (n <= 0)
+        return Op::template identity<T>();
+    T acc = x[0];
+    y[0]  = acc;
+    for (int64_t i = 1; i < n; ++i) {
+        acc  = scan_step<T, Op>(acc, x[i]);
+        y[i] = acc;
+    }
+    return acc;
+}
+
+// 偏移修正：y[i] = op(offset, y[i])
+template <typename T, typename ISA, typename Op>
+auto scan_fixup_linear(T* y, int64_t n, T offset) -> void
+{
+    int64_t i = 0;
+    if constexpr (Op::template has_simd<T, ISA>) {
+        using B          = simd::SimdBackend<T, ISA>;
+        constexpr auto W = static_cast<int64_t>(B::width);
+        const auto     vo = B::set1(offset);
+        for (; i + W <= n; i += W)
+            B::storeu(y + i, Op::template simd_acc<T, ISA>(vo, B::loadu(y + i)));
+    }
+    for (; i < n; ++i)
+        y[i] = scan_step<T, Op>(offset, y[i]);
+}
+
+// 长行三阶段并行扫描
+template <typename T, typename ISA, typename Op>
+auto scan_row_parallel(const T* x, T* y, int64_t n) -> void
+{
+    const int64_t workers = static_cast<int64_t>(parallel::available_parallelism());
+    const int64_t grain   = std::max<int64_t>(1, kScanGrainBytes / static_cast<int64_t>(sizeof(T)));
+    const int64_t chunks  = std::max<int64_t>(1, std::min(workers, (n + grain - 1) / grain));
+    if (chunks <= 1) {
+        scan_row_serial<T, Op>(x, y, n);
+        return;
+    }
+    const int64_t per = (n + chunks - 1) / chunks;
+
+    // 第一阶段：各块局部 scan
+    std::vector<T> totals(static_cast<std::size_t>(chunks));
+    parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(chunks), std::size_t{1}, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t c = lo; c < hi; ++c) {
+            const int64_t b = static_cast<int64_t>(c) * per;
+            const int64_t e = std::min(n, b + per);
+            totals[c]       = scan_row_serial<T, Op>(x + b, y + b, e - b);
+        }
+    });
+
+    // 第二阶段：串行计算块前缀偏移（offsets[c] = op(totals[0..c-1])）
+    std::vector<T> offsets(static_cast<std::size_t>(chunks));
+    for (int64_t c = 1; c < chunks; ++c) {
+        const auto i = static_cast<std::size_t>(c);
+        offsets[i]   = (c == 1) ? totals[0] : scan_step<T, Op>(offsets[i - 1], totals[i - 1]);
+    }
+
+    // 第三阶段：偏移修正（跳过第 0 块）
+    parallel::parallel_for(std::size_t{1}, static_cast<std::size_t>(chunks), std::size_t{1}, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t c = lo; c < hi; ++c) {
+            const int64_t b = static_cast<int64_t>(c) * per;
+            const int64_t e = std::min(n, b + per);
+            scan_fixup_linear<T, ISA, Op>(y + b, e - b, offsets[c]);
+        }
+    });
+}
+
+// inner > 1：对 [K, ld] 的 [c0, c0+nc) 列块沿 K 扫描，lane 间相互独立
+template <typename T, typename ISA, typename Op>
+auto scan_columns(const T* x, T* y, int64_t K, int64_t ld, int64_t nc) -> void
+{
+    for (int64_t j = 0; j < nc; ++j)
+        y[j] = x[j];
+    for (int64_t k = 1; k < K; ++k) {
+        const T* xr   = x + k * ld;
+        const T* prev = y + (k - 1) * ld;
+        T*       yr   = y + k * ld;
+        int64_t  j    = 0;
+        if constexpr (Op::template has_simd<T, ISA>) {
+            using B          = simd::SimdBackend<T, ISA>;
+            constexpr auto W = static_cast<int64_t>(B::width);
+            for (; j + W <= nc; j += W)
+                B::storeu(yr + j, Op::template simd_acc<T, ISA>(B::loadu(prev + j), B::loadu(xr + j)));
+        }
+        for (; j < nc; ++j)
+            yr[j] = scan_step<T, Op>(prev[j], xr[j]);
+    }
+}
+
+template <typename T, typename ISA, typename Op>
+auto cpu_scan_dispatch(const Tensor& a, int64_t dim, Tensor& out) -> void
+{
+    const auto& shape = a.shape();
+    const auto* in    = static_cast<const T*>(a.const_data_ptr());
+    auto*       o_ptr = static_cast<T*>(out.scoped_data_ptr());
+
+    const int64_t K     = shape[static_cast<std::size_t>(dim)];
+    int64_t       outer = 1;
+    for (int64_t d = 0; d < dim; ++d)
+        outer *= shape[static_cast<std::size_t>(d)];
+    int64_t inner = 1;
+    for (int64_t d = dim + 1; d < a.ndim(); ++d)
+        inner *= shape[static_cast<std::size_t>(d)];
+    if (outer == 0 || K == 0 || inner == 0)
+        return;
+
+    const int64_t workers = static_cast<int64_t>(parallel::available_parallelism());
+
+    if (inner == 1) {
+        const int64_t row_bytes = K * static_cast<int64_t>(sizeof(T));
+        if (outer < workers && row_bytes >= kScanLongAxisBytes) {
+            for (int64_t o = 0; o < outer; ++o)
+                scan_row_parallel<T, ISA, Op>(in + o * K, o_ptr + o * K, K);
+            return;
+        }
+        const auto grain = static_cast<std::size_t>(std::max<int64_t>(1, kScanGrainBytes / std::max<int64_t>(1, row_bytes)));
+        parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(outer), grain, [&](std::size_t lo, std::size_t hi) {
+            for (std::size_t o = lo; o < hi; ++o)
+                scan_row_serial<T, Op>(in + static_cast<int64_t>(o) * K, o_ptr + static_cast<int64_t>(o) * K, K);
+        });
+        return;
+    }
+
+    // inner > 1：列块宽度兼顾并行度（outer 较少时把 inner 切细）
+    const int64_t want_chunks = std::max<int64_t>(1, (workers + outer - 1) / outer);
+    const int64_t col_chunk   = std::min(inner, std::max(kScanMinColChunk, (inner + want_chunks - 1) / want_chunks));
+    const int64_t col_chunks  = (inner + col_chunk - 1) / col_chunk;
+    const int64_t tasks       = outer * col_chunks;
+    const int64_t task_bytes  = K * col_chunk * static_cast<int64_t>(sizeof(T));
+    const auto    grain       = static_cast<std::size_t>(std::max<int64_t>(1, kScanGrainBytes / std::max<int64_t>(1, task_bytes)));
+
+    parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(tasks), grain, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t t = lo; t < hi; ++t) {
+            const int64_t o    = static_cast<int64_t>(t) / col_chunks;
+            const int64_t c0   = (static_cast<int64_t>(t) % col_chunks) * col_chunk;
+            const int64_t nc   = std::min(col_chunk, inner - c0);
+            const int64_t base = o * K * inner + c0;
+            scan_columns<T, ISA, Op>(in + base, o_ptr + base, K, inner, nc);
+        }
+    });
+}
+
+} // namespace bee::cpu
@@ -0,0 +1,405 @@
+#pragma once
+
+// CPU 排序内核：sort / argsort 沿任意轴（数据折叠为 {O, N, I}，每个 (o, i) 为一行）
+// - 键变换：元素映射为无符号整数键，整数序即数值序；NaN 统一为最大键（升序排在最后），-0.0 并入 +0.0；
+//   降序时键取反。各路径都按 (键, 原下标) 排序，结果稳定，且与所走路径、线程数无关
+// - 短行（N ≤ 16 且键为 32 位）：键与下标拼成 64 位，W 行一组转置进向量寄存器，按 Batcher 奇偶归并网络
+//   逐比较器做 min/max（AVX-512 用 min/max_epu64，AVX2 用 cmpgt_epi64 + blendv，其余逐行标量）
+// - 其余行在行间并行：行内 N ≤ kSortStdMax 用 std::sort，更长的行用串行 LSD 基数排序
+// - 行数少于线程数的长轴：单行内并行 LSD 基数排序（8 位一趟：各块直方图 → 桶优先的全局前缀 → 各块稳定散射；
+//   某一趟所有键落入同一桶时跳过该趟）
+
+#include "SIMD/SIMD.hpp"
+#include "Base/Parallel/ParallelFor.hpp"
+#include "Tensor/Cpu/SortGeom.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(BEE_SIMD_ENABLE_AVX2) || defined(BEE_SIMD_ENABLE_AVX512)
+    #include <immintrin.h>
+#endif
+
+namespace bee::cpu
+{
+
+inline constexpr std::int64_t kSortNetworkMax  = 16;        // 走排序网络的最大行长
+inline constexpr std::int64_t kSortStdMax      = 256;       // 行内 std::sort 的最大行长，更长走基数排序
+inline constexpr std::int64_t kSortParallelMin = 64 * 1024; // 单行内并行基数排序的最小行长
+inline constexpr std::int64_t kSortGrainElems  = 16 * 1024; // 行间并行时每个任务的目标元素数
+inline constexpr std::int64_t kRadixBlockMin   = 16 * 1024; // 并行基数排序每块的最小元素数
+
+// ─── 键变换 ──────────────────────────────────────────────────────────────────
+template <typename T>
+using sort_key_t = std::conditional_t<(sizeof(T) <= 4), std::uint32_t, std::uint64_t>;
+
+template <typename T>
+inline auto sort_key(T v, bool descending) -> sort_key_t<T>
+{
+    using K           = sort_key_t<T>;
+    constexpr K kSign = K{1} << (sizeof(K) * 8 - 1);
+    K           key   = 0;
+    if constexpr (std::is_floating_point_v<T>) {
+        if (v != v) {
+            key = ~K{0};
+        } else {
+            const K bits = std::bit_cast<K>(v == T(0) ? T(0) : v);
+            key          = (bits & kSign) != 0 ? ~bits : bits ^ kSign;
+        }
+    } else if constexpr (std::is_signed_v<T>) {
+        key = static_cast<K>(static_cast<std::make_unsigned_t<T>>(v)) ^ kSign;
+    } else {
+        key = static_cast<K>(v);
+    }
+    return descending ? ~key : key;
+}
+
+// 第 r 行（r = o * I + i）首元素的线性位置；行内元素步长为 I
+inline auto sort_row_base(const SortGeom& g, std::int64_t r) -> std::int64_t
+{
+    return (r / g.I) * g.N * g.I + r % g.I;
+}
+
+// 按排好的原下标写出一行：indices 必写，values 可为 nullptr（argsort）
+template <typename T, typename Order>
+inline void sort_write_row(const SortGeom& g, std::int64_t base, const T* src, T* values, std::int64_t* indices, Order&& order)
+{
+    for (std::int64_t j = 0; j < g.N; ++j) {
+        const std::int64_t k    = order(j);
+        indices[base + j * g.I] = k;
+        if (values != nullptr)
+            values[base + j * g.I] = src[base + k * g.I];
+    }
+}
+
+// ─── 排序网络 ────────────────────────────────────────────────────────────────
+struct SortPair
+{
+    std::uint8_t a;
+    std::uint8_t b;
+};
+
+// Batcher 奇偶归并网络（P 为 2 的幂）：对每个比较器 (a, b)（a < b）调用 emit
+template <typename Emit>
+constexpr void batcher_visit(int P, Emit&& emit)
+{
+    for (int p = 1; p < P; p <<= 1) {
+        for (int k = p; k >= 1; k >>= 1) {
+            for (int j = k % p; j + k < P; j += 2 * k) {
+                for (int i = 0; i < std::min(k, P - j - k); ++i) {
+                    if ((i + j) / (2 * p) == (i + j + k) / (2 * p))
+                        emit(i + j, i + j + k);
+                }
+            }
+        }
+    }
+}
+
+template <int P>
+inline constexpr auto kBatcherPairs = [] {
+    constexpr int count = [] {
+        int c = 0;
+        batcher_visit(P, [&](int, int) { ++c; });
+        return c;
+    }();
+    std::array<SortPair, count> out{};
+    int                         n = 0;
+    batcher_visit(P, [&](int a, int b) { out[n++] = SortPair{static_cast<std::uint8_t>(a), static_cast<std::uint8_t>(b)}; });
+    return out;
+}();
+
+// 网络的一条"通道"：W 行并排，寄存器 v[j] 的第 l 道为第 l 行的第 j 个 64 位复合键
+template <typename ISA>
+struct SortLanes
+{
+    static constexpr int W = 1;
+    using V                = std::uint64_t;
+
+    static auto load(const std::uint64_t* p) -> V { return *p; }
+
+    static void store(std::uint64_t* p, V v) { *p = v; }
+
+    static void cmpswap(V& a, V& b)
+    {
+        const V lo = a < b ? a : b;
+        b          = a < b ? b : a;
+        a          = lo;
+    }
+};
+
+#if defined(BEE_SIMD_ENABLE_AVX2)
+// AVX2 只有有符号 64 位比较：载入 / 写回时翻转符号位
+template <>
+struct SortLanes<simd::IsaAvx2>
+{
+    static constexpr int W = 4;
+    using V                = __m256i;
+
+    static auto bias() -> __m256i { return _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ull)); }
+
+    static auto load(const std::uint64_t* p) -> V { return _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), bias()); }
+
+    static void store(std::uint64_t* p, V v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm256_xor_si256(v, bias())); }
+
+    static void cmpswap(V& a, V& b)
+    {
+        const __m256i gt = _mm256_cmpgt_epi64(a, b);
+        const __m256i lo = _mm256_blendv_epi8(a, b, gt);
+        b                = _mm256_blendv_epi8(b, a, gt);
+        a                = lo;
+    }
+};
+#endif
+
+#if defined(BEE_SIMD_ENABLE_AVX512)
+template <>
+struct SortLanes<simd::IsaAvx512>
+{
+    static constexpr int W = 8;
+    using V                = __m512i;
+
+    static auto load(const std::uint64_t* p) -> V { return _mm512_loadu_si512(p); }
+
+    static void store(std::uint64_t* p, V v) { _mm512_storeu_si512(p, v); }
+
+    static void cmpswap(V& a, V& b)
+    {
+        const __m512i lo = _mm512_min_epu64(a, b);
+        b                = _mm512_max_epu64(a, b);
+        a                = lo;
+    }
+};
+#endif
+
+template <int P, typename L>
+inline void sort_network(typename L::V* v)
+{
+    for (const auto& pr : kBatcherPairs<P>)
+        L::cmpswap(v[pr.a], v[pr.b]);
+}
+
+// 短行 [r0, r1)：复合键 (key << 32) | j 唯一，网络排序即稳定排序；不足 P 的位置与不足 W 的行填全 1（排在最后）
+template <typename T, typename ISA>
+void sort_small_rows(const SortGeom& g, const T* src, T* values, std::int64_t* indices, std::int64_t r0, std::int64_t r1)
+{
+    using L         = SortLanes<ISA>;
+    constexpr int W = L::W;
+    const auto    n = static_cast<int>(g.N);
+    const auto    P = static_cast<int>(std::bit_ceil(static_cast<unsigned>(n)));
+    std::uint64_t buf[kSortNetworkMax * W];
+    typename L::V v[kSortNetworkMax];
+
+    for (std::int64_t r = r0; r < r1; r += W) {
+        const auto lanes = static_cast<int>(std::min<std::int64_t>(W, r1 - r));
+        for (int l = 0; l < W; ++l) {
+            const std::int64_t base = l < lanes ? sort_row_base(g, r + l) : 0;
+            for (int j = 0; j < P; ++j) {
+                std::uint64_t c = ~std::uint64_t{0};
+                if (l < lanes && j < n)
+                    c = static_cast<std::uint64_t>(sort_key(src[base + j * g.I], g.descending)) << 32 | static_cast<std::uint64_t>(j);
+                buf[j * W + l] = c;
+            }
+        }
+        for (int j = 0; j < P; ++j)
+            v[j] = L::load(buf + j * W);
+        switch (P) {
+        case 2: sort_network<2, L>(v); break;
+        case 4: sort_network<4, L>(v); break;
+        case 8: sort_network<8, L>(v); break;
+        default: sort_network<16, L>(v); break;
+        }
+        for (int j = 0; j < P; ++j)
+            L::store(buf + j * W, v[j]);
+        for (int l = 0; l < lanes; ++l) {
+            sort_write_row(g, sort_row_base(g, r + l), src, values, indices, [&](std::int64_t j) {
+                return static_cast<std::int64_t>(static_cast<std::uint32_t>(buf[j * W + l]));
+            });
+        }
+    }
+}
+
+// ─── 基数排序 ────────────────────────────────────────────────────────────────
+// 稳定 LSD 基数排序：按 key 升序重排 (key, idx)；blocks > 1 时每趟的直方图与散射在块间并行。
+// 返回结果所在的下标数组（idx 或 idx_tmp，取决于实际执行的趟数）
+template <typename K>
+auto radix_sort_pairs(K* key, std::int64_t* idx, K* key_tmp, std::int64_t* idx_tmp, std::int64_t n, std::int64_t blocks) -> const std::int64_t*
+{
+    std::vector<std::int64_t> hist(static_cast<std::size_t>(blocks) * 256);
+    auto                      block_lo = [&](std::int64_t b) { return n * b / blocks; };
+
+    // 块 b 为 [block_lo(b), block_lo(b + 1))，划分只取决于 n 与 blocks
+    auto for_blocks = [&](auto&& fn) {
+        if (blocks == 1) {
+            fn(std::int64_t{0});
+            return;
+        }
+        parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(blocks), std::size_t{1}, [&](std::size_t b0, std::size_t b1) {
+            for (auto b = static_cast<std::int64_t>(b0); b < static_cast<std::int64_t>(b1); ++b)
+                fn(b);
+        });
+    };
+
+    for (int shift = 0; shift < static_cast<int>(sizeof(K) * 8); shift += 8) {
+        std::fill(hist.begin(), hist.end(), 0);
+        for_blocks([&](std::int64_t b) {
+            std::int64_t* h = hist.data() + b * 256;
+            for (std::int64_t i = block_lo(b); i < block_lo(b + 1); ++i)
+                ++h[(key[i] >> shift) & 0xFF];
+        });
+
+        // 桶优先、块其次的前缀和：同桶内保持块序与块内原序，整趟稳定
+        std::int64_t run     = 0;
+        bool         trivial = false;
+        for (int d = 0; d < 256; ++d) {
+            std::int64_t total = 0;
+            for (std::int64_t b = 0; b < blocks; ++b) {
+                const std::int64_t c = hist[b * 256 + d];
+                hist[b * 256 + d]    = run;
+                run += c;
+                total += c;
+            }
+            trivial = trivial || total == n;
+        }
+        if (trivial)
+            continue;
+
+        for_blocks([&](std::int64_t b) {
+            std::int64_t* h = hist.data() + b * 256;
+            for (std::int64_t i = block_lo(b); i < block_lo(b + 1); ++i) {
+                const std::int64_t p = h[(key[i] >> shift) & 0xFF]++;
+                key_tmp[p]           = key[i];
+                idx_tmp[p]           = idx[i];
+            }
+        });
+        std::swap(key, key_tmp);
+        std::swap(idx, idx_tmp);
+    }
+    return idx;
+}
+
+// 行间并行路径的单行排序；scratch 在同一任务的各行间复用
+template <typename K>
+struct SortScratch
+{
+    std::vector<std::uint64_t>              comp;
+    std::vector<std::pair<K, std::int64_t>> pairs;
+    std::vector<K>                          key;
+    std::vector<K>                          key_tmp;
+    std::vector<std::int64_t>               idx;
+    std::vector<std::int64_t>               idx_tmp;
+};
+
+template <typename T>
+void sort_row_serial(const SortGeom& g, std::int64_t base, const T* src, T* values, std::int64_t* indices, SortScratch<sort_key_t<T>>& s)
+{
+    using K           = sort_key_t<T>;
+    const auto n      = static_cast<std::size_t>(g.N);
+    auto       key_at = [&](std::int64_t j) { return sort_key(src[base + j * g.I], g.descending); };
+
+    if (g.N <= kSortStdMax) {
+        if constexpr (sizeof(K) == 4) {
+            s.comp.resize(n);
+            for (std::int64_t j = 0; j < g.N; ++j)
+                s.comp[j] = static_cast<std::uint64_t>(key_at(j)) << 32 | static_cast<std::uint64_t>(j);
+            std::sort(s.comp.begin(), s.comp.end());
+            sort_write_row(g, base, src, values, indices, [&](std::int64_t j) {
+                return static_cast<std::int64_t>(static_cast<std::uint32_t>(s.comp[j]));
+            });
+        } else {
+            s.pairs.resize(n);
+            for (std::int64_t j = 0; j < g.N; ++j)
+                s.pairs[j] = {key_at(j), j};
+            std::sort(s.pairs.begin(), s.pairs.end());
+            sort_write_row(g, base, src, values, indices, [&](std::int64_t j) { return s.pairs[j].second; });
+        }
+        return;
+    }
+
+    s.key.resize(n);
+    s.key_tmp.resize(n);
+    s.idx.resize(n);
+    s.idx_tmp.resize(n);
+    for (std::int64_t j = 0; j < g.N; ++j) {
+        s.key[j] = key_at(j);
+        s.idx[j] = j;
+    }
+    const std::int64_t* order = radix_sort_pairs<K>(s.key.data(), s.idx.data(), s.key_tmp.data(), s.idx_tmp.data(), g.N, 1);
+    sort_write_row(g, base, src, values, indices, [&](std::int64_t j) { return order[j]; });
+}
+
+// 长轴单行：键生成、基数排序各趟与写出均在行内并行
+template <typename T>
+void sort_row_parallel(const SortGeom& g, std::int64_t base, const T* src, T* values, std::int64_t* indices)
+{
+    using K                   = sort_key_t<T>;
+    const std::int64_t n      = g.N;
+    const auto         blocks = std::clamp<std::int64_t>(n / kRadixBlockMin, 1, static_cast<std::int64_t>(parallel::available_parallelism()));
+    const auto         grain  = static_cast<std::size_t>(kRadixBlockMin);
+
+    std::vector<K>            key(static_cast<std::size_t>(n));
+    std::vector<K>            key_tmp(static_cast<std::size_t>(n));
+    std::vector<std::int64_t> idx(static_cast<std::size_t>(n));
+    std::vector<std::int64_t> idx_tmp(static_cast<std::size_t>(n));
+
+    parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(n), grain, [&](std::size_t lo, std::size_t hi) {
+        for (auto j = static_cast<std::int64_t>(lo); j < static_cast<std::int64_t>(hi); ++j) {
+            key[j] = sort_key(src[base + j * g.I], g.descending);
+            idx[j] = j;
+        }
+    });
+    const std::int64_t* order = radix_sort_pairs<K>(key.data(), idx.data(), key_tmp.data(), idx_tmp.data(), n, blocks);
+    parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(n), grain, [&](std::size_t lo, std::size_t hi) {
+        for (auto j = static_cast<std::int64_t>(lo); j < static_cast<std::int64_t>(hi); ++j) {
+            const std::int64_t k    = order[j];
+            indices[base + j * g.I] = k;
+            if (values != nullptr)
+                values[base + j * g.I] = src[base + k * g.I];
+        }
+    });
+}
+
+// 顶层：src / values / indices 均为 {O, N, I} 连续；values 为 nullptr 时只输出下标
+template <typename T, typename ISA>
+auto cpu_sort(const SortGeom& g, const T* src, T* values, std::int64_t* indices) -> void
+{
+    const std::int64_t rows = g.O * g.I;
+    if (rows == 0 || g.N == 0)
+        return;
+    if (g.N == 1) {
+        const auto grain = static_cast<std::size_t>(kSortGrainElems);
+        parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(rows), grain, [&](std::size_t lo, std::size_t hi) {
+            std::fill(indices + lo, indices + hi, std::int64_t{0});
+            if (values != nullptr)
+                std::copy(src + lo, src + hi, values + lo);
+        });
+        return;
+    }
+    if (g.N >= kSortParallelMin && rows < static_cast<std::int64_t>(parallel::available_parallelism())) {
+        for (std::int64_t r = 0; r < rows; ++r)
+            sort_row_parallel(g, sort_row_base(g, r), src, values, indices);
+        return;
+    }
+
+    const std::int64_t grain = std::max<std::int64_t>(1, kSortGrainElems / g.N);
+    parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(rows), static_cast<std::size_t>(grain), [&](std::size_t lo, std::size_t hi) {
+        const auto r0 = static_cast<std::int64_t>(lo);
+        const auto r1 = static_cast<std::int64_t>(hi);
+        if constexpr (sizeof(sort_key_t<T>) == 4) {
+            if (g.N <= kSortNetworkMax) {
+                sort_small_rows<T, ISA>(g, src, values, indices, r0, r1);
+                return;
+            }
+        }
+        SortScratch<sort_key_t<T>> s;
+        for (std::int64_t r = r0; r < r1; ++r)
+            sort_row_serial(g, sort_row_base(g, r), src, values, indices, s);
+    });
+}
+
+} // namespace bee::cpu
@@ -0,0 +1,19 @@
+#pragma once
+
+// 沿轴排序的几何参数，供 Ops 层、运行期分派与 CPU 内核共享
+
+#include <cstdint>
+
+namespace bee::cpu
+{
+
+// 以 dim 为界把张量折叠成 {O, N, I}（连续）：每个 (o, i) 为一行，元素 j 位于 (o * N + j) * I + i
+struct SortGeom
+{
+    std::int64_t O          = 1; // dim 之前各维之积
+    std::int64_t N          = 0; // 排序轴长度
+    std::int64_t I          = 1; // dim 之后各维之积
+    bool         descending = false;
+};
+
+} // namespace bee::cpu
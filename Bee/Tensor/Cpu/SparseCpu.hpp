@@ -0,0 +1,202 @@
+#pragma once
+
+// CPU 稀疏 CSR 内核：spmv / spmm
+// - 行并行按 nnz 均衡：parallel_for 切分的是 [0, nnz)，每块处理起点落在块内的行，
+//   长短行混杂时各块工作量仍接近（单行本身过长时该行仍由一个任务完成）
+// - spmv 行内点积在 AVX2 / AVX-512 下用 32 位索引 gather 取 x[col]，尾部走掩码 gather；其余 ISA 走标量
+// - spmm 对 b 的整行做 FMA 累加，输出按 4 个寄存器宽的列块驻留寄存器，每个非零元只读一次 b 的对应行片段
+
+#include "SIMD/SIMD.hpp"
+#include "Base/Parallel/ParallelFor.hpp"
+#include "Tensor/Cpu/SparseGeom.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(BEE_SIMD_ENABLE_AVX2) || defined(BEE_SIMD_ENABLE_AVX512)
+    #include <immintrin.h>
+#endif
+
+namespace bee::cpu
+{
+
+inline constexpr std::int64_t kCsrGrainNnz = 16 * 1024; // 每个并行任务的目标乘加次数
+
+// 按 nnz 均衡的行并行：fn(r0, r1) 处理行 [r0, r1)；行 r 归属于 crow[r] 所在的 nnz 块，
+// 末尾的空行（crow[r] == nnz）并入最后一块
+template <typename Fn>
+inline void csr_parallel_rows(const CsrView& a, std::int64_t grain, Fn&& fn)
+{
+    if (a.nnz == 0) {
+        fn(std::int64_t{0}, a.rows);
+        return;
+    }
+    const std::int64_t* first = a.crow;
+    const std::int64_t* last  = a.crow + a.rows;
+    parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(a.nnz), static_cast<std::size_t>(grain), [&](std::size_t lo, std::size_t hi) {
+        const auto r0 = std::lower_bound(first, last, static_cast<std::int64_t>(lo)) - first;
+        const auto r1 = hi == static_cast<std::size_t>(a.nnz) ? a.rows : std::lower_bound(first, last, static_cast<std::int64_t>(hi)) - first;
+        if (r0 < r1)
+            fn(static_cast<std::int64_t>(r0), static_cast<std::int64_t>(r1));
+    });
+}
+
+// 行内点积：Σ v[k] · x[c[k]]，k ∈ [0, n)
+template <typename T, typename ISA>
+inline auto csr_row_dot(const T* v, const std::int32_t* c, const T* x, std::int64_t n) -> T
+{
+    T s = T(0);
+    for (std::int64_t k = 0; k < n; ++k)
+        s += v[k] * x[c[k]];
+    return s;
+}
+
+// ─── AVX2 特化 ───────────────────────────────────────────────────────────────
+#if defined(BEE_SIMD_ENABLE_AVX2)
+
+template <>
+inline auto csr_row_dot<float, simd::IsaAvx2>(const float* v, const std::int32_t* c, const float* x, std::int64_t n) -> float
+{
+    __m256       acc = _mm256_setzero_ps();
+    std::int64_t k   = 0;
+    for (; k + 8 <= n; k += 8) {
+        const __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c + k));
+        acc               = _mm256_fmadd_ps(_mm256_loadu_ps(v + k), _mm256_i32gather_ps(x, idx, 4), acc);
+    }
+    if (k < n) {
+        const __m256i m   = _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(n - k)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        const __m256i idx = _mm256_maskload_epi32(reinterpret_cast<const int*>(c + k), m);
+        const __m256  g   = _mm256_mask_i32gather_ps(_mm256_setzero_ps(), x, idx, _mm256_castsi256_ps(m), 4);
+        acc               = _mm256_fmadd_ps(_mm256_maskload_ps(v + k, m), g, acc);
+    }
+    return simd::SimdBackend<float, simd::IsaAvx2>::reduce_sum(acc);
+}
+
+template <>
+inline auto csr_row_dot<double, simd::IsaAvx2>(const double* v, const std::int32_t* c, const double* x, std::int64_t n) -> double
+{
+    __m256d      acc = _mm256_setzero_pd();
+    std::int64_t k   = 0;
+    for (; k + 4 <= n; k += 4) {
+        const __m128i idx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c + k));
+        acc               = _mm256_fmadd_pd(_mm256_loadu_pd(v + k), _mm256_i32gather_pd(x, idx, 8), acc);
+    }
+    if (k < n) {
+        const __m128i m32 = _mm_cmpgt_epi32(_mm_set1_epi32(static_cast<int>(n - k)), _mm_setr_epi32(0, 1, 2, 3));
+        const __m256i m64 = _mm256_cvtepi32_epi64(m32);
+        const __m128i idx = _mm_maskload_epi32(reinterpret_cast<const int*>(c + k), m32);
+        const __m256d g   = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), x, idx, _mm256_castsi256_pd(m64), 8);
+        acc               = _mm256_fmadd_pd(_mm256_maskload_pd(v + k, m64), g, acc);
+    }
+    return simd::SimdBackend<double, simd::IsaAvx2>::reduce_sum(acc);
+}
+
+#endif // BEE_SIMD_ENABLE_AVX2
+
+// ─── AVX-512 特化 ────────────────────────────────────────────────────────────
+#if defined(BEE_SIMD_ENABLE_AVX512)
+
+template <>
+inline auto csr_row_dot<float, simd::IsaAvx512>(const float* v, const std::int32_t* c, const float* x, std::int64_t n) -> float
+{
+    __m512       acc = _mm512_setzero_ps();
+    std::int64_t k   = 0;
+    for (; k + 16 <= n; k += 16) {
+        const __m512i idx = _mm512_loadu_si512(c + k);
+        acc               = _mm512_fmadd_ps(_mm512_loadu_ps(v + k), _mm512_i32gather_ps(idx, x, 4), acc);
+    }
+    if (k < n) {
+        const auto    m   = static_cast<__mmask16>((1u << (n - k)) - 1u);
+        const __m512i idx = _mm512_maskz_loadu_epi32(m, c + k);
+        const __m512  g   = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), m, idx, x, 4);
+        acc               = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(m, v + k), g, acc);
+    }
+    return _mm512_reduce_add_ps(acc);
+}
+
+template <>
+inline auto csr_row_dot<double, simd::IsaAvx512>(const double* v, const std::int32_t* c, const double* x, std::int64_t n) -> double
+{
+    __m512d      acc = _mm512_setzero_pd();
+    std::int64_t k   = 0;
+    for (; k + 8 <= n; k += 8) {
+        const __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c + k));
+        acc               = _mm512_fmadd_pd(_mm512_loadu_pd(v + k), _mm512_i32gather_pd(idx, x, 8), acc);
+    }
+    if (k < n) {
+        const auto    m   = static_cast<__mmask8>((1u << (n - k)) - 1u);
+        const __m256i idx = _mm256_maskz_loadu_epi32(m, c + k);
+        const __m512d g   = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), m, idx, x, 8);
+        acc               = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m, v + k), g, acc);
+    }
+    return _mm512_reduce_add_pd(acc);
+}
+
+#endif // BEE_SIMD_ENABLE_AVX512
+
+// y = A·x：x={cols}，y={rows}
+template <typename T, typename ISA>
+auto cpu_spmv(const CsrView& a, const T* x, T* y) -> void
+{
+    const auto* vals = static_cast<const T*>(a.vals);
+    csr_parallel_rows(a, kCsrGrainNnz, [&](std::int64_t r0, std::int64_t r1) {
+        for (std::int64_t r = r0; r < r1; ++r) {
+            const std::int64_t k0 = a.crow[r];
+            y[r]                  = csr_row_dot<T, ISA>(vals + k0, a.col + k0, x, a.crow[r + 1] - k0);
+        }
+    });
+}
+
+// c = A·b：b={cols, n}、c={rows, n} 均连续
+template <typename T, typename ISA>
+auto cpu_spmm(const CsrView& a, std::int64_t n, const T* b, T* c) -> void
+{
+    using B                   = simd::SimdBackend<T, ISA>;
+    constexpr std::int64_t W  = static_cast<std::int64_t>(B::width);
+    const auto*            vs = static_cast<const T*>(a.vals);
+    const auto*            cs = a.col;
+
+    // 每个非零元贡献 n 次乘加：grain 按 nnz 计，使单任务工作量与 spmv 同量级
+    const std::int64_t grain = std::max<std::int64_t>(1, kCsrGrainNnz / std::max<std::int64_t>(n, 1));
+    csr_parallel_rows(a, grain, [&](std::int64_t r0, std::int64_t r1) {
+        for (std::int64_t r = r0; r < r1; ++r) {
+            const std::int64_t k0  = a.crow[r];
+            const std::int64_t k1  = a.crow[r + 1];
+            T*                 out = c + r * n;
+            std::int64_t       j   = 0;
+            for (; j + 4 * W <= n; j += 4 * W) {
+                auto acc0 = B::set1(T(0));
+                auto acc1 = B::set1(T(0));
+                auto acc2 = B::set1(T(0));
+                auto acc3 = B::set1(T(0));
+                for (std::int64_t k = k0; k < k1; ++k) {
+                    const auto vk = B::set1(vs[k]);
+                    const T*   br = b + static_cast<std::int64_t>(cs[k]) * n + j;
+                    acc0          = B::fma(vk, B::loadu(br), acc0);
+                    acc1          = B::fma(vk, B::loadu(br + W), acc1);
+                    acc2          = B::fma(vk, B::loadu(br + 2 * W), acc2);
+                    acc3          = B::fma(vk, B::loadu(br + 3 * W), acc3);
+                }
+                B::storeu(out + j, acc0);
+                B::storeu(out + j + W, acc1);
+                B::storeu(out + j + 2 * W, acc2);
+                B::storeu(out + j + 3 * W, acc3);
+            }
+            for (; j + W <= n; j += W) {
+                auto acc = B::set1(T(0));
+                for (std::int64_t k = k0; k < k1; ++k)
+                    acc = B::fma(B::set1(vs[k]), B::loadu(b + static_cast<std::int64_t>(cs[k]) * n + j), acc);
+                B::storeu(out + j, acc);
+            }
+            for (; j < n; ++j) {
+                T s = T(0);
+                for (std::int64_t k = k0; k < k1; ++k)
+                    s += vs[k] * b[static_cast<std::int64_t>(cs[k]) * n + j];
+                out[j] = s;
+            }
+        }
+    });
+}
+
+} // namespace bee::cpu
@@ -0,0 +1,21 @@
+#pragma once
+
+// 稀疏 CSR 矩阵的只读视图，供 Ops 层、运行期分派与 CPU 内核共享
+
+#include <cstdint>
+
+namespace bee::cpu
+{
+
+// crow={rows+1}，第 r 行非零元为 [crow[r], crow[r+1])；col 为行内升序列号，vals 与 col 同长（F32/F64）
+struct CsrView
+{
+    std::int64_t        rows = 0;
+    std::int64_t        cols = 0;
+    std::int64_t        nnz  = 0;
+    const std::int64_t* crow = nullptr;
+    const std::int32_t* col  = nullptr;
+    const void*         vals = nullptr;
+};
+
+} // namespace bee::cpu
@@ -1,10 +1,12 @@
 #pragma once
 
-// CPU 2D strided→contiguous 拷贝（即 transpose 物化）
-// - 按 TILE × TILE 分块，显著改善 L1 局部性
-// - F32 在 AVX2 下用 8×8 寄存器转置 + 块内 NT-store（当 bytes 足够大）
-// - 其他 elem_sz 走通用标量块拷贝
-// - 外层 tile-row 维度走 parallel_for
+// CPU N 维 strided→contiguous 拷贝（即 permute / transpose / 切片视图的物化）
+// - 先去掉长度 1 的维，并合并在源中同样行优先相邻的维，把问题降到最少维数
+// - 最内维源步长为 1：按连续段 memcpy
+// - 某个外层维源步长为 1：与最内维构成转置平面，按 TILE × TILE 分块改善 L1 局部性；
+//   4 字节元素在 AVX2 / AVX-512 下用 8×8 寄存器转置
+// - 其余（带步长切片、expand 等）：最内维按元素宽度 strided gather
+// - 外层批次 × 行块走 parallel_for
 
 #include "SIMD/SIMD.hpp"
 #include "Base/Parallel/ParallelFor.hpp"
@@ -13,6 +15,10 @@
 #include <cstring>
 #include <cstddef>
 #include <algorithm>
+#include <functional>
+#include <numeric>
+#include <type_traits>
+#include <vector>
 
 #if defined(BEE_SIMD_ENABLE_AVX2)
     #include <immintrin.h>
@@ -21,49 +27,9 @@
 namespace bee::cpu
 {
 
-inline constexpr std::int64_t kTrTile          = 32; // 字节通用分块
-inline constexpr std::int64_t kTrParallelRows  = 64; // 行数小于该阈值单线程
-inline constexpr std::int64_t kTrGrainTileRows = 2;  // 每任务多少 tile-row
-
-// ── 通用：按字节拷贝 tile（任意 elem_sz）────────────────────────────────────
-// src 按 (rows, cols) 逻辑，src[r,c] 的字节偏移 = r*src_row_bytes + c*src_col_bytes
-// dst 按连续行优先 [rows, cols] 写入
-inline void transpose_2d_generic(
-    const std::uint8_t* src_base,
-    std::int64_t        src_row_bytes, // src 中"行步进"字节（对应输出列方向步进）
-    std::int64_t        src_col_bytes, // src 中"列步进"字节（对应输出行方向步进）
-    std::uint8_t*       dst,
-    std::int64_t        rows, // 输出行数
-    std::int64_t        cols, // 输出列数
-    std::size_t         elem_sz
-)
-{
-    const std::int64_t dst_row_bytes = cols * static_cast<std::int64_t>(elem_sz);
-    const std::int64_t tile          = kTrTile;
-
-    auto run_tile_row = [&](std::int64_t r0, std::int64_t r1) {
-        for (std::int64_t c0 = 0; c0 < cols; c0 += tile) {
-            const std::int64_t c1 = std::min(c0 + tile, cols);
-            for (std::int64_t r = r0; r < r1; ++r) {
-                const std::uint8_t* src_row_ptr_base = src_base + r * src_row_bytes;
-                std::uint8_t*       dst_row_ptr      = dst + r * dst_row_bytes;
-                for (std::int64_t c = c0; c < c1; ++c) {
-                    std::memcpy(dst_row_ptr + c * static_cast<std::int64_t>(elem_sz), src_row_ptr_base + c * src_col_bytes, elem_sz);
-                }
-            }
-        }
-    };
-
-    if (rows < kTrParallelRows) {
-        run_tile_row(0, rows);
-        return;
-    }
-
-    const std::size_t row_grain = static_cast<std::size_t>(tile) * static_cast<std::size_t>(kTrGrainTileRows);
-    parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(rows), row_grain, [&](std::size_t lo, std::size_t hi) {
-        run_tile_row(static_cast<std::int64_t>(lo), static_cast<std::int64_t>(hi));
-    });
-}
+inline constexpr std::int64_t kTrTile       = 32;        // 转置平面分块边长（元素）
+inline constexpr std::int64_t kTrBlockRows  = 64;        // 转置平面每个任务的行数上限
+inline constexpr std::int64_t kTrGrainBytes = 64 * 1024; // 每个并行任务至少写出的字节数
 
 // ── F32 AVX2 特化：8×8 寄存器转置 ────────────────────────────────────────────
 #if defined(BEE_SIMD_ENABLE_AVX2)
@@ -116,94 +82,249 @@ inline void transpose_8x8_ps_avx2(const float* src, std::int64_t src_stride, flo
     _mm256_storeu_ps(dst + 7 * dst_stride, o7);
 }
 
-// 前提：src 在原张量中是 F32 contiguous（按原行主序），要输出的 dst 是 src 的转置。
-// 这里 src_row_elems 是原张量每行 F32 个数（= 输出的列数 cols），
-// src_col_elems = 1（F32 元素相邻）。
-// 该函数专门服务 2D transpose：输出 [rows, cols] 来自原 [cols, rows] contiguous。
-inline void transpose_2d_f32_avx2(
-    const float* src,      // 原连续矩阵（shape [cols, rows]）
-    std::int64_t src_lead, // src 每行 F32 个数 = rows_out 方向 = "rows"
-    float*       dst,      // 输出矩阵（shape [rows, cols] contiguous）
-    std::int64_t rows_out, // 输出行数
-    std::int64_t cols_out, // 输出列数
-    std::int64_t dst_lead
-) // dst 每行 F32 个数 = cols_out
+// 输出行 [r0, r1) 的转置拷贝：dst[r, c] = src[c * src_lead + r]，c ∈ [0, cols_out)
+// 整 8×8 块走寄存器转置，尾行 / 尾列标量
+inline void transpose_rows_f32_avx2(
+    const float* src, std::int64_t src_lead, float* dst, std::int64_t dst_lead, std::int64_t r0, std::int64_t r1, std::int64_t cols_out
+)
 {
-    constexpr std::int64_t T       = 8;
-    const std::int64_t     tiles_r = rows_out / T * T;
-    const std::int64_t     tiles_c = cols_out / T * T;
-
-    auto run_rows = [&](std::int64_t r0, std::int64_t r1) {
-        std::int64_t r = r0;
-        for (; r + T <= r1; r += T) {
-            std::int64_t c = 0;
-            for (; c + T <= cols_out; c += T) {
-                // src[c..c+8, r..r+8] → dst[r..r+8, c..c+8]
-                const float* sp = src + c * src_lead + r;
-                float*       dp = dst + r * dst_lead + c;
-                transpose_8x8_ps_avx2(sp, src_lead, dp, dst_lead);
+    constexpr std::int64_t T = 8;
+    std::int64_t           r = r0;
+    for (; r + T <= r1; r += T) {
+        std::int64_t c = 0;
+        for (; c + T <= cols_out; c += T) {
+            // src[c..c+8, r..r+8] → dst[r..r+8, c..c+8]
+            transpose_8x8_ps_avx2(src + c * src_lead + r, src_lead, dst + r * dst_lead + c, dst_lead);
+        }
+        // 尾列
+        for (; c < cols_out; ++c) {
+            for (std::int64_t rr = r; rr < r + T; ++rr) {
+                dst[rr * dst_lead + c] = src[c * src_lead + rr];
             }
-            // 尾列
-            for (; c < cols_out; ++c) {
-                for (std::int64_t rr = r; rr < r + T; ++rr) {
-                    dst[rr * dst_lead + c] = src[c * src_lead + rr];
-                }
+        }
+    }
+    // 尾行
+    for (; r < r1; ++r) {
+        for (std::int64_t c = 0; c < cols_out; ++c)
+            dst[r * dst_lead + c] = src[c * src_lead + r];
+    }
+}
+
+#endif // BEE_SIMD_ENABLE_AVX2
+
+// ── 通用转置平面：dst[r, c] = src[c * src_lead + r]，r ∈ [r0, r1)，c ∈ [0, cols) ──
+template <typename U>
+inline void transpose_rows_tiled(
+    const U* src, std::int64_t src_lead, U* dst, std::int64_t dst_lead, std::int64_t r0, std::int64_t r1, std::int64_t cols
+)
+{
+    for (std::int64_t rb = r0; rb < r1; rb += kTrTile) {
+        const std::int64_t re = std::min(rb + kTrTile, r1);
+        for (std::int64_t cb = 0; cb < cols; cb += kTrTile) {
+            const std::int64_t ce = std::min(cb + kTrTile, cols);
+            for (std::int64_t r = rb; r < re; ++r) {
+                U* d = dst + r * dst_lead;
+                for (std::int64_t c = cb; c < ce; ++c)
+                    d[c] = src[c * src_lead + r];
             }
         }
-        // 尾行
-        for (; r < r1; ++r) {
-            for (std::int64_t c = 0; c < cols_out; ++c)
-                dst[r * dst_lead + c] = src[c * src_lead + r];
+    }
+}
+
+// ── 维度合并 ────────────────────────────────────────────────────────────────
+// 去掉长度 1 的维；相邻两维满足 st[i] == st[i+1] · sh[i+1] 时合并为一维。
+// 合并后的维在输出（行优先连续）与源中都保持相同的遍历顺序。
+struct TrLayout
+{
+    std::vector<std::int64_t> shape;
+    std::vector<std::int64_t> stride; // 源步长（元素）
+};
+
+inline auto tr_coalesce(std::int64_t ndim, const std::int64_t* shape, const std::int64_t* strides) -> TrLayout
+{
+    TrLayout l;
+    for (std::int64_t i = 0; i < ndim; ++i) {
+        if (shape[i] == 1)
+            continue;
+        if (!l.shape.empty() && l.stride.back() == strides[i] * shape[i]) {
+            l.shape.back() *= shape[i];
+            l.stride.back() = strides[i];
+        } else {
+            l.shape.push_back(shape[i]);
+            l.stride.push_back(strides[i]);
         }
-    };
-    (void)tiles_r;
-    (void)tiles_c;
+    }
+    return l;
+}
 
-    if (rows_out < kTrParallelRows) {
-        run_rows(0, rows_out);
-        return;
+// 线性下标 linear（在 shape[0..n) 上按行优先展开）对应的步长加权偏移
+inline auto tr_offset_of(std::int64_t linear, const std::int64_t* shape, const std::int64_t* stride, std::size_t n) -> std::int64_t
+{
+    std::int64_t off = 0;
+    for (std::size_t i = n; i-- > 0;) {
+        off += (linear % shape[i]) * stride[i];
+        linear /= shape[i];
     }
-    const std::size_t grain = static_cast<std::size_t>(T * kTrGrainTileRows);
-    parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(rows_out), grain, [&](std::size_t lo, std::size_t hi) {
-        run_rows(static_cast<std::int64_t>(lo), static_cast<std::int64_t>(hi));
-    });
+    return off;
 }
 
-#endif // BEE_SIMD_ENABLE_AVX2
+// 依次访问外层下标 [lo, hi)：fn(i, src_off)。起点用一次除法定位，之后走进位计数器
+template <typename Fn>
+inline void tr_for_each_outer(const std::int64_t* shape, const std::int64_t* stride, std::size_t n, std::int64_t lo, std::int64_t hi, Fn&& fn)
+{
+    std::vector<std::int64_t> idx(n, 0);
+    std::int64_t              rem = lo;
+    std::int64_t              off = 0;
+    for (std::size_t i = n; i-- > 0;) {
+        idx[i] = rem % shape[i];
+        rem /= shape[i];
+        off += idx[i] * stride[i];
+    }
+    for (std::int64_t o = lo; o < hi; ++o) {
+        fn(o, off);
+        for (std::size_t i = n; i-- > 0;) {
+            off += stride[i];
+            if (++idx[i] < shape[i])
+                break;
+            off -= idx[i] * stride[i];
+            idx[i] = 0;
+        }
+    }
+}
 
-// ── 顶层分派：按 elem_sz 与 ISA 选择实现 ────────────────────────────────────
-// 接口：仅处理 2D 的 "strided-source → contiguous-dst" 拷贝；
-//   src_row_stride_elems / src_col_stride_elems 以"元素"为单位。
+// 按元素宽度选择等宽整数类型搬运（只搬位模式，不做数值转换）
+template <typename Fn>
+inline auto tr_visit_elem(std::size_t elem_sz, Fn&& fn) -> bool
+{
+    switch (elem_sz) {
+    case 1: fn(std::uint8_t{}); return true;
+    case 2: fn(std::uint16_t{}); return true;
+    case 4: fn(std::uint32_t{}); return true;
+    case 8: fn(std::uint64_t{}); return true;
+    default: return false;
+    }
+}
+
+template <typename ISA>
+inline constexpr bool kTrHasAvx2 = std::is_same_v<ISA, simd::IsaAvx2> || std::is_same_v<ISA, simd::IsaAvx512>;
+
+// ── 顶层分派 ────────────────────────────────────────────────────────────────
+// src 指向视图首元素（已加 offset），shape / strides 以元素为单位；dst 为行优先连续输出。
+// elem_sz 须为 1 / 2 / 4 / 8（全部 DType 都满足）。
 template <typename ISA>
-inline void cpu_transpose_2d_dispatch(
-    const void*  src,
-    void*        dst,
-    std::int64_t rows,
-    std::int64_t cols,
-    std::int64_t src_row_stride_elems, // 输出行 → src 偏移
-    std::int64_t src_col_stride_elems, // 输出列 → src 偏移
-    std::size_t  elem_sz
+inline void cpu_strided_copy_nd(
+    const void* src, void* dst, std::int64_t ndim, const std::int64_t* shape, const std::int64_t* strides, std::size_t elem_sz
 )
 {
-    if (rows <= 0 || cols <= 0)
+    for (std::int64_t i = 0; i < ndim; ++i) {
+        if (shape[i] == 0)
+            return;
+    }
+
+    const TrLayout     l  = tr_coalesce(ndim, shape, strides);
+    const std::size_t  k  = l.shape.size();
+    const auto*        sb = static_cast<const std::uint8_t*>(src);
+    auto*              db = static_cast<std::uint8_t*>(dst);
+    const std::int64_t es = static_cast<std::int64_t>(elem_sz);
+
+    if (k == 0) {
+        std::memcpy(db, sb, elem_sz);
         return;
+    }
 
-#if defined(BEE_SIMD_ENABLE_AVX2)
-    // F32 专用 fast-path：src_row_stride_elems == 1（输出行方向在 src 中单位步进）
-    // 意味着 src 是 [cols, rows] 连续、我们要转置到 [rows, cols]；
-    //   src[r, c] = src_base[c * src_col_stride_elems + r]
-    if constexpr (std::is_same_v<ISA, simd::IsaAvx2>) {
-        if (elem_sz == sizeof(float) && src_row_stride_elems == 1) {
-            transpose_2d_f32_avx2(static_cast<const float*>(src), src_col_stride_elems, static_cast<float*>(dst), rows, cols, cols);
-            return;
+    const std::int64_t q     = l.shape[k - 1];
+    const std::int64_t sq    = l.stride[k - 1];
+    const std::int64_t outer = std::accumulate(l.shape.begin(), l.shape.end() - 1, std::int64_t{1}, std::multiplies<>{});
+
+    // A：最内维在源中连续 → 每个外层下标一次 memcpy
+    if (sq == 1) {
+        const std::size_t run_bytes = static_cast<std::size_t>(q * es);
+        const std::size_t grain     = std::max<std::size_t>(1, static_cast<std::size_t>(kTrGrainBytes) / run_bytes);
+        const auto        copy_run  = [&](std::int64_t o, std::int64_t off) { std::memcpy(db + o * q * es, sb + off * es, run_bytes); };
+        parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(outer), grain, [&](std::size_t lo, std::size_t hi) {
+            tr_for_each_outer(l.shape.data(), l.stride.data(), k - 1, static_cast<std::int64_t>(lo), static_cast<std::int64_t>(hi), copy_run);
+        });
+        return;
+    }
+
+    // 输出（行优先连续）各维步长
+    std::vector<std::int64_t> dst_stride(k, 1);
+    for (std::size_t i = k - 1; i-- > 0;)
+        dst_stride[i] = dst_stride[i + 1] * l.shape[i + 1];
+
+    // B：取最内侧源步长为 1 的外层维 p，与最内维构成转置平面
+    std::size_t p = k;
+    for (std::size_t i = k - 1; i-- > 0;) {
+        if (l.stride[i] == 1) {
+            p = i;
+            break;
         }
     }
+
+    if (p < k) {
+        // 其余维作为平面批次
+        std::vector<std::int64_t> bsh, bss, bds;
+        for (std::size_t i = 0; i + 1 < k; ++i) {
+            if (i == p)
+                continue;
+            bsh.push_back(l.shape[i]);
+            bss.push_back(l.stride[i]);
+            bds.push_back(dst_stride[i]);
+        }
+        const std::int64_t rows     = l.shape[p];
+        const std::int64_t dst_lead = dst_stride[p];
+        const std::int64_t batches  = std::accumulate(bsh.begin(), bsh.end(), std::int64_t{1}, std::multiplies<>{});
+
+        // 任务 = 批次 × 行块 × 列块；行块取 8 的倍数（对齐寄存器转置），列块使一个任务约 kTrGrainBytes，
+        // 块内源数据在 L2 内被各 8 行组复用，避免对高长宽比平面反复整列扫描源
+        const std::int64_t rblk  = std::min(rows, kTrBlockRows);
+        const std::int64_t want  = std::max<std::int64_t>(kTrTile, kTrGrainBytes / (rblk * es));
+        const std::int64_t cblk  = std::min(q, (want + 7) / 8 * 8);
+        const std::int64_t nrblk = (rows + rblk - 1) / rblk;
+        const std::int64_t ncblk = (q + cblk - 1) / cblk;
+        const std::size_t  tasks = static_cast<std::size_t>(batches * nrblk * ncblk);
+
+        tr_visit_elem(elem_sz, [&]<typename U>(U) {
+            const auto* s = reinterpret_cast<const U*>(sb);
+            auto*       d = reinterpret_cast<U*>(db);
+            parallel::parallel_for(std::size_t{0}, tasks, std::size_t{1}, [&](std::size_t lo, std::size_t hi) {
+                for (auto t = static_cast<std::int64_t>(lo); t < static_cast<std::int64_t>(hi); ++t) {
+                    const std::int64_t b  = t / (nrblk * ncblk);
+                    const std::int64_t r0 = (t / ncblk % nrblk) * rblk;
+                    const std::int64_t r1 = std::min(r0 + rblk, rows);
+                    const std::int64_t c0 = (t % ncblk) * cblk;
+                    const std::int64_t nc = std::min(cblk, q - c0);
+                    const U*           sp = s + tr_offset_of(b, bsh.data(), bss.data(), bsh.size()) + c0 * sq;
+                    U*                 dp = d + tr_offset_of(b, bsh.data(), bds.data(), bsh.size()) + c0;
+#if defined(BEE_SIMD_ENABLE_AVX2)
+                    if constexpr (kTrHasAvx2<ISA> && sizeof(U) == sizeof(float)) {
+                        // 只搬位模式：按 float 装载 / 存储不改变任何位
+                        transpose_rows_f32_avx2(reinterpret_cast<const float*>(sp), sq, reinterpret_cast<float*>(dp), dst_lead, r0, r1, nc);
+                        continue;
+                    }
 #endif
+                    transpose_rows_tiled(sp, sq, dp, dst_lead, r0, r1, nc);
+                }
+            });
+        });
+        return;
+    }
 
-    // 通用 blocked-tile 拷贝
-    const std::int64_t src_row_bytes = src_row_stride_elems * static_cast<std::int64_t>(elem_sz);
-    const std::int64_t src_col_bytes = src_col_stride_elems * static_cast<std::int64_t>(elem_sz);
-    transpose_2d_generic(static_cast<const std::uint8_t*>(src), src_row_bytes, src_col_bytes, static_cast<std::uint8_t*>(dst), rows, cols, elem_sz);
+    // C：没有单位步长维 → 最内维 strided gather
+    const std::size_t grain = std::max<std::size_t>(1, static_cast<std::size_t>(kTrGrainBytes / (q * es)));
+    tr_visit_elem(elem_sz, [&]<typename U>(U) {
+        const auto* s = reinterpret_cast<const U*>(sb);
+        auto*       d = reinterpret_cast<U*>(db);
+        const auto  gather = [&](std::int64_t o, std::int64_t off) {
+            const U* sp = s + off;
+            U*       dp = d + o * q;
+            for (std::int64_t j = 0; j < q; ++j)
+                dp[j] = sp[j * sq];
+        };
+        parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(outer), grain, [&](std::size_t lo, std::size_t hi) {
+            tr_for_each_outer(l.shape.data(), l.stride.data(), k - 1, static_cast<std::int64_t>(lo), static_cast<std::int64_t>(hi), gather);
+        });
+    });
 }
 
 } // namespace bee::cpu
@@ -0,0 +1,94 @@
+#include "Tensor/Ops/Attention.hpp"
+#include "Tensor/Cpu/Dispatch/Dispatch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+
+namespace bee
+{
+
+auto attention(const Tensor& q, const Tensor& k, const Tensor& v, const Tensor& mask, const AttentionOptions& opt) -> Result<Tensor>
+{
+    if (!q.defined() || !k.defined() || !v.defined())
+        return std::unexpected(make_error("attention: 输入 Tensor 未定义", Severity::Recoverable));
+    if (q.device() != Device::CPU || k.device() != Device::CPU || v.device() != Device::CPU)
+        return std::unexpected(make_error("attention: 仅支持 CPU 张量", Severity::Recoverable));
+    if (q.dtype() != DType::F32 && q.dtype() != DType::F64)
+        return std::unexpected(make_error(std::format("attention: 不支持 DType::{}，仅允许 F32/F64", enum_to_name(q.dtype())), Severity::Recoverable));
+    if (k.dtype() != q.dtype() || v.dtype() != q.dtype())
+        return std::unexpected(make_error("attention: q / k / v 的 dtype 必须一致", Severity::Recoverable));
+
+    const int64_t nd = q.ndim();
+    if (nd < 2 || k.ndim() != nd || v.ndim() != nd)
+        return std::unexpected(make_error("attention: q / k / v 须为维数相同的 ≥2D 张量", Severity::Recoverable));
+
+    const auto& qs     = q.shape();
+    const auto& ks     = k.shape();
+    const auto& vs     = v.shape();
+    const auto  lead_n = static_cast<std::size_t>(nd - 2);
+    const Shape lead(qs.begin(), qs.begin() + static_cast<std::ptrdiff_t>(lead_n));
+    if (!std::equal(lead.begin(), lead.end(), ks.begin()) || !std::equal(lead.begin(), lead.end(), vs.begin()))
+        return std::unexpected(make_error("attention: q / k / v 的前导（batch / head）维必须相同", Severity::Recoverable));
+
+    cpu::AttentionGeom g;
+    g.BH     = numel(lead);
+    g.Lq     = qs[lead_n];
+    g.D      = qs[lead_n + 1];
+    g.Lk     = ks[lead_n];
+    g.Dv     = vs[lead_n + 1];
+    g.causal = opt.is_causal;
+    if (ks[lead_n + 1] != g.D)
+        return std::unexpected(make_error(std::format("attention: k 的最后一维 {} 与 q 的 {} 不一致", ks[lead_n + 1], g.D), Severity::Recoverable));
+    if (vs[lead_n] != g.Lk)
+        return std::unexpected(make_error(std::format("attention: v 的序列长度 {} 与 k 的 {} 不一致", vs[lead_n], g.Lk), Severity::Recoverable));
+    if (opt.scale < 0.0 || !std::isfinite(opt.scale))
+        return std::unexpected(make_error("attention: scale 须为有限非负数（0 表示 1 / sqrt(D)）", Severity::Recoverable));
+
+    Tensor cmask;
+    if (mask.defined()) {
+        if (mask.dtype() != DType::Bool || mask.device() != Device::CPU)
+            return std::unexpected(make_error("attention: mask 须为 CPU 上的 Bool 张量", Severity::Recoverable));
+        const Shape per_head = {g.Lq, g.Lk};
+        Shape       full     = lead;
+        full.insert(full.end(), per_head.begin(), per_head.end());
+        if (mask.shape() == per_head)
+            g.mask_stride = 0;
+        else if (mask.shape() == full)
+            g.mask_stride = g.Lq * g.Lk;
+        else
+            return std::unexpected(make_error(std::format("attention: mask 形状须为 {{{}, {}}} 或带相同前导维", g.Lq, g.Lk), Severity::Recoverable));
+        auto r = mask.contiguous();
+        if (!r)
+            return std::unexpected(std::move(r.error()));
+        cmask = *r;
+    }
+
+    auto cq = q.contiguous();
+    if (!cq)
+        return std::unexpected(std::move(cq.error()));
+    auto ck = k.contiguous();
+    if (!ck)
+        return std::unexpected(std::move(ck.error()));
+    auto cv = v.contiguous();
+    if (!cv)
+        return std::unexpected(std::move(cv.error()));
+
+    Shape out_shape = lead;
+    out_shape.push_back(g.Lq);
+    out_shape.push_back(g.Dv);
+    auto out = Tensor::empty(out_shape, q.dtype());
+    if (!out)
+        return std::unexpected(std::move(out.error()));
+    if (out->numel() == 0)
+        return *out;
+
+    const double scale = opt.scale != 0.0 ? opt.scale : (g.D > 0 ? 1.0 / std::sqrt(static_cast<double>(g.D)) : 1.0);
+    const bool*  m     = cmask.defined() ? static_cast<const bool*>(cmask.const_data_ptr()) : nullptr;
+    BEE_RT_DISPATCH_STMT(
+        at_attention, q.dtype(), g, cq->const_data_ptr(), ck->const_data_ptr(), cv->const_data_ptr(), m, scale, out->scoped_data_ptr()
+    );
+    return *out;
+}
+
+} // namespace bee
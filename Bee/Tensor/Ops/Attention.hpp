@@ -0,0 +1,28 @@
+#pragma once
+
+// 融合 scaled-dot-product attention：out = softmax(scale · q·kᵀ [+ mask]) · v
+// CPU 路径按 FlashAttention 方式分块并做 online softmax，不物化 {Lq, Lk} 分数矩阵；
+// 并行网格为 batch·heads × query 块，块乘积复用 GEMM 微内核。
+//
+// dtype 支持：F32/F64（其余 → Err）；当前仅 CPU。
+
+#include "Base/Diagnostics/Error.hpp"
+#include "Tensor/Core/Tensor.hpp"
+
+namespace bee
+{
+
+struct AttentionOptions
+{
+    double scale     = 0.0;   // 0 表示 1 / sqrt(D)
+    bool   is_causal = false; // 仅允许 key 下标 j ≤ query 下标 i（左上对齐）
+};
+
+// q={..., Lq, D}，k={..., Lk, D}，v={..., Lk, Dv} → 输出 {..., Lq, Dv}
+// - 三者前导维必须完全相同（不广播），至少 2 维；
+// - mask 为可选的 Bool 张量，true 表示参与注意力，形状为 {Lq, Lk}（所有头共享）或 {..., Lq, Lk}；
+// - 某一行全部被屏蔽时该行输出为 0。
+[[nodiscard]] auto attention(const Tensor& q, const Tensor& k, const Tensor& v, const Tensor& mask = {}, const AttentionOptions& opt = {})
+    -> Result<Tensor>;
+
+} // namespace bee
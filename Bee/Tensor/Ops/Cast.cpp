@@ -37,7 +37,11 @@ auto cast(const Tensor& src, DType dst_dtype) -> Result<Tensor>
 
     if (cont.device() == Device::CUDA) {
         auto r = tensor::cuda::ew_cast(
-            static_cast<int>(cont.dtype()), cont.data_ptr(), static_cast<int>(dst_dtype), out.data_ptr(), static_cast<std::size_t>(cont.numel())
+            static_cast<int>(cont.dtype()),
+            cont.const_data_ptr(),
+            static_cast<int>(dst_dtype),
+            out.scoped_data_ptr(),
+            static_cast<std::size_t>(cont.numel())
         );
         if (!r)
             return std::unexpected(std::move(r.error()));
@@ -45,7 +49,7 @@ auto cast(const Tensor& src, DType dst_dtype) -> Result<Tensor>
     }
 
     // CPU 路径：通过运行期 ISA 分派进入 B11 的 SIMD + parallel_for cast 内核。
-    BEE_RT_DISPATCH_STMT(ct_cast, cont.dtype(), dst_dtype, cont.data_ptr(), out.data_ptr(), cont.numel());
+    BEE_RT_DISPATCH_STMT(ct_cast, cont.dtype(), dst_dtype, cont.const_data_ptr(), out.scoped_data_ptr(), cont.numel());
 
     return out;
 }
@@ -0,0 +1,231 @@
+#include "Tensor/Ops/Concat.hpp"
+#include "Tensor/Cpu/ConcatPlan.hpp"
+#include "Tensor/Cpu/Dispatch/Dispatch.hpp"
+
+#include <algorithm>
+#include <format>
+#include <string_view>
+
+namespace bee
+{
+
+namespace
+{
+
+    auto check_inputs(std::span<const Tensor> ts, std::string_view op) -> Result<void>
+    {
+        if (ts.empty())
+            return std::unexpected(make_error(std::format("{}: 输入列表为空", op), Severity::Recoverable));
+        for (std::size_t i = 0; i < ts.size(); ++i) {
+            if (!ts[i].defined())
+                return std::unexpected(make_error(std::format("{}: 第 {} 个输入 Tensor 未定义", op, i), Severity::Recoverable));
+            if (ts[i].device() != Device::CPU)
+                return std::unexpected(make_error(std::format("{}: 仅支持 CPU 张量", op), Severity::Recoverable));
+            if (ts[i].dtype() != ts[0].dtype())
+                return std::unexpected(make_error(
+                    std::format("{}: 第 {} 个输入的 DType::{} 与 DType::{} 不一致", op, i, enum_to_name(ts[i].dtype()), enum_to_name(ts[0].dtype())),
+                    Severity::Recoverable
+                ));
+        }
+        return {};
+    }
+
+    // 输入已校验、dim 已归一化：按计划拷贝
+    auto cat_impl(std::span<const Tensor> ts, int dim, std::string_view op) -> Result<Tensor>
+    {
+        const auto& ref = ts[0].shape();
+        const auto  d   = static_cast<std::size_t>(dim);
+
+        Shape out_shape = ref;
+        out_shape[d]    = 0;
+        for (std::size_t i = 0; i < ts.size(); ++i) {
+            const auto& sh = ts[i].shape();
+            bool        ok = sh.size() == ref.size();
+            for (std::size_t j = 0; ok && j < sh.size(); ++j)
+                ok = j == d || sh[j] == ref[j];
+            if (!ok)
+                return std::unexpected(make_error(std::format("{}: 第 {} 个输入的形状除第 {} 维外须与第 0 个一致", op, i, dim), Severity::Recoverable));
+            out_shape[d] += sh[d];
+        }
+
+        auto out = Tensor::empty(out_shape, ts[0].dtype());
+        if (!out)
+            return std::unexpected(std::move(out.error()));
+        if (out->numel() == 0)
+            return *out;
+
+        const auto es    = static_cast<int64_t>(dtype_size(ts[0].dtype()));
+        int64_t    outer = 1;
+        int64_t    inner = es;
+        for (std::size_t j = 0; j < d; ++j)
+            outer *= ref[j];
+        for (std::size_t j = d + 1; j < ref.size(); ++j)
+            inner *= ref[j];
+        const int64_t row_bytes = out_shape[d] * inner;
+        auto*         dst       = static_cast<uint8_t*>(out->scoped_data_ptr());
+
+        // 连续输入进计划；非连续输入在 outer == 1 时（输出中对应区间连续）直接 strided 拷贝到位，
+        // 否则先物化为连续临时张量再进计划
+        std::vector<cpu::CatSegment> segs;
+        std::vector<Tensor>          temps;
+        segs.reserve(ts.size());
+        int64_t off = 0;
+        for (const auto& t : ts) {
+            const int64_t bytes = t.shape()[d] * inner;
+            if (bytes == 0)
+                continue;
+            const void* src = t.const_data_ptr();
+            if (!t.is_contiguous()) {
+                if (outer == 1) {
+                    const auto nd = static_cast<int64_t>(t.ndim());
+                    BEE_RT_DISPATCH_STMT(tr_copy_nd, src, dst + off, nd, t.shape().data(), t.strides().data(), static_cast<std::size_t>(es));
+                    off += bytes;
+                    continue;
+                }
+                auto c = t.contiguous();
+                if (!c)
+                    return std::unexpected(std::move(c.error()));
+                src = c->const_data_ptr();
+                temps.push_back(std::move(*c));
+            }
+            segs.push_back({src, bytes, off});
+            off += bytes;
+        }
+
+        BEE_RT_DISPATCH_STMT(cc_cat, segs.data(), static_cast<int64_t>(segs.size()), outer, row_bytes, dst);
+        return *out;
+    }
+
+    auto split_impl(const Tensor& a, std::span<const int64_t> sizes, int dim) -> Result<std::vector<Tensor>>
+    {
+        std::vector<Tensor> parts;
+        parts.reserve(sizes.size());
+        int64_t start = 0;
+        for (const int64_t n : sizes) {
+            auto v = a.slice(dim, start, start + n);
+            if (!v)
+                return std::unexpected(std::move(v.error()));
+            parts.push_back(std::move(*v));
+            start += n;
+        }
+        return parts;
+    }
+
+    // 归一化 dim 到 [0, ndim)；失败返回 -1
+    auto wrap_dim(int dim, int64_t nd) -> int
+    {
+        const auto n = static_cast<int>(nd);
+        if (dim < -n || dim >= n)
+            return -1;
+        return dim < 0 ? dim + n : dim;
+    }
+
+    auto split_prologue(const Tensor& a, int& dim, std::string_view op) -> Result<void>
+    {
+        if (!a.defined())
+            return std::unexpected(make_error(std::format("{}: 输入 Tensor 未定义", op), Severity::Recoverable));
+        const int w = wrap_dim(dim, a.ndim());
+        if (w < 0)
+            return std::unexpected(make_error(std::format("{}: 维度索引 {} 越界（ndim={}）", op, dim, a.ndim()), Severity::Recoverable));
+        dim = w;
+        return {};
+    }
+
+} // namespace
+
+auto cat(std::span<const Tensor> tensors, int dim) -> Result<Tensor>
+{
+    if (auto r = check_inputs(tensors, "cat"); !r)
+        return std::unexpected(std::move(r.error()));
+    const int64_t nd = tensors[0].ndim();
+    if (nd == 0)
+        return std::unexpected(make_error("cat: 0 维张量无法拼接，请改用 stack", Severity::Recoverable));
+    const int w = wrap_dim(dim, nd);
+    if (w < 0)
+        return std::unexpected(make_error(std::format("cat: 维度索引 {} 越界（ndim={}）", dim, nd), Severity::Recoverable));
+    return cat_impl(tensors, w, "cat");
+}
+
+auto cat(std::initializer_list<Tensor> tensors, int dim) -> Result<Tensor>
+{
+    return cat(std::span<const Tensor>(tensors.begin(), tensors.size()), dim);
+}
+
+auto stack(std::span<const Tensor> tensors, int dim) -> Result<Tensor>
+{
+    if (auto r = check_inputs(tensors, "stack"); !r)
+        return std::unexpected(std::move(r.error()));
+    const int64_t nd = tensors[0].ndim();
+    const int     w  = wrap_dim(dim, nd + 1);
+    if (w < 0)
+        return std::unexpected(make_error(std::format("stack: 维度索引 {} 越界（有效范围 [{}, {}]）", dim, -(nd + 1), nd), Severity::Recoverable));
+
+    // 各输入在 dim 处插入长度 1 的维（零拷贝视图）后沿该维拼接
+    std::vector<Tensor> views;
+    views.reserve(tensors.size());
+    for (std::size_t i = 0; i < tensors.size(); ++i) {
+        if (tensors[i].shape() != tensors[0].shape())
+            return std::unexpected(make_error(std::format("stack: 第 {} 个输入的形状与第 0 个不一致", i), Severity::Recoverable));
+        auto v = tensors[i].unsqueeze(w);
+        if (!v)
+            return std::unexpected(std::move(v.error()));
+        views.push_back(std::move(*v));
+    }
+    return cat_impl(views, w, "stack");
+}
+
+auto stack(std::initializer_list<Tensor> tensors, int dim) -> Result<Tensor>
+{
+    return stack(std::span<const Tensor>(tensors.begin(), tensors.size()), dim);
+}
+
+auto split(const Tensor& a, int64_t split_size, int dim) -> Result<std::vector<Tensor>>
+{
+    if (auto r = split_prologue(a, dim, "split"); !r)
+        return std::unexpected(std::move(r.error()));
+    if (split_size < 1)
+        return std::unexpected(make_error(std::format("split: split_size={} 非法，必须 >= 1", split_size), Severity::Recoverable));
+
+    const int64_t        n = a.shape()[static_cast<std::size_t>(dim)];
+    std::vector<int64_t> sizes;
+    for (int64_t s = 0; s < n; s += split_size)
+        sizes.push_back(std::min(split_size, n - s));
+    if (sizes.empty())
+        sizes.push_back(0); // 长度为 0 的维：返回一个空视图
+    return split_impl(a, sizes, dim);
+}
+
+auto split(const Tensor& a, std::span<const int64_t> sizes, int dim) -> Result<std::vector<Tensor>>
+{
+    if (auto r = split_prologue(a, dim, "split"); !r)
+        return std::unexpected(std::move(r.error()));
+
+    const int64_t n     = a.shape()[static_cast<std::size_t>(dim)];
+    int64_t       total = 0;
+    for (const int64_t s : sizes) {
+        if (s < 0)
+            return std::unexpected(make_error(std::format("split: 段长 {} 非法，必须 >= 0", s), Severity::Recoverable));
+        total += s;
+    }
+    if (total != n)
+        return std::unexpected(make_error(std::format("split: 段长之和 {} 与第 {} 维长度 {} 不一致", total, dim, n), Severity::Recoverable));
+    return split_impl(a, sizes, dim);
+}
+
+auto split(const Tensor& a, std::initializer_list<int64_t> sizes, int dim) -> Result<std::vector<Tensor>>
+{
+    return split(a, std::span<const int64_t>(sizes.begin(), sizes.size()), dim);
+}
+
+auto chunk(const Tensor& a, int64_t chunks, int dim) -> Result<std::vector<Tensor>>
+{
+    if (auto r = split_prologue(a, dim, "chunk"); !r)
+        return std::unexpected(std::move(r.error()));
+    if (chunks < 1)
+        return std::unexpected(make_error(std::format("chunk: chunks={} 非法，必须 >= 1", chunks), Severity::Recoverable));
+
+    const int64_t n = a.shape()[static_cast<std::size_t>(dim)];
+    return split(a, std::max<int64_t>(1, (n + chunks - 1) / chunks), dim);
+}
+
+} // namespace bee
@@ -0,0 +1,39 @@
+#pragma once
+
+// 拼接与切分：
+//   cat           ：沿已有维 dim 拼接，除 dim 外各输入形状须一致，输出为新的连续张量
+//   stack         ：沿新插入的维 dim 堆叠，各输入形状须完全一致
+//   split / chunk ：沿 dim 切成若干段，返回共享 storage 的视图（零拷贝）
+//
+// cat / stack 把拷贝规划为各输入在输出每行中的一段连续字节，按输出字节均分后并行执行，
+// 大输出改用 NT-store；非连续输入经 N 维 strided 拷贝路径物化。
+// dtype 不限（按位拷贝，但各输入须一致）；当前仅 CPU。
+
+#include "Base/Diagnostics/Error.hpp"
+#include "Tensor/Core/Tensor.hpp"
+
+#include <initializer_list>
+#include <span>
+#include <vector>
+
+namespace bee
+{
+
+[[nodiscard]] auto cat(std::span<const Tensor> tensors, int dim = 0) -> Result<Tensor>;
+[[nodiscard]] auto cat(std::initializer_list<Tensor> tensors, int dim = 0) -> Result<Tensor>;
+
+// dim 范围 [-ndim-1, ndim]
+[[nodiscard]] auto stack(std::span<const Tensor> tensors, int dim = 0) -> Result<Tensor>;
+[[nodiscard]] auto stack(std::initializer_list<Tensor> tensors, int dim = 0) -> Result<Tensor>;
+
+// 每段长 split_size（≥ 1），末段可更短
+[[nodiscard]] auto split(const Tensor& a, int64_t split_size, int dim = 0) -> Result<std::vector<Tensor>>;
+
+// 各段长度由 sizes 给出（允许 0），总和须等于 dim 维长度
+[[nodiscard]] auto split(const Tensor& a, std::span<const int64_t> sizes, int dim = 0) -> Result<std::vector<Tensor>>;
+[[nodiscard]] auto split(const Tensor& a, std::initializer_list<int64_t> sizes, int dim = 0) -> Result<std::vector<Tensor>>;
+
+// 切成至多 chunks 段，每段长 ceil(size / chunks)；与 PyTorch 一致，实际段数可能少于 chunks
+[[nodiscard]] auto chunk(const Tensor& a, int64_t chunks, int dim = 0) -> Result<std::vector<Tensor>>;
+
+} // namespace bee
@@ -0,0 +1,187 @@
+#include "Tensor/Ops/Conv.hpp"
+#include "Tensor/Cpu/Dispatch/Dispatch.hpp"
+
+#include <format>
+#include <string_view>
+
+namespace bee
+{
+
+namespace
+{
+
+    // 输出尺寸；窗口大于填充后的输入时返回 -1
+    auto out_size(int64_t in, int64_t k, int64_t stride, int64_t pad, int64_t dilation) -> int64_t
+    {
+        const int64_t span = in + 2 * pad - dilation * (k - 1) - 1;
+        return span < 0 ? -1 : span / stride + 1;
+    }
+
+    // 公共输入校验：定义、CPU、F32/F64、3D 或 4D；返回 4D 视图（3D 前置 batch 维 1）
+    auto prepare_nchw(const Tensor& x, std::string_view op) -> Result<Tensor>
+    {
+        if (!x.defined())
+            return std::unexpected(make_error(std::format("{}: 输入 Tensor 未定义", op), Severity::Recoverable));
+        if (x.device() != Device::CPU)
+            return std::unexpected(make_error(std::format("{}: 仅支持 CPU 张量", op), Severity::Recoverable));
+        if (x.dtype() != DType::F32 && x.dtype() != DType::F64)
+            return std::unexpected(make_error(std::format("{}: 不支持 DType::{}，仅允许 F32/F64", op, enum_to_name(x.dtype())), Severity::Recoverable));
+        if (x.ndim() != 3 && x.ndim() != 4)
+            return std::unexpected(make_error(std::format("{}: 输入须为 {{N, C, H, W}} 或 {{C, H, W}}，当前 ndim={}", op, x.ndim()), Severity::Recoverable));
+
+        auto c = x.contiguous();
+        if (!c)
+            return std::unexpected(std::move(c.error()));
+        if (x.ndim() == 4)
+            return *c;
+        const auto& sh = x.shape();
+        return c->reshape({1, sh[0], sh[1], sh[2]});
+    }
+
+    auto check_spatial(std::string_view op, std::string_view name, const std::array<int64_t, 2>& v, int64_t min) -> Result<void>
+    {
+        if (v[0] < min || v[1] < min)
+            return std::unexpected(make_error(std::format("{}: {} 须不小于 {}，当前 {{{}, {}}}", op, name, min, v[0], v[1]), Severity::Recoverable));
+        return {};
+    }
+
+    // 去掉 3D 输入时补上的 batch 维
+    auto finish_output(const Tensor& x, Tensor out) -> Result<Tensor>
+    {
+        if (x.ndim() == 4)
+            return out;
+        const auto& sh = out.shape();
+        return out.reshape({sh[1], sh[2], sh[3]});
+    }
+
+    auto pool2d_impl(const Tensor& x, const Pool2dOptions& opt, bool is_max) -> Result<Tensor>
+    {
+        const std::string_view op = is_max ? "max_pool2d" : "avg_pool2d";
+
+        auto in = prepare_nchw(x, op);
+        if (!in)
+            return std::unexpected(std::move(in.error()));
+
+        const std::array<int64_t, 2> stride = {
+            opt.stride[0] == 0 ? opt.kernel[0] : opt.stride[0],
+            opt.stride[1] == 0 ? opt.kernel[1] : opt.stride[1],
+        };
+        for (auto r : {check_spatial(op, "kernel", opt.kernel, 1),
+                       check_spatial(op, "stride", stride, 1),
+                       check_spatial(op, "padding", opt.padding, 0),
+                       check_spatial(op, "dilation", opt.dilation, 1)}) {
+            if (!r)
+                return std::unexpected(std::move(r.error()));
+        }
+        if (opt.padding[0] > opt.kernel[0] / 2 || opt.padding[1] > opt.kernel[1] / 2)
+            return std::unexpected(make_error(std::format("{}: padding 不能超过 kernel 的一半", op), Severity::Recoverable));
+        if (!is_max && (opt.dilation[0] != 1 || opt.dilation[1] != 1))
+            return std::unexpected(make_error("avg_pool2d: 不支持 dilation", Severity::Recoverable));
+
+        const auto& sh = in->shape();
+        cpu::Pool2dGeom g;
+        g.planes = sh[0] * sh[1];
+        g.H      = sh[2];
+        g.W      = sh[3];
+        g.KH     = opt.kernel[0];
+        g.KW     = opt.kernel[1];
+        g.SH     = stride[0];
+        g.SW     = stride[1];
+        g.PH     = opt.padding[0];
+        g.PW     = opt.padding[1];
+        g.DH     = opt.dilation[0];
+        g.DW     = opt.dilation[1];
+        g.OH     = out_size(g.H, g.KH, g.SH, g.PH, g.DH);
+        g.OW     = out_size(g.W, g.KW, g.SW, g.PW, g.DW);
+        if (g.OH <= 0 || g.OW <= 0)
+            return std::unexpected(make_error(std::format("{}: 窗口大于填充后的输入（{}×{}）", op, g.H, g.W), Severity::Recoverable));
+
+        auto out = Tensor::empty({sh[0], sh[1], g.OH, g.OW}, in->dtype());
+        if (!out)
+            return std::unexpected(std::move(out.error()));
+        if (out->numel() > 0)
+            BEE_RT_DISPATCH_STMT(pl_pool2d, in->dtype(), g, is_max, opt.count_include_pad, in->const_data_ptr(), out->scoped_data_ptr());
+        return finish_output(x, *out);
+    }
+
+} // namespace
+
+auto conv2d(const Tensor& x, const Tensor& weight, const Tensor& bias, const Conv2dOptions& opt) -> Result<Tensor>
+{
+    auto in = prepare_nchw(x, "conv2d");
+    if (!in)
+        return std::unexpected(std::move(in.error()));
+    if (!weight.defined() || weight.ndim() != 4)
+        return std::unexpected(make_error("conv2d: weight 须为 {Cout, C / groups, KH, KW} 的 4D 张量", Severity::Recoverable));
+    if (weight.dtype() != x.dtype() || weight.device() != x.device())
+        return std::unexpected(make_error("conv2d: weight 的 dtype/device 与输入不一致", Severity::Recoverable));
+    for (auto r : {check_spatial("conv2d", "stride", opt.stride, 1),
+                   check_spatial("conv2d", "padding", opt.padding, 0),
+                   check_spatial("conv2d", "dilation", opt.dilation, 1)}) {
+        if (!r)
+            return std::unexpected(std::move(r.error()));
+    }
+
+    const auto& sh = in->shape();
+    const auto& ws = weight.shape();
+    cpu::Conv2dGeom g;
+    g.C      = sh[1];
+    g.H      = sh[2];
+    g.W      = sh[3];
+    g.Cout   = ws[0];
+    g.KH     = ws[2];
+    g.KW     = ws[3];
+    g.SH     = opt.stride[0];
+    g.SW     = opt.stride[1];
+    g.PH     = opt.padding[0];
+    g.PW     = opt.padding[1];
+    g.DH     = opt.dilation[0];
+    g.DW     = opt.dilation[1];
+    g.groups = opt.groups;
+    if (g.groups < 1 || g.C % g.groups != 0 || g.Cout % g.groups != 0)
+        return std::unexpected(
+            make_error(std::format("conv2d: groups={} 须整除输入通道 {} 与输出通道 {}", g.groups, g.C, g.Cout), Severity::Recoverable)
+        );
+    if (ws[1] != g.cin_g())
+        return std::unexpected(make_error(std::format("conv2d: weight 第 1 维应为 C / groups = {}，当前 {}", g.cin_g(), ws[1]), Severity::Recoverable));
+    if (g.KH < 1 || g.KW < 1)
+        return std::unexpected(make_error("conv2d: 卷积核尺寸须为正", Severity::Recoverable));
+    g.OH = out_size(g.H, g.KH, g.SH, g.PH, g.DH);
+    g.OW = out_size(g.W, g.KW, g.SW, g.PW, g.DW);
+    if (g.OH <= 0 || g.OW <= 0)
+        return std::unexpected(make_error(std::format("conv2d: 卷积核大于填充后的输入（{}×{}）", g.H, g.W), Severity::Recoverable));
+
+    Tensor cbias;
+    if (bias.defined()) {
+        if (bias.dtype() != x.dtype() || bias.device() != x.device() || bias.ndim() != 1 || bias.shape()[0] != g.Cout)
+            return std::unexpected(make_error(std::format("conv2d: bias 须为 dtype 一致的 {{{}}} 张量", g.Cout), Severity::Recoverable));
+        auto r = bias.contiguous();
+        if (!r)
+            return std::unexpected(std::move(r.error()));
+        cbias = *r;
+    }
+    auto w = weight.contiguous();
+    if (!w)
+        return std::unexpected(std::move(w.error()));
+
+    auto out = Tensor::empty({sh[0], g.Cout, g.OH, g.OW}, in->dtype());
+    if (!out)
+        return std::unexpected(std::move(out.error()));
+    if (out->numel() > 0) {
+        const void* b = cbias.defined() ? cbias.const_data_ptr() : nullptr;
+        BEE_RT_DISPATCH_STMT(cv_conv2d, in->dtype(), g, sh[0], in->const_data_ptr(), w->const_data_ptr(), b, out->scoped_data_ptr());
+    }
+    return finish_output(x, *out);
+}
+
+auto max_pool2d(const Tensor& x, const Pool2dOptions& opt) -> Result<Tensor>
+{
+    return pool2d_impl(x, opt, true);
+}
+
+auto avg_pool2d(const Tensor& x, const Pool2dOptions& opt) -> Result<Tensor>
+{
+    return pool2d_impl(x, opt, false);
+}
+
+} // namespace bee
@@ -0,0 +1,45 @@
+#pragma once
+
+// 2D 卷积与池化自由函数声明（NCHW）
+//   - 输入为 {N, C, H, W}，或不带 batch 维的 {C, H, W}（输出同样不带 batch 维）；
+//   - 空间参数均按 {H, W} 给出，输出尺寸 O = (I + 2·pad - dilation·(k - 1) - 1) / stride + 1；
+//   - conv2d 以 implicit im2col 喂给 GEMM（不物化 im2col 矩阵），池化为可分的 SIMD 窗口合并。
+//
+// dtype 支持：F32/F64（其余 → Err）；当前仅 CPU。
+
+#include "Base/Diagnostics/Error.hpp"
+#include "Tensor/Core/Tensor.hpp"
+
+#include <array>
+
+namespace bee
+{
+
+struct Conv2dOptions
+{
+    std::array<int64_t, 2> stride   = {1, 1};
+    std::array<int64_t, 2> padding  = {0, 0};
+    std::array<int64_t, 2> dilation = {1, 1};
+    int64_t                groups   = 1;
+};
+
+// y = conv(x, weight) + bias：weight={Cout, C / groups, KH, KW}，bias 为 {Cout}（未定义表示无）
+// C 与 Cout 均须被 groups 整除
+[[nodiscard]] auto conv2d(const Tensor& x, const Tensor& weight, const Tensor& bias = {}, const Conv2dOptions& opt = {}) -> Result<Tensor>;
+
+struct Pool2dOptions
+{
+    std::array<int64_t, 2> kernel            = {1, 1};
+    std::array<int64_t, 2> stride            = {0, 0}; // 0 表示与 kernel 相同
+    std::array<int64_t, 2> padding           = {0, 0}; // 不超过 kernel / 2
+    std::array<int64_t, 2> dilation          = {1, 1}; // 仅 max_pool2d
+    bool                   count_include_pad = true;   // 仅 avg_pool2d：padding 位置是否计入除数
+};
+
+// 窗口最大值；padding 位置不参与比较
+[[nodiscard]] auto max_pool2d(const Tensor& x, const Pool2dOptions& opt) -> Result<Tensor>;
+
+// 窗口均值
+[[nodiscard]] auto avg_pool2d(const Tensor& x, const Pool2dOptions& opt) -> Result<Tensor>;
+
+} // namespace bee
@@ -59,10 +59,10 @@ namespace
 
     auto check_dtype_float(DType dt, std::string_view op) -> Result<void>
     {
-        if (dt != DType::F32 && dt != DType::F64)
-            return std::unexpected(
-                make_error(std::format("{} 仅支持 DType::F32 / DType::F64，当前 dtype 为 {}", op, enum_to_name(dt)), Severity::Recoverable)
-            );
+        if (dt != DType::F32 && dt != DType::F64 && !dtype_is_half_float(dt))
+            return std::unexpected(make_error(
+                std::format("{} 仅支持 DType::F32 / DType::F64 / DType::F16 / DType::BF16，当前 dtype 为 {}", op, enum_to_name(dt)), Severity::Recoverable
+            ));
         return {};
     }
 
@@ -112,7 +112,12 @@ namespace
         if (!a.is_contiguous() || !b.is_contiguous() || !out.is_contiguous())
             return std::unexpected(make_error(std::format("{}: CUDA 后端要求所有张量均 contiguous", op_name), Severity::Recoverable));
         return tensor::cuda::ew_binary(
-            static_cast<int>(op), static_cast<int>(a.dtype()), a.data_ptr(), b.data_ptr(), out.data_ptr(), static_cast<std::size_t>(a.numel())
+            static_cast<int>(op),
+            static_cast<int>(a.dtype()),
+            a.const_data_ptr(),
+            b.const_data_ptr(),
+            out.scoped_data_ptr(),
+            static_cast<std::size_t>(a.numel())
         );
     }
 
@@ -121,7 +126,7 @@ namespace
         if (!a.is_contiguous() || !out.is_contiguous())
             return std::unexpected(make_error(std::format("{}: CUDA 后端要求所有张量均 contiguous", op_name), Severity::Recoverable));
         return tensor::cuda::ew_unary(
-            static_cast<int>(op), static_cast<int>(a.dtype()), a.data_ptr(), out.data_ptr(), static_cast<std::size_t>(a.numel())
+            static_cast<int>(op), static_cast<int>(a.dtype()), a.const_data_ptr(), out.scoped_data_ptr(), static_cast<std::size_t>(a.numel())
         );
     }
 
@@ -198,6 +203,9 @@ namespace
             return run_binary_cuda(Op, dst, src, dst, op_name);
         }
 
+        // dst 若是写时复制 clone，先物化私有副本；src 与 dst 同源时仍读旧块，结果不受影响
+        if (auto r = dst.materialize(); !r)
+            return r;
         dispatch_binary_cpu(Op, dst, src, dst);
         return {};
     }
@@ -318,6 +326,8 @@ namespace
     {
         if (dst.device() == Device::CUDA)
             return run_unary_cuda(op, dst, dst, op_name);
+        if (auto r = dst.materialize(); !r)
+            return r;
         dispatch_unary_cpu(op, dst, dst);
         return {};
     }
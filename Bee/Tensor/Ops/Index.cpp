@@ -0,0 +1,297 @@
+#include "Tensor/Ops/Index.hpp"
+#include "Tensor/Ops/Cast.hpp"
+#include "Tensor/Cpu/IndexGeom.hpp"
+#include "Tensor/Cpu/Dispatch/Dispatch.hpp"
+
+#include <format>
+#include <string_view>
+
+namespace bee
+{
+
+namespace
+{
+
+    auto check_input(const Tensor& t, std::string_view op, std::string_view what) -> Result<void>
+    {
+        if (!t.defined())
+            return std::unexpected(make_error(std::format("{}: {} 未定义", op, what), Severity::Recoverable));
+        if (t.device() != Device::CPU)
+            return std::unexpected(make_error(std::format("{}: 仅支持 CPU 张量", op), Severity::Recoverable));
+        return {};
+    }
+
+    // 索引张量转为连续 I64，并校验每个值落在 [0, bound)
+    auto prepare_index(const Tensor& index, int64_t bound, std::string_view op, std::string_view what) -> Result<Tensor>
+    {
+        if (auto r = check_input(index, op, what); !r)
+            return std::unexpected(std::move(r.error()));
+        if (index.dtype() != DType::I64 && index.dtype() != DType::I32)
+            return std::unexpected(
+                make_error(std::format("{}: {} 的 DType::{} 非法，仅允许 I64/I32", op, what, enum_to_name(index.dtype())), Severity::Recoverable)
+            );
+
+        auto c = index.dtype() == DType::I64 ? index.contiguous() : cast(index, DType::I64);
+        if (!c)
+            return std::unexpected(std::move(c.error()));
+        const auto*   p = static_cast<const int64_t*>(c->const_data_ptr());
+        const int64_t n = c->numel();
+        for (int64_t k = 0; k < n; ++k) {
+            if (p[k] < 0 || p[k] >= bound)
+                return std::unexpected(
+                    make_error(std::format("{}: {} 的第 {} 个值 {} 越界（有效范围 [0, {})）", op, what, k, p[k], bound), Severity::Recoverable)
+                );
+        }
+        return *c;
+    }
+
+    // 归一化 dim 到 [0, ndim)；0 维张量或越界时报错
+    auto wrap_dim(const Tensor& a, int dim, std::string_view op) -> Result<int>
+    {
+        const auto n = static_cast<int>(a.ndim());
+        if (n == 0)
+            return std::unexpected(make_error(std::format("{}: 不支持 0 维张量", op), Severity::Recoverable));
+        if (dim < -n || dim >= n)
+            return std::unexpected(make_error(std::format("{}: 维度索引 {} 越界（ndim={}）", op, dim, n), Severity::Recoverable));
+        return dim < 0 ? dim + n : dim;
+    }
+
+    // 以 dim 为界折叠：O = dim 之前各维之积，I = dim 之后各维之积
+    auto make_geom(const Shape& data, int dim, int64_t J) -> cpu::IndexGeom
+    {
+        const auto     d = static_cast<std::size_t>(dim);
+        cpu::IndexGeom g;
+        g.N = data[d];
+        g.J = J;
+        for (std::size_t k = 0; k < d; ++k)
+            g.O *= data[k];
+        for (std::size_t k = d + 1; k < data.size(); ++k)
+            g.I *= data[k];
+        return g;
+    }
+
+    // gather / scatter 的 index 形状：与 a 同维数，除 dim 外各维长度相等
+    auto check_index_shape(const Tensor& a, const Tensor& index, int dim, std::string_view op) -> Result<void>
+    {
+        bool ok = index.ndim() == a.ndim();
+        for (std::size_t k = 0; ok && k < a.shape().size(); ++k)
+            ok = static_cast<int>(k) == dim || index.shape()[k] == a.shape()[k];
+        if (!ok)
+            return std::unexpected(make_error(std::format("{}: index 须与输入同维数，且除第 {} 维外各维长度相等", op, dim), Severity::Recoverable));
+        return {};
+    }
+
+    // scatter / scatter_add 公共部分：校验后返回 a 的连续副本，并给出连续的 index / src
+    struct ScatterArgs
+    {
+        Tensor         out;
+        Tensor         index;
+        Tensor         src;
+        cpu::IndexGeom geom;
+    };
+
+    auto prepare_scatter(const Tensor& a, int dim, const Tensor& index, const Tensor& src, std::string_view op) -> Result<ScatterArgs>
+    {
+        if (auto r = check_input(a, op, "输入 Tensor"); !r)
+            return std::unexpected(std::move(r.error()));
+        if (auto r = check_input(src, op, "src"); !r)
+            return std::unexpected(std::move(r.error()));
+        auto w = wrap_dim(a, dim, op);
+        if (!w)
+            return std::unexpected(std::move(w.error()));
+        if (src.dtype() != a.dtype())
+            return std::unexpected(make_error(
+                std::format("{}: src 的 DType::{} 与输入的 DType::{} 不一致", op, enum_to_name(src.dtype()), enum_to_name(a.dtype())), Severity::Recoverable
+            ));
+        if (auto r = check_index_shape(a, index, *w, op); !r)
+            return std::unexpected(std::move(r.error()));
+        if (src.shape() != index.shape())
+            return std::unexpected(make_error(std::format("{}: src 的形状须与 index 一致", op), Severity::Recoverable));
+
+        auto idx = prepare_index(index, a.shape()[static_cast<std::size_t>(*w)], op, "index");
+        if (!idx)
+            return std::unexpected(std::move(idx.error()));
+        auto s = src.contiguous();
+        if (!s)
+            return std::unexpected(std::move(s.error()));
+        auto out = a.clone();
+        if (!out)
+            return std::unexpected(std::move(out.error()));
+        if (auto r = out->materialize(); !r)
+            return std::unexpected(std::move(r.error()));
+        const auto geom = make_geom(a.shape(), *w, index.shape()[static_cast<std::size_t>(*w)]);
+        return ScatterArgs{std::move(*out), std::move(*idx), std::move(*s), geom};
+    }
+
+} // namespace
+
+auto index_select(const Tensor& a, int dim, const Tensor& index) -> Result<Tensor>
+{
+    if (auto r = check_input(a, "index_select", "输入 Tensor"); !r)
+        return std::unexpected(std::move(r.error()));
+    auto w = wrap_dim(a, dim, "index_select");
+    if (!w)
+        return std::unexpected(std::move(w.error()));
+    if (index.defined() && index.ndim() != 1)
+        return std::unexpected(make_error(std::format("index_select: index 须为一维，当前 ndim={}", index.ndim()), Severity::Recoverable));
+
+    const auto d   = static_cast<std::size_t>(*w);
+    auto       idx = prepare_index(index, a.shape()[d], "index_select", "index");
+    if (!idx)
+        return std::unexpected(std::move(idx.error()));
+
+    Shape out_shape = a.shape();
+    out_shape[d]    = idx->numel();
+    auto out        = Tensor::empty(out_shape, a.dtype());
+    if (!out)
+        return std::unexpected(std::move(out.error()));
+    if (out->numel() == 0)
+        return *out;
+
+    auto c = a.contiguous();
+    if (!c)
+        return std::unexpected(std::move(c.error()));
+    const auto geom = make_geom(a.shape(), *w, idx->numel());
+    const auto es   = dtype_size(a.dtype());
+    BEE_RT_DISPATCH_STMT(ix_index_select, es, geom, c->const_data_ptr(), static_cast<const int64_t*>(idx->const_data_ptr()), out->scoped_data_ptr());
+    return *out;
+}
+
+auto gather(const Tensor& a, int dim, const Tensor& index) -> Result<Tensor>
+{
+    if (auto r = check_input(a, "gather", "输入 Tensor"); !r)
+        return std::unexpected(std::move(r.error()));
+    auto w = wrap_dim(a, dim, "gather");
+    if (!w)
+        return std::unexpected(std::move(w.error()));
+    if (auto r = check_input(index, "gather", "index"); !r)
+        return std::unexpected(std::move(r.error()));
+    if (auto r = check_index_shape(a, index, *w, "gather"); !r)
+        return std::unexpected(std::move(r.error()));
+
+    const auto d   = static_cast<std::size_t>(*w);
+    auto       idx = prepare_index(index, a.shape()[d], "gather", "index");
+    if (!idx)
+        return std::unexpected(std::move(idx.error()));
+    auto out = Tensor::empty(index.shape(), a.dtype());
+    if (!out)
+        return std::unexpected(std::move(out.error()));
+    if (out->numel() == 0)
+        return *out;
+
+    auto c = a.contiguous();
+    if (!c)
+        return std::unexpected(std::move(c.error()));
+    const auto geom = make_geom(a.shape(), *w, index.shape()[d]);
+    const auto es   = dtype_size(a.dtype());
+    BEE_RT_DISPATCH_STMT(ix_gather, es, geom, c->const_data_ptr(), static_cast<const int64_t*>(idx->const_data_ptr()), out->scoped_data_ptr());
+    return *out;
+}
+
+auto scatter(const Tensor& a, int dim, const Tensor& index, const Tensor& src) -> Result<Tensor>
+{
+    auto args = prepare_scatter(a, dim, index, src, "scatter");
+    if (!args)
+        return std::unexpected(std::move(args.error()));
+    if (args->index.numel() == 0)
+        return std::move(args->out);
+
+    const auto  es  = dtype_size(a.dtype());
+    const auto* idx = static_cast<const int64_t*>(args->index.const_data_ptr());
+    BEE_RT_DISPATCH_STMT(ix_scatter, es, args->geom, idx, args->src.const_data_ptr(), args->out.scoped_data_ptr());
+    return std::move(args->out);
+}
+
+auto scatter_add(const Tensor& a, int dim, const Tensor& index, const Tensor& src) -> Result<Tensor>
+{
+    if (a.defined() && a.dtype() != DType::F32 && a.dtype() != DType::F64 && a.dtype() != DType::I32 && a.dtype() != DType::I64)
+        return std::unexpected(
+            make_error(std::format("scatter_add: 不支持 DType::{}，仅允许 F32/F64/I32/I64", enum_to_name(a.dtype())), Severity::Recoverable)
+        );
+    auto args = prepare_scatter(a, dim, index, src, "scatter_add");
+    if (!args)
+        return std::unexpected(std::move(args.error()));
+    if (args->index.numel() == 0)
+        return std::move(args->out);
+
+    const auto* idx = static_cast<const int64_t*>(args->index.const_data_ptr());
+    BEE_RT_DISPATCH_STMT(ix_scatter_add, a.dtype(), args->geom, idx, args->src.const_data_ptr(), args->out.scoped_data_ptr());
+    return std::move(args->out);
+}
+
+auto embedding_bag(const Tensor& weight, const Tensor& indices, const Tensor& offsets, EmbeddingBagMode mode, const Tensor& per_sample_weights)
+    -> Result<Tensor>
+{
+    if (auto r = check_input(weight, "embedding_bag", "weight"); !r)
+        return std::unexpected(std::move(r.error()));
+    if (weight.dtype() != DType::F32 && weight.dtype() != DType::F64)
+        return std::unexpected(
+            make_error(std::format("embedding_bag: 不支持 DType::{}，仅允许 F32/F64", enum_to_name(weight.dtype())), Severity::Recoverable)
+        );
+    if (weight.ndim() != 2)
+        return std::unexpected(make_error(std::format("embedding_bag: weight 须为 {{N, D}}，当前 ndim={}", weight.ndim()), Severity::Recoverable));
+    if ((indices.defined() && indices.ndim() != 1) || (offsets.defined() && offsets.ndim() != 1))
+        return std::unexpected(make_error("embedding_bag: indices 与 offsets 须为一维", Severity::Recoverable));
+
+    cpu::EmbeddingBagGeom geom;
+    geom.N    = weight.shape()[0];
+    geom.D    = weight.shape()[1];
+    geom.mean = mode == EmbeddingBagMode::Mean;
+
+    auto idx = prepare_index(indices, geom.N, "embedding_bag", "indices");
+    if (!idx)
+        return std::unexpected(std::move(idx.error()));
+    geom.L   = idx->numel();
+    auto off = prepare_index(offsets, geom.L + 1, "embedding_bag", "offsets");
+    if (!off)
+        return std::unexpected(std::move(off.error()));
+    geom.B = off->numel();
+
+    const auto* po = static_cast<const int64_t*>(off->const_data_ptr());
+    if (geom.B > 0 && po[0] != 0)
+        return std::unexpected(make_error(std::format("embedding_bag: offsets[0]={} 非法，须为 0", po[0]), Severity::Recoverable));
+    for (int64_t b = 1; b < geom.B; ++b) {
+        if (po[b] < po[b - 1])
+            return std::unexpected(
+                make_error(std::format("embedding_bag: offsets 须单调不减（第 {} 个值 {} < {}）", b, po[b], po[b - 1]), Severity::Recoverable)
+            );
+    }
+
+    Tensor psw;
+    if (per_sample_weights.defined()) {
+        if (mode != EmbeddingBagMode::Sum)
+            return std::unexpected(make_error("embedding_bag: per_sample_weights 仅支持 Sum 模式", Severity::Recoverable));
+        if (auto r = check_input(per_sample_weights, "embedding_bag", "per_sample_weights"); !r)
+            return std::unexpected(std::move(r.error()));
+        if (per_sample_weights.dtype() != weight.dtype() || per_sample_weights.shape() != Shape{geom.L})
+            return std::unexpected(make_error("embedding_bag: per_sample_weights 须与 weight 同 dtype、与 indices 同形", Severity::Recoverable));
+        auto p = per_sample_weights.contiguous();
+        if (!p)
+            return std::unexpected(std::move(p.error()));
+        psw = std::move(*p);
+    }
+
+    auto out = Tensor::empty({geom.B, geom.D}, weight.dtype());
+    if (!out)
+        return std::unexpected(std::move(out.error()));
+    if (out->numel() == 0)
+        return *out;
+
+    auto w = weight.contiguous();
+    if (!w)
+        return std::unexpected(std::move(w.error()));
+    const void* psw_ptr = psw.defined() ? psw.const_data_ptr() : nullptr;
+    BEE_RT_DISPATCH_STMT(
+        ix_embedding_bag,
+        weight.dtype(),
+        geom,
+        w->const_data_ptr(),
+        static_cast<const int64_t*>(idx->const_data_ptr()),
+        po,
+        psw_ptr,
+        out->scoped_data_ptr()
+    );
+    return *out;
+}
+
+} // namespace bee
@@ -0,0 +1,42 @@
+#pragma once
+
+// 索引类算子（语义对齐 PyTorch，索引均为 I64 或 I32，取值须落在 [0, size)）：
+//   index_select ：沿 dim 按一维 index 选取整片，out.shape[dim] = index.numel()
+//   gather       ：out[.., j, ..] = a[.., index[.., j, ..], ..]，index 与 a 同维数，
+//                  且除 dim 外各维长度须与 a 相等（PyTorch 允许 ≤，此处不支持）
+//   scatter      ：a 的副本上执行 out[.., index[.., j, ..], ..] = src[.., j, ..]，src 与 index 同形；
+//                  重复索引保留 j 最大者（确定性）
+//   scatter_add  ：同上但累加；结果确定且与线程数无关（列数少、J 大时沿 j 分固定块求部分和，
+//                  浮点舍入可能与串行逐个累加不同）
+//   embedding_bag：weight={N, D}，indices={L}，offsets={B} 划分 bag，输出 {B, D} 为各 bag 所选行的和 / 均值；
+//                  offsets 须从 0 开始且单调不减，空 bag 输出 0；per_sample_weights 仅 Sum 模式可用
+//
+// 数据侧按位拷贝的算子（index_select / gather / scatter）不限 dtype；scatter_add 支持 F32/F64/I32/I64，
+// embedding_bag 支持 F32/F64。输出均为新的连续张量；当前仅 CPU。
+
+#include "Base/Diagnostics/Error.hpp"
+#include "Tensor/Core/Tensor.hpp"
+
+namespace bee
+{
+
+enum class EmbeddingBagMode : uint8_t
+{
+    Sum,
+    Mean,
+};
+
+[[nodiscard]] auto index_select(const Tensor& a, int dim, const Tensor& index) -> Result<Tensor>;
+[[nodiscard]] auto gather(const Tensor& a, int dim, const Tensor& index) -> Result<Tensor>;
+[[nodiscard]] auto scatter(const Tensor& a, int dim, const Tensor& index, const Tensor& src) -> Result<Tensor>;
+[[nodiscard]] auto scatter_add(const Tensor& a, int dim, const Tensor& index, const Tensor& src) -> Result<Tensor>;
+
+[[nodiscard]] auto embedding_bag(
+    const Tensor&    weight,
+    const Tensor&    indices,
+    const Tensor&    offsets,
+    EmbeddingBagMode mode               = EmbeddingBagMode::Sum,
+    const Tensor&    per_sample_weights = {}
+) -> Result<Tensor>;
+
+} // namespace bee
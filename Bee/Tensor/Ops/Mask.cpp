@@ -0,0 +1,123 @@
+#include "Tensor/Ops/Mask.hpp"
+#include "Tensor/Ops/Cast.hpp"
+#include "Tensor/Cpu/MaskGeom.hpp"
+#include "Tensor/Cpu/Dispatch/Dispatch.hpp"
+
+#include <format>
+#include <string_view>
+#include <vector>
+
+namespace bee
+{
+
+namespace
+{
+
+    auto check_input(const Tensor& t, std::string_view op, std::string_view what) -> Result<void>
+    {
+        if (!t.defined())
+            return std::unexpected(make_error(std::format("{}: {} 未定义", op, what), Severity::Recoverable));
+        if (t.device() != Device::CPU)
+            return std::unexpected(make_error(std::format("{}: 仅支持 CPU 张量", op), Severity::Recoverable));
+        return {};
+    }
+
+    // 连续的 1 字节掩码：Bool / U8 / I8 直接使用原字节，其余 dtype 经 cast 转为 Bool
+    auto byte_mask(const Tensor& a) -> Result<Tensor>
+    {
+        if (a.dtype() == DType::Bool || a.dtype() == DType::U8 || a.dtype() == DType::I8)
+            return a.contiguous();
+        return cast(a, DType::Bool);
+    }
+
+    // 第一遍 + 独占前缀和：offsets[c] 为第 c 块的输出起点，返回选中总数
+    auto plan_chunks(const std::uint8_t* m, int64_t n, std::vector<int64_t>& offsets) -> int64_t
+    {
+        offsets.assign(static_cast<std::size_t>(cpu::mask_chunk_count(n)), 0);
+        if (n > 0)
+            BEE_RT_DISPATCH_STMT(mk_chunk_counts, m, n, offsets.data());
+        int64_t total = 0;
+        for (auto& c : offsets) {
+            const int64_t cnt = c;
+            c                 = total;
+            total += cnt;
+        }
+        return total;
+    }
+
+    auto mask_bytes(const Tensor& m) -> const std::uint8_t*
+    {
+        return static_cast<const std::uint8_t*>(m.const_data_ptr());
+    }
+
+} // namespace
+
+auto count_nonzero(const Tensor& a) -> Result<Tensor>
+{
+    if (auto r = check_input(a, "count_nonzero", "输入 Tensor"); !r)
+        return std::unexpected(std::move(r.error()));
+    auto m = byte_mask(a);
+    if (!m)
+        return std::unexpected(std::move(m.error()));
+
+    std::vector<int64_t> offsets;
+    const int64_t        total = plan_chunks(mask_bytes(*m), m->numel(), offsets);
+    auto                 out   = Tensor::empty({}, DType::I64);
+    if (!out)
+        return std::unexpected(std::move(out.error()));
+    *static_cast<int64_t*>(out->scoped_data_ptr()) = total;
+    return out;
+}
+
+auto nonzero(const Tensor& a) -> Result<Tensor>
+{
+    if (auto r = check_input(a, "nonzero", "输入 Tensor"); !r)
+        return std::unexpected(std::move(r.error()));
+    auto m = byte_mask(a);
+    if (!m)
+        return std::unexpected(std::move(m.error()));
+
+    std::vector<int64_t> offsets;
+    const int64_t        n     = m->numel();
+    const int64_t        total = plan_chunks(mask_bytes(*m), n, offsets);
+    const auto           ndim  = static_cast<int>(a.ndim());
+    auto                 out   = Tensor::empty({total, static_cast<int64_t>(ndim)}, DType::I64);
+    if (!out)
+        return std::unexpected(std::move(out.error()));
+    if (total > 0 && ndim > 0)
+        BEE_RT_DISPATCH_STMT(mk_nonzero, mask_bytes(*m), n, offsets.data(), ndim, a.shape().data(), static_cast<int64_t*>(out->scoped_data_ptr()));
+    return out;
+}
+
+auto masked_select(const Tensor& a, const Tensor& mask) -> Result<Tensor>
+{
+    if (auto r = check_input(a, "masked_select", "输入 Tensor"); !r)
+        return std::unexpected(std::move(r.error()));
+    if (auto r = check_input(mask, "masked_select", "mask"); !r)
+        return std::unexpected(std::move(r.error()));
+    if (mask.dtype() != DType::Bool)
+        return std::unexpected(
+            make_error(std::format("masked_select: mask 须为 Bool，当前为 DType::{}", enum_to_name(mask.dtype())), Severity::Recoverable)
+        );
+    if (mask.shape() != a.shape())
+        return std::unexpected(make_error("masked_select: mask 须与输入同形（不支持广播）", Severity::Recoverable));
+
+    auto m = mask.contiguous();
+    if (!m)
+        return std::unexpected(std::move(m.error()));
+    auto src = a.contiguous();
+    if (!src)
+        return std::unexpected(std::move(src.error()));
+
+    std::vector<int64_t> offsets;
+    const int64_t        n     = m->numel();
+    const int64_t        total = plan_chunks(mask_bytes(*m), n, offsets);
+    auto                 out   = Tensor::empty({total}, a.dtype());
+    if (!out)
+        return std::unexpected(std::move(out.error()));
+    if (total > 0)
+        BEE_RT_DISPATCH_STMT(mk_select, mask_bytes(*m), n, offsets.data(), src->const_data_ptr(), dtype_size(a.dtype()), out->scoped_data_ptr());
+    return out;
+}
+
+} // namespace bee
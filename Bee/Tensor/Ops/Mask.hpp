@@ -0,0 +1,21 @@
+#pragma once
+
+// 布尔掩码压缩（语义对齐 PyTorch，当前仅 CPU）：
+//   count_nonzero：非零元素个数，返回 shape={} 的 I64 标量张量
+//   nonzero      ：非零元素的坐标，返回 {N, ndim} 的 I64，按行主序升序排列
+//   masked_select：按 Bool 掩码选取元素，返回一维 {N}；mask 须与 a 同形（不支持广播），a 不限 dtype
+//
+// 判零：Bool / U8 / I8 直接按字节判断，其余 dtype 先经 cast 转为 Bool（浮点 NaN 视为非零，-0.0 视为零）。
+// 三者共用两遍并行压缩：固定分块统计个数 → 独占前缀和 → 各块并行写出，输出只分配一次，结果与线程数无关。
+
+#include "Base/Diagnostics/Error.hpp"
+#include "Tensor/Core/Tensor.hpp"
+
+namespace bee
+{
+
+[[nodiscard]] auto count_nonzero(const Tensor& a) -> Result<Tensor>;
+[[nodiscard]] auto nonzero(const Tensor& a) -> Result<Tensor>;
+[[nodiscard]] auto masked_select(const Tensor& a, const Tensor& mask) -> Result<Tensor>;
+
+} // namespace bee
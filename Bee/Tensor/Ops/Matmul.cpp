@@ -1,10 +1,16 @@
 #include "Tensor/Ops/Matmul.hpp"
+#include "Tensor/Ops/Broadcast.hpp"
+#include "Tensor/Ops/Cast.hpp"
 #include "Tensor/Cpu/Dispatch/Dispatch.hpp"
 #include "Tensor/Cuda/Backend.hpp"
 #include "Tensor/Core/DType.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <format>
+#include <utility>
+#include <vector>
 
 namespace bee
 {
@@ -12,25 +18,434 @@ namespace bee
 namespace
 {
 
+    // GEMM 操作数的矩阵视图：元素 (i, k) 位于 data[i * rs + k * cs]
+    struct MatView
+    {
+        Tensor  t;
+        int64_t rs = 0;
+        int64_t cs = 1;
+    };
+
+    // 把 t（前导维折叠进行；1D 视为单行）视为矩阵。CPU 上除 I64 外的 pack 直接按步长读取，
+    // 转置 / 切片视图无需拷贝；前导维无法合并为单一行步长，或走 I64 模板内核 / CUDA 时才连续化。
+    auto gemm_view(const Tensor& t) -> Result<MatView>
+    {
+        const auto& sh = t.shape();
+        const auto& st = t.strides();
+        const auto  nd = static_cast<std::ptrdiff_t>(sh.size());
+        if (nd < 2 && t.device() == Device::CPU && t.dtype() != DType::I64)
+            return MatView{t, 0, st.back()}; // 1D 视为单行
+
+        bool    direct = t.device() == Device::CPU && t.dtype() != DType::I64;
+        int64_t rs     = st[static_cast<std::size_t>(nd - 2)];
+        int64_t expect = -1;
+        for (std::ptrdiff_t d = nd - 2; direct && d >= 0; --d) {
+            const auto i = static_cast<std::size_t>(d);
+            if (sh[i] == 1)
+                continue;
+            if (expect < 0)
+                rs = st[i];
+            else if (st[i] != expect)
+                direct = false;
+            expect = st[i] * sh[i];
+        }
+        if (direct)
+            return MatView{t, rs, st[static_cast<std::size_t>(nd - 1)]};
+
+        auto c = t.contiguous();
+        if (!c)
+            return std::unexpected(std::move(c.error()));
+        return MatView{*c, sh.back(), 1};
+    }
+
     // 分派到对应类型的 CPU 内核（运行期 ISA 分派）
     // in_dtype：输入 A/B 的 dtype；out_dtype：输出 C 的 dtype（通常同 in_dtype，
     // 但 I8×I8→I32 时不同）
-    auto dispatch_matmul_cpu(int64_t M, int64_t K, int64_t N, DType in_dtype, DType out_dtype, const void* A, const void* B, void* C) -> void
+    auto dispatch_matmul_cpu(int64_t M, int64_t K, int64_t N, DType in_dtype, DType out_dtype, const MatView& a, const MatView& b, void* C) -> void
     {
         // 输出缓冲区按 out_dtype 大小置零
         const std::size_t nbytes = static_cast<std::size_t>(M * N) * dtype_size(out_dtype);
         std::memset(C, 0, nbytes);
 
+        const void* A = a.t.const_data_ptr();
+        const void* B = b.t.const_data_ptr();
         switch (in_dtype) {
-        case DType::F32: BEE_RT_DISPATCH(mm_f32, M, K, N, static_cast<const float*>(A), static_cast<const float*>(B), static_cast<float*>(C));
-        case DType::F64: BEE_RT_DISPATCH(mm_f64, M, K, N, static_cast<const double*>(A), static_cast<const double*>(B), static_cast<double*>(C));
-        case DType::I32: BEE_RT_DISPATCH(mm_i32, M, K, N, static_cast<const int32_t*>(A), static_cast<const int32_t*>(B), static_cast<int32_t*>(C));
+        case DType::F32:
+            BEE_RT_DISPATCH(
+                mm_f32, M, K, N, static_cast<const float*>(A), a.rs, a.cs, static_cast<const float*>(B), b.rs, b.cs, static_cast<float*>(C)
+            );
+        case DType::F64:
+            BEE_RT_DISPATCH(
+                mm_f64, M, K, N, static_cast<const double*>(A), a.rs, a.cs, static_cast<const double*>(B), b.rs, b.cs, static_cast<double*>(C)
+            );
+        case DType::I32:
+            BEE_RT_DISPATCH(
+                mm_i32, M, K, N, static_cast<const int32_t*>(A), a.rs, a.cs, static_cast<const int32_t*>(B), b.rs, b.cs, static_cast<int32_t*>(C)
+            );
         case DType::I64: BEE_RT_DISPATCH(mm_i64, M, K, N, static_cast<const int64_t*>(A), static_cast<const int64_t*>(B), static_cast<int64_t*>(C));
-        case DType::I8: BEE_RT_DISPATCH(mm_i8, M, K, N, static_cast<const int8_t*>(A), static_cast<const int8_t*>(B), static_cast<int32_t*>(C));
+        case DType::I8:
+            BEE_RT_DISPATCH(
+                mm_i8, M, K, N, static_cast<const int8_t*>(A), a.rs, a.cs, static_cast<const int8_t*>(B), b.rs, b.cs, static_cast<int32_t*>(C)
+            );
+        case DType::F16:
+            BEE_RT_DISPATCH(
+                mm_f16, M, K, N, static_cast<const Half*>(A), a.rs, a.cs, static_cast<const Half*>(B), b.rs, b.cs, static_cast<float*>(C)
+            );
+        case DType::BF16:
+            BEE_RT_DISPATCH(
+                mm_bf16, M, K, N, static_cast<const BFloat16*>(A), a.rs, a.cs, static_cast<const BFloat16*>(B), b.rs, b.cs, static_cast<float*>(C)
+            );
         default: break;
         }
     }
 
+    // 批量 matmul 计划：batch 维按 NumPy 规则广播；
+    // a_index / b_index 给出每个输出 batch 对应的输入 slice 序号（广播维取 0）
+    struct BatchPlan
+    {
+        Shape                out_shape;
+        int64_t              batch = 1;
+        int64_t              M     = 0;
+        int64_t              K     = 0;
+        int64_t              N     = 0;
+        std::vector<int64_t> a_index;
+        std::vector<int64_t> b_index;
+    };
+
+    auto plan_batched(const Shape& sa, const Shape& sb) -> Result<BatchPlan>
+    {
+        const std::size_t ra = sa.size();
+        const std::size_t rb = sb.size();
+
+        BatchPlan p;
+        p.M              = sa[ra - 2];
+        p.K              = sa[ra - 1];
+        p.N              = sb[rb - 1];
+        const int64_t Kb = sb[rb - 2];
+        if (p.K != Kb)
+            return std::unexpected(make_error(std::format("matmul: 内维不匹配（a 列={}, b 行={}）", p.K, Kb), Severity::Recoverable));
+
+        const Shape ba(sa.begin(), sa.end() - 2);
+        const Shape bb(sb.begin(), sb.end() - 2);
+        auto        bs = compute_broadcast_shape(ba, bb);
+        if (!bs)
+            return std::unexpected(std::move(bs.error()));
+
+        p.batch     = numel(*bs);
+        p.out_shape = *bs;
+        p.out_shape.push_back(p.M);
+        p.out_shape.push_back(p.N);
+
+        // 输入 batch 维在输出 batch 维上的步长（以 slice 为单位），广播维步长为 0
+        const std::size_t r          = bs->size();
+        auto              slice_step = [&](const Shape& in) {
+            std::vector<int64_t> step(r, 0);
+            int64_t              acc = 1;
+            for (std::size_t d = in.size(); d-- > 0;) {
+                step[r - in.size() + d] = (in[d] == 1) ? 0 : acc;
+                acc *= in[d];
+            }
+            return step;
+        };
+        const auto step_a = slice_step(ba);
+        const auto step_b = slice_step(bb);
+
+        p.a_index.resize(static_cast<std::size_t>(p.batch));
+        p.b_index.resize(static_cast<std::size_t>(p.batch));
+        for (int64_t i = 0; i < p.batch; ++i) {
+            int64_t rem = i;
+            int64_t ia  = 0;
+            int64_t ib  = 0;
+            for (std::size_t d = r; d-- > 0;) {
+                const int64_t extent = (*bs)[d];
+                const int64_t coord  = rem % extent;
+                rem /= extent;
+                ia += coord * step_a[d];
+                ib += coord * step_b[d];
+            }
+            p.a_index[static_cast<std::size_t>(i)] = ia;
+            p.b_index[static_cast<std::size_t>(i)] = ib;
+        }
+        return p;
+    }
+
+    // 输入 slice 序号（按 t 的 batch 维行主序编号）→ slice 起点的元素偏移（按 t 的实际步长）
+    auto slice_offsets(const Tensor& t, const std::vector<int64_t>& index) -> std::vector<int64_t>
+    {
+        const auto&       sh = t.shape();
+        const auto&       st = t.strides();
+        const std::size_t nb = sh.size() - 2;
+
+        std::vector<int64_t> off(index.size());
+        for (std::size_t i = 0; i < index.size(); ++i) {
+            int64_t rem = index[i];
+            int64_t o   = 0;
+            for (std::size_t d = nb; d-- > 0;) {
+                o += (rem % sh[d]) * st[d];
+                rem /= sh[d];
+            }
+            off[i] = o;
+        }
+        return off;
+    }
+
+    template <typename T>
+    auto slice_ptrs(const Tensor& t, const std::vector<int64_t>& offsets) -> std::vector<const T*>
+    {
+        std::vector<const T*> ptrs(offsets.size());
+        for (std::size_t i = 0; i < offsets.size(); ++i)
+            ptrs[i] = static_cast<const T*>(t.const_data_ptr()) + offsets[i];
+        return ptrs;
+    }
+
+    // 批量分派：各 slice 指针按计划展开，由批量 GEMM driver 在一次 parallel_for 内完成；
+    // slice 内行 / 列步长取末两维，a / b 可为任意步长视图（I64 由调用方保证连续）
+    auto dispatch_bmm_cpu(const BatchPlan& p, DType in_dtype, const Tensor& a, const Tensor& b, void* C) -> void
+    {
+        const auto    off_a = slice_offsets(a, p.a_index);
+        const auto    off_b = slice_offsets(b, p.b_index);
+        const auto&   sa    = a.strides();
+        const auto&   sb    = b.strides();
+        const int64_t rsa   = sa[sa.size() - 2];
+        const int64_t csa   = sa.back();
+        const int64_t rsb   = sb[sb.size() - 2];
+        const int64_t csb   = sb.back();
+        switch (in_dtype) {
+        case DType::F32: {
+            const auto pa = slice_ptrs<float>(a, off_a);
+            const auto pb = slice_ptrs<float>(b, off_b);
+            BEE_RT_DISPATCH(bmm_f32, p.batch, p.M, p.K, p.N, pa.data(), rsa, csa, pb.data(), rsb, csb, static_cast<float*>(C));
+        }
+        case DType::F64: {
+            const auto pa = slice_ptrs<double>(a, off_a);
+            const auto pb = slice_ptrs<double>(b, off_b);
+            BEE_RT_DISPATCH(bmm_f64, p.batch, p.M, p.K, p.N, pa.data(), rsa, csa, pb.data(), rsb, csb, static_cast<double*>(C));
+        }
+        case DType::I32: {
+            const auto pa = slice_ptrs<int32_t>(a, off_a);
+            const auto pb = slice_ptrs<int32_t>(b, off_b);
+            BEE_RT_DISPATCH(bmm_i32, p.batch, p.M, p.K, p.N, pa.data(), rsa, csa, pb.data(), rsb, csb, static_cast<int32_t*>(C));
+        }
+        case DType::I64: {
+            const auto pa = slice_ptrs<int64_t>(a, off_a);
+            const auto pb = slice_ptrs<int64_t>(b, off_b);
+            BEE_RT_DISPATCH(bmm_i64, p.batch, p.M, p.K, p.N, pa.data(), pb.data(), static_cast<int64_t*>(C));
+        }
+        case DType::I8: {
+            const auto pa = slice_ptrs<int8_t>(a, off_a);
+            const auto pb = slice_ptrs<int8_t>(b, off_b);
+            BEE_RT_DISPATCH(bmm_i8, p.batch, p.M, p.K, p.N, pa.data(), rsa, csa, pb.data(), rsb, csb, static_cast<int32_t*>(C));
+        }
+        case DType::F16: {
+            const auto pa = slice_ptrs<Half>(a, off_a);
+            const auto pb = slice_ptrs<Half>(b, off_b);
+            BEE_RT_DISPATCH(bmm_f16, p.batch, p.M, p.K, p.N, pa.data(), rsa, csa, pb.data(), rsb, csb, static_cast<float*>(C));
+        }
+        case DType::BF16: {
+            const auto pa = slice_ptrs<BFloat16>(a, off_a);
+            const auto pb = slice_ptrs<BFloat16>(b, off_b);
+            BEE_RT_DISPATCH(bmm_bf16, p.batch, p.M, p.K, p.N, pa.data(), rsa, csa, pb.data(), rsb, csb, static_cast<float*>(C));
+        }
+        default: break;
+        }
+    }
+
+    // ≥3D 输入：batch 维广播后逐 slice 计算，输出 {broadcast(batch)..., M, N}
+    // 调用前 dtype/device 已校验；out_dt 为输出 dtype（I8 → I32）
+    auto matmul_batched(const Tensor& a, const Tensor& b, DType out_dt) -> Result<Tensor>
+    {
+        if (a.ndim() < 2)
+            return std::unexpected(make_error(std::format("matmul: a 至少需要 2 维，当前 ndim={}", a.ndim()), Severity::Recoverable));
+        if (b.ndim() < 2)
+            return std::unexpected(make_error(std::format("matmul: b 至少需要 2 维，当前 ndim={}", b.ndim()), Severity::Recoverable));
+
+        auto plan = plan_batched(a.shape(), b.shape());
+        if (!plan)
+            return std::unexpected(std::move(plan.error()));
+        const BatchPlan& p = *plan;
+
+        auto out = Tensor::zeros(p.out_shape, out_dt, a.device());
+        if (!out)
+            return std::unexpected(std::move(out.error()));
+        if (out->numel() == 0 || p.K == 0)
+            return *out;
+
+        // CPU 上除 I64 外直接消费任意步长视图；CUDA 与 I64 需连续输入
+        const bool need_contig = a.device() == Device::CUDA || a.dtype() == DType::I64;
+        Tensor     ca          = a;
+        if (need_contig && !a.is_contiguous()) {
+            auto r = a.contiguous();
+            if (!r)
+                return std::unexpected(std::move(r.error()));
+            ca = *r;
+        }
+        Tensor cb = b;
+        if (need_contig && !b.is_contiguous()) {
+            auto r = b.contiguous();
+            if (!r)
+                return std::unexpected(std::move(r.error()));
+            cb = *r;
+        }
+
+        if (a.device() == Device::CUDA) {
+            // CUDA 后端仅提供 2D 入口：逐 slice 转发
+            const std::size_t esz = dtype_size(a.dtype());
+            const auto*       pa  = static_cast<const std::byte*>(ca.const_data_ptr());
+            const auto*       pb  = static_cast<const std::byte*>(cb.const_data_ptr());
+            auto*             pc  = static_cast<std::byte*>(out->scoped_data_ptr());
+            for (int64_t i = 0; i < p.batch; ++i) {
+                const auto idx = static_cast<std::size_t>(i);
+                auto       rc  = tensor::cuda::matmul(
+                    static_cast<int>(a.dtype()),
+                    pa + static_cast<std::size_t>(p.a_index[idx] * p.M * p.K) * esz,
+                    pb + static_cast<std::size_t>(p.b_index[idx] * p.K * p.N) * esz,
+                    pc + static_cast<std::size_t>(i * p.M * p.N) * esz,
+                    static_cast<std::size_t>(p.M),
+                    static_cast<std::size_t>(p.K),
+                    static_cast<std::size_t>(p.N)
+                );
+                if (!rc)
+                    return std::unexpected(std::move(rc.error()));
+            }
+            return *out;
+        }
+
+        dispatch_bmm_cpu(p, a.dtype(), ca, cb, out->scoped_data_ptr());
+        return *out;
+    }
+
+    // 当前 ISA 下 pack_matrix 的存储元素数
+    auto packed_elems(DType dt, int64_t K, int64_t N) -> int64_t
+    {
+        BEE_RT_DISPATCH(pk_packed_elems, dt, K, N);
+    }
+
+    auto to_gemm_act(Activation act) -> cpu::gemm::GemmAct
+    {
+        switch (act) {
+        case Activation::ReLU: return cpu::gemm::GemmAct::ReLU;
+        case Activation::GELU: return cpu::gemm::GemmAct::GELU;
+        case Activation::SiLU: return cpu::gemm::GemmAct::SiLU;
+        default: return cpu::gemm::GemmAct::None;
+        }
+    }
+
+    // 融合路径的公共校验与连续化：返回 bias / residual 的连续版本（未定义则保持未定义）
+    // op：错误信息前缀；out_shape：输出 shape（residual 需与之一致）
+    auto prepare_epilogue(const char* op, DType dt, int64_t N, const Shape& out_shape, const Tensor& bias, const Tensor& residual)
+        -> Result<std::pair<Tensor, Tensor>>
+    {
+        if (dt != DType::F32 && dt != DType::F64)
+            return std::unexpected(make_error(std::format("{}: 融合 GEMM 仅支持 F32/F64，当前 DType::{}", op, enum_to_name(dt)), Severity::Recoverable));
+
+        Tensor cbias;
+        if (bias.defined()) {
+            if (bias.device() != Device::CPU || bias.dtype() != dt || bias.ndim() != 1 || bias.shape()[0] != N)
+                return std::unexpected(make_error(std::format("{}: bias 必须是 CPU 上 dtype 一致的 {{{}}} 张量", op, N), Severity::Recoverable));
+            auto r = bias.contiguous();
+            if (!r)
+                return std::unexpected(std::move(r.error()));
+            cbias = *r;
+        }
+        Tensor cres;
+        if (residual.defined()) {
+            if (residual.device() != Device::CPU || residual.dtype() != dt || residual.shape() != out_shape)
+                return std::unexpected(make_error(std::format("{}: residual 必须是 CPU 上与输出同 shape、同 dtype 的张量", op), Severity::Recoverable));
+            auto r = residual.contiguous();
+            if (!r)
+                return std::unexpected(std::move(r.error()));
+            cres = *r;
+        }
+        return std::pair<Tensor, Tensor>{cbias, cres};
+    }
+
+    // linear 的公共实现：B 为任意步长的 {K,N}（b_packed=false，步长 rsb / csb）或预打包布局
+    auto linear_impl(
+        const Tensor& x,
+        DType         w_dt,
+        int64_t       K,
+        int64_t       N,
+        const void*   B,
+        int64_t       rsb,
+        int64_t       csb,
+        bool          b_packed,
+        const Tensor& bias,
+        Activation    act,
+        const Tensor& residual
+    ) -> Result<Tensor>
+    {
+        if (!x.defined())
+            return std::unexpected(make_error("linear: 输入 Tensor 未定义", Severity::Recoverable));
+        if (x.device() != Device::CPU)
+            return std::unexpected(make_error("linear: 仅支持 CPU 张量", Severity::Recoverable));
+        if (x.dtype() != w_dt)
+            return std::unexpected(
+                make_error(std::format("linear: dtype 不匹配（{} vs {}）", enum_to_name(x.dtype()), enum_to_name(w_dt)), Severity::Recoverable)
+            );
+        if (x.ndim() < 1 || x.shape().back() != K)
+            return std::unexpected(make_error(std::format("linear: x 末维须等于权重行数 {}", K), Severity::Recoverable));
+
+        Shape out_shape  = x.shape();
+        out_shape.back() = N;
+        const int64_t M  = numel(Shape(x.shape().begin(), x.shape().end() - 1));
+
+        auto ep = prepare_epilogue("linear", x.dtype(), N, out_shape, bias, residual);
+        if (!ep)
+            return std::unexpected(std::move(ep.error()));
+
+        auto out = Tensor::empty(out_shape, x.dtype());
+        if (!out)
+            return std::unexpected(std::move(out.error()));
+        if (M == 0 || N == 0)
+            return *out;
+
+        auto vx = gemm_view(x);
+        if (!vx)
+            return std::unexpected(std::move(vx.error()));
+
+        cpu::FusedGemmArgs args;
+        args.bias     = ep->first.defined() ? ep->first.const_data_ptr() : nullptr;
+        args.residual = ep->second.defined() ? ep->second.const_data_ptr() : nullptr;
+        args.act      = to_gemm_act(act);
+        BEE_RT_DISPATCH_STMT(
+            mm_fused, x.dtype(), M, K, N, vx->t.const_data_ptr(), vx->rs, vx->cs, B, rsb, csb, b_packed, out->scoped_data_ptr(), args
+        );
+        return *out;
+    }
+
+    // 两个 CPU 张量实际访问的字节区间是否相交（按 shape / strides 求出首末元素地址）
+    auto memory_overlaps(const Tensor& x, const Tensor& y) -> bool
+    {
+        auto span = [](const Tensor& t) -> std::pair<std::uintptr_t, std::uintptr_t> {
+            const auto base = reinterpret_cast<std::uintptr_t>(t.const_data_ptr());
+            if (t.numel() == 0)
+                return {base, base};
+            int64_t lo = 0;
+            int64_t hi = 0;
+            for (std::size_t d = 0; d < t.shape().size(); ++d) {
+                const int64_t ext = (t.shape()[d] - 1) * t.strides()[d];
+                (ext < 0 ? lo : hi) += ext;
+            }
+            const auto es = static_cast<int64_t>(dtype_size(t.dtype()));
+            return {base + static_cast<std::uintptr_t>(lo * es), base + static_cast<std::uintptr_t>((hi + 1) * es)};
+        };
+        const auto [x0, x1] = span(x);
+        const auto [y0, y1] = span(y);
+        return x0 < y1 && y0 < x1;
+    }
+
+    // 与 c 重叠的 bias / residual：beta·C 预处理会先改写 c，故先复制出私有副本（已连续）
+    auto detach_from(const Tensor& t, const Tensor& c) -> Result<Tensor>
+    {
+        if (!t.defined() || !memory_overlaps(t, c))
+            return t;
+        auto copy = Tensor::empty(t.shape(), t.dtype());
+        if (!copy)
+            return std::unexpected(std::move(copy.error()));
+        std::memcpy(copy->scoped_data_ptr(), t.const_data_ptr(), static_cast<std::size_t>(t.numel()) * dtype_size(t.dtype()));
+        return *copy;
+    }
+
 } // namespace
 
 auto matmul(const Tensor& a, const Tensor& b) -> Result<Tensor>
@@ -60,8 +475,11 @@ auto matmul(const Tensor& a, const Tensor& b) -> Result<Tensor>
         if (dt_cu == DType::Bool || dt_cu == DType::U8)
             return std::unexpected(make_error(std::format("matmul: CUDA 不支持 DType::{}", enum_to_name(dt_cu)), Severity::Recoverable));
 
+        if (a.ndim() > 2 || b.ndim() > 2)
+            return matmul_batched(a, b, dt_cu);
+
         if (a.ndim() != 2 || b.ndim() != 2)
-            return std::unexpected(make_error("matmul: 仅支持 2D × 2D", Severity::Recoverable));
+            return std::unexpected(make_error("matmul: 输入至少需要 2 维", Severity::Recoverable));
 
         const int64_t M  = a.shape()[0];
         const int64_t Ka = a.shape()[1];
@@ -93,9 +511,9 @@ auto matmul(const Tensor& a, const Tensor& b) -> Result<Tensor>
 
         auto rc = tensor::cuda::matmul(
             static_cast<int>(dt_cu),
-            ca.data_ptr(),
-            cb.data_ptr(),
-            out_r->data_ptr(),
+            ca.const_data_ptr(),
+            cb.const_data_ptr(),
+            out_r->scoped_data_ptr(),
             static_cast<std::size_t>(M),
             static_cast<std::size_t>(Ka),
             static_cast<std::size_t>(N)
@@ -115,15 +533,25 @@ auto matmul(const Tensor& a, const Tensor& b) -> Result<Tensor>
     if (dt == DType::Bool || dt == DType::U8)
         return std::unexpected(make_error(std::format("matmul: 不支持 DType::{}", enum_to_name(dt)), Severity::Recoverable));
 
-    // I8 输入 → I32 输出（累加到更宽类型避免溢出）
-    const DType out_dt = (dt == DType::I8) ? DType::I32 : dt;
+    // I8 输入 → I32 输出（累加到更宽类型避免溢出）；F16 / BF16 以 F32 累加，最后收窄回输入 dtype
+    const bool  half   = dtype_is_half_float(dt);
+    const DType out_dt = (dt == DType::I8) ? DType::I32 : (half ? DType::F32 : dt);
+    auto        narrow = [&](Result<Tensor> r) -> Result<Tensor> {
+        if (!r || !half)
+            return r;
+        return cast(*r, dt);
+    };
 
-    // ── 维度检查：仅支持 2D × 2D ─────────────────────────────────────────────
+    // ── ≥3D：batch 维广播的批量路径 ──────────────────────────────────────────
+    if (a.ndim() > 2 || b.ndim() > 2)
+        return narrow(matmul_batched(a, b, out_dt));
+
+    // ── 维度检查：2D × 2D ────────────────────────────────────────────────────
     if (a.ndim() != 2)
-        return std::unexpected(make_error(std::format("matmul: a 必须是 2D 张量，当前 ndim={}", a.ndim()), Severity::Recoverable));
+        return std::unexpected(make_error(std::format("matmul: a 至少需要 2 维，当前 ndim={}", a.ndim()), Severity::Recoverable));
 
     if (b.ndim() != 2)
-        return std::unexpected(make_error(std::format("matmul: b 必须是 2D 张量，当前 ndim={}", b.ndim()), Severity::Recoverable));
+        return std::unexpected(make_error(std::format("matmul: b 至少需要 2 维，当前 ndim={}", b.ndim()), Severity::Recoverable));
 
     // ── shape 相容性检查 ──────────────────────────────────────────────────────
     const int64_t M  = a.shape()[0];
@@ -137,12 +565,8 @@ auto matmul(const Tensor& a, const Tensor& b) -> Result<Tensor>
     const int64_t K = Ka;
 
     // ── M 或 N 为 0：直接返回形状正确的零张量 ────────────────────────────────
-    if (M == 0 || N == 0) {
-        auto out = Tensor::zeros({M, N}, out_dt);
-        if (!out)
-            return std::unexpected(std::move(out.error()));
-        return *out;
-    }
+    if (M == 0 || N == 0)
+        return Tensor::zeros({M, N}, dt == DType::I8 ? DType::I32 : dt);
 
     // ── 输出张量（全零，contiguous）──────────────────────────────────────────
     auto out = Tensor::zeros({M, N}, out_dt);
@@ -151,31 +575,206 @@ auto matmul(const Tensor& a, const Tensor& b) -> Result<Tensor>
 
     // K==0：输出已经是全 0，直接返回
     if (K == 0)
-        return *out;
+        return narrow(*out);
 
-    // ── 非 contiguous 输入自动整理 ────────────────────────────────────────────
-    Tensor ca = a;
-    if (!a.is_contiguous()) {
-        auto r = a.contiguous();
-        if (!r)
-            return std::unexpected(std::move(r.error()));
-        ca = *r;
-    }
-
-    Tensor cb = b;
-    if (!b.is_contiguous()) {
-        auto r = b.contiguous();
-        if (!r)
-            return std::unexpected(std::move(r.error()));
-        cb = *r;
-    }
+    // ── 操作数视图：转置 / 切片视图由 pack 按步长直接读取，不再整体连续化 ──────
+    auto va = gemm_view(a);
+    if (!va)
+        return std::unexpected(std::move(va.error()));
+    auto vb = gemm_view(b);
+    if (!vb)
+        return std::unexpected(std::move(vb.error()));
 
     // ── 调用 CPU 内核 ─────────────────────────────────────────────────────────
     // 这里继续下沉到运行期 ISA 分派；F32/F64/I32 走 GEMM driver，I64 走模板核，
-    // I8 则提升到 I32 输出。
-    dispatch_matmul_cpu(M, K, N, dt, out_dt, ca.data_ptr(), cb.data_ptr(), out->data_ptr());
+    // I8 则提升到 I32 输出，F16 / BF16 在 pack 时展开为 F32。
+    dispatch_matmul_cpu(M, K, N, dt, out_dt, *va, *vb, out->scoped_data_ptr());
+
+    return narrow(*out);
+}
+
+auto bmm(const Tensor& a, const Tensor& b) -> Result<Tensor>
+{
+    if (!a.defined() || !b.defined())
+        return std::unexpected(make_error("bmm: 输入 Tensor 未定义", Severity::Recoverable));
+    if (a.ndim() != 3 || b.ndim() != 3)
+        return std::unexpected(make_error(std::format("bmm: 要求 3D × 3D，当前 ndim={} / {}", a.ndim(), b.ndim()), Severity::Recoverable));
+    if (a.shape()[0] != b.shape()[0])
+        return std::unexpected(make_error(std::format("bmm: batch 大小不一致（{} vs {}）", a.shape()[0], b.shape()[0]), Severity::Recoverable));
+    return matmul(a, b);
+}
+
+auto pack_matrix(const Tensor& b) -> Result<PackedMatrix>
+{
+    if (!b.defined())
+        return std::unexpected(make_error("pack_matrix: 输入 Tensor 未定义", Severity::Recoverable));
+    if (b.device() != Device::CPU)
+        return std::unexpected(make_error("pack_matrix: 仅支持 CPU 张量", Severity::Recoverable));
+    if (b.ndim() != 2)
+        return std::unexpected(make_error(std::format("pack_matrix: b 必须是 2D 张量，当前 ndim={}", b.ndim()), Severity::Recoverable));
+
+    const DType dt = b.dtype();
+    if (dt != DType::F32 && dt != DType::F64 && dt != DType::I32 && dt != DType::I64 && dt != DType::I8)
+        return std::unexpected(make_error(std::format("pack_matrix: 不支持 DType::{}", enum_to_name(dt)), Severity::Recoverable));
+
+    const int64_t K = b.shape()[0];
+    const int64_t N = b.shape()[1];
+
+    // 元素数由当前 ISA 的布局决定（列条带补零到 NR）
+    const int64_t elems = packed_elems(dt, K, N);
+    auto          data  = Tensor::empty({elems}, dt);
+    if (!data)
+        return std::unexpected(std::move(data.error()));
+
+    // pack 按步长直接读取 b（转置 / 切片视图无需先连续化）
+    if (K * N > 0)
+        BEE_RT_DISPATCH_STMT(pk_pack_b, dt, K, N, b.const_data_ptr(), b.strides()[0], b.strides()[1], data->scoped_data_ptr());
+
+    PackedMatrix pm;
+    pm.data_  = *data;
+    pm.rows_  = K;
+    pm.cols_  = N;
+    pm.dtype_ = dt;
+    pm.isa_   = simd::current_isa();
+    return pm;
+}
 
+auto gemm_blocking_info(DType dt) -> GemmBlockingInfo
+{
+    GemmBlockingInfo info;
+    const auto       caches = simd::detect_cache_sizes();
+    info.l1d                = static_cast<int64_t>(caches.l1d);
+    info.l2                 = static_cast<int64_t>(caches.l2);
+    info.l3                 = static_cast<int64_t>(caches.l3);
+    BEE_RT_DISPATCH_STMT(mm_blocking, dt, info.mc, info.kc, info.nc);
+    return info;
+}
+
+auto matmul(const Tensor& a, const PackedMatrix& b) -> Result<Tensor>
+{
+    if (!a.defined() || !b.defined())
+        return std::unexpected(make_error("matmul: 输入 Tensor 未定义", Severity::Recoverable));
+    if (a.device() != Device::CPU)
+        return std::unexpected(make_error("matmul: 预打包 B 仅支持 CPU 输入", Severity::Recoverable));
+    if (b.isa() != simd::current_isa())
+        return std::unexpected(make_error(
+            std::format("matmul: PackedMatrix 打包于 {}，与当前 ISA {} 不一致", simd::isa_name(b.isa()), simd::isa_name(simd::current_isa())),
+            Severity::Recoverable
+        ));
+    if (a.dtype() != b.dtype())
+        return std::unexpected(
+            make_error(std::format("matmul: dtype 不匹配（{} vs {}）", enum_to_name(a.dtype()), enum_to_name(b.dtype())), Severity::Recoverable)
+        );
+    if (a.ndim() < 2)
+        return std::unexpected(make_error(std::format("matmul: a 至少需要 2 维，当前 ndim={}", a.ndim()), Severity::Recoverable));
+
+    const int64_t K  = b.rows();
+    const int64_t N  = b.cols();
+    const int64_t Ka = a.shape()[static_cast<std::size_t>(a.ndim() - 1)];
+    if (Ka != K)
+        return std::unexpected(make_error(std::format("matmul: 内维不匹配（a 列={}, b 行={}）", Ka, K), Severity::Recoverable));
+
+    // 前导维折叠进 M
+    Shape out_shape  = a.shape();
+    out_shape.back() = N;
+    const int64_t M  = numel(Shape(a.shape().begin(), a.shape().end() - 1));
+
+    const DType out_dt = (a.dtype() == DType::I8) ? DType::I32 : a.dtype();
+    auto        out    = Tensor::zeros(out_shape, out_dt);
+    if (!out)
+        return std::unexpected(std::move(out.error()));
+    if (M == 0 || N == 0 || K == 0)
+        return *out;
+
+    auto va = gemm_view(a);
+    if (!va)
+        return std::unexpected(std::move(va.error()));
+
+    BEE_RT_DISPATCH_STMT(pk_mm, a.dtype(), M, K, N, va->t.const_data_ptr(), va->rs, va->cs, b.data_.const_data_ptr(), out->scoped_data_ptr());
     return *out;
 }
 
+auto linear(const Tensor& x, const Tensor& w, const Tensor& bias, Activation act, const Tensor& residual) -> Result<Tensor>
+{
+    if (!w.defined())
+        return std::unexpected(make_error("linear: 权重 Tensor 未定义", Severity::Recoverable));
+    if (w.device() != Device::CPU)
+        return std::unexpected(make_error("linear: 仅支持 CPU 张量", Severity::Recoverable));
+    if (w.ndim() != 2)
+        return std::unexpected(make_error(std::format("linear: 权重必须是 2D 张量，当前 ndim={}", w.ndim()), Severity::Recoverable));
+
+    // 权重可为转置视图（如 {N,K} 权重的 transpose(0, 1)），由 pack 按步长读取
+    return linear_impl(x, w.dtype(), w.shape()[0], w.shape()[1], w.const_data_ptr(), w.strides()[0], w.strides()[1], false, bias, act, residual);
+}
+
+auto linear(const Tensor& x, const PackedMatrix& w, const Tensor& bias, Activation act, const Tensor& residual) -> Result<Tensor>
+{
+    if (!w.defined())
+        return std::unexpected(make_error("linear: 权重 PackedMatrix 未定义", Severity::Recoverable));
+    if (w.isa() != simd::current_isa())
+        return std::unexpected(make_error(
+            std::format("linear: PackedMatrix 打包于 {}，与当前 ISA {} 不一致", simd::isa_name(w.isa()), simd::isa_name(simd::current_isa())),
+            Severity::Recoverable
+        ));
+    return linear_impl(x, w.dtype(), w.rows(), w.cols(), w.data_.const_data_ptr(), w.cols(), 1, true, bias, act, residual);
+}
+
+auto gemm(const Tensor& a, const Tensor& b, Tensor& c, const GemmOptions& opts) -> Result<void>
+{
+    if (!a.defined() || !b.defined() || !c.defined())
+        return std::unexpected(make_error("gemm: 输入 Tensor 未定义", Severity::Recoverable));
+    if (a.device() != Device::CPU || b.device() != Device::CPU || c.device() != Device::CPU)
+        return std::unexpected(make_error("gemm: 仅支持 CPU 张量", Severity::Recoverable));
+    if (a.dtype() != b.dtype() || a.dtype() != c.dtype())
+        return std::unexpected(make_error(
+            std::format("gemm: dtype 不匹配（{} / {} / {}）", enum_to_name(a.dtype()), enum_to_name(b.dtype()), enum_to_name(c.dtype())),
+            Severity::Recoverable
+        ));
+    if (a.ndim() != 2 || b.ndim() != 2 || c.ndim() != 2)
+        return std::unexpected(make_error("gemm: a / b / c 均须为 2D 张量", Severity::Recoverable));
+
+    const int64_t M = a.shape()[0];
+    const int64_t K = a.shape()[1];
+    const int64_t N = b.shape()[1];
+    if (b.shape()[0] != K || c.shape()[0] != M || c.shape()[1] != N)
+        return std::unexpected(make_error(
+            std::format("gemm: shape 不匹配（a={{{},{}}}, b={{{},{}}}, c={{{},{}}}）", M, K, b.shape()[0], N, c.shape()[0], c.shape()[1]),
+            Severity::Recoverable
+        ));
+    if (!c.is_contiguous())
+        return std::unexpected(make_error("gemm: c 必须是连续张量（就地写回）", Severity::Recoverable));
+
+    auto ep = prepare_epilogue("gemm", a.dtype(), N, c.shape(), opts.bias, opts.residual);
+    if (!ep)
+        return std::unexpected(std::move(ep.error()));
+    if (M == 0 || N == 0)
+        return {};
+    // c 就地写回：写时复制共享中的 c 先物化，避免改到 clone 来源
+    if (auto r = c.materialize(); !r)
+        return r;
+    // 物化后再判别别名：c 在读取 a / b 之前就被 beta·C 改写，a / b 与 c 重叠时拒绝
+    if (memory_overlaps(a, c) || memory_overlaps(b, c))
+        return std::unexpected(make_error("gemm: a / b 与 c 的存储重叠（c 会在读取输入前被改写）", Severity::Recoverable));
+    auto bias = detach_from(ep->first, c);
+    if (!bias)
+        return std::unexpected(std::move(bias.error()));
+    auto residual = detach_from(ep->second, c);
+    if (!residual)
+        return std::unexpected(std::move(residual.error()));
+
+    cpu::FusedGemmArgs args;
+    args.alpha    = opts.alpha;
+    args.beta     = opts.beta;
+    args.bias     = bias->defined() ? bias->const_data_ptr() : nullptr;
+    args.residual = residual->defined() ? residual->const_data_ptr() : nullptr;
+    args.act      = to_gemm_act(opts.act);
+    // a / b 按步长直接读取（转置 / 切片视图无需先连续化）
+    const auto& sa = a.strides();
+    const auto& sb = b.strides();
+    BEE_RT_DISPATCH_STMT(
+        mm_fused, a.dtype(), M, K, N, a.const_data_ptr(), sa[0], sa[1], b.const_data_ptr(), sb[0], sb[1], false, c.scoped_data_ptr(), args
+    );
+    return {};
+}
+
 } // namespace bee
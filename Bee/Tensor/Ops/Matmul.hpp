@@ -1,17 +1,111 @@
 #pragma once
 
-// matmul 自由函数声明：仅支持 2D × 2D，输出连续张量
+// matmul / bmm 自由函数声明：2D × 2D 与带 batch 广播的 ≥3D 矩阵乘，输出连续张量
+// 另提供预打包权重 PackedMatrix：重复使用同一 B 时跳过每次调用的 B packing
+// 以及融合 epilogue 的 gemm / linear：bias、激活、residual 在 GEMM 写回时一并完成
 
 #include "Base/Diagnostics/Error.hpp"
 #include "Tensor/Core/Tensor.hpp"
+#include "SIMD/Detect.hpp"
 
 namespace bee
 {
 
-// 矩阵乘法：a={M,K}，b={K,N} → 输出 {M,N}
+// 矩阵乘法：a={...,M,K}，b={...,K,N} → 输出 {broadcast(...),M,N}
+// - 两侧至少 2 维；前导 batch 维按 NumPy 规则广播（如 {B,M,K} × {K,N}）；
 // - 两侧 dtype/device 必须相同；
-// - CPU 路径支持 F32/F64/I32/I64，另有 I8×I8→I32 的特化；
+// - CPU 路径支持 F32/F64/I32/I64，另有 I8×I8→I32 的特化；F16/BF16 以 F32 累加、结果收窄回输入 dtype；
 // - CUDA 路径支持 F32/F64/I32/I64，并会在必要时先整理为 contiguous。
 [[nodiscard]] auto matmul(const Tensor& a, const Tensor& b) -> Result<Tensor>;
 
+// 批量矩阵乘法：a={B,M,K}，b={B,K,N} → 输出 {B,M,N}
+// 要求两侧均为 3D 且 batch 相同（不广播）；其余约束同 matmul
+[[nodiscard]] auto bmm(const Tensor& a, const Tensor& b) -> Result<Tensor>;
+
+class PackedMatrix;
+
+// gemm / linear 的融合激活
+enum class Activation : uint8_t
+{
+    None,
+    ReLU,
+    GELU, // erf 精确形式
+    SiLU,
+};
+
+// 融合 GEMM 选项：C = act(alpha·A·B + beta·C + bias) + residual
+struct GemmOptions
+{
+    double     alpha = 1.0;
+    double     beta  = 0.0;
+    Tensor     bias;     // {N}，未定义表示无
+    Activation act = Activation::None;
+    Tensor     residual; // 与 C 同 shape，未定义表示无
+};
+
+// 融合线性层：y = act(x·w + bias) + residual，x={...,K}，w={K,N} → y={...,N}
+// - CPU，F32/F64；bias 为 {N}，residual 与 y 同 shape；
+// - bias / 激活 / residual 在微内核写回 tile 时完成，不再额外遍历输出。
+[[nodiscard]] auto linear(const Tensor& x, const Tensor& w, const Tensor& bias = {}, Activation act = Activation::None, const Tensor& residual = {})
+    -> Result<Tensor>;
+
+// 同上，权重为预打包矩阵（跳过 B packing）
+[[nodiscard]] auto linear(const Tensor& x, const PackedMatrix& w, const Tensor& bias = {}, Activation act = Activation::None, const Tensor& residual = {})
+    -> Result<Tensor>;
+
+// 就地融合 GEMM：a={M,K}，b={K,N}，c={M,N} 为输入输出（CPU、连续、F32/F64，dtype 一致）
+// - a / b 不得与 c 共享内存（返回错误）；bias / residual 可与 c 重叠（如 residual = c），按调用前的 c 值参与计算
+[[nodiscard]] auto gemm(const Tensor& a, const Tensor& b, Tensor& c, const GemmOptions& opts = {}) -> Result<void>;
+
+// 预打包的 B 矩阵（通常是推理中的常量权重）：按打包时 ISA 的 GEMM NR 条带布局存放。
+// 内容不透明，仅能被同 ISA 的 matmul(a, PackedMatrix) 消费；拷贝为浅拷贝（共享存储）。
+class PackedMatrix
+{
+public:
+    PackedMatrix() = default;
+
+    [[nodiscard]] auto defined() const noexcept -> bool { return data_.defined(); }
+
+    [[nodiscard]] auto rows() const noexcept -> int64_t { return rows_; }
+
+    [[nodiscard]] auto cols() const noexcept -> int64_t { return cols_; }
+
+    [[nodiscard]] auto dtype() const noexcept -> DType { return dtype_; }
+
+    [[nodiscard]] auto isa() const noexcept -> simd::Isa { return isa_; }
+
+private:
+    friend auto pack_matrix(const Tensor& b) -> Result<PackedMatrix>;
+    friend auto matmul(const Tensor& a, const PackedMatrix& b) -> Result<Tensor>;
+    friend auto linear(const Tensor& x, const PackedMatrix& w, const Tensor& bias, Activation act, const Tensor& residual) -> Result<Tensor>;
+
+    Tensor    data_;
+    int64_t   rows_  = 0;
+    int64_t   cols_  = 0;
+    DType     dtype_ = DType::F32;
+    simd::Isa isa_   = simd::Isa::Scalar;
+};
+
+// 把 b={K,N} 预打包为当前 ISA 的 GEMM 布局（CPU；F32/F64/I32/I64/I8）
+[[nodiscard]] auto pack_matrix(const Tensor& b) -> Result<PackedMatrix>;
+
+// 使用预打包 B 的矩阵乘法：a={...,M,K} → 输出 {...,M,N}
+// 前导维折叠进 M（B 对所有行共享），整个调用不再 pack B；I8 输入输出 I32
+[[nodiscard]] auto matmul(const Tensor& a, const PackedMatrix& b) -> Result<Tensor>;
+
+// 当前进程 CPU GEMM 使用的 cache 分块参数与探测到的各级 cache 大小（字节）
+// 分块在首次使用时按 L1d / L2 / L3 推导，可用环境变量 BEE_GEMM_MC / BEE_GEMM_KC / BEE_GEMM_NC 覆盖；
+// 标量 ISA 或不走 Goto 路径的 dtype（I64 等）分块项为 0
+struct GemmBlockingInfo
+{
+    int64_t mc  = 0;
+    int64_t kc  = 0;
+    int64_t nc  = 0;
+    int64_t l1d = 0;
+    int64_t l2  = 0;
+    int64_t l3  = 0;
+};
+
+[[nodiscard]] auto gemm_blocking_info(DType dt) -> GemmBlockingInfo;
+
 } // namespace bee
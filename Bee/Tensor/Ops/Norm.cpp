@@ -0,0 +1,96 @@
+#include "Tensor/Ops/Norm.hpp"
+#include "Tensor/Cpu/Dispatch/Dispatch.hpp"
+
+#include <format>
+
+namespace bee
+{
+
+namespace
+{
+
+    // 校验 x 与 normalized_shape，返回被归一化的元素数 N
+    auto check_norm_input(const Tensor& x, const Shape& normalized_shape, std::string_view op) -> Result<int64_t>
+    {
+        if (!x.defined())
+            return std::unexpected(make_error(std::format("{}: 输入 Tensor 未定义", op), Severity::Recoverable));
+        if (x.dtype() != DType::F32 && x.dtype() != DType::F64)
+            return std::unexpected(make_error(std::format("{}: 不支持 DType::{}，仅允许 F32/F64", op, enum_to_name(x.dtype())), Severity::Recoverable));
+        if (x.device() == Device::CUDA)
+            return std::unexpected(make_error(std::format("{}: CUDA 后端暂未实现", op), Severity::Recoverable));
+
+        const auto nd = static_cast<int64_t>(normalized_shape.size());
+        if (nd == 0 || nd > x.ndim())
+            return std::unexpected(
+                make_error(std::format("{}: normalized_shape 维数 {} 非法（输入 ndim={}）", op, nd, x.ndim()), Severity::Recoverable)
+            );
+        for (int64_t i = 0; i < nd; ++i) {
+            const int64_t xs = x.shape()[static_cast<std::size_t>(x.ndim() - nd + i)];
+            if (xs != normalized_shape[static_cast<std::size_t>(i)])
+                return std::unexpected(make_error(std::format("{}: normalized_shape 与输入末尾维度不匹配", op), Severity::Recoverable));
+        }
+        return numel(normalized_shape);
+    }
+
+    // 校验可选的仿射参数，返回其连续版本（未定义时原样返回）
+    auto prepare_affine(const Tensor& p, const Tensor& x, const Shape& normalized_shape, std::string_view op, std::string_view name) -> Result<Tensor>
+    {
+        if (!p.defined())
+            return p;
+        if (p.dtype() != x.dtype() || p.device() != x.device())
+            return std::unexpected(make_error(std::format("{}: {} 的 dtype/device 与输入不一致", op, name), Severity::Recoverable));
+        if (p.shape() != normalized_shape)
+            return std::unexpected(make_error(std::format("{}: {} 的形状必须等于 normalized_shape", op, name), Severity::Recoverable));
+        return p.contiguous();
+    }
+
+} // namespace
+
+auto layer_norm(const Tensor& x, const Shape& normalized_shape, const Tensor& weight, const Tensor& bias, double eps) -> Result<Tensor>
+{
+    auto n_r = check_norm_input(x, normalized_shape, "layer_norm");
+    if (!n_r)
+        return std::unexpected(std::move(n_r.error()));
+    auto w = prepare_affine(weight, x, normalized_shape, "layer_norm", "weight");
+    if (!w)
+        return std::unexpected(std::move(w.error()));
+    auto b = prepare_affine(bias, x, normalized_shape, "layer_norm", "bias");
+    if (!b)
+        return std::unexpected(std::move(b.error()));
+
+    auto in = x.contiguous();
+    if (!in)
+        return std::unexpected(std::move(in.error()));
+    auto out = Tensor::empty(x.shape(), x.dtype(), x.device());
+    if (!out)
+        return std::unexpected(std::move(out.error()));
+    if (out->numel() == 0)
+        return *out;
+
+    BEE_RT_DISPATCH_STMT(nm_layer_norm, *in, *n_r, *w, *b, eps, *out);
+    return *out;
+}
+
+auto rms_norm(const Tensor& x, const Shape& normalized_shape, const Tensor& weight, double eps) -> Result<Tensor>
+{
+    auto n_r = check_norm_input(x, normalized_shape, "rms_norm");
+    if (!n_r)
+        return std::unexpected(std::move(n_r.error()));
+    auto w = prepare_affine(weight, x, normalized_shape, "rms_norm", "weight");
+    if (!w)
+        return std::unexpected(std::move(w.error()));
+
+    auto in = x.contiguous();
+    if (!in)
+        return std::unexpected(std::move(in.error()));
+    auto out = Tensor::empty(x.shape(), x.dtype(), x.device());
+    if (!out)
+        return std::unexpected(std::move(out.error()));
+    if (out->numel() == 0)
+        return *out;
+
+    BEE_RT_DISPATCH_STMT(nm_rms_norm, *in, *n_r, *w, eps, *out);
+    return *out;
+}
+
+} // namespace bee
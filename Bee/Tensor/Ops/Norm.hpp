@@ -0,0 +1,23 @@
+#pragma once
+
+// 归一化算子自由函数声明：layer_norm / rms_norm
+//   - 在 x 的末尾若干维（normalized_shape）上逐行归一化；
+//   - weight / bias 可选（未定义即跳过），形状须等于 normalized_shape、dtype 与 x 一致；
+//   - 统计量与仿射变换在同一内核内完成，不产生中间张量。
+//
+// dtype 支持：F32/F64（其余 → Err）；当前仅 CPU。
+
+#include "Base/Diagnostics/Error.hpp"
+#include "Tensor/Core/Tensor.hpp"
+
+namespace bee
+{
+
+// y = (x - mean) / sqrt(var + eps) * weight + bias；var 为总体方差（correction = 0）
+[[nodiscard]] auto layer_norm(const Tensor& x, const Shape& normalized_shape, const Tensor& weight = {}, const Tensor& bias = {}, double eps = 1e-5)
+    -> Result<Tensor>;
+
+// y = x / sqrt(mean(x^2) + eps) * weight
+[[nodiscard]] auto rms_norm(const Tensor& x, const Shape& normalized_shape, const Tensor& weight = {}, double eps = 1e-6) -> Result<Tensor>;
+
+} // namespace bee
@@ -0,0 +1,427 @@
+#include "Tensor/Ops/Quantize.hpp"
+#include "Tensor/Ops/Cast.hpp"
+#include "Tensor/Cpu/Dispatch/Dispatch.hpp"
+#include "Tensor/Core/DType.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <utility>
+#include <vector>
+
+namespace bee
+{
+
+namespace
+{
+
+    auto quant_range(DType dt) -> std::pair<int64_t, int64_t>
+    {
+        return dt == DType::U8 ? std::pair<int64_t, int64_t>{0, 255} : std::pair<int64_t, int64_t>{-128, 127};
+    }
+
+    auto check_qdtype(const char* op, DType dt) -> Result<void>
+    {
+        if (dt != DType::U8 && dt != DType::I8)
+            return std::unexpected(make_error(std::format("{}: 量化 dtype 须为 U8 或 I8，当前 {}", op, enum_to_name(dt)), Severity::Recoverable));
+        return {};
+    }
+
+    auto check_scale(const char* op, double scale) -> Result<void>
+    {
+        if (!(scale > 0.0) || !std::isfinite(scale) || !std::isfinite(1.0 / static_cast<float>(scale)))
+            return std::unexpected(make_error(std::format("{}: scale 须为正有限值，当前 {}", op, scale), Severity::Recoverable));
+        return {};
+    }
+
+    auto check_zero_point(const char* op, DType dt, int64_t zp) -> Result<void>
+    {
+        const auto [lo, hi] = quant_range(dt);
+        if (zp < lo || zp > hi)
+            return std::unexpected(make_error(
+                std::format("{}: zero_point={} 超出 {} 值域 [{}, {}]", op, zp, enum_to_name(dt), lo, hi), Severity::Recoverable
+            ));
+        return {};
+    }
+
+    auto check_input(const char* op, const Tensor& t) -> Result<void>
+    {
+        if (!t.defined())
+            return std::unexpected(make_error(std::format("{}: 输入 Tensor 未定义", op), Severity::Recoverable));
+        if (t.device() != Device::CPU)
+            return std::unexpected(make_error(std::format("{}: 仅支持 CPU 张量", op), Severity::Recoverable));
+        return {};
+    }
+
+    // 浮点输入整理为连续 F32（F32 连续时零拷贝）
+    auto as_f32(const char* op, const Tensor& x) -> Result<Tensor>
+    {
+        if (x.dtype() == DType::F32)
+            return x.contiguous();
+        if (x.dtype() != DType::F64)
+            return std::unexpected(make_error(std::format("{}: 输入须为 F32 / F64，当前 {}", op, enum_to_name(x.dtype())), Severity::Recoverable));
+        return cast(x, DType::F32);
+    }
+
+    // 通道参数：scales / zero_points 读为 C 个 float / int32 并校验
+    struct ChannelParams
+    {
+        std::vector<float>   scales;
+        std::vector<int32_t> zero_points;
+    };
+
+    auto channel_params(const char* op, const Tensor& scales, const Tensor& zero_points, int64_t C, DType qdt) -> Result<ChannelParams>
+    {
+        if (!scales.defined() || scales.device() != Device::CPU || scales.numel() != C)
+            return std::unexpected(make_error(std::format("{}: scales 须为 {{{}}} 的 CPU 张量", op, C), Severity::Recoverable));
+        if (scales.dtype() != DType::F32 && scales.dtype() != DType::F64)
+            return std::unexpected(make_error(std::format("{}: scales 须为浮点张量，当前 {}", op, enum_to_name(scales.dtype())), Severity::Recoverable));
+
+        auto s = scales.dtype() == DType::F32 ? scales.contiguous() : cast(scales, DType::F32);
+        if (!s)
+            return std::unexpected(std::move(s.error()));
+        ChannelParams p;
+        const auto*   sp = static_cast<const float*>(s->const_data_ptr());
+        p.scales.assign(sp, sp + C);
+        for (const float v : p.scales)
+            if (auto ok = check_scale(op, v); !ok)
+                return std::unexpected(std::move(ok.error()));
+
+        p.zero_points.assign(static_cast<std::size_t>(C), 0);
+        if (!zero_points.defined())
+            return p;
+        if (zero_points.device() != Device::CPU || zero_points.numel() != C)
+            return std::unexpected(make_error(std::format("{}: zero_points 须为 {{{}}} 的 CPU 张量", op, C), Severity::Recoverable));
+        const DType zdt = zero_points.dtype();
+        if (zdt != DType::U8 && zdt != DType::I8 && zdt != DType::I32 && zdt != DType::I64)
+            return std::unexpected(make_error(std::format("{}: zero_points 须为整型张量，当前 {}", op, enum_to_name(zdt)), Severity::Recoverable));
+
+        auto z = cast(zero_points, DType::I64);
+        if (!z)
+            return std::unexpected(std::move(z.error()));
+        const auto* zp = static_cast<const int64_t*>(z->const_data_ptr());
+        for (int64_t c = 0; c < C; ++c) {
+            if (auto ok = check_zero_point(op, qdt, zp[c]); !ok)
+                return std::unexpected(std::move(ok.error()));
+            p.zero_points[static_cast<std::size_t>(c)] = static_cast<int32_t>(zp[c]);
+        }
+        return p;
+    }
+
+    // 把 shape 沿 axis 拆成 [outer, C, inner]
+    struct AxisSplit
+    {
+        int64_t outer = 1;
+        int64_t C     = 1;
+        int64_t inner = 1;
+    };
+
+    auto split_axis(const char* op, const Shape& shape, int64_t axis) -> Result<AxisSplit>
+    {
+        const auto nd = static_cast<int64_t>(shape.size());
+        if (axis < 0)
+            axis += nd;
+        if (axis < 0 || axis >= nd)
+            return std::unexpected(make_error(std::format("{}: axis 越界（ndim={}）", op, nd), Severity::Recoverable));
+        AxisSplit s;
+        for (int64_t d = 0; d < nd; ++d) {
+            const int64_t n = shape[static_cast<std::size_t>(d)];
+            if (d < axis)
+                s.outer *= n;
+            else if (d == axis)
+                s.C = n;
+            else
+                s.inner *= n;
+        }
+        return s;
+    }
+
+    auto quantize_impl(const char* op, const Tensor& x, DType dtype, const AxisSplit& sp, const float* scales, const int32_t* zero_points)
+        -> Result<Tensor>
+    {
+        auto xf = as_f32(op, x);
+        if (!xf)
+            return std::unexpected(std::move(xf.error()));
+        auto out = Tensor::empty(x.shape(), dtype);
+        if (!out)
+            return std::unexpected(std::move(out.error()));
+        if (x.numel() > 0)
+            BEE_RT_DISPATCH_STMT(
+                qt_quantize,
+                static_cast<const float*>(xf->const_data_ptr()),
+                dtype,
+                out->scoped_data_ptr(),
+                sp.outer,
+                sp.C,
+                sp.inner,
+                scales,
+                zero_points
+            );
+        return *out;
+    }
+
+    auto dequantize_impl(const Tensor& q, const AxisSplit& sp, const float* scales, const int32_t* zero_points) -> Result<Tensor>
+    {
+        auto qc = q.contiguous();
+        if (!qc)
+            return std::unexpected(std::move(qc.error()));
+        auto out = Tensor::empty(q.shape(), DType::F32);
+        if (!out)
+            return std::unexpected(std::move(out.error()));
+        if (q.numel() > 0)
+            BEE_RT_DISPATCH_STMT(
+                qt_dequantize,
+                qc->const_data_ptr(),
+                q.dtype(),
+                static_cast<float*>(out->scoped_data_ptr()),
+                sp.outer,
+                sp.C,
+                sp.inner,
+                scales,
+                zero_points
+            );
+        return *out;
+    }
+
+    // 当前 ISA 下 pack_qmatrix 的存储字节数
+    auto packed_bytes(int64_t K, int64_t N) -> int64_t
+    {
+        BEE_RT_DISPATCH(qmm_packed_bytes, K, N);
+    }
+
+    // w_scales 读为连续 F32 {1} 或 {N}
+    auto weight_scales(const char* op, const Tensor& w_scales, int64_t N) -> Result<Tensor>
+    {
+        if (!w_scales.defined() || w_scales.device() != Device::CPU || (w_scales.numel() != 1 && w_scales.numel() != N))
+            return std::unexpected(make_error(std::format("{}: w_scales 须为 {{1}} 或 {{{}}} 的 CPU 张量", op, N), Severity::Recoverable));
+        if (w_scales.dtype() != DType::F32 && w_scales.dtype() != DType::F64)
+            return std::unexpected(
+                make_error(std::format("{}: w_scales 须为浮点张量，当前 {}", op, enum_to_name(w_scales.dtype())), Severity::Recoverable)
+            );
+        auto s = w_scales.dtype() == DType::F32 ? w_scales.contiguous() : cast(w_scales, DType::F32);
+        if (!s)
+            return std::unexpected(std::move(s.error()));
+        auto flat = s->reshape({w_scales.numel()});
+        if (!flat)
+            return std::unexpected(std::move(flat.error()));
+        const auto* p = static_cast<const float*>(flat->const_data_ptr());
+        for (int64_t j = 0; j < flat->numel(); ++j)
+            if (auto ok = check_scale(op, p[j]); !ok)
+                return std::unexpected(std::move(ok.error()));
+        return *flat;
+    }
+
+} // namespace
+
+auto quantize_per_tensor(const Tensor& x, QuantParams qp, DType dtype) -> Result<Tensor>
+{
+    constexpr const char* op = "quantize_per_tensor";
+    if (auto ok = check_input(op, x); !ok)
+        return std::unexpected(std::move(ok.error()));
+    if (auto ok = check_qdtype(op, dtype); !ok)
+        return std::unexpected(std::move(ok.error()));
+    if (auto ok = check_scale(op, qp.scale); !ok)
+        return std::unexpected(std::move(ok.error()));
+    if (auto ok = check_zero_point(op, dtype, qp.zero_point); !ok)
+        return std::unexpected(std::move(ok.error()));
+
+    const float   scale = static_cast<float>(qp.scale);
+    const int32_t zp    = static_cast<int32_t>(qp.zero_point);
+    return quantize_impl(op, x, dtype, AxisSplit{1, 1, x.numel()}, &scale, &zp);
+}
+
+auto quantize_per_channel(const Tensor& x, const Tensor& scales, const Tensor& zero_points, int64_t axis, DType dtype) -> Result<Tensor>
+{
+    constexpr const char* op = "quantize_per_channel";
+    if (auto ok = check_input(op, x); !ok)
+        return std::unexpected(std::move(ok.error()));
+    if (auto ok = check_qdtype(op, dtype); !ok)
+        return std::unexpected(std::move(ok.error()));
+    auto sp = split_axis(op, x.shape(), axis);
+    if (!sp)
+        return std::unexpected(std::move(sp.error()));
+    auto params = channel_params(op, scales, zero_points, sp->C, dtype);
+    if (!params)
+        return std::unexpected(std::move(params.error()));
+    return quantize_impl(op, x, dtype, *sp, params->scales.data(), params->zero_points.data());
+}
+
+auto dequantize_per_tensor(const Tensor& q, QuantParams qp) -> Result<Tensor>
+{
+    constexpr const char* op = "dequantize_per_tensor";
+    if (auto ok = check_input(op, q); !ok)
+        return std::unexpected(std::move(ok.error()));
+    if (auto ok = check_qdtype(op, q.dtype()); !ok)
+        return std::unexpected(std::move(ok.error()));
+    if (auto ok = check_scale(op, qp.scale); !ok)
+        return std::unexpected(std::move(ok.error()));
+    if (auto ok = check_zero_point(op, q.dtype(), qp.zero_point); !ok)
+        return std::unexpected(std::move(ok.error()));
+
+    const float   scale = static_cast<float>(qp.scale);
+    const int32_t zp    = static_cast<int32_t>(qp.zero_point);
+    return dequantize_impl(q, AxisSplit{1, 1, q.numel()}, &scale, &zp);
+}
+
+auto dequantize_per_channel(const Tensor& q, const Tensor& scales, const Tensor& zero_points, int64_t axis) -> Result<Tensor>
+{
+    constexpr const char* op = "dequantize_per_channel";
+    if (auto ok = check_input(op, q); !ok)
+        return std::unexpected(std::move(ok.error()));
+    if (auto ok = check_qdtype(op, q.dtype()); !ok)
+        return std::unexpected(std::move(ok.error()));
+    auto sp = split_axis(op, q.shape(), axis);
+    if (!sp)
+        return std::unexpected(std::move(sp.error()));
+    auto params = channel_params(op, scales, zero_points, sp->C, q.dtype());
+    if (!params)
+        return std::unexpected(std::move(params.error()));
+    return dequantize_impl(q, *sp, params->scales.data(), params->zero_points.data());
+}
+
+auto pack_qmatrix(const Tensor& w, const Tensor& w_scales) -> Result<PackedQMatrix>
+{
+    constexpr const char* op = "pack_qmatrix";
+    if (auto ok = check_input(op, w); !ok)
+        return std::unexpected(std::move(ok.error()));
+    if (w.dtype() != DType::I8)
+        return std::unexpected(make_error(std::format("{}: 权重须为 I8，当前 {}", op, enum_to_name(w.dtype())), Severity::Recoverable));
+    if (w.ndim() != 2)
+        return std::unexpected(make_error(std::format("{}: 权重必须是 2D 张量，当前 ndim={}", op, w.ndim()), Severity::Recoverable));
+
+    const int64_t K = w.shape()[0];
+    const int64_t N = w.shape()[1];
+    if (K > qmm_max_k)
+        return std::unexpected(make_error(std::format("{}: K={} 超过上限 {}（i32 累加会溢出）", op, K, qmm_max_k), Severity::Recoverable));
+    auto scales = weight_scales(op, w_scales, N);
+    if (!scales)
+        return std::unexpected(std::move(scales.error()));
+
+    // 字节数由当前 ISA 的布局决定（列条带补零到 NR，另含列和与饱和标记）
+    const int64_t bytes = packed_bytes(K, N);
+    auto          data  = Tensor::empty({bytes}, DType::U8);
+    if (!data)
+        return std::unexpected(std::move(data.error()));
+
+    // pack 按步长直接读取 w，并预先计算列和（zero point 补偿）与 per-panel 饱和标记
+    if (bytes > 0)
+        BEE_RT_DISPATCH_STMT(
+            qmm_pack_b, K, N, static_cast<const int8_t*>(w.const_data_ptr()), w.strides()[0], w.strides()[1], data->scoped_data_ptr()
+        );
+
+    PackedQMatrix pm;
+    pm.data_   = *data;
+    pm.scales_ = *scales;
+    pm.rows_   = K;
+    pm.cols_   = N;
+    pm.isa_    = simd::current_isa();
+    return pm;
+}
+
+auto quantized_matmul(const Tensor& a, QuantParams a_qp, const PackedQMatrix& w, const Tensor& bias, DType out_dtype, QuantParams out_qp)
+    -> Result<Tensor>
+{
+    constexpr const char* op = "quantized_matmul";
+    if (!w.defined())
+        return std::unexpected(make_error(std::format("{}: 权重 PackedQMatrix 未定义", op), Severity::Recoverable));
+    if (w.isa() != simd::current_isa())
+        return std::unexpected(make_error(
+            std::format("{}: PackedQMatrix 打包于 {}，与当前 ISA {} 不一致", op, simd::isa_name(w.isa()), simd::isa_name(simd::current_isa())),
+            Severity::Recoverable
+        ));
+    if (auto ok = check_input(op, a); !ok)
+        return std::unexpected(std::move(ok.error()));
+    if (a.dtype() != DType::U8)
+        return std::unexpected(make_error(std::format("{}: 激活须为 U8，当前 {}", op, enum_to_name(a.dtype())), Severity::Recoverable));
+    if (a.ndim() < 1)
+        return std::unexpected(make_error(std::format("{}: 激活至少需要 1 维", op), Severity::Recoverable));
+    if (auto ok = check_scale(op, a_qp.scale); !ok)
+        return std::unexpected(std::move(ok.error()));
+    if (auto ok = check_zero_point(op, DType::U8, a_qp.zero_point); !ok)
+        return std::unexpected(std::move(ok.error()));
+    if (out_dtype != DType::F32) {
+        if (auto ok = check_qdtype(op, out_dtype); !ok)
+            return std::unexpected(make_error(std::format("{}: 输出 dtype 须为 F32 / U8 / I8", op), Severity::Recoverable));
+        if (auto ok = check_scale(op, out_qp.scale); !ok)
+            return std::unexpected(std::move(ok.error()));
+        if (auto ok = check_zero_point(op, out_dtype, out_qp.zero_point); !ok)
+            return std::unexpected(std::move(ok.error()));
+    }
+
+    const int64_t K  = w.rows();
+    const int64_t N  = w.cols();
+    const int64_t Ka = a.shape().back();
+    if (Ka != K)
+        return std::unexpected(make_error(std::format("{}: 内维不匹配（a 列={}, w 行={}）", op, Ka, K), Severity::Recoverable));
+
+    Tensor bias_f;
+    if (bias.defined()) {
+        if (bias.device() != Device::CPU || bias.numel() != N || (bias.dtype() != DType::F32 && bias.dtype() != DType::F64))
+            return std::unexpected(make_error(std::format("{}: bias 须为 {{{}}} 的 CPU 浮点张量", op, N), Severity::Recoverable));
+        auto b = as_f32(op, bias);
+        if (!b)
+            return std::unexpected(std::move(b.error()));
+        bias_f = *b;
+    }
+
+    // 前导维折叠进 M
+    Shape out_shape  = a.shape();
+    out_shape.back() = N;
+    const int64_t M  = numel(Shape(a.shape().begin(), a.shape().end() - 1));
+
+    auto out = Tensor::empty(out_shape, out_dtype);
+    if (!out)
+        return std::unexpected(std::move(out.error()));
+    if (M == 0 || N == 0)
+        return *out;
+
+    // 2D 激活按步长直接读取；更高维且不连续时先连续化
+    Tensor  av  = a;
+    int64_t rsa = K;
+    int64_t csa = 1;
+    if (a.ndim() == 2) {
+        rsa = a.strides()[0];
+        csa = a.strides()[1];
+    } else if (!a.is_contiguous()) {
+        auto c = a.contiguous();
+        if (!c)
+            return std::unexpected(std::move(c.error()));
+        av = *c;
+    }
+
+    cpu::gemm::QGemmEpilogue ep;
+    ep.a_scale        = static_cast<float>(a_qp.scale);
+    ep.a_zero_point   = static_cast<int32_t>(a_qp.zero_point);
+    ep.b_scale        = static_cast<const float*>(w.scales_.const_data_ptr());
+    ep.b_scale_stride = w.scales_.numel() > 1 ? 1 : 0;
+    ep.bias           = bias_f.defined() ? static_cast<const float*>(bias_f.const_data_ptr()) : nullptr;
+    if (out_dtype != DType::F32) {
+        ep.out            = out_dtype == DType::U8 ? cpu::gemm::QGemmOut::U8 : cpu::gemm::QGemmOut::S8;
+        ep.out_scale      = static_cast<float>(out_qp.scale);
+        ep.out_zero_point = static_cast<int32_t>(out_qp.zero_point);
+    }
+
+    BEE_RT_DISPATCH_STMT(
+        qmm_u8s8, M, K, N, static_cast<const uint8_t*>(av.const_data_ptr()), rsa, csa, w.data_.const_data_ptr(), ep, out->scoped_data_ptr()
+    );
+    return *out;
+}
+
+auto quantized_matmul(
+    const Tensor& a,
+    QuantParams   a_qp,
+    const Tensor& w,
+    const Tensor& w_scales,
+    const Tensor& bias,
+    DType         out_dtype,
+    QuantParams   out_qp
+) -> Result<Tensor>
+{
+    auto packed = pack_qmatrix(w, w_scales);
+    if (!packed)
+        return std::unexpected(std::move(packed.error()));
+    return quantized_matmul(a, a_qp, *packed, bias, out_dtype, out_qp);
+}
+
+} // namespace bee
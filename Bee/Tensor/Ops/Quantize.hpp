@@ -0,0 +1,91 @@
+#pragma once
+
+// 仿射量化自由函数声明：real = (q - zero_point) · scale
+// - quantize / dequantize：F32 ↔ U8 / I8，per-tensor 或沿某一轴 per-channel；
+// - quantized_matmul：u8 激活 × s8 权重，i32 累加，scale / bias / 再量化在 GEMM 写回时于寄存器内完成
+
+#include "Base/Diagnostics/Error.hpp"
+#include "Tensor/Core/Tensor.hpp"
+#include "SIMD/Detect.hpp"
+
+namespace bee
+{
+
+// per-tensor 量化参数
+struct QuantParams
+{
+    double  scale      = 1.0;
+    int64_t zero_point = 0;
+};
+
+// per-tensor 量化：x 为浮点（非 F32 先转换为 F32），dtype 为 U8 或 I8 → 同 shape 的连续张量
+// q = clamp(round_half_even(x · (1 / scale) + zero_point))；scale 须为正有限值，zero_point 须落在 dtype 值域内
+[[nodiscard]] auto quantize_per_tensor(const Tensor& x, QuantParams qp, DType dtype) -> Result<Tensor>;
+
+// per-channel 量化：沿 axis（可为负）的第 c 个切片使用 scales[c] / zero_points[c]
+// scales 为 {C} 浮点张量，zero_points 为 {C} 整型张量（未定义表示全 0），C == x.shape()[axis]
+[[nodiscard]] auto quantize_per_channel(const Tensor& x, const Tensor& scales, const Tensor& zero_points, int64_t axis, DType dtype)
+    -> Result<Tensor>;
+
+// 反量化：q 为 U8 / I8 → F32，x = (q - zero_point) · scale
+[[nodiscard]] auto dequantize_per_tensor(const Tensor& q, QuantParams qp) -> Result<Tensor>;
+
+[[nodiscard]] auto dequantize_per_channel(const Tensor& q, const Tensor& scales, const Tensor& zero_points, int64_t axis) -> Result<Tensor>;
+
+class PackedQMatrix;
+
+// 量化矩阵乘：a={...,K} U8（a_qp 为激活量化参数），w={K,N} I8 对称量化（zero point 为 0）→ 输出 {...,N}
+//   y[i, j] = a_scale · w_scales[j] · Σ_k (a[i, k] - a_zp) · w[k, j] + bias[j]
+// - w_scales 为 {1}（per-tensor）或 {N}（per-output-channel）浮点张量；bias 为 {N} 浮点（未定义表示无）；
+// - out_dtype 为 F32 时直接输出 y；为 U8 / I8 时按 out_qp 再量化（舍入到偶数并饱和）；
+// - CPU；前导维折叠进 M，K 不超过 qmm_max_k（保证 i32 累加不溢出）。
+[[nodiscard]] auto quantized_matmul(
+    const Tensor& a,
+    QuantParams   a_qp,
+    const Tensor& w,
+    const Tensor& w_scales,
+    const Tensor& bias,
+    DType         out_dtype,
+    QuantParams   out_qp = {}
+) -> Result<Tensor>;
+
+// 同上，权重为预打包矩阵（跳过权重 packing 与列和计算）
+[[nodiscard]] auto quantized_matmul(const Tensor& a, QuantParams a_qp, const PackedQMatrix& w, const Tensor& bias, DType out_dtype, QuantParams out_qp = {})
+    -> Result<Tensor>;
+
+// 量化 GEMM 允许的最大 K：255 · 128 · K 不超过 i32 上限
+inline constexpr int64_t qmm_max_k = 65793;
+
+// 预打包的量化权重：按打包时 ISA 的 u8s8 微内核布局存放 s8 权重、列和与 per-panel 饱和标记，并持有 w_scales。
+// 内容不透明，仅能被同 ISA 的 quantized_matmul 消费；拷贝为浅拷贝（共享存储）。
+class PackedQMatrix
+{
+public:
+    PackedQMatrix() = default;
+
+    [[nodiscard]] auto defined() const noexcept -> bool { return data_.defined(); }
+
+    [[nodiscard]] auto rows() const noexcept -> int64_t { return rows_; }
+
+    [[nodiscard]] auto cols() const noexcept -> int64_t { return cols_; }
+
+    [[nodiscard]] auto per_channel() const noexcept -> bool { return scales_.numel() > 1; }
+
+    [[nodiscard]] auto isa() const noexcept -> simd::Isa { return isa_; }
+
+private:
+    friend auto pack_qmatrix(const Tensor& w, const Tensor& w_scales) -> Result<PackedQMatrix>;
+    friend auto quantized_matmul(const Tensor& a, QuantParams a_qp, const PackedQMatrix& w, const Tensor& bias, DType out_dtype, QuantParams out_qp)
+        -> Result<Tensor>;
+
+    Tensor    data_;
+    Tensor    scales_; // F32 {1} 或 {N}，连续
+    int64_t   rows_ = 0;
+    int64_t   cols_ = 0;
+    simd::Isa isa_  = simd::Isa::Scalar;
+};
+
+// 把 w={K,N} I8（可为转置 / 切片视图）与其 scale 预打包为当前 ISA 的量化 GEMM 布局（CPU）
+[[nodiscard]] auto pack_qmatrix(const Tensor& w, const Tensor& w_scales) -> Result<PackedQMatrix>;
+
+} // namespace bee
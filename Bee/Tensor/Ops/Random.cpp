@@ -1,10 +1,13 @@
 #include "Tensor/Ops/Random.hpp"
 #include "Tensor/Cuda/Backend.hpp"
+#include "Tensor/Cpu/Dispatch/Dispatch.hpp"
 
+#include <cmath>
 #include <format>
 #include <random>
 #include <cstdint>
 #include <limits>
+#include <string_view>
 
 namespace bee
 {
@@ -12,18 +15,9 @@ namespace bee
 namespace
 {
 
-    auto make_engine(uint64_t seed) -> std::mt19937_64
-    {
-        if (seed == 0) {
-            std::random_device rd;
-            return std::mt19937_64{rd()};
-        }
-        return std::mt19937_64{seed};
-    }
-
-    // 对 seed=0 的 CUDA 路径派生非零种子。Philox 在 counter/key 全 0 时输出仍满足
-    // 均匀性，但为与 CPU 行为一致（seed=0 表示"真随机"），派生一个随机 u64。
-    auto resolve_cuda_seed(uint64_t seed) -> uint64_t
+    // CPU 与 CUDA 共用 Philox4x32-10 流：seed 非 0 时两端逐元素一致；
+    // seed=0 表示"真随机"，由 std::random_device 派生一个非零 u64
+    auto resolve_seed(uint64_t seed) -> uint64_t
     {
         if (seed != 0)
             return seed;
@@ -34,6 +28,75 @@ namespace
         return s == 0 ? 0x9E3779B97F4A7C15ull : s;
     }
 
+    auto check_probability(double p, std::string_view op) -> Result<void>
+    {
+        if (!(p >= 0.0 && p <= 1.0))
+            return std::unexpected(make_error(std::format("{}: 概率 p={} 须落在 [0, 1]", op, p), Severity::Recoverable));
+        return {};
+    }
+
+    // rand(F32) 的取值为 u = (u32 >> 8) · 2^-24，故 u < p ⇔ (u32 >> 8) < ceil(p · 2^24)
+    auto bernoulli_threshold(double p) -> uint32_t
+    {
+        return static_cast<uint32_t>(std::ceil(p * 16777216.0));
+    }
+
+    auto dropout_scale(double p) -> double
+    {
+        return p < 1.0 ? 1.0 / (1.0 - p) : 0.0;
+    }
+
+    auto check_dropout_input(const Tensor& x, double p, std::string_view op) -> Result<void>
+    {
+        if (!x.defined())
+            return std::unexpected(make_error(std::format("{}: 输入未定义", op), Severity::Recoverable));
+        if (x.device() != Device::CPU)
+            return std::unexpected(make_error(std::format("{}: 仅支持 CPU 张量", op), Severity::Recoverable));
+        if (x.dtype() != DType::F32 && x.dtype() != DType::F64)
+            return std::unexpected(
+                make_error(std::format("{}: 不支持 DType::{}，仅允许 F32/F64", op, enum_to_name(x.dtype())), Severity::Recoverable)
+            );
+        return check_probability(p, op);
+    }
+
+    auto run_dropout(const Tensor& x, double p, uint64_t seed, bool with_mask, std::string_view op) -> Result<DropoutResult>
+    {
+        if (auto r = check_dropout_input(x, p, op); !r)
+            return std::unexpected(std::move(r.error()));
+
+        auto xc = x.contiguous();
+        if (!xc)
+            return std::unexpected(std::move(xc.error()));
+        auto out = Tensor::empty(x.shape(), x.dtype());
+        if (!out)
+            return std::unexpected(std::move(out.error()));
+
+        const int64_t n = x.numel();
+        DropoutResult res{std::move(*out), {}};
+        if (with_mask) {
+            auto mask = Tensor::empty(Shape{(n + 7) / 8}, DType::U8);
+            if (!mask)
+                return std::unexpected(std::move(mask.error()));
+            res.mask = std::move(*mask);
+        }
+        if (n == 0)
+            return res;
+
+        auto* mp = with_mask ? static_cast<uint8_t*>(res.mask.scoped_data_ptr()) : nullptr;
+        BEE_RT_DISPATCH_STMT(
+            rn_dropout,
+            x.dtype(),
+            resolve_seed(seed),
+            bernoulli_threshold(p),
+            dropout_scale(p),
+            xc->const_data_ptr(),
+            res.output.scoped_data_ptr(),
+            mp,
+            n
+        );
+        return res;
+    }
+
 } // namespace
 
 auto rand(Shape shape, DType dtype, uint64_t seed, Device device) -> Result<Tensor>
@@ -50,28 +113,15 @@ auto rand(Shape shape, DType dtype, uint64_t seed, Device device) -> Result<Tens
     if (n == 0)
         return out;
 
+    const uint64_t s = resolve_seed(seed);
     if (device == Device::CUDA) {
-        const uint64_t s = resolve_cuda_seed(seed);
-        auto           r = tensor::cuda::random_uniform(static_cast<int>(dtype), out.data_ptr(), static_cast<std::size_t>(n), s);
+        auto           r = tensor::cuda::random_uniform(static_cast<int>(dtype), out.scoped_data_ptr(), static_cast<std::size_t>(n), s);
         if (!r)
             return std::unexpected(std::move(r.error()));
         return out;
     }
 
-    auto eng = make_engine(seed);
-
-    if (dtype == DType::F32) {
-        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-        auto*                                 ptr = static_cast<float*>(out.data_ptr());
-        for (int64_t i = 0; i < n; ++i)
-            ptr[i] = dist(eng);
-    } else {
-        std::uniform_real_distribution<double> dist(0.0, 1.0);
-        auto*                                  ptr = static_cast<double*>(out.data_ptr());
-        for (int64_t i = 0; i < n; ++i)
-            ptr[i] = dist(eng);
-    }
-
+    BEE_RT_DISPATCH_STMT(rn_uniform, dtype, s, out.scoped_data_ptr(), n);
     return out;
 }
 
@@ -89,28 +139,15 @@ auto randn(Shape shape, DType dtype, uint64_t seed, Device device) -> Result<Ten
     if (n == 0)
         return out;
 
+    const uint64_t s = resolve_seed(seed);
     if (device == Device::CUDA) {
-        const uint64_t s = resolve_cuda_seed(seed);
-        auto           r = tensor::cuda::random_normal(static_cast<int>(dtype), out.data_ptr(), static_cast<std::size_t>(n), s);
+        auto           r = tensor::cuda::random_normal(static_cast<int>(dtype), out.scoped_data_ptr(), static_cast<std::size_t>(n), s);
         if (!r)
             return std::unexpected(std::move(r.error()));
         return out;
     }
 
-    auto eng = make_engine(seed);
-
-    if (dtype == DType::F32) {
-        std::normal_distribution<float> dist(0.0f, 1.0f);
-        auto*                           ptr = static_cast<float*>(out.data_ptr());
-        for (int64_t i = 0; i < n; ++i)
-            ptr[i] = dist(eng);
-    } else {
-        std::normal_distribution<double> dist(0.0, 1.0);
-        auto*                            ptr = static_cast<double*>(out.data_ptr());
-        for (int64_t i = 0; i < n; ++i)
-            ptr[i] = dist(eng);
-    }
-
+    BEE_RT_DISPATCH_STMT(rn_normal, dtype, s, out.scoped_data_ptr(), n);
     return out;
 }
 
@@ -150,33 +187,83 @@ auto randint(int64_t low, int64_t high, Shape shape, DType dtype, uint64_t seed,
     if (n == 0)
         return out;
 
+    const uint64_t s = resolve_seed(seed);
     if (device == Device::CUDA) {
-        const uint64_t s = resolve_cuda_seed(seed);
-        auto           r = tensor::cuda::random_int(static_cast<int>(dtype), out.data_ptr(), static_cast<std::size_t>(n), low, high, s);
+        auto           r = tensor::cuda::random_int(static_cast<int>(dtype), out.scoped_data_ptr(), static_cast<std::size_t>(n), low, high, s);
         if (!r)
             return std::unexpected(std::move(r.error()));
         return out;
     }
 
-    auto eng = make_engine(seed);
+    const uint64_t range = static_cast<uint64_t>(high) - static_cast<uint64_t>(low);
+    BEE_RT_DISPATCH_STMT(rn_randint, dtype, s, low, range, out.scoped_data_ptr(), n);
+    return out;
+}
 
-    if (dtype == DType::I32) {
-        std::uniform_int_distribution<int32_t> dist(static_cast<int32_t>(low), static_cast<int32_t>(high) - 1);
-        auto*                                  ptr = static_cast<int32_t*>(out.data_ptr());
-        for (int64_t i = 0; i < n; ++i)
-            ptr[i] = dist(eng);
-    } else if (dtype == DType::I64) {
-        std::uniform_int_distribution<int64_t> dist(low, high - 1);
-        auto*                                  ptr = static_cast<int64_t*>(out.data_ptr());
-        for (int64_t i = 0; i < n; ++i)
-            ptr[i] = dist(eng);
-    } else {
-        std::uniform_int_distribution<uint16_t> dist(static_cast<uint16_t>(low), static_cast<uint16_t>(high) - 1u);
-        auto*                                   ptr = static_cast<uint8_t*>(out.data_ptr());
-        for (int64_t i = 0; i < n; ++i)
-            ptr[i] = static_cast<uint8_t>(dist(eng));
-    }
+auto bernoulli(Shape shape, double p, DType dtype, uint64_t seed, Device device) -> Result<Tensor>
+{
+    if (auto r = check_probability(p, "bernoulli"); !r)
+        return std::unexpected(std::move(r.error()));
+
+    if (!dtype_is_cpu_computable(dtype) || dtype == DType::I8)
+        return std::unexpected(
+            make_error(std::format("bernoulli: 不支持 DType::{}，仅允许 Bool/U8/I32/I64/F32/F64", enum_to_name(dtype)), Severity::Recoverable)
+        );
+
+    if (device != Device::CPU)
+        return std::unexpected(make_error("bernoulli: 当前仅支持 CPU", Severity::Recoverable));
+
+    auto out_r = Tensor::empty(shape, dtype, device);
+    if (!out_r)
+        return std::unexpected(std::move(out_r.error()));
+    Tensor out = std::move(*out_r);
+
+    const int64_t n = out.numel();
+    if (n == 0)
+        return out;
+
+    BEE_RT_DISPATCH_STMT(rn_bernoulli, dtype, resolve_seed(seed), bernoulli_threshold(p), out.scoped_data_ptr(), n);
+    return out;
+}
+
+auto dropout(const Tensor& x, double p, uint64_t seed) -> Result<Tensor>
+{
+    auto r = run_dropout(x, p, seed, false, "dropout");
+    if (!r)
+        return std::unexpected(std::move(r.error()));
+    return std::move(r->output);
+}
+
+auto dropout_with_mask(const Tensor& x, double p, uint64_t seed) -> Result<DropoutResult>
+{
+    return run_dropout(x, p, seed, true, "dropout_with_mask");
+}
+
+auto dropout_apply_mask(const Tensor& x, const Tensor& mask, double p) -> Result<Tensor>
+{
+    if (auto r = check_dropout_input(x, p, "dropout_apply_mask"); !r)
+        return std::unexpected(std::move(r.error()));
+
+    const int64_t n = x.numel();
+    if (!mask.defined() || mask.device() != Device::CPU || mask.dtype() != DType::U8 || mask.numel() != (n + 7) / 8)
+        return std::unexpected(
+            make_error(std::format("dropout_apply_mask: 掩码须为 {} 个元素的 U8 CPU 张量（x 含 {} 个元素）", (n + 7) / 8, n), Severity::Recoverable)
+        );
+
+    auto xc = x.contiguous();
+    if (!xc)
+        return std::unexpected(std::move(xc.error()));
+    auto mc = mask.contiguous();
+    if (!mc)
+        return std::unexpected(std::move(mc.error()));
+    auto out = Tensor::empty(x.shape(), x.dtype());
+    if (!out)
+        return std::unexpected(std::move(out.error()));
+    if (n == 0)
+        return out;
 
+    const auto* mp = static_cast<const uint8_t*>(mc->const_data_ptr());
+    BEE_RT_DISPATCH_STMT(rn_dropout_apply_mask, x.dtype(), mp, dropout_scale(p), xc->const_data_ptr(), out->scoped_data_ptr(), n);
     return out;
 }
 
@@ -1,7 +1,9 @@
 #pragma once
 
-// Random 初始化算子自由函数声明：rand / randn / randint
-// 基于 std::mt19937_64；seed==0 时使用 std::random_device 生成随机种子
+// Random 初始化算子自由函数声明：rand / randn / randint / bernoulli，以及融合 dropout
+// CPU 与 CUDA 共用计数器式 Philox4x32-10：元素只取决于 (seed, 下标)，结果与线程数无关，
+// 同一 seed 下 rand / randint 两端逐位一致（randn 仅 log / sincos 的末位舍入可能不同）；
+// seed==0 时使用 std::random_device 生成随机种子
 
 #include "Base/Diagnostics/Error.hpp"
 #include "Base/Memory/Device.hpp"
@@ -23,4 +25,26 @@ namespace bee
 [[nodiscard]] auto randint(int64_t low, int64_t high, Shape shape, DType dtype = DType::I64, uint64_t seed = 0, Device device = Device::CPU)
     -> Result<Tensor>;
 
+// 伯努利分布：以概率 p ∈ [0, 1] 取 1，否则取 0；dtype 支持 Bool/U8/I32/I64/F32/F64；
+// 与 rand(shape, F32, seed) < p 逐元素一致（与 dtype 无关）；当前仅 CPU
+[[nodiscard]] auto bernoulli(Shape shape, double p, DType dtype = DType::Bool, uint64_t seed = 0, Device device = Device::CPU)
+    -> Result<Tensor>;
+
+// 融合 dropout 的结果。mask 为位压缩的保留掩码：U8 {ceil(numel / 8)}，元素 k（按逻辑行主序编号）保留时
+// 字节 k / 8 的第 k % 8 位（低位在前）为 1，末字节多余的位为 0
+struct DropoutResult
+{
+    Tensor output;
+    Tensor mask;
+};
+
+// 融合 dropout：一次遍历内生成随机数、判定并缩放，output = keep ? x / (1 - p) : 0（与 x 同形、连续）。
+// 被丢弃的元素恰为 bernoulli(x.shape(), p, Bool, seed) 为 true 的位置，与 x 的 dtype、线程数无关；
+// x 为 F32/F64 的 CPU 张量，p ∈ [0, 1]，p = 1 时输出全 0
+[[nodiscard]] auto dropout(const Tensor& x, double p, uint64_t seed = 0) -> Result<Tensor>;
+[[nodiscard]] auto dropout_with_mask(const Tensor& x, double p, uint64_t seed = 0) -> Result<DropoutResult>;
+
+// 按 dropout_with_mask 返回的掩码重放（如反向传播）：output = bit ? x / (1 - p) : 0；x 的元素数须与掩码一致
+[[nodiscard]] auto dropout_apply_mask(const Tensor& x, const Tensor& mask, double p) -> Result<Tensor>;
+
 } // namespace bee
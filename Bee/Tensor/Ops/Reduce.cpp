@@ -1,4 +1,5 @@
 #include "Tensor/Ops/Reduce.hpp"
+#include "Tensor/Ops/Cast.hpp"
 #include "Tensor/Cpu/ReduceCpu.hpp"
 #include "Tensor/Cpu/Dispatch/Dispatch.hpp"
 #include "Tensor/Cuda/Backend.hpp"
@@ -36,10 +37,11 @@ namespace
         return {};
     }
 
+    // 浮点输入保持原 dtype（F16 / BF16 内部以 F64 累加后收窄），整型输入输出 F64
     auto mean_out_dtype(DType dt) -> DType
     {
-        if (dt == DType::F32)
-            return DType::F32;
+        if (dt == DType::F32 || dtype_is_half_float(dt))
+            return dt;
         return DType::F64;
     }
 
@@ -101,6 +103,8 @@ namespace
         case DType::I32: cpu::cpu_reduce_axis_dispatch<int32_t, Op>(a, dim, keepdim, out); break;
         case DType::I64: cpu::cpu_reduce_axis_dispatch<int64_t, Op>(a, dim, keepdim, out); break;
         case DType::U8: cpu::cpu_reduce_axis_dispatch<uint8_t, Op>(a, dim, keepdim, out); break;
+        case DType::F16: cpu::cpu_reduce_axis_dispatch<Half, Op>(a, dim, keepdim, out); break;
+        case DType::BF16: cpu::cpu_reduce_axis_dispatch<BFloat16, Op>(a, dim, keepdim, out); break;
         default: break;
         }
     }
@@ -134,7 +138,7 @@ namespace
         if (auto r = check_cuda_contig(a, op_name); !r)
             return std::unexpected(std::move(r.error()));
         return tensor::cuda::reduce_global(
-            static_cast<int>(op), static_cast<int>(a.dtype()), a.data_ptr(), out.data_ptr(), static_cast<std::size_t>(a.numel())
+            static_cast<int>(op), static_cast<int>(a.dtype()), a.const_data_ptr(), out.scoped_data_ptr(), static_cast<std::size_t>(a.numel())
         );
     }
 
@@ -149,7 +153,9 @@ namespace
         for (int64_t i = dim + 1; i < static_cast<int64_t>(s.size()); ++i)
             inner *= static_cast<std::size_t>(s[static_cast<std::size_t>(i)]);
         const std::size_t axis_n = static_cast<std::size_t>(s[static_cast<std::size_t>(dim)]);
-        return tensor::cuda::reduce_axis(static_cast<int>(op), static_cast<int>(a.dtype()), a.data_ptr(), out.data_ptr(), outer, axis_n, inner);
+        return tensor::cuda::reduce_axis(
+            static_cast<int>(op), static_cast<int>(a.dtype()), a.const_data_ptr(), out.scoped_data_ptr(), outer, axis_n, inner
+        );
     }
 
     auto mean_not_impl_on_cuda_for_int(DType dt, std::string_view op) -> Result<void>
@@ -201,17 +207,21 @@ auto mean(const Tensor& a) -> Result<Tensor>
         if (auto r = run_global_cuda(RdOp::Sum, a, *out, "mean"); !r)
             return std::unexpected(std::move(r.error()));
         const double inv = 1.0 / static_cast<double>(a.numel());
-        return tensor::cuda::scale_fp(static_cast<int>(a.dtype()), out->data_ptr(), inv, 1).transform([&] { return *out; });
+        if (auto r_ = tensor::cuda::scale_fp(static_cast<int>(a.dtype()), out->scoped_data_ptr(), inv, 1); !r_) return std::unexpected(std::move(r_.error())); return *out; /*LOCALHACK*/
     }
 
     if (a.dtype() == DType::F32) {
         dispatch_global_cpu(RdOp::Sum, a, *out);
-        auto* p  = static_cast<float*>(out->data_ptr());
+        auto* p  = static_cast<float*>(out->scoped_data_ptr());
         p[0]    /= static_cast<float>(a.numel());
     } else if (a.dtype() == DType::F64) {
         dispatch_global_cpu(RdOp::Sum, a, *out);
-        auto* p  = static_cast<double*>(out->data_ptr());
+        auto* p  = static_cast<double*>(out->scoped_data_ptr());
         p[0]    /= static_cast<double>(a.numel());
+    } else if (a.dtype() == DType::F16) {
+        cpu::cpu_reduce_mean_global_dispatch<Half, Half>(a, *out);
+    } else if (a.dtype() == DType::BF16) {
+        cpu::cpu_reduce_mean_global_dispatch<BFloat16, BFloat16>(a, *out);
     } else if (a.dtype() == DType::I32) {
         cpu::cpu_reduce_mean_global_dispatch<int32_t, double>(a, *out);
     } else {
@@ -325,21 +335,25 @@ auto mean(const Tensor& a, int dim, bool keepdim) -> Result<Tensor>
         if (auto r = run_axis_cuda(RdOp::Sum, a, d, *out, "mean"); !r)
             return std::unexpected(std::move(r.error()));
         const double inv = 1.0 / static_cast<double>(K);
-        if (auto r = tensor::cuda::scale_fp(static_cast<int>(a.dtype()), out->data_ptr(), inv, static_cast<std::size_t>(out->numel())); !r)
+        if (auto r = tensor::cuda::scale_fp(static_cast<int>(a.dtype()), out->scoped_data_ptr(), inv, static_cast<std::size_t>(out->numel())); !r)
             return std::unexpected(std::move(r.error()));
         return *out;
     }
 
     if (a.dtype() == DType::F32) {
         cpu::cpu_reduce_axis_dispatch<float, cpu::OpReduceSum>(a, d, keepdim, *out);
-        auto* p = static_cast<float*>(out->data_ptr());
+        auto* p = static_cast<float*>(out->scoped_data_ptr());
         for (int64_t i = 0; i < out->numel(); ++i)
             p[i] /= static_cast<float>(K);
     } else if (a.dtype() == DType::F64) {
         cpu::cpu_reduce_axis_dispatch<double, cpu::OpReduceSum>(a, d, keepdim, *out);
-        auto* p = static_cast<double*>(out->data_ptr());
+        auto* p = static_cast<double*>(out->scoped_data_ptr());
         for (int64_t i = 0; i < out->numel(); ++i)
             p[i] /= static_cast<double>(K);
+    } else if (a.dtype() == DType::F16) {
+        cpu::cpu_reduce_mean_axis_dispatch<Half, Half>(a, d, keepdim, *out);
+    } else if (a.dtype() == DType::BF16) {
+        cpu::cpu_reduce_mean_axis_dispatch<BFloat16, BFloat16>(a, d, keepdim, *out);
     } else if (a.dtype() == DType::I32) {
         cpu::cpu_reduce_mean_axis_dispatch<int32_t, double>(a, d, keepdim, *out);
     } else {
@@ -413,4 +427,102 @@ auto prod(const Tensor& a, int dim, bool keepdim) -> Result<Tensor>
     return *out;
 }
 
+// ─────────────────────────────────────────────────────────────────────────────
+// var / std 实现
+// ─────────────────────────────────────────────────────────────────────────────
+
+namespace
+{
+    auto check_var_common(const Tensor& a, int64_t correction, std::string_view op) -> Result<void>
+    {
+        if (correction < 0)
+            return std::unexpected(make_error(std::format("{}: correction={} 不能为负", op, correction), Severity::Recoverable));
+        if (a.device() == Device::CUDA)
+            return std::unexpected(make_error(std::format("{}: CUDA 后端暂未实现", op), Severity::Recoverable));
+        return {};
+    }
+
+    // 整理为 CPU 内核可直接消费的输入：整型先转 F64，F16 / BF16 展开为 F32，非连续整理为连续
+    auto prepare_var_input(const Tensor& a) -> Result<Tensor>
+    {
+        if (a.dtype() == DType::I32 || a.dtype() == DType::I64)
+            return cast(a, DType::F64);
+        if (dtype_is_half_float(a.dtype()))
+            return cast(a, DType::F32);
+        return a.contiguous();
+    }
+
+    // F16 / BF16 输入：F32 结果收窄回原 dtype
+    auto finish_var_output(const Tensor& a, Tensor out) -> Result<Tensor>
+    {
+        if (dtype_is_half_float(a.dtype()))
+            return cast(out, a.dtype());
+        return out;
+    }
+
+    auto var_global_impl(const Tensor& a, int64_t correction, bool take_sqrt, std::string_view op) -> Result<Tensor>
+    {
+        if (auto r = check_global_precond(a, op, check_dtype_mean); !r)
+            return std::unexpected(std::move(r.error()));
+        if (auto r = check_var_common(a, correction, op); !r)
+            return std::unexpected(std::move(r.error()));
+        if (a.numel() == 0)
+            return std::unexpected(make_error(std::format("{}: 不支持空张量（numel == 0）", op), Severity::Recoverable));
+
+        auto in = prepare_var_input(a);
+        if (!in)
+            return std::unexpected(std::move(in.error()));
+        auto out = Tensor::empty({}, in->dtype(), a.device());
+        if (!out)
+            return std::unexpected(std::move(out.error()));
+
+        BEE_RT_DISPATCH_STMT(rd_var_global, *in, *out, correction, take_sqrt);
+        return finish_var_output(a, std::move(*out));
+    }
+
+    auto var_axis_impl(const Tensor& a, int dim, int64_t correction, bool keepdim, bool take_sqrt, std::string_view op) -> Result<Tensor>
+    {
+        auto dim_r = check_axis_precond(a, dim, op, check_dtype_mean);
+        if (!dim_r)
+            return std::unexpected(std::move(dim_r.error()));
+        const int64_t d = *dim_r;
+        if (auto r = check_var_common(a, correction, op); !r)
+            return std::unexpected(std::move(r.error()));
+        if (a.shape()[static_cast<std::size_t>(d)] == 0)
+            return std::unexpected(make_error(std::format("{}: 被 reduce 的维度大小为 0", op), Severity::Recoverable));
+
+        auto in = prepare_var_input(a);
+        if (!in)
+            return std::unexpected(std::move(in.error()));
+        auto out = make_axis_out(a, d, keepdim, in->dtype());
+        if (!out)
+            return std::unexpected(std::move(out.error()));
+        if (out->numel() == 0)
+            return finish_var_output(a, std::move(*out));
+
+        BEE_RT_DISPATCH_STMT(rd_var_axis, *in, d, *out, correction, take_sqrt);
+        return finish_var_output(a, std::move(*out));
+    }
+} // namespace
+
+auto var(const Tensor& a, int64_t correction) -> Result<Tensor>
+{
+    return var_global_impl(a, correction, false, "var");
+}
+
+auto stddev(const Tensor& a, int64_t correction) -> Result<Tensor>
+{
+    return var_global_impl(a, correction, true, "stddev");
+}
+
+auto var(const Tensor& a, int dim, int64_t correction, bool keepdim) -> Result<Tensor>
+{
+    return var_axis_impl(a, dim, correction, keepdim, false, "var");
+}
+
+auto stddev(const Tensor& a, int dim, int64_t correction, bool keepdim) -> Result<Tensor>
+{
+    return var_axis_impl(a, dim, correction, keepdim, true, "stddev");
+}
+
 } // namespace bee
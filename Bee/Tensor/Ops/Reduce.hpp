@@ -8,6 +8,7 @@
 //   sum/prod  ： F32/F64/I32/I64（Bool/U8 → Err）
 //   min/max   ： F32/F64/I32/I64/U8（Bool → Err）
 //   mean      ： F32→F32, F64→F64, I32/I64→F64（Bool/U8 → Err）
+//   var/stddev： 同 mean；仅 CPU
 //
 // CUDA 侧说明：
 // - 全局 reduce 已接入设备端规约；
@@ -36,4 +37,15 @@ namespace bee
 [[nodiscard]] auto max(const Tensor& a, int dim, bool keepdim = false) -> Result<Tensor>;
 [[nodiscard]] auto prod(const Tensor& a, int dim, bool keepdim = false) -> Result<Tensor>;
 
+// ─── 方差 / 标准差 ────────────────────────────────────────────────────────────
+// correction 为自由度修正：除数为 N - correction（1 = 无偏样本方差，0 = 总体方差），
+// N - correction <= 0 时结果为 NaN；correction < 0 返回 Err。
+// 标准差命名为 stddev（避免与 namespace std 冲突）；
+// 按轴版本的 correction 无默认值，避免 var(a, 0) 在全局/按轴两种重载间产生歧义。
+
+[[nodiscard]] auto var(const Tensor& a, int64_t correction = 1) -> Result<Tensor>;
+[[nodiscard]] auto stddev(const Tensor& a, int64_t correction = 1) -> Result<Tensor>;
+[[nodiscard]] auto var(const Tensor& a, int dim, int64_t correction, bool keepdim = false) -> Result<Tensor>;
+[[nodiscard]] auto stddev(const Tensor& a, int dim, int64_t correction, bool keepdim = false) -> Result<Tensor>;
+
 } // namespace bee
@@ -0,0 +1,96 @@
+#include "Tensor/Ops/Scan.hpp"
+#include "Tensor/Cpu/Dispatch/Dispatch.hpp"
+
+#include <format>
+
+namespace bee
+{
+
+namespace
+{
+
+    enum class ScanOp
+    {
+        Sum,
+        Prod,
+        Max,
+        Min
+    };
+
+    auto check_scan_precond(const Tensor& a, int dim, ScanOp op, std::string_view name) -> Result<int64_t>
+    {
+        if (!a.defined())
+            return std::unexpected(make_error(std::format("{}: 输入 Tensor 未定义", name), Severity::Recoverable));
+
+        const DType dt        = a.dtype();
+        const bool  supported = dt == DType::F32 || dt == DType::F64 || dt == DType::I32 || dt == DType::I64
+                             || (dt == DType::U8 && (op == ScanOp::Max || op == ScanOp::Min));
+        if (!supported)
+            return std::unexpected(make_error(std::format("{} 不支持 DType::{}", name, enum_to_name(dt)), Severity::Recoverable));
+        if (a.device() == Device::CUDA)
+            return std::unexpected(make_error(std::format("{}: CUDA 后端暂未实现", name), Severity::Recoverable));
+
+        const int64_t ndim = a.ndim();
+        if (ndim == 0)
+            return std::unexpected(make_error(std::format("{}: 0-rank 张量不支持按轴扫描", name), Severity::Recoverable));
+
+        int64_t d = static_cast<int64_t>(dim);
+        if (d < 0)
+            d += ndim;
+        if (d < 0 || d >= ndim)
+            return std::unexpected(make_error(std::format("{}: dim={} 越界（ndim={}）", name, dim, ndim), Severity::Recoverable));
+        return d;
+    }
+
+    auto dispatch_scan_cpu(ScanOp op, const Tensor& a, int64_t dim, Tensor& out) -> void
+    {
+        switch (op) {
+        case ScanOp::Sum: BEE_RT_DISPATCH(sc_cumsum, a, dim, out);
+        case ScanOp::Prod: BEE_RT_DISPATCH(sc_cumprod, a, dim, out);
+        case ScanOp::Max: BEE_RT_DISPATCH(sc_cummax, a, dim, out);
+        case ScanOp::Min: BEE_RT_DISPATCH(sc_cummin, a, dim, out);
+        }
+    }
+
+    auto scan_impl(const Tensor& a, int dim, ScanOp op, std::string_view name) -> Result<Tensor>
+    {
+        auto dim_r = check_scan_precond(a, dim, op, name);
+        if (!dim_r)
+            return std::unexpected(std::move(dim_r.error()));
+
+        auto in = a.contiguous();
+        if (!in)
+            return std::unexpected(std::move(in.error()));
+        auto out = Tensor::empty(a.shape(), a.dtype(), a.device());
+        if (!out)
+            return std::unexpected(std::move(out.error()));
+        if (out->numel() == 0)
+            return *out;
+
+        dispatch_scan_cpu(op, *in, *dim_r, *out);
+        return *out;
+    }
+
+} // namespace
+
+auto cumsum(const Tensor& a, int dim) -> Result<Tensor>
+{
+    return scan_impl(a, dim, ScanOp::Sum, "cumsum");
+}
+
+auto cumprod(const Tensor& a, int dim) -> Result<Tensor>
+{
+    return scan_impl(a, dim, ScanOp::Prod, "cumprod");
+}
+
+auto cummax(const Tensor& a, int dim) -> Result<Tensor>
+{
+    return scan_impl(a, dim, ScanOp::Max, "cummax");
+}
+
+auto cummin(const Tensor& a, int dim) -> Result<Tensor>
+{
+    return scan_impl(a, dim, ScanOp::Min, "cummin");
+}
+
+} // namespace bee
@@ -0,0 +1,22 @@
+#pragma once
+
+// 前缀扫描算子自由函数声明：沿单一维度的 inclusive scan，输出与输入同形状、同 dtype
+//   out[..., k, ...] = op(in[..., 0, ...], ..., in[..., k, ...])
+//
+// dtype 支持矩阵（与对应 reduce 一致）：
+//   cumsum/cumprod ： F32/F64/I32/I64（Bool/U8 → Err）
+//   cummax/cummin  ： F32/F64/I32/I64/U8（Bool → Err）
+// 整型 cumsum/cumprod 溢出按补码回绕；当前仅 CPU。
+
+#include "Base/Diagnostics/Error.hpp"
+#include "Tensor/Core/Tensor.hpp"
+
+namespace bee
+{
+
+[[nodiscard]] auto cumsum(const Tensor& a, int dim) -> Result<Tensor>;
+[[nodiscard]] auto cumprod(const Tensor& a, int dim) -> Result<Tensor>;
+[[nodiscard]] auto cummax(const Tensor& a, int dim) -> Result<Tensor>;
+[[nodiscard]] auto cummin(const Tensor& a, int dim) -> Result<Tensor>;
+
+} // namespace bee
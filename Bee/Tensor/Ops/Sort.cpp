@@ -0,0 +1,89 @@
+#include "Tensor/Ops/Sort.hpp"
+#include "Tensor/Cpu/SortGeom.hpp"
+#include "Tensor/Cpu/Dispatch/Dispatch.hpp"
+
+#include <format>
+#include <string_view>
+
+namespace bee
+{
+
+namespace
+{
+
+    // 校验输入并以 dim 为界折叠成 {O, N, I}；0 维张量视为长度 1 的轴
+    auto make_sort_geom(const Tensor& a, int dim, bool descending, std::string_view op) -> Result<cpu::SortGeom>
+    {
+        if (!a.defined())
+            return std::unexpected(make_error(std::format("{}: 输入 Tensor 未定义", op), Severity::Recoverable));
+        if (a.device() != Device::CPU)
+            return std::unexpected(make_error(std::format("{}: 仅支持 CPU 张量", op), Severity::Recoverable));
+        const DType dt = a.dtype();
+        if (dt != DType::F32 && dt != DType::F64 && dt != DType::I32 && dt != DType::I64 && dt != DType::U8)
+            return std::unexpected(
+                make_error(std::format("{}: 不支持 DType::{}，仅允许 F32/F64/I32/I64/U8", op, enum_to_name(dt)), Severity::Recoverable)
+            );
+
+        const auto n  = static_cast<int>(a.ndim());
+        const int  lo = n == 0 ? -1 : -n;
+        const int  hi = n == 0 ? 1 : n;
+        if (dim < lo || dim >= hi)
+            return std::unexpected(make_error(std::format("{}: 维度索引 {} 越界（ndim={}）", op, dim, n), Severity::Recoverable));
+
+        cpu::SortGeom g;
+        g.descending = descending;
+        if (n == 0) {
+            g.N = 1;
+            return g;
+        }
+        const auto d = static_cast<std::size_t>(dim < 0 ? dim + n : dim);
+        g.N          = a.shape()[d];
+        for (std::size_t k = 0; k < d; ++k)
+            g.O *= a.shape()[k];
+        for (std::size_t k = d + 1; k < a.shape().size(); ++k)
+            g.I *= a.shape()[k];
+        return g;
+    }
+
+    auto run_sort(const Tensor& a, int dim, bool descending, bool with_values, std::string_view op) -> Result<SortResult>
+    {
+        auto g = make_sort_geom(a, dim, descending, op);
+        if (!g)
+            return std::unexpected(std::move(g.error()));
+        auto src = a.contiguous();
+        if (!src)
+            return std::unexpected(std::move(src.error()));
+
+        SortResult res;
+        auto       idx = Tensor::empty(a.shape(), DType::I64);
+        if (!idx)
+            return std::unexpected(std::move(idx.error()));
+        res.indices = std::move(*idx);
+        if (with_values) {
+            auto vals = Tensor::empty(a.shape(), a.dtype());
+            if (!vals)
+                return std::unexpected(std::move(vals.error()));
+            res.values = std::move(*vals);
+        }
+
+        void* values = with_values ? res.values.scoped_data_ptr() : nullptr;
+        BEE_RT_DISPATCH_STMT(so_sort, a.dtype(), *g, src->const_data_ptr(), values, static_cast<int64_t*>(res.indices.scoped_data_ptr()));
+        return res;
+    }
+
+} // namespace
+
+auto sort(const Tensor& a, int dim, bool descending) -> Result<SortResult>
+{
+    return run_sort(a, dim, descending, true, "sort");
+}
+
+auto argsort(const Tensor& a, int dim, bool descending) -> Result<Tensor>
+{
+    auto r = run_sort(a, dim, descending, false, "argsort");
+    if (!r)
+        return std::unexpected(std::move(r.error()));
+    return std::move(r->indices);
+}
+
+} // namespace bee
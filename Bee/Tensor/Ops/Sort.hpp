@@ -0,0 +1,24 @@
+#pragma once
+
+// 沿轴排序（语义对齐 PyTorch 的 stable=True，当前仅 CPU，F32/F64/I32/I64/U8）：
+//   sort   ：返回排好的 values 与其在原轴上的下标 indices（I64），二者均为与输入同形的新连续张量
+//   argsort：只返回 indices
+// 排序稳定（相等元素保持原相对顺序，降序亦然）；NaN 视为最大（升序排最后、降序排最前），-0.0 与 +0.0 相等。
+// 0 维张量按长度 1 的轴处理（dim 取 0 或 -1）。
+
+#include "Base/Diagnostics/Error.hpp"
+#include "Tensor/Core/Tensor.hpp"
+
+namespace bee
+{
+
+struct SortResult
+{
+    Tensor values;
+    Tensor indices;
+};
+
+[[nodiscard]] auto sort(const Tensor& a, int dim = -1, bool descending = false) -> Result<SortResult>;
+[[nodiscard]] auto argsort(const Tensor& a, int dim = -1, bool descending = false) -> Result<Tensor>;
+
+} // namespace bee
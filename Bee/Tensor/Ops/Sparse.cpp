@@ -0,0 +1,391 @@
+#include "Tensor/Ops/Sparse.hpp"
+#include "Tensor/Ops/Cast.hpp"
+#include "Tensor/Cpu/SparseGeom.hpp"
+#include "Tensor/Cpu/Dispatch/Dispatch.hpp"
+#include "Base/Parallel/ParallelFor.hpp"
+
+#include <algorithm>
+#include <format>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace bee
+{
+
+namespace
+{
+
+    constexpr int64_t kSparseGrainElems = 16 * 1024; // 构造 / 稠密化时每个并行任务处理的元素数
+
+    template <typename T>
+    constexpr DType value_dtype = std::is_same_v<T, float> ? DType::F32 : DType::F64;
+
+    // parallel_for 的 int64 外壳：fn(lo, hi) 处理 [lo, hi)
+    template <typename Fn>
+    void sparse_parallel_for(int64_t n, int64_t grain, Fn&& fn)
+    {
+        parallel::parallel_for(std::size_t{0}, static_cast<std::size_t>(n), static_cast<std::size_t>(grain), [&](std::size_t lo, std::size_t hi) {
+            fn(static_cast<int64_t>(lo), static_cast<int64_t>(hi));
+        });
+    }
+
+    // 按行并行时的行粒度：使每个任务平均覆盖约 kSparseGrainElems 个元素
+    auto row_grain(int64_t rows, int64_t elems) -> int64_t
+    {
+        return std::max<int64_t>(1, kSparseGrainElems * rows / std::max<int64_t>(elems, 1));
+    }
+
+    auto check_input(const Tensor& t, std::string_view op, std::string_view what) -> Result<void>
+    {
+        if (!t.defined())
+            return std::unexpected(make_error(std::format("{}: {} 未定义", op, what), Severity::Recoverable));
+        if (t.device() != Device::CPU)
+            return std::unexpected(make_error(std::format("{}: 仅支持 CPU 张量", op), Severity::Recoverable));
+        return {};
+    }
+
+    auto check_value_dtype(DType dt, std::string_view op) -> Result<void>
+    {
+        if (dt != DType::F32 && dt != DType::F64)
+            return std::unexpected(make_error(std::format("{}: 不支持 DType::{}，仅允许 F32/F64", op, enum_to_name(dt)), Severity::Recoverable));
+        return {};
+    }
+
+    auto check_cols(int64_t cols, std::string_view op) -> Result<void>
+    {
+        if (cols > std::numeric_limits<int32_t>::max())
+            return std::unexpected(make_error(std::format("{}: 列数 {} 超出 I32 列索引范围", op, cols), Severity::Recoverable));
+        return {};
+    }
+
+    auto check_csr(const SparseCsr& a, std::string_view op) -> Result<void>
+    {
+        if (!a.defined())
+            return std::unexpected(make_error(std::format("{}: 稀疏矩阵未定义", op), Severity::Recoverable));
+        return {};
+    }
+
+    auto make_view(const SparseCsr& a) -> cpu::CsrView
+    {
+        cpu::CsrView v;
+        v.rows = a.rows();
+        v.cols = a.cols();
+        v.nnz  = a.nnz();
+        v.crow = static_cast<const int64_t*>(a.crow_indices().const_data_ptr());
+        v.col  = static_cast<const int32_t*>(a.col_indices().const_data_ptr());
+        v.vals = a.values().const_data_ptr();
+        return v;
+    }
+
+    // 两遍构造：先逐行计数写入 crow[r+1] 并做前缀和，再各行独立写入 [crow[r], crow[r+1])
+    template <typename T>
+    void dense_to_csr(const T* src, int64_t rows, int64_t cols, int64_t* crow, Tensor& col, Tensor& values, Result<void>& status)
+    {
+        const int64_t grain = row_grain(rows, rows * cols);
+        crow[0]             = 0;
+        sparse_parallel_for(rows, grain, [&](int64_t r0, int64_t r1) {
+            for (int64_t r = r0; r < r1; ++r) {
+                const T* row = src + r * cols;
+                int64_t  cnt = 0;
+                for (int64_t j = 0; j < cols; ++j)
+                    cnt += row[j] != T(0) ? 1 : 0;
+                crow[r + 1] = cnt;
+            }
+        });
+        for (int64_t r = 0; r < rows; ++r)
+            crow[r + 1] += crow[r];
+
+        const int64_t nnz = crow[rows];
+        auto          c   = Tensor::empty({nnz}, DType::I32);
+        auto          v   = Tensor::empty({nnz}, value_dtype<T>);
+        if (!c || !v) {
+            status = std::unexpected(std::move(!c ? c.error() : v.error()));
+            return;
+        }
+        auto* cp = static_cast<int32_t*>(c->scoped_data_ptr());
+        auto* vp = static_cast<T*>(v->scoped_data_ptr());
+        sparse_parallel_for(rows, grain, [&](int64_t r0, int64_t r1) {
+            for (int64_t r = r0; r < r1; ++r) {
+                const T* row = src + r * cols;
+                int64_t  k   = crow[r];
+                for (int64_t j = 0; j < cols; ++j) {
+                    if (row[j] != T(0)) {
+                        cp[k] = static_cast<int32_t>(j);
+                        vp[k] = row[j];
+                        ++k;
+                    }
+                }
+            }
+        });
+        col    = std::move(*c);
+        values = std::move(*v);
+    }
+
+    // 三元组按行计数排序（稳定）→ 行内按列稳定排序 → 合并重复坐标（按输入顺序求和，结果确定）
+    template <typename T>
+    void triplets_to_csr(
+        const int64_t* ri,
+        const int64_t* ci,
+        const T*       vi,
+        int64_t        n,
+        int64_t        rows,
+        int64_t*       crow,
+        Tensor&        col,
+        Tensor&        values,
+        Result<void>&  status
+    )
+    {
+        std::vector<int64_t> start(static_cast<std::size_t>(rows) + 1, 0);
+        for (int64_t i = 0; i < n; ++i)
+            ++start[static_cast<std::size_t>(ri[i]) + 1];
+        for (int64_t r = 0; r < rows; ++r)
+            start[r + 1] += start[r];
+
+        std::vector<int64_t> perm(static_cast<std::size_t>(n));
+        {
+            std::vector<int64_t> fill(start.begin(), start.end() - 1);
+            for (int64_t i = 0; i < n; ++i)
+                perm[fill[ri[i]]++] = i;
+        }
+
+        const int64_t grain = row_grain(rows, n);
+        crow[0]             = 0;
+        sparse_parallel_for(rows, grain, [&](int64_t r0, int64_t r1) {
+            for (int64_t r = r0; r < r1; ++r) {
+                auto first = perm.begin() + start[r];
+                auto last  = perm.begin() + start[r + 1];
+                std::stable_sort(first, last, [ci](int64_t a, int64_t b) { return ci[a] < ci[b]; });
+                int64_t uniq = 0;
+                for (auto it = first; it != last; ++it)
+                    uniq += (it == first || ci[*it] != ci[*(it - 1)]) ? 1 : 0;
+                crow[r + 1] = uniq;
+            }
+        });
+        for (int64_t r = 0; r < rows; ++r)
+            crow[r + 1] += crow[r];
+
+        const int64_t nnz = crow[rows];
+        auto          c   = Tensor::empty({nnz}, DType::I32);
+        auto          v   = Tensor::empty({nnz}, value_dtype<T>);
+        if (!c || !v) {
+            status = std::unexpected(std::move(!c ? c.error() : v.error()));
+            return;
+        }
+        auto* cp = static_cast<int32_t*>(c->scoped_data_ptr());
+        auto* vp = static_cast<T*>(v->scoped_data_ptr());
+        sparse_parallel_for(rows, grain, [&](int64_t r0, int64_t r1) {
+            for (int64_t r = r0; r < r1; ++r) {
+                int64_t k = crow[r] - 1;
+                for (int64_t p = start[r]; p < start[r + 1]; ++p) {
+                    const int64_t i = perm[p];
+                    if (p == start[r] || ci[i] != ci[perm[p - 1]]) {
+                        ++k;
+                        cp[k] = static_cast<int32_t>(ci[i]);
+                        vp[k] = vi[i];
+                    } else {
+                        vp[k] += vi[i];
+                    }
+                }
+            }
+        });
+        col    = std::move(*c);
+        values = std::move(*v);
+    }
+
+    template <typename T>
+    void csr_to_dense(const cpu::CsrView& a, T* out)
+    {
+        const auto* vals = static_cast<const T*>(a.vals);
+        sparse_parallel_for(a.rows, row_grain(a.rows, a.nnz), [&](int64_t r0, int64_t r1) {
+            for (int64_t r = r0; r < r1; ++r) {
+                T* row = out + r * a.cols;
+                for (int64_t k = a.crow[r]; k < a.crow[r + 1]; ++k)
+                    row[a.col[k]] = vals[k];
+            }
+        });
+    }
+
+    // 索引张量转为连续 I64，并校验每个值落在 [0, bound)
+    auto prepare_coords(const Tensor& idx, int64_t bound, std::string_view what) -> Result<Tensor>
+    {
+        constexpr std::string_view op = "sparse_csr_from_triplets";
+        if (auto r = check_input(idx, op, what); !r)
+            return std::unexpected(std::move(r.error()));
+        if (idx.ndim() != 1)
+            return std::unexpected(make_error(std::format("{}: {} 须为一维，当前 ndim={}", op, what, idx.ndim()), Severity::Recoverable));
+        if (idx.dtype() != DType::I64 && idx.dtype() != DType::I32)
+            return std::unexpected(
+                make_error(std::format("{}: {} 须为 I32/I64，当前为 DType::{}", op, what, enum_to_name(idx.dtype())), Severity::Recoverable)
+            );
+        auto c = idx.dtype() == DType::I64 ? idx.contiguous() : cast(idx, DType::I64);
+        if (!c)
+            return std::unexpected(std::move(c.error()));
+        const auto*   p = static_cast<const int64_t*>(c->const_data_ptr());
+        const int64_t n = c->numel();
+        for (int64_t k = 0; k < n; ++k) {
+            if (p[k] < 0 || p[k] >= bound)
+                return std::unexpected(make_error(std::format("{}: {}[{}]={} 越界，须在 [0, {})", op, what, k, p[k], bound), Severity::Recoverable));
+        }
+        return c;
+    }
+
+} // namespace
+
+// ── 构造与稠密化 ─────────────────────────────────────────────────────────────
+
+auto to_sparse_csr(const Tensor& dense) -> Result<SparseCsr>
+{
+    if (auto r = check_input(dense, "to_sparse_csr", "输入 Tensor"); !r)
+        return std::unexpected(std::move(r.error()));
+    if (dense.ndim() != 2)
+        return std::unexpected(make_error(std::format("to_sparse_csr: 输入须为 2D，当前 ndim={}", dense.ndim()), Severity::Recoverable));
+    if (auto r = check_value_dtype(dense.dtype(), "to_sparse_csr"); !r)
+        return std::unexpected(std::move(r.error()));
+    const int64_t rows = dense.shape()[0];
+    const int64_t cols = dense.shape()[1];
+    if (auto r = check_cols(cols, "to_sparse_csr"); !r)
+        return std::unexpected(std::move(r.error()));
+
+    auto c = dense.contiguous();
+    if (!c)
+        return std::unexpected(std::move(c.error()));
+    auto crow = Tensor::empty({rows + 1}, DType::I64);
+    if (!crow)
+        return std::unexpected(std::move(crow.error()));
+
+    SparseCsr    out;
+    Result<void> status;
+    auto*        rp = static_cast<int64_t*>(crow->scoped_data_ptr());
+    if (dense.dtype() == DType::F32)
+        dense_to_csr(static_cast<const float*>(c->const_data_ptr()), rows, cols, rp, out.col_, out.values_, status);
+    else
+        dense_to_csr(static_cast<const double*>(c->const_data_ptr()), rows, cols, rp, out.col_, out.values_, status);
+    if (!status)
+        return std::unexpected(std::move(status.error()));
+
+    out.crow_ = std::move(*crow);
+    out.rows_ = rows;
+    out.cols_ = cols;
+    return out;
+}
+
+auto sparse_csr_from_triplets(int64_t rows, int64_t cols, const Tensor& row_idx, const Tensor& col_idx, const Tensor& values) -> Result<SparseCsr>
+{
+    constexpr std::string_view op = "sparse_csr_from_triplets";
+    if (rows < 0 || cols < 0)
+        return std::unexpected(make_error(std::format("{}: 非法的形状 {{{}, {}}}", op, rows, cols), Severity::Recoverable));
+    if (auto r = check_cols(cols, op); !r)
+        return std::unexpected(std::move(r.error()));
+    if (auto r = check_input(values, op, "values"); !r)
+        return std::unexpected(std::move(r.error()));
+    if (auto r = check_value_dtype(values.dtype(), op); !r)
+        return std::unexpected(std::move(r.error()));
+    if (values.ndim() != 1)
+        return std::unexpected(make_error(std::format("{}: values 须为一维，当前 ndim={}", op, values.ndim()), Severity::Recoverable));
+
+    auto ri = prepare_coords(row_idx, rows, "row_idx");
+    if (!ri)
+        return std::unexpected(std::move(ri.error()));
+    auto ci = prepare_coords(col_idx, cols, "col_idx");
+    if (!ci)
+        return std::unexpected(std::move(ci.error()));
+    const int64_t n = values.numel();
+    if (ri->numel() != n || ci->numel() != n)
+        return std::unexpected(make_error(
+            std::format("{}: row_idx / col_idx / values 长度须一致（{} / {} / {}）", op, ri->numel(), ci->numel(), n), Severity::Recoverable
+        ));
+
+    auto vc = values.contiguous();
+    if (!vc)
+        return std::unexpected(std::move(vc.error()));
+    auto crow = Tensor::empty({rows + 1}, DType::I64);
+    if (!crow)
+        return std::unexpected(std::move(crow.error()));
+
+    SparseCsr    out;
+    Result<void> status;
+    const auto*  rp  = static_cast<const int64_t*>(ri->const_data_ptr());
+    const auto*  cp  = static_cast<const int64_t*>(ci->const_data_ptr());
+    auto*        crp = static_cast<int64_t*>(crow->scoped_data_ptr());
+    if (values.dtype() == DType::F32)
+        triplets_to_csr(rp, cp, static_cast<const float*>(vc->const_data_ptr()), n, rows, crp, out.col_, out.values_, status);
+    else
+        triplets_to_csr(rp, cp, static_cast<const double*>(vc->const_data_ptr()), n, rows, crp, out.col_, out.values_, status);
+    if (!status)
+        return std::unexpected(std::move(status.error()));
+
+    out.crow_ = std::move(*crow);
+    out.rows_ = rows;
+    out.cols_ = cols;
+    return out;
+}
+
+auto to_dense(const SparseCsr& a) -> Result<Tensor>
+{
+    if (auto r = check_csr(a, "to_dense"); !r)
+        return std::unexpected(std::move(r.error()));
+    auto out = Tensor::zeros({a.rows(), a.cols()}, a.dtype());
+    if (!out)
+        return std::unexpected(std::move(out.error()));
+    const auto view = make_view(a);
+    if (a.dtype() == DType::F32)
+        csr_to_dense(view, static_cast<float*>(out->scoped_data_ptr()));
+    else
+        csr_to_dense(view, static_cast<double*>(out->scoped_data_ptr()));
+    return out;
+}
+
+// ── 稀疏 × 稠密 ──────────────────────────────────────────────────────────────
+
+auto spmv(const SparseCsr& a, const Tensor& x) -> Result<Tensor>
+{
+    if (auto r = check_csr(a, "spmv"); !r)
+        return std::unexpected(std::move(r.error()));
+    if (auto r = check_input(x, "spmv", "x"); !r)
+        return std::unexpected(std::move(r.error()));
+    if (x.dtype() != a.dtype())
+        return std::unexpected(make_error(
+            std::format("spmv: x 的 DType::{} 与矩阵的 DType::{} 不一致", enum_to_name(x.dtype()), enum_to_name(a.dtype())), Severity::Recoverable
+        ));
+    if (x.ndim() != 1 || x.numel() != a.cols())
+        return std::unexpected(make_error(std::format("spmv: x 须为长度 {} 的一维张量", a.cols()), Severity::Recoverable));
+
+    auto xc = x.contiguous();
+    if (!xc)
+        return std::unexpected(std::move(xc.error()));
+    auto out = Tensor::empty({a.rows()}, a.dtype());
+    if (!out)
+        return std::unexpected(std::move(out.error()));
+    if (a.rows() > 0)
+        BEE_RT_DISPATCH_STMT(sp_spmv, a.dtype(), make_view(a), xc->const_data_ptr(), out->scoped_data_ptr());
+    return out;
+}
+
+auto spmm(const SparseCsr& a, const Tensor& b) -> Result<Tensor>
+{
+    if (auto r = check_csr(a, "spmm"); !r)
+        return std::unexpected(std::move(r.error()));
+    if (auto r = check_input(b, "spmm", "b"); !r)
+        return std::unexpected(std::move(r.error()));
+    if (b.dtype() != a.dtype())
+        return std::unexpected(make_error(
+            std::format("spmm: b 的 DType::{} 与矩阵的 DType::{} 不一致", enum_to_name(b.dtype()), enum_to_name(a.dtype())), Severity::Recoverable
+        ));
+    if (b.ndim() != 2 || b.shape()[0] != a.cols())
+        return std::unexpected(make_error(std::format("spmm: b 须为 2D 且首维为 {}", a.cols()), Severity::Recoverable));
+
+    auto bc = b.contiguous();
+    if (!bc)
+        return std::unexpected(std::move(bc.error()));
+    const int64_t n   = b.shape()[1];
+    auto          out = Tensor::empty({a.rows(), n}, a.dtype());
+    if (!out)
+        return std::unexpected(std::move(out.error()));
+    if (a.rows() > 0 && n > 0)
+        BEE_RT_DISPATCH_STMT(sp_spmm, a.dtype(), make_view(a), n, bc->const_data_ptr(), out->scoped_data_ptr());
+    return out;
+}
+
+} // namespace bee
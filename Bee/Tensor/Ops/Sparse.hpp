@@ -0,0 +1,63 @@
+#pragma once
+
+// 稀疏 CSR 矩阵与稀疏 × 稠密乘法（当前仅 CPU，F32/F64）：
+//   to_sparse_csr            ：稠密 2D 张量 → CSR，丢弃值为 0 的元素（NaN 保留）
+//   sparse_csr_from_triplets ：COO 三元组 (row, col, value) → CSR，行内按列排序，重复坐标求和
+//   to_dense                 ：CSR → 稠密 {rows, cols}
+//   spmv                     ：A·x，x={cols} → {rows}
+//   spmm                     ：A·b，b={cols, N} → {rows, N}
+// spmv / spmm 的行并行按 nnz 而非行数均衡切分；输出均为新的连续张量。
+
+#include "Base/Diagnostics/Error.hpp"
+#include "Tensor/Core/Tensor.hpp"
+
+namespace bee
+{
+
+// CSR 稀疏矩阵：crow_indices={rows+1}（I64），col_indices={nnz}（I32，行内严格升序），values={nnz}（F32/F64）
+// 三个数组均为连续 CPU 张量；列数上限为 I32 最大值。拷贝为浅拷贝（共享数组）
+class SparseCsr
+{
+public:
+    SparseCsr() = default;
+
+    [[nodiscard]] auto defined() const noexcept -> bool { return values_.defined(); }
+
+    [[nodiscard]] auto rows() const noexcept -> int64_t { return rows_; }
+
+    [[nodiscard]] auto cols() const noexcept -> int64_t { return cols_; }
+
+    [[nodiscard]] auto nnz() const noexcept -> int64_t { return values_.defined() ? values_.numel() : 0; }
+
+    [[nodiscard]] auto dtype() const noexcept -> DType { return values_.defined() ? values_.dtype() : DType::F32; }
+
+    [[nodiscard]] auto crow_indices() const noexcept -> const Tensor& { return crow_; }
+
+    [[nodiscard]] auto col_indices() const noexcept -> const Tensor& { return col_; }
+
+    [[nodiscard]] auto values() const noexcept -> const Tensor& { return values_; }
+
+private:
+    friend auto to_sparse_csr(const Tensor& dense) -> Result<SparseCsr>;
+    friend auto sparse_csr_from_triplets(int64_t rows, int64_t cols, const Tensor& row_idx, const Tensor& col_idx, const Tensor& values)
+        -> Result<SparseCsr>;
+
+    Tensor  crow_;
+    Tensor  col_;
+    Tensor  values_;
+    int64_t rows_ = 0;
+    int64_t cols_ = 0;
+};
+
+[[nodiscard]] auto to_sparse_csr(const Tensor& dense) -> Result<SparseCsr>;
+
+// row_idx / col_idx 为等长一维 I32/I64，取值分别落在 [0, rows) / [0, cols)；values 为同长一维 F32/F64
+[[nodiscard]] auto sparse_csr_from_triplets(int64_t rows, int64_t cols, const Tensor& row_idx, const Tensor& col_idx, const Tensor& values)
+    -> Result<SparseCsr>;
+
+[[nodiscard]] auto to_dense(const SparseCsr& a) -> Result<Tensor>;
+
+[[nodiscard]] auto spmv(const SparseCsr& a, const Tensor& x) -> Result<Tensor>;
+[[nodiscard]] auto spmm(const SparseCsr& a, const Tensor& b) -> Result<Tensor>;
+
+} // namespace bee
@@ -9,12 +9,22 @@
 #include "Tensor/Core/Storage.hpp"
 #include "Tensor/Core/TensorImpl.hpp"
 #include "Tensor/Core/Tensor.hpp"
+#include "Tensor/Ops/Attention.hpp"
 #include "Tensor/Ops/Broadcast.hpp"
 #include "Tensor/Ops/Cast.hpp"
+#include "Tensor/Ops/Concat.hpp"
+#include "Tensor/Ops/Conv.hpp"
 #include "Tensor/Ops/ElementWise.hpp"
+#include "Tensor/Ops/Index.hpp"
+#include "Tensor/Ops/Mask.hpp"
 #include "Tensor/Ops/Matmul.hpp"
+#include "Tensor/Ops/Quantize.hpp"
+#include "Tensor/Ops/Norm.hpp"
 #include "Tensor/Ops/Random.hpp"
 #include "Tensor/Ops/Reduce.hpp"
+#include "Tensor/Ops/Scan.hpp"
+#include "Tensor/Ops/Sort.hpp"
+#include "Tensor/Ops/Sparse.hpp"
 #include "Tensor/Cuda/Backend.hpp"
 
 #include <string_view>
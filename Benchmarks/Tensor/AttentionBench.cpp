@@ -0,0 +1,93 @@
+/**
+ * @File AttentionBench.cpp
+ * @Brief 融合 attention 与 matmul → softmax → matmul 组合对照（F32，{B, H, L, D}）。
+ *
+ * "gflops" 以两次乘法 4·B·H·L²·D 计（causal 同样按满矩阵计，便于横向对照有效吞吐）。
+ * 组合版本每个头都物化 {L, L} 分数矩阵并经 max / sub / exp / sum / div 五次遍历，
+ * L ≥ 2K 时分数矩阵超出缓存，两者差距随 L 增大。
+ */
+
+#include "BenchUtil.hpp"
+
+#include "Tensor/Ops/Attention.hpp"
+#include "Tensor/Ops/ElementWise.hpp"
+#include "Tensor/Ops/Matmul.hpp"
+#include "Tensor/Ops/Reduce.hpp"
+
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+
+using namespace bee;
+using namespace bee::bench;
+
+// 组合版本的就地步骤：失败即中止
+void must_ok(Result<void>&& r)
+{
+    if (!r)
+        std::abort();
+}
+
+void set_flops(benchmark::State& state, int64_t bh, int64_t l, int64_t d)
+{
+    const double flops       = 4.0 * static_cast<double>(bh) * l * l * d;
+    state.counters["gflops"] = benchmark::Counter(flops, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1000);
+}
+
+// args：{B·H, L, D, causal}
+void BM_AttentionFused(benchmark::State& state)
+{
+    const int64_t bh = state.range(0);
+    const int64_t l  = state.range(1);
+    const int64_t d  = state.range(2);
+
+    auto q = bench_must(Tensor::full(Shape{bh, l, d}, DType::F32, 0.01));
+    auto k = bench_must(Tensor::full(Shape{bh, l, d}, DType::F32, 0.02));
+    auto v = bench_must(Tensor::full(Shape{bh, l, d}, DType::F32, 0.5));
+
+    const AttentionOptions opt{.is_causal = state.range(3) != 0};
+    for (auto _ : state) {
+        auto o = bench_must(attention(q, k, v, {}, opt));
+        benchmark::DoNotOptimize(o);
+        benchmark::ClobberMemory();
+    }
+    set_flops(state, bh, l, d);
+}
+BENCHMARK(BM_AttentionFused)
+    ->Args({16, 512, 64, 0})
+    ->Args({16, 2048, 64, 0})
+    ->Args({8, 4096, 64, 0})
+    ->Args({8, 4096, 64, 1})
+    ->Args({16, 1024, 128, 0})
+    ->Unit(benchmark::kMillisecond);
+
+// args：{B·H, L, D}
+void BM_AttentionUnfused(benchmark::State& state)
+{
+    const int64_t bh = state.range(0);
+    const int64_t l  = state.range(1);
+    const int64_t d  = state.range(2);
+
+    auto q     = bench_must(Tensor::full(Shape{bh, l, d}, DType::F32, 0.01));
+    auto kt    = bench_must(Tensor::full(Shape{bh, d, l}, DType::F32, 0.02));
+    auto v     = bench_must(Tensor::full(Shape{bh, l, d}, DType::F32, 0.5));
+    auto scale = bench_must(Tensor::full(Shape{1}, DType::F32, 1.0 / std::sqrt(static_cast<double>(d))));
+    for (auto _ : state) {
+        auto s = bench_must(matmul(q, kt));
+        must_ok(mul_inplace(s, scale));
+        auto m = bench_must(max(s, 2, true));
+        must_ok(sub_inplace(s, m));
+        must_ok(exp_inplace(s));
+        auto z = bench_must(sum(s, 2, true));
+        must_ok(div_inplace(s, z));
+        auto o = bench_must(matmul(s, v));
+        benchmark::DoNotOptimize(o);
+        benchmark::ClobberMemory();
+    }
+    set_flops(state, bh, l, d);
+}
+BENCHMARK(BM_AttentionUnfused)->Args({16, 512, 64})->Args({16, 2048, 64})->Args({8, 4096, 64})->Args({16, 1024, 128})->Unit(benchmark::kMillisecond);
+
+} // namespace
@@ -0,0 +1,68 @@
+/**
+ * @File CloneBench.cpp
+ * @Brief clone 写时复制：防御性 clone 后只读 vs 首次写入触发物化，以及部分视图的立即拷贝。
+ *        只读路径应与尺寸无关；写入路径等价于一次整块 memcpy。
+ */
+
+#include "BenchUtil.hpp"
+
+using bee::Tensor;
+using bee::DType;
+using bee::Shape;
+using bee::bench::bench_must;
+
+namespace {
+
+// clone 后只读，不产生拷贝
+void BM_Clone_F32_ReadOnly(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    auto src = bench_must(Tensor::full(Shape{n}, DType::F32, 1.0));
+    for (auto _ : state) {
+        auto c = bench_must(src.clone());
+        benchmark::DoNotOptimize(c.const_data_ptr());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * n);
+}
+
+// clone 后首次写入：物化一次整块拷贝
+void BM_Clone_F32_FirstWrite(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    auto src = bench_must(Tensor::full(Shape{n}, DType::F32, 1.0));
+    for (auto _ : state) {
+        auto c = bench_must(src.clone());
+        static_cast<float*>(c.data_ptr())[0] = 2.0f;
+        benchmark::DoNotOptimize(c.const_data_ptr());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * n * 4 * 2);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * n);
+}
+
+// 部分视图（前半段）：不共享，立即紧凑拷贝
+void BM_Clone_F32_PartialView(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    auto src  = bench_must(Tensor::full(Shape{n}, DType::F32, 1.0));
+    auto half = bench_must(src.slice(0, 0, n / 2));
+    for (auto _ : state) {
+        auto c = bench_must(half.clone());
+        benchmark::DoNotOptimize(c.const_data_ptr());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * (n / 2) * 4 * 2);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * (n / 2));
+}
+
+} // namespace
+
+BENCHMARK(BM_Clone_F32_ReadOnly)
+    ->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 22)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Clone_F32_FirstWrite)
+    ->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 22)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Clone_F32_PartialView)
+    ->Arg(1 << 16)->Arg(1 << 20)->Arg(1 << 22)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,89 @@
+/**
+ * @File ConcatBench.cpp
+ * @Brief cat / stack 拷贝带宽（F32）：
+ *        dim=0 每个输入一整段、dim=last 为大量短段，两者都按输出字节均分并行；
+ *        输出超过 4 MB 时走 NT-store。对照组为先分配输出、再逐输入逐行 memcpy 的单线程手写循环。
+ */
+
+#include "BenchUtil.hpp"
+
+#include "Tensor/Ops/Concat.hpp"
+
+#include <cstring>
+#include <vector>
+
+namespace
+{
+
+using namespace bee;
+using namespace bee::bench;
+
+auto make_inputs(int64_t count, int64_t rows, int64_t cols) -> std::vector<Tensor>
+{
+    std::vector<Tensor> v;
+    for (int64_t i = 0; i < count; ++i)
+        v.push_back(bench_must(Tensor::full(Shape{rows, cols}, DType::F32, static_cast<double>(i))));
+    return v;
+}
+
+void set_bytes(benchmark::State& state, const Tensor& out)
+{
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * out.numel() * 4 * 2);
+}
+
+// args：{输入个数, rows, cols, dim}
+void BM_Cat_F32(benchmark::State& state)
+{
+    const auto ins = make_inputs(state.range(0), state.range(1), state.range(2));
+    const auto dim = static_cast<int>(state.range(3));
+    Tensor     last;
+    for (auto _ : state) {
+        last = bench_must(cat(std::span<const Tensor>(ins), dim));
+        benchmark::DoNotOptimize(last.impl().get());
+    }
+    set_bytes(state, last);
+}
+BENCHMARK(BM_Cat_F32)
+    ->Args({4, 256, 256, 0})
+    ->Args({4, 256, 256, 1})
+    ->Args({8, 1024, 1024, 0})
+    ->Args({8, 1024, 1024, 1})
+    ->Args({64, 4096, 16, 1})
+    ->Unit(benchmark::kMicrosecond);
+
+// args：{输入个数, rows, cols}
+void BM_Stack_F32(benchmark::State& state)
+{
+    const auto ins = make_inputs(state.range(0), state.range(1), state.range(2));
+    Tensor     last;
+    for (auto _ : state) {
+        last = bench_must(stack(std::span<const Tensor>(ins), 0));
+        benchmark::DoNotOptimize(last.impl().get());
+    }
+    set_bytes(state, last);
+}
+BENCHMARK(BM_Stack_F32)->Args({32, 224, 224})->Args({8, 1024, 1024})->Unit(benchmark::kMicrosecond);
+
+// 对照：先分配输出，再逐输入按行 memcpy（沿 dim=1 拼接的手写循环）
+void BM_Cat_F32_HandLoop(benchmark::State& state)
+{
+    const auto    ins  = make_inputs(state.range(0), state.range(1), state.range(2));
+    const int64_t rows = state.range(1);
+    const int64_t cols = state.range(2);
+    const int64_t n    = state.range(0);
+    Tensor        last;
+    for (auto _ : state) {
+        last      = bench_must(Tensor::empty(Shape{rows, cols * n}, DType::F32));
+        auto* out = static_cast<float*>(last.data_ptr());
+        for (int64_t i = 0; i < n; ++i) {
+            const auto* src = static_cast<const float*>(ins[static_cast<std::size_t>(i)].data_ptr());
+            for (int64_t r = 0; r < rows; ++r)
+                std::memcpy(out + r * cols * n + i * cols, src + r * cols, static_cast<std::size_t>(cols) * 4);
+        }
+        benchmark::DoNotOptimize(out);
+    }
+    set_bytes(state, last);
+}
+BENCHMARK(BM_Cat_F32_HandLoop)->Args({4, 256, 256})->Args({8, 1024, 1024})->Args({64, 4096, 16})->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,75 @@
+/**
+ * @File ConvBench.cpp
+ * @Brief conv2d / max_pool2d / avg_pool2d 基准（NCHW，F32）。
+ *
+ * 卷积用例 "gflops" 以 2·N·Cout·OH·OW·(C / groups)·KH·KW 计：3x3（padding 1）、1x1 pointwise 与 depthwise 3x3，
+ * 形状取自常见 CNN 的中间层。池化用例报告 bytes/s（输入 + 输出）。
+ */
+
+#include "BenchUtil.hpp"
+
+#include "Tensor/Ops/Conv.hpp"
+
+namespace
+{
+
+using namespace bee;
+using namespace bee::bench;
+
+// args：{N, C, HW, Cout, K, groups}；stride 1，padding K / 2
+void BM_Conv2d(benchmark::State& state)
+{
+    const int64_t n      = state.range(0);
+    const int64_t c      = state.range(1);
+    const int64_t hw     = state.range(2);
+    const int64_t cout   = state.range(3);
+    const int64_t k      = state.range(4);
+    const int64_t groups = state.range(5);
+
+    auto x = bench_must(Tensor::full(Shape{n, c, hw, hw}, DType::F32, 0.5));
+    auto w = bench_must(Tensor::full(Shape{cout, c / groups, k, k}, DType::F32, 0.25));
+    auto b = make_filled_1d(cout, DType::F32, 0.1);
+
+    const Conv2dOptions opt{.padding = {k / 2, k / 2}, .groups = groups};
+    for (auto _ : state) {
+        auto y = bench_must(conv2d(x, w, b, opt));
+        benchmark::DoNotOptimize(y);
+        benchmark::ClobberMemory();
+    }
+    const double flops       = 2.0 * static_cast<double>(n) * cout * hw * hw * (c / groups) * k * k;
+    state.counters["gflops"] = benchmark::Counter(flops, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1000);
+}
+BENCHMARK(BM_Conv2d)
+    ->Name("BM_Conv2d_3x3")
+    ->Args({1, 64, 56, 64, 3, 1})
+    ->Args({8, 64, 56, 64, 3, 1})
+    ->Args({1, 256, 14, 256, 3, 1})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Conv2d)->Name("BM_Conv2d_1x1")->Args({1, 64, 56, 256, 1, 1})->Args({8, 256, 14, 1024, 1, 1})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Conv2d)->Name("BM_Conv2d_Depthwise3x3")->Args({1, 128, 56, 128, 3, 128})->Args({8, 256, 28, 256, 3, 256})->Unit(benchmark::kMillisecond);
+
+// args：{N, C, HW, K, stride}；padding K / 2
+template <bool IsMax>
+void BM_Pool2d(benchmark::State& state)
+{
+    const int64_t n  = state.range(0);
+    const int64_t c  = state.range(1);
+    const int64_t hw = state.range(2);
+    const int64_t k  = state.range(3);
+    const int64_t s  = state.range(4);
+
+    auto x = bench_must(Tensor::full(Shape{n, c, hw, hw}, DType::F32, 0.5));
+
+    const Pool2dOptions opt{.kernel = {k, k}, .stride = {s, s}, .padding = {k / 2, k / 2}};
+    const int64_t       out_numel = n * c * ((hw + 2 * (k / 2) - k) / s + 1) * ((hw + 2 * (k / 2) - k) / s + 1);
+    for (auto _ : state) {
+        auto y = bench_must(IsMax ? max_pool2d(x, opt) : avg_pool2d(x, opt));
+        benchmark::DoNotOptimize(y);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * (x.numel() + out_numel) * static_cast<int64_t>(sizeof(float)));
+}
+BENCHMARK(BM_Pool2d<true>)->Name("BM_MaxPool2d")->Args({8, 64, 112, 3, 2})->Args({8, 64, 56, 3, 1})->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Pool2d<false>)->Name("BM_AvgPool2d")->Args({8, 64, 112, 3, 2})->Args({8, 64, 56, 3, 1})->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,95 @@
+/**
+ * @File HalfBench.cpp
+ * @Brief F16 / BF16 存储基准：批量转换吞吐、逐元素与 F32 对照、matmul / GEMV 的 16 位权重与 F32 对照。
+ *
+ * 转换用例报告 bytes/s（源 + 目标）；add 用例同尺寸下 half 读写字节数为 F32 的一半，
+ * 带宽受限区间应接近 2× 吞吐。matmul 用例 "gflops" 以 2·M·N·K 计，{1, n} 为 GEMV（按权重字节计带宽）。
+ */
+
+#include "BenchUtil.hpp"
+
+#include "Tensor/Ops/Cast.hpp"
+#include "Tensor/Ops/ElementWise.hpp"
+#include "Tensor/Ops/Matmul.hpp"
+
+namespace
+{
+
+using namespace bee;
+using namespace bee::bench;
+
+template <DType SrcDT, DType DstDT>
+void BM_HalfCast(benchmark::State& state)
+{
+    const int64_t n   = state.range(0);
+    auto          src = make_filled_1d(n, SrcDT, 1.25);
+    for (auto _ : state) {
+        auto dst = bench_must(cast(src, DstDT));
+        benchmark::DoNotOptimize(dst);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * n * static_cast<int64_t>(dtype_size(SrcDT) + dtype_size(DstDT)));
+}
+BENCHMARK(BM_HalfCast<DType::F32, DType::F16>)->Name("BM_HalfCast_F32_F16")->Apply(set_shape_args_1d);
+BENCHMARK(BM_HalfCast<DType::F16, DType::F32>)->Name("BM_HalfCast_F16_F32")->Apply(set_shape_args_1d);
+BENCHMARK(BM_HalfCast<DType::F32, DType::BF16>)->Name("BM_HalfCast_F32_BF16")->Apply(set_shape_args_1d);
+BENCHMARK(BM_HalfCast<DType::BF16, DType::F32>)->Name("BM_HalfCast_BF16_F32")->Apply(set_shape_args_1d);
+
+template <DType DT>
+void BM_HalfAdd(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    auto          a = make_filled_1d(n, DT, 1.0);
+    auto          b = make_filled_1d(n, DT, 2.0);
+    for (auto _ : state) {
+        auto c = bench_must(add(a, b));
+        benchmark::DoNotOptimize(c);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * n * 3 * static_cast<int64_t>(dtype_size(DT)));
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_HalfAdd<DType::F32>)->Name("BM_HalfAdd_F32")->Apply(set_shape_args_1d);
+BENCHMARK(BM_HalfAdd<DType::F16>)->Name("BM_HalfAdd_F16")->Apply(set_shape_args_1d);
+BENCHMARK(BM_HalfAdd<DType::BF16>)->Name("BM_HalfAdd_BF16")->Apply(set_shape_args_1d);
+
+// args：{m, n}；{n, n} 权重，GEMV（m = 1）时按权重字节计带宽
+template <DType DT>
+void BM_HalfMatmul(benchmark::State& state)
+{
+    const int64_t m = state.range(0);
+    const int64_t n = state.range(1);
+    auto          a = make_filled_2d(m, n, DT, 0.5);
+    auto          w = make_filled_2d(n, n, DT, 0.25);
+    for (auto _ : state) {
+        auto y = bench_must(matmul(a, w));
+        benchmark::DoNotOptimize(y);
+        benchmark::ClobberMemory();
+    }
+    const double flops       = 2.0 * static_cast<double>(m) * n * n;
+    state.counters["gflops"] = benchmark::Counter(flops, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1000);
+    state.SetBytesProcessed(state.iterations() * n * n * static_cast<int64_t>(dtype_size(DT)));
+}
+BENCHMARK(BM_HalfMatmul<DType::F32>)
+    ->Name("BM_HalfMatmul_F32")
+    ->Args({1, 2048})
+    ->Args({8, 2048})
+    ->Args({256, 256})
+    ->Args({1024, 1024})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_HalfMatmul<DType::F16>)
+    ->Name("BM_HalfMatmul_F16")
+    ->Args({1, 2048})
+    ->Args({8, 2048})
+    ->Args({256, 256})
+    ->Args({1024, 1024})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_HalfMatmul<DType::BF16>)
+    ->Name("BM_HalfMatmul_BF16")
+    ->Args({1, 2048})
+    ->Args({8, 2048})
+    ->Args({256, 256})
+    ->Args({1024, 1024})
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace
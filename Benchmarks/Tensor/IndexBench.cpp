@@ -0,0 +1,188 @@
+/**
+ * @File IndexBench.cpp
+ * @Brief 索引类算子（F32）：
+ *        index_select / embedding_bag 随机取行（软件预取 + 整行 SIMD 拷贝 / 累加，按行或按 bag 并行）；
+ *        gather 为一维随机取元素；scatter_add 分一维（沿 j 部分和 / 按目标区间划分）与按行累加两种形态。
+ *        对照组为单线程、无预取的朴素循环。
+ */
+
+#include "BenchUtil.hpp"
+
+#include "Tensor/Ops/Index.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+
+using namespace bee;
+using namespace bee::bench;
+
+// 确定性伪随机索引，取值 [0, bound)
+auto make_index(int64_t n, int64_t bound) -> Tensor
+{
+    auto     t = bench_must(Tensor::empty(Shape{n}, DType::I64));
+    auto*    p = static_cast<int64_t*>(t.data_ptr());
+    uint64_t s = 0x9E3779B97F4A7C15ull;
+    for (int64_t i = 0; i < n; ++i) {
+        s    = s * 6364136223846793005ull + 1442695040888963407ull;
+        p[i] = static_cast<int64_t>((s >> 33) % static_cast<uint64_t>(bound));
+    }
+    return t;
+}
+
+auto make_table(int64_t rows, int64_t cols) -> Tensor
+{
+    return bench_must(Tensor::full(Shape{rows, cols}, DType::F32, 0.5));
+}
+
+// ─── index_select ───────────────────────────────────────────────────────────
+
+// args：{表行数 N, 行长 D, 选取行数 J}
+void BM_IndexSelect_F32(benchmark::State& state)
+{
+    const auto a   = make_table(state.range(0), state.range(1));
+    const auto idx = make_index(state.range(2), state.range(0));
+    for (auto _ : state) {
+        auto r = bench_must(index_select(a, 0, idx));
+        benchmark::DoNotOptimize(r.data_ptr());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(2) * state.range(1) * 4 * 2);
+}
+BENCHMARK(BM_IndexSelect_F32)->Args({100000, 64, 65536})->Args({1 << 20, 16, 1 << 18})->Unit(benchmark::kMicrosecond);
+
+void BM_IndexSelect_F32_Naive(benchmark::State& state)
+{
+    const auto    a   = make_table(state.range(0), state.range(1));
+    const auto    idx = make_index(state.range(2), state.range(0));
+    const int64_t D   = state.range(1);
+    const int64_t J   = state.range(2);
+    for (auto _ : state) {
+        auto        r  = bench_must(Tensor::empty(Shape{J, D}, DType::F32));
+        const auto* ap = static_cast<const float*>(a.data_ptr());
+        const auto* ip = static_cast<const int64_t*>(idx.data_ptr());
+        auto*       rp = static_cast<float*>(r.data_ptr());
+        for (int64_t j = 0; j < J; ++j)
+            std::memcpy(rp + j * D, ap + ip[j] * D, static_cast<std::size_t>(D) * 4);
+        benchmark::DoNotOptimize(rp);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * J * D * 4 * 2);
+}
+BENCHMARK(BM_IndexSelect_F32_Naive)->Args({100000, 64, 65536})->Args({1 << 20, 16, 1 << 18})->Unit(benchmark::kMicrosecond);
+
+// ─── gather（一维随机取元素）──────────────────────────────────────────────────
+
+// args：{源长度 N, 索引数 J}
+void BM_Gather1D_F32(benchmark::State& state)
+{
+    const auto a   = bench_must(Tensor::full(Shape{state.range(0)}, DType::F32, 1.0));
+    const auto idx = make_index(state.range(1), state.range(0));
+    for (auto _ : state) {
+        auto r = bench_must(gather(a, 0, idx));
+        benchmark::DoNotOptimize(r.data_ptr());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(1));
+}
+BENCHMARK(BM_Gather1D_F32)->Args({1 << 22, 1 << 20})->Unit(benchmark::kMicrosecond);
+
+// ─── scatter_add ────────────────────────────────────────────────────────────
+
+// 一维：args：{目标长度 N, 源长度 J}
+void BM_ScatterAdd1D_F32(benchmark::State& state)
+{
+    const auto a   = bench_must(Tensor::full(Shape{state.range(0)}, DType::F32, 0.0));
+    const auto src = bench_must(Tensor::full(Shape{state.range(1)}, DType::F32, 1.0));
+    const auto idx = make_index(state.range(1), state.range(0));
+    for (auto _ : state) {
+        auto r = bench_must(scatter_add(a, 0, idx, src));
+        benchmark::DoNotOptimize(r.data_ptr());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(1));
+}
+BENCHMARK(BM_ScatterAdd1D_F32)->Args({1 << 12, 1 << 20})->Args({1 << 20, 1 << 20})->Unit(benchmark::kMicrosecond);
+
+void BM_ScatterAdd1D_F32_Naive(benchmark::State& state)
+{
+    const auto    a   = bench_must(Tensor::full(Shape{state.range(0)}, DType::F32, 0.0));
+    const auto    src = bench_must(Tensor::full(Shape{state.range(1)}, DType::F32, 1.0));
+    const auto    idx = make_index(state.range(1), state.range(0));
+    const int64_t J   = state.range(1);
+    for (auto _ : state) {
+        auto        r  = bench_must(a.clone());
+        const auto* sp = static_cast<const float*>(src.data_ptr());
+        const auto* ip = static_cast<const int64_t*>(idx.data_ptr());
+        auto*       rp = static_cast<float*>(r.data_ptr());
+        for (int64_t j = 0; j < J; ++j)
+            rp[ip[j]] += sp[j];
+        benchmark::DoNotOptimize(rp);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * J);
+}
+BENCHMARK(BM_ScatterAdd1D_F32_Naive)->Args({1 << 12, 1 << 20})->Args({1 << 20, 1 << 20})->Unit(benchmark::kMicrosecond);
+
+// 按行累加（index 沿行恒定，相当于 index_add）：args：{目标行数 N, 行长 D, 源行数 J}
+void BM_ScatterAddRows_F32(benchmark::State& state)
+{
+    const int64_t N    = state.range(0);
+    const int64_t D    = state.range(1);
+    const int64_t J    = state.range(2);
+    const auto    rows = make_index(J, N);
+    auto          idx  = bench_must(Tensor::empty(Shape{J, D}, DType::I64));
+    for (int64_t j = 0; j < J; ++j)
+        std::fill_n(static_cast<int64_t*>(idx.data_ptr()) + j * D, D, static_cast<const int64_t*>(rows.data_ptr())[j]);
+    const auto a   = make_table(N, D);
+    const auto src = make_table(J, D);
+    for (auto _ : state) {
+        auto r = bench_must(scatter_add(a, 0, idx, src));
+        benchmark::DoNotOptimize(r.data_ptr());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * J * D * 4);
+}
+BENCHMARK(BM_ScatterAddRows_F32)->Args({4096, 128, 32768})->Unit(benchmark::kMicrosecond);
+
+// ─── embedding_bag ──────────────────────────────────────────────────────────
+
+// args：{表行数 N, 行长 D, bag 数 B, 每个 bag 的索引数}
+void BM_EmbeddingBagSum_F32(benchmark::State& state)
+{
+    const int64_t B   = state.range(2);
+    const int64_t len = state.range(3);
+    const auto    w   = make_table(state.range(0), state.range(1));
+    const auto    idx = make_index(B * len, state.range(0));
+    const auto    off = bench_must(Tensor::arange(0, B * len, len, DType::I64));
+    for (auto _ : state) {
+        auto r = bench_must(embedding_bag(w, idx, off));
+        benchmark::DoNotOptimize(r.data_ptr());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * B * len * state.range(1) * 4);
+}
+BENCHMARK(BM_EmbeddingBagSum_F32)->Args({100000, 64, 2048, 32})->Args({1 << 17, 128, 512, 64})->Unit(benchmark::kMicrosecond);
+
+void BM_EmbeddingBagSum_F32_Naive(benchmark::State& state)
+{
+    const int64_t D   = state.range(1);
+    const int64_t B   = state.range(2);
+    const int64_t len = state.range(3);
+    const auto    w   = make_table(state.range(0), D);
+    const auto    idx = make_index(B * len, state.range(0));
+    for (auto _ : state) {
+        auto        r  = bench_must(Tensor::empty(Shape{B, D}, DType::F32));
+        const auto* wp = static_cast<const float*>(w.data_ptr());
+        const auto* ip = static_cast<const int64_t*>(idx.data_ptr());
+        auto*       rp = static_cast<float*>(r.data_ptr());
+        for (int64_t b = 0; b < B; ++b) {
+            float* acc = rp + b * D;
+            std::fill_n(acc, D, 0.0f);
+            for (int64_t k = b * len; k < (b + 1) * len; ++k)
+                for (int64_t d = 0; d < D; ++d)
+                    acc[d] += wp[ip[k] * D + d];
+        }
+        benchmark::DoNotOptimize(rp);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * B * len * D * 4);
+}
+BENCHMARK(BM_EmbeddingBagSum_F32_Naive)->Args({100000, 64, 2048, 32})->Args({1 << 17, 128, 512, 64})->Unit(benchmark::kMicrosecond);
+
+} // namespace
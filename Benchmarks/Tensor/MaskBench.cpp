@@ -0,0 +1,71 @@
+/**
+ * @File MaskBench.cpp
+ * @Brief 布尔掩码压缩：count_nonzero / nonzero / masked_select。
+ *        两遍并行（分块 popcount → 前缀和 → 并行写出）；密度 1% 与 50% 分别对应遍历开销与写出开销主导。
+ */
+
+#include "BenchUtil.hpp"
+
+#include <cstring>
+#include <vector>
+
+using bee::Tensor;
+using bee::DType;
+using bee::Shape;
+using bee::bench::bench_must;
+
+namespace {
+
+// 确定性伪随机 Bool 掩码，约 pct% 为 1
+Tensor make_mask(int64_t n, int pct)
+{
+    std::vector<uint8_t> v(static_cast<std::size_t>(n));
+    uint64_t s = 0x9E3779B97F4A7C15ull;
+    for (auto& x : v) {
+        s = s * 6364136223846793005ull + 1442695040888963407ull;
+        x = static_cast<int>((s >> 33) % 100) < pct ? 1 : 0;
+    }
+    auto t = bench_must(Tensor::empty(Shape{n}, DType::Bool));
+    std::memcpy(t.data_ptr(), v.data(), v.size());
+    return t;
+}
+
+void BM_Mask_CountNonzero(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    auto m = make_mask(n, static_cast<int>(state.range(1)));
+    for (auto _ : state) {
+        auto c = bench_must(bee::count_nonzero(m));
+        benchmark::DoNotOptimize(c.const_data_ptr());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * n);
+}
+
+void BM_Mask_Nonzero(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    auto m = make_mask(n, static_cast<int>(state.range(1)));
+    for (auto _ : state) {
+        auto z = bench_must(bee::nonzero(m));
+        benchmark::DoNotOptimize(z.const_data_ptr());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * n);
+}
+
+void BM_Mask_F32_MaskedSelect(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    auto m = make_mask(n, static_cast<int>(state.range(1)));
+    auto a = bee::bench::make_filled_1d(n, DType::F32, 1.0);
+    for (auto _ : state) {
+        auto s = bench_must(bee::masked_select(a, m));
+        benchmark::DoNotOptimize(s.const_data_ptr());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * n * 5);
+}
+
+} // namespace
+
+BENCHMARK(BM_Mask_CountNonzero)->Args({1 << 20, 50})->Args({1 << 24, 50})->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Mask_Nonzero)->Args({1 << 20, 1})->Args({1 << 20, 50})->Args({1 << 24, 50})->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Mask_F32_MaskedSelect)->Args({1 << 20, 1})->Args({1 << 20, 50})->Args({1 << 24, 50})->Unit(benchmark::kMicrosecond);
@@ -5,11 +5,24 @@
  *
  * 当前实现：朴素 ikj 三重循环，B4 会改为 tiled + AVX2 microkernel + 多线程。
  * 基准额外注册 "flops" Counter 以 2·M·N·K 计，便于换算 TFLOPS。
+ * 批量用例：{8,n,n} × {n,n} 广播 B，对比逐 slice 调用 2D matmul 的开销。
+ * 小 M 用例：{m,1024} × {1024,1024}，对比每次 pack B 与预打包 PackedMatrix。
+ * Linear 用例：matmul + add(bias) + add(residual) 与融合 epilogue 的 linear 对比。
+ * GEMV 用例：1×n×n 与 n×n×1，访存受限，额外报告读取矩阵的带宽（bytes_per_second）。
+ * 边界用例：M / N 非 MR / NR 整数倍（1000²、N=100 等），边界 tile 与主体同走微内核。
+ * 定长小矩阵：4096 个独立 n×n 乘法，simd::small_gemm_batched 对比 {4096,n,n} 的 matmul（bmm）；
+ * 本 TU 不带额外 ISA 标志，small_gemm 的默认 ISA 按编译器基线（x86-64 为 SSE2）选取。
+ * 分块扫描：M×K×N 覆盖深 K / 宽 N / 高 M，并以 Counter 报告本进程选定的 MC/KC/NC 与探测到的 cache 大小；
+ * 配合 BEE_GEMM_MC / BEE_GEMM_KC / BEE_GEMM_NC 环境变量可对比不同分块。
  */
 
 #include "BenchUtil.hpp"
 
+#include "Tensor/Ops/ElementWise.hpp"
 #include "Tensor/Ops/Matmul.hpp"
+#include "SIMD/SmallGemm.hpp"
+
+#include <vector>
 
 namespace
 {
@@ -80,4 +93,258 @@ BENCHMARK(BM_MatmulI32_Square)
     ->Arg(128)->Arg(256)->Arg(512)->Arg(1024)
     ->Unit(benchmark::kMillisecond);
 
+// 分块扫描：{M,K} × {K,N}，形状分别压在 MC / KC / NC 方向上
+static void BM_MatmulF32_BlockingSweep(benchmark::State& state)
+{
+    const int64_t M = state.range(0);
+    const int64_t K = state.range(1);
+    const int64_t N = state.range(2);
+    auto a = make_filled_2d(M, K, DType::F32, 1.0);
+    auto b = make_filled_2d(K, N, DType::F32, 2.0);
+    for (auto _ : state) {
+        auto c = bee::matmul(a, b);
+        benchmark::DoNotOptimize(c);
+        benchmark::ClobberMemory();
+    }
+    const double flops = 2.0 * static_cast<double>(M) * K * N;
+    state.counters["gflops"] = benchmark::Counter(
+        flops, benchmark::Counter::kIsIterationInvariantRate,
+        benchmark::Counter::OneK::kIs1000);
+
+    const auto bk = bee::gemm_blocking_info(DType::F32);
+    state.counters["MC"] = static_cast<double>(bk.mc);
+    state.counters["KC"] = static_cast<double>(bk.kc);
+    state.counters["NC"] = static_cast<double>(bk.nc);
+    state.counters["L1d_KiB"] = static_cast<double>(bk.l1d) / 1024.0;
+    state.counters["L2_KiB"] = static_cast<double>(bk.l2) / 1024.0;
+    state.counters["L3_KiB"] = static_cast<double>(bk.l3) / 1024.0;
+}
+BENCHMARK(BM_MatmulF32_BlockingSweep)
+    ->Args({512, 512, 512})
+    ->Args({1024, 1024, 1024})
+    ->Args({256, 4096, 256})
+    ->Args({2048, 256, 2048})
+    ->Args({4096, 512, 256})
+    ->Args({256, 512, 8192})
+    ->Unit(benchmark::kMillisecond);
+
+// 边界形状：M / N 不是 MR / NR 的整数倍（1000² 的行列余数、N=100 的窄输出）
+static void BM_MatmulF32_Edge(benchmark::State& state)
+{
+    const int64_t M = state.range(0);
+    const int64_t K = state.range(1);
+    const int64_t N = state.range(2);
+    auto a = make_filled_2d(M, K, DType::F32, 1.0);
+    auto b = make_filled_2d(K, N, DType::F32, 2.0);
+    for (auto _ : state) {
+        auto c = bee::matmul(a, b);
+        benchmark::DoNotOptimize(c);
+        benchmark::ClobberMemory();
+    }
+    const double flops = 2.0 * static_cast<double>(M) * K * N;
+    state.counters["gflops"] = benchmark::Counter(
+        flops, benchmark::Counter::kIsIterationInvariantRate,
+        benchmark::Counter::OneK::kIs1000);
+}
+BENCHMARK(BM_MatmulF32_Edge)
+    ->Args({1000, 1000, 1000})
+    ->Args({1021, 1024, 1021})
+    ->Args({1024, 1024, 100})
+    ->Args({4096, 256, 13})
+    ->Unit(benchmark::kMillisecond);
+
+// 定长小矩阵：4096 × (n×n · n×n)，小乘法直接走模板内核 vs Tensor 批量 matmul
+template <int N>
+static void BM_SmallGemmF32_Batched(benchmark::State& state)
+{
+    constexpr std::size_t count = 4096;
+    std::vector<float>    a(count * N * N, 1.0f);
+    std::vector<float>    b(count * N * N, 2.0f);
+    std::vector<float>    c(count * N * N);
+    for (auto _ : state) {
+        bee::simd::small_gemm_batched<N, N, N>(count, a.data(), b.data(), c.data());
+        benchmark::DoNotOptimize(c.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK_TEMPLATE(BM_SmallGemmF32_Batched, 3)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SmallGemmF32_Batched, 4)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SmallGemmF32_Batched, 8)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SmallGemmF32_Batched, 16)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_SmallGemmF32_Batched, 32)->Unit(benchmark::kMicrosecond);
+
+static void BM_MatmulF32_SmallBatched(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    auto a = make_filled_1d(4096 * n * n, DType::F32, 1.0).reshape({4096, n, n});
+    auto b = make_filled_1d(4096 * n * n, DType::F32, 2.0).reshape({4096, n, n});
+    for (auto _ : state) {
+        auto c = bee::matmul(*a, *b);
+        benchmark::DoNotOptimize(c);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * 4096);
+}
+BENCHMARK(BM_MatmulF32_SmallBatched)
+    ->Arg(3)->Arg(4)->Arg(8)->Arg(16)->Arg(32)
+    ->Unit(benchmark::kMicrosecond);
+
+// 批量广播：{B,n,n} × {n,n}，B 只 pack 一次，batch × 行块单次 parallel_for
+static void BM_MatmulF32_BatchedBroadcast(benchmark::State& state)
+{
+    constexpr int64_t batch = 8;
+    const int64_t     n     = state.range(0);
+    auto a = bench_must(Tensor::full(Shape{batch, n, n}, DType::F32, 1.0));
+    auto b = make_filled_2d(n, n, DType::F32, 2.0);
+    for (auto _ : state) {
+        auto c = bee::matmul(a, b);
+        benchmark::DoNotOptimize(c);
+        benchmark::ClobberMemory();
+    }
+    const double flops = 2.0 * static_cast<double>(batch) * n * n * n;
+    state.counters["flops/iter"] = flops;
+    state.counters["gflops"] = benchmark::Counter(
+        flops, benchmark::Counter::kIsIterationInvariantRate,
+        benchmark::Counter::OneK::kIs1000);
+    state.SetItemsProcessed(state.iterations() * batch * n * n);
+}
+BENCHMARK(BM_MatmulF32_BatchedBroadcast)
+    ->Arg(64)->Arg(128)->Arg(256)
+    ->Unit(benchmark::kMillisecond);
+
+// 小 M（推理 / 解码场景）：每次调用都要 pack 整个 B
+static void BM_MatmulF32_SmallM(benchmark::State& state)
+{
+    constexpr int64_t kn = 1024;
+    const int64_t     m  = state.range(0);
+    auto a = make_filled_2d(m, kn, DType::F32, 1.0);
+    auto b = make_filled_2d(kn, kn, DType::F32, 2.0);
+    for (auto _ : state) {
+        auto c = bee::matmul(a, b);
+        benchmark::DoNotOptimize(c);
+        benchmark::ClobberMemory();
+    }
+    const double flops = 2.0 * static_cast<double>(m) * kn * kn;
+    state.counters["gflops"] = benchmark::Counter(
+        flops, benchmark::Counter::kIsIterationInvariantRate,
+        benchmark::Counter::OneK::kIs1000);
+}
+BENCHMARK(BM_MatmulF32_SmallM)
+    ->Arg(1)->Arg(4)->Arg(8)->Arg(32)
+    ->Unit(benchmark::kMicrosecond);
+
+// 同上，B 预打包一次，循环内不再 pack
+static void BM_MatmulF32_SmallM_Prepacked(benchmark::State& state)
+{
+    constexpr int64_t kn = 1024;
+    const int64_t     m  = state.range(0);
+    auto a  = make_filled_2d(m, kn, DType::F32, 1.0);
+    auto pb = bench_must(bee::pack_matrix(make_filled_2d(kn, kn, DType::F32, 2.0)));
+    for (auto _ : state) {
+        auto c = bee::matmul(a, pb);
+        benchmark::DoNotOptimize(c);
+        benchmark::ClobberMemory();
+    }
+    const double flops = 2.0 * static_cast<double>(m) * kn * kn;
+    state.counters["gflops"] = benchmark::Counter(
+        flops, benchmark::Counter::kIsIterationInvariantRate,
+        benchmark::Counter::OneK::kIs1000);
+}
+BENCHMARK(BM_MatmulF32_SmallM_Prepacked)
+    ->Arg(1)->Arg(8)->Arg(32)
+    ->Unit(benchmark::kMicrosecond);
+
+// GEMV（解码阶段 / 逐样本打分）：{1,n} × {n,n}，带宽受限，按读取 B 的字节数计速率
+static void BM_MatmulF32_GemvRow(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    auto a = make_filled_2d(1, n, DType::F32, 1.0);
+    auto b = make_filled_2d(n, n, DType::F32, 2.0);
+    for (auto _ : state) {
+        auto c = bee::matmul(a, b);
+        benchmark::DoNotOptimize(c);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * static_cast<int64_t>(sizeof(float)));
+}
+BENCHMARK(BM_MatmulF32_GemvRow)
+    ->Arg(1024)->Arg(4096)
+    ->Unit(benchmark::kMicrosecond);
+
+// 同上，{n,n} × {n,1}：逐行点积
+static void BM_MatmulF32_GemvCol(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    auto a = make_filled_2d(n, n, DType::F32, 1.0);
+    auto b = make_filled_2d(n, 1, DType::F32, 2.0);
+    for (auto _ : state) {
+        auto c = bee::matmul(a, b);
+        benchmark::DoNotOptimize(c);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * static_cast<int64_t>(sizeof(float)));
+}
+BENCHMARK(BM_MatmulF32_GemvCol)
+    ->Arg(1024)->Arg(4096)
+    ->Unit(benchmark::kMicrosecond);
+
+// Linear 层：{n,1024} × {1024,1024} + bias{1024} + residual{n,1024}，逐算子 vs 融合
+static void BM_LinearF32_Unfused(benchmark::State& state)
+{
+    constexpr int64_t kn = 1024;
+    const int64_t     m  = state.range(0);
+    auto x    = make_filled_2d(m, kn, DType::F32, 1.0);
+    auto w    = make_filled_2d(kn, kn, DType::F32, 2.0);
+    auto bias = make_filled_1d(kn, DType::F32, 0.5);
+    auto res  = make_filled_2d(m, kn, DType::F32, 0.25);
+    for (auto _ : state) {
+        auto y  = bench_must(bee::matmul(x, w));
+        auto yb = bench_must(bee::add(y, bias));
+        auto yr = bench_must(bee::add(yb, res));
+        benchmark::DoNotOptimize(yr);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_LinearF32_Unfused)
+    ->Arg(32)->Arg(256)
+    ->Unit(benchmark::kMicrosecond);
+
+static void BM_LinearF32_Fused(benchmark::State& state)
+{
+    constexpr int64_t kn = 1024;
+    const int64_t     m  = state.range(0);
+    auto x    = make_filled_2d(m, kn, DType::F32, 1.0);
+    auto w    = make_filled_2d(kn, kn, DType::F32, 2.0);
+    auto bias = make_filled_1d(kn, DType::F32, 0.5);
+    auto res  = make_filled_2d(m, kn, DType::F32, 0.25);
+    for (auto _ : state) {
+        auto y = bee::linear(x, w, bias, bee::Activation::None, res);
+        benchmark::DoNotOptimize(y);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_LinearF32_Fused)
+    ->Arg(32)->Arg(256)
+    ->Unit(benchmark::kMicrosecond);
+
+// 同上，权重预打包（推理常见形态）
+static void BM_LinearF32_FusedPrepacked(benchmark::State& state)
+{
+    constexpr int64_t kn = 1024;
+    const int64_t     m  = state.range(0);
+    auto x    = make_filled_2d(m, kn, DType::F32, 1.0);
+    auto pw   = bench_must(bee::pack_matrix(make_filled_2d(kn, kn, DType::F32, 2.0)));
+    auto bias = make_filled_1d(kn, DType::F32, 0.5);
+    auto res  = make_filled_2d(m, kn, DType::F32, 0.25);
+    for (auto _ : state) {
+        auto y = bee::linear(x, pw, bias, bee::Activation::None, res);
+        benchmark::DoNotOptimize(y);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_LinearF32_FusedPrepacked)
+    ->Arg(32)->Arg(256)
+    ->Unit(benchmark::kMicrosecond);
+
 } // namespace
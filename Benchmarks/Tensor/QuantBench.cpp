@@ -0,0 +1,122 @@
+/**
+ * @File QuantBench.cpp
+ * @Brief 量化基准：仿射量化 / 反量化吞吐，以及 u8 × s8 量化 GEMM 与同尺寸 F32 GEMM 的对比。
+ *
+ * 量化用例：per-tensor 与 per-channel（通道为最内维，参数逐元素取）的 F32 → U8 / U8 → F32，报告 bytes/s。
+ * GEMM 用例：{m,n} × {n,n}，权重预打包（PackedQMatrix / PackedMatrix），
+ * 量化侧分别输出 F32 与再量化 U8；"gops" 以 2·M·N·K 计，便于与 F32 的 gflops 对照。
+ * 权重取 50（成对和不超过 128，可走 maddubs 快路径）与 127（激活 ≥ 128 时走拆分的精确路径）两组。
+ */
+
+#include "BenchUtil.hpp"
+
+#include "Tensor/Ops/Matmul.hpp"
+#include "Tensor/Ops/Quantize.hpp"
+
+namespace
+{
+
+using namespace bee;
+using namespace bee::bench;
+
+static void BM_QuantizePerTensorU8(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    auto          x = make_filled_1d(n, DType::F32, 1.25);
+    for (auto _ : state) {
+        auto q = quantize_per_tensor(x, {0.01, 128}, DType::U8);
+        benchmark::DoNotOptimize(q);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * n * 5);
+}
+BENCHMARK(BM_QuantizePerTensorU8)->Arg(kShapeSmall)->Arg(kShapeMedium)->Arg(kShapeLarge);
+
+static void BM_QuantizePerChannelU8(benchmark::State& state)
+{
+    const int64_t n      = state.range(0);
+    const int64_t C      = 256;
+    auto          x      = make_filled_2d(n / C, C, DType::F32, 1.25);
+    auto          scales = make_filled_1d(C, DType::F32, 0.01);
+    auto          zps    = make_filled_1d(C, DType::I32, 128);
+    for (auto _ : state) {
+        auto q = quantize_per_channel(x, scales, zps, -1, DType::U8);
+        benchmark::DoNotOptimize(q);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * n * 5);
+}
+BENCHMARK(BM_QuantizePerChannelU8)->Arg(kShapeSmall)->Arg(kShapeMedium)->Arg(kShapeLarge);
+
+static void BM_DequantizePerTensorU8(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    auto          q = make_filled_1d(n, DType::U8, 200);
+    for (auto _ : state) {
+        auto x = dequantize_per_tensor(q, {0.01, 128});
+        benchmark::DoNotOptimize(x);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * n * 5);
+}
+BENCHMARK(BM_DequantizePerTensorU8)->Arg(kShapeSmall)->Arg(kShapeMedium)->Arg(kShapeLarge);
+
+auto set_gemm_counters(benchmark::State& state, int64_t m, int64_t n, const char* name) -> void
+{
+    const double ops = 2.0 * static_cast<double>(m) * n * n;
+    state.counters[name] = benchmark::Counter(ops, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::OneK::kIs1000);
+}
+
+// args：{m, n, 权重值, 输出再量化?}；权重 127 时成对和超过 128，激活 200 ≥ 128，走精确路径
+static void BM_QMatmulU8S8(benchmark::State& state)
+{
+    const int64_t m       = state.range(0);
+    const int64_t n       = state.range(1);
+    const double  w_val   = static_cast<double>(state.range(2));
+    const bool    requant = state.range(3) != 0;
+    auto          a       = make_filled_2d(m, n, DType::U8, 200);
+    auto          w       = make_filled_2d(n, n, DType::I8, w_val);
+    auto          ws      = make_filled_1d(n, DType::F32, 0.01);
+    auto          bias    = make_filled_1d(n, DType::F32, 0.5);
+    auto          pw      = bench_must(pack_qmatrix(w, ws));
+    for (auto _ : state) {
+        auto y = quantized_matmul(a, {0.02, 128}, pw, bias, requant ? DType::U8 : DType::F32, {0.5, 128});
+        benchmark::DoNotOptimize(y);
+        benchmark::ClobberMemory();
+    }
+    set_gemm_counters(state, m, n, "gops");
+}
+BENCHMARK(BM_QMatmulU8S8)
+    ->Args({1, 1024, 50, 0})
+    ->Args({16, 1024, 50, 0})
+    ->Args({256, 256, 50, 0})
+    ->Args({512, 512, 50, 0})
+    ->Args({512, 512, 50, 1})
+    ->Args({512, 512, 127, 0})
+    ->Args({1024, 1024, 50, 1})
+    ->Unit(benchmark::kMicrosecond);
+
+static void BM_QMatmulF32Baseline(benchmark::State& state)
+{
+    const int64_t m    = state.range(0);
+    const int64_t n    = state.range(1);
+    auto          a    = make_filled_2d(m, n, DType::F32, 1.0);
+    auto          w    = make_filled_2d(n, n, DType::F32, 0.5);
+    auto          bias = make_filled_1d(n, DType::F32, 0.5);
+    auto          pw   = bench_must(pack_matrix(w));
+    for (auto _ : state) {
+        auto y = linear(a, pw, bias);
+        benchmark::DoNotOptimize(y);
+        benchmark::ClobberMemory();
+    }
+    set_gemm_counters(state, m, n, "gflops");
+}
+BENCHMARK(BM_QMatmulF32Baseline)
+    ->Args({1, 1024})
+    ->Args({16, 1024})
+    ->Args({256, 256})
+    ->Args({512, 512})
+    ->Args({1024, 1024})
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace
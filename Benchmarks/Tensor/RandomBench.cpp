@@ -1,12 +1,16 @@
 /**
  * @File RandomBench.cpp
- * @Brief rand / randn / randint 基线。
+ * @Brief rand / randn / randint 基线（CPU 为 Philox4x32-10，按 counter 并行、批量向量化生成）。
+ *        *_Mt19937 为替换前的单线程 std::mt19937_64 + std 分布，作对照。
  */
 
 #include "BenchUtil.hpp"
 
+#include "Tensor/Ops/ElementWise.hpp"
 #include "Tensor/Ops/Random.hpp"
 
+#include <random>
+
 using bee::Tensor;
 using bee::DType;
 using bee::Shape;
@@ -54,6 +58,124 @@ void BM_RandintI64(benchmark::State& state)
     state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * n);
 }
 
+void BM_RandF64(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    uint64_t seed = 1;
+    for (auto _ : state) {
+        auto t = bench_must(bee::rand(Shape{n}, DType::F64, seed++));
+        benchmark::DoNotOptimize(t.impl().get());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * n * 8);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * n);
+}
+
+void BM_RandnF64(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    uint64_t seed = 1;
+    for (auto _ : state) {
+        auto t = bench_must(bee::randn(Shape{n}, DType::F64, seed++));
+        benchmark::DoNotOptimize(t.impl().get());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * n * 8);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * n);
+}
+
+void BM_RandintI32(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    uint64_t seed = 1;
+    for (auto _ : state) {
+        auto t = bench_must(bee::randint(0, 1000, Shape{n}, DType::I32, seed++));
+        benchmark::DoNotOptimize(t.impl().get());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * n * 4);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * n);
+}
+
+void BM_RandF32_Mt19937(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    uint64_t seed = 1;
+    for (auto _ : state) {
+        auto t = bench_must(Tensor::empty(Shape{n}, DType::F32));
+        std::mt19937_64 eng{seed++};
+        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+        auto* p = static_cast<float*>(t.data_ptr());
+        for (int64_t i = 0; i < n; ++i)
+            p[i] = dist(eng);
+        benchmark::DoNotOptimize(t.impl().get());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * n * 4);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * n);
+}
+
+void BM_RandnF32_Mt19937(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    uint64_t seed = 1;
+    for (auto _ : state) {
+        auto t = bench_must(Tensor::empty(Shape{n}, DType::F32));
+        std::mt19937_64 eng{seed++};
+        std::normal_distribution<float> dist(0.0f, 1.0f);
+        auto* p = static_cast<float*>(t.data_ptr());
+        for (int64_t i = 0; i < n; ++i)
+            p[i] = dist(eng);
+        benchmark::DoNotOptimize(t.impl().get());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * n * 4);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * n);
+}
+
+void BM_DropoutF32(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    const auto x = bench_must(bee::randn(Shape{n}, DType::F32, 7));
+    uint64_t seed = 1;
+    for (auto _ : state) {
+        auto t = bench_must(bee::dropout(x, 0.1, seed++));
+        benchmark::DoNotOptimize(t.impl().get());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * n * 8);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * n);
+}
+
+void BM_DropoutWithMaskF32(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    const auto x = bench_must(bee::randn(Shape{n}, DType::F32, 7));
+    uint64_t seed = 1;
+    for (auto _ : state) {
+        auto r = bench_must(bee::dropout_with_mask(x, 0.1, seed++));
+        benchmark::DoNotOptimize(r.mask.impl().get());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * n * 8);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * n);
+}
+
+// 分步实现：rand → 比较出 F32 掩码 → mul → div，四个临时张量
+void BM_DropoutF32_Unfused(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    const auto x = bench_must(bee::randn(Shape{n}, DType::F32, 7));
+    const auto keep_prob = bench_must(Tensor::full(Shape{n}, DType::F32, 0.9));
+    uint64_t seed = 1;
+    for (auto _ : state) {
+        auto u = bench_must(bee::rand(Shape{n}, DType::F32, seed++));
+        auto m = bench_must(Tensor::empty(Shape{n}, DType::F32));
+        const auto* pu = static_cast<const float*>(u.data_ptr());
+        auto* pm = static_cast<float*>(m.data_ptr());
+        for (int64_t i = 0; i < n; ++i)
+            pm[i] = pu[i] >= 0.1f ? 1.0f : 0.0f;
+        auto y = bench_must(bee::mul(x, m));
+        auto t = bench_must(bee::div(y, keep_prob));
+        benchmark::DoNotOptimize(t.impl().get());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * n * 8);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * n);
+}
+
 } // namespace
 
 #define BEE_BENCH_ARGS_1D ->Arg(kShapeTiny)->Arg(kShapeSmall)->Arg(kShapeMedium)->Arg(kShapeLarge)->Unit(benchmark::kMicrosecond)
@@ -61,3 +183,11 @@ void BM_RandintI64(benchmark::State& state)
 BENCHMARK(BM_RandF32)BEE_BENCH_ARGS_1D;
 BENCHMARK(BM_RandnF32)BEE_BENCH_ARGS_1D;
 BENCHMARK(BM_RandintI64)BEE_BENCH_ARGS_1D;
+BENCHMARK(BM_RandF64)BEE_BENCH_ARGS_1D;
+BENCHMARK(BM_RandnF64)BEE_BENCH_ARGS_1D;
+BENCHMARK(BM_RandintI32)BEE_BENCH_ARGS_1D;
+BENCHMARK(BM_RandF32_Mt19937)BEE_BENCH_ARGS_1D;
+BENCHMARK(BM_RandnF32_Mt19937)BEE_BENCH_ARGS_1D;
+BENCHMARK(BM_DropoutF32)BEE_BENCH_ARGS_1D;
+BENCHMARK(BM_DropoutWithMaskF32)BEE_BENCH_ARGS_1D;
+BENCHMARK(BM_DropoutF32_Unfused)BEE_BENCH_ARGS_1D;
@@ -0,0 +1,90 @@
+/**
+ * @File SortBench.cpp
+ * @Brief 沿轴排序：大量短行（排序网络，行间并行）、中等行（行内 std::sort / 基数排序）
+ *        与单条长轴（行内并行 LSD 基数排序）；以单线程 std::stable_sort 作为长轴对照。
+ */
+
+#include "BenchUtil.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+using bee::Tensor;
+using bee::DType;
+using bee::Shape;
+using bee::bench::bench_must;
+
+namespace {
+
+template <typename T>
+std::vector<T> random_values(int64_t n)
+{
+    std::vector<T> v(static_cast<std::size_t>(n));
+    uint64_t s = 0x9E3779B97F4A7C15ull;
+    for (auto& x : v) {
+        s = s * 6364136223846793005ull + 1442695040888963407ull;
+        x = static_cast<T>(static_cast<int64_t>(s >> 34) - (int64_t{1} << 29));
+    }
+    return v;
+}
+
+template <typename T>
+Tensor random_tensor(const Shape& shape, DType dt)
+{
+    const auto v = random_values<T>(bee::numel(shape));
+    auto t = bench_must(Tensor::empty(shape, dt));
+    std::memcpy(t.data_ptr(), v.data(), v.size() * sizeof(T));
+    return t;
+}
+
+// {rows, n} 沿最后一维排序
+template <typename T>
+void BM_Sort_Rows(benchmark::State& state, DType dt)
+{
+    const int64_t rows = state.range(0);
+    const int64_t n    = state.range(1);
+    auto a = random_tensor<T>(Shape{rows, n}, dt);
+    for (auto _ : state) {
+        auto r = bench_must(bee::sort(a, -1));
+        benchmark::DoNotOptimize(r.indices.const_data_ptr());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * rows * n);
+}
+
+void BM_Sort_F32_Rows(benchmark::State& state) { BM_Sort_Rows<float>(state, DType::F32); }
+void BM_Sort_I64_Rows(benchmark::State& state) { BM_Sort_Rows<int64_t>(state, DType::I64); }
+
+void BM_Sort_F32_Argsort1D(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    auto a = random_tensor<float>(Shape{n}, DType::F32);
+    for (auto _ : state) {
+        auto r = bench_must(bee::argsort(a));
+        benchmark::DoNotOptimize(r.const_data_ptr());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * n);
+}
+
+// 对照：单线程 std::stable_sort 求 argsort
+void BM_Sort_F32_StdStableArgsort1D(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    const auto v = random_values<float>(n);
+    std::vector<int64_t> idx(static_cast<std::size_t>(n));
+    for (auto _ : state) {
+        std::iota(idx.begin(), idx.end(), int64_t{0});
+        std::stable_sort(idx.begin(), idx.end(), [&](int64_t a, int64_t b) { return v[a] < v[b]; });
+        benchmark::DoNotOptimize(idx.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * n);
+}
+
+} // namespace
+
+BENCHMARK(BM_Sort_F32_Rows)->Args({1 << 16, 8})->Args({1 << 16, 16})->Args({4096, 200})->Args({256, 4096})->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Sort_I64_Rows)->Args({1 << 16, 8})->Args({4096, 200})->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Sort_F32_Argsort1D)->Arg(1 << 20)->Arg(1 << 23)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Sort_F32_StdStableArgsort1D)->Arg(1 << 20)->Arg(1 << 23)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,136 @@
+/**
+ * @File SparseBench.cpp
+ * @Brief CSR 稀疏 × 稠密：~1% 密度下 spmv / spmm 对照同尺寸稠密 matmul，
+ *        以及少数超长行 + 大量短行的倾斜分布（检验按 nnz 而非行数切分的负载均衡）。
+ */
+
+#include "BenchUtil.hpp"
+
+#include <cstring>
+#include <vector>
+
+using bee::Tensor;
+using bee::DType;
+using bee::Shape;
+using bee::SparseCsr;
+using bee::bench::bench_must;
+
+namespace {
+
+// 确定性稀疏方阵：row_nnz(r) 给出第 r 行的非零个数，列位置由 LCG 决定
+template <typename RowNnz>
+Tensor make_sparse_dense(int64_t n, RowNnz row_nnz)
+{
+    std::vector<float> v(static_cast<std::size_t>(n * n), 0.0f);
+    uint64_t s = 0x9E3779B97F4A7C15ull;
+    for (int64_t r = 0; r < n; ++r) {
+        const int64_t k = row_nnz(r);
+        for (int64_t i = 0; i < k; ++i) {
+            s = s * 6364136223846793005ull + 1442695040888963407ull;
+            v[static_cast<std::size_t>(r * n + static_cast<int64_t>((s >> 33) % static_cast<uint64_t>(n)))] = 0.5f;
+        }
+    }
+    auto t = bench_must(Tensor::empty(Shape{n, n}, DType::F32));
+    std::memcpy(t.data_ptr(), v.data(), v.size() * sizeof(float));
+    return t;
+}
+
+Tensor uniform_1pct(int64_t n)
+{
+    return make_sparse_dense(n, [n](int64_t) { return n / 100; });
+}
+
+// 前 8 行各占 n/4 个非零，其余行 2 个：按行数均分时首个任务承担绝大部分工作
+Tensor skewed(int64_t n)
+{
+    return make_sparse_dense(n, [n](int64_t r) { return r < 8 ? n / 4 : int64_t{2}; });
+}
+
+void BM_Sparse_F32_Spmv(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    const SparseCsr a = bench_must(bee::to_sparse_csr(uniform_1pct(n)));
+    auto x = bench_must(Tensor::full(Shape{n}, DType::F32, 1.0));
+    for (auto _ : state) {
+        auto y = bench_must(bee::spmv(a, x));
+        benchmark::DoNotOptimize(y.const_data_ptr());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * a.nnz());
+}
+
+void BM_Sparse_F32_SpmvSkewed(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    const SparseCsr a = bench_must(bee::to_sparse_csr(skewed(n)));
+    auto x = bench_must(Tensor::full(Shape{n}, DType::F32, 1.0));
+    for (auto _ : state) {
+        auto y = bench_must(bee::spmv(a, x));
+        benchmark::DoNotOptimize(y.const_data_ptr());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * a.nnz());
+}
+
+// 对照：同尺寸稠密矩阵 × 向量（{n, n} · {n, 1}）
+void BM_Sparse_F32_DenseMatvec(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    auto d = uniform_1pct(n);
+    auto x = bench_must(Tensor::full(Shape{n, 1}, DType::F32, 1.0));
+    for (auto _ : state) {
+        auto y = bench_must(bee::matmul(d, x));
+        benchmark::DoNotOptimize(y.const_data_ptr());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * n * n);
+}
+
+void BM_Sparse_F32_Spmm(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    const int64_t k = state.range(1);
+    const SparseCsr a = bench_must(bee::to_sparse_csr(uniform_1pct(n)));
+    auto b = bench_must(Tensor::full(Shape{n, k}, DType::F32, 1.0));
+    for (auto _ : state) {
+        auto c = bench_must(bee::spmm(a, b));
+        benchmark::DoNotOptimize(c.const_data_ptr());
+    }
+    state.counters["flops"] = benchmark::Counter(
+        static_cast<double>(state.iterations()) * 2.0 * static_cast<double>(a.nnz() * k),
+        benchmark::Counter::kIsRate);
+}
+
+void BM_Sparse_F32_DenseMatmul(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    const int64_t k = state.range(1);
+    auto d = uniform_1pct(n);
+    auto b = bench_must(Tensor::full(Shape{n, k}, DType::F32, 1.0));
+    for (auto _ : state) {
+        auto c = bench_must(bee::matmul(d, b));
+        benchmark::DoNotOptimize(c.const_data_ptr());
+    }
+    state.counters["flops"] = benchmark::Counter(
+        static_cast<double>(state.iterations()) * 2.0 * static_cast<double>(n * n * k),
+        benchmark::Counter::kIsRate);
+}
+
+void BM_Sparse_F32_FromDense(benchmark::State& state)
+{
+    const int64_t n = state.range(0);
+    auto d = uniform_1pct(n);
+    for (auto _ : state) {
+        auto a = bench_must(bee::to_sparse_csr(d));
+        benchmark::DoNotOptimize(a.values().const_data_ptr());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * n * n * 4);
+}
+
+} // namespace
+
+BENCHMARK(BM_Sparse_F32_Spmv)->Arg(2048)->Arg(8192)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Sparse_F32_SpmvSkewed)->Arg(2048)->Arg(8192)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Sparse_F32_DenseMatvec)->Arg(2048)->Arg(8192)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Sparse_F32_Spmm)->Args({2048, 64})->Args({4096, 128})->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Sparse_F32_DenseMatmul)->Args({2048, 64})->Args({4096, 128})->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Sparse_F32_FromDense)->Arg(2048)->Arg(8192)->Unit(benchmark::kMicrosecond);
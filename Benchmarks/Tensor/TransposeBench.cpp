@@ -1,6 +1,6 @@
 /**
  * @File TransposeBench.cpp
- * @Brief transpose + contiguous 基线：covers 2D 方阵与高长宽比矩阵。
+ * @Brief transpose / permute + contiguous 基线：covers 2D 方阵、高长宽比矩阵与 4D 常见 permute。
  *        transpose 自身零拷贝，我们关心 strided→contiguous 物化的带宽。
  */
 
@@ -43,6 +43,41 @@ void BM_Transpose_Contig_F32_Tall(benchmark::State& state)
     state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * n * k);
 }
 
+// 4D permute：{N, C, H, W} → {N, H, W, C}（合并后为批量转置平面）
+void BM_Permute_Contig_F32_NchwToNhwc(benchmark::State& state)
+{
+    const int64_t c  = state.range(0);
+    const int64_t hw = state.range(1);
+    constexpr int64_t n = 8;
+    auto src = bench_must(Tensor::full(Shape{n, c, hw, hw}, DType::F32, 1.0));
+    for (auto _ : state) {
+        auto p = bench_must(src.permute({0, 2, 3, 1}));
+        auto o = bench_must(p.contiguous());
+        benchmark::DoNotOptimize(o.impl().get());
+    }
+    const int64_t items = n * c * hw * hw;
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * items * 4 * 2);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * items);
+}
+
+// 4D permute：{B, L, H, D} → {B, H, L, D}（多头拆分，最内维 D 连续）
+void BM_Permute_Contig_F32_HeadSplit(benchmark::State& state)
+{
+    const int64_t l = state.range(0);
+    const int64_t d = state.range(1);
+    constexpr int64_t b = 4;
+    constexpr int64_t h = 12;
+    auto src = bench_must(Tensor::full(Shape{b, l, h, d}, DType::F32, 1.0));
+    for (auto _ : state) {
+        auto p = bench_must(src.permute({0, 2, 1, 3}));
+        auto o = bench_must(p.contiguous());
+        benchmark::DoNotOptimize(o.impl().get());
+    }
+    const int64_t items = b * l * h * d;
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * items * 4 * 2);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * items);
+}
+
 } // namespace
 
 BENCHMARK(BM_Transpose_Contig_F32_Square)
@@ -52,3 +87,11 @@ BENCHMARK(BM_Transpose_Contig_F32_Square)
 BENCHMARK(BM_Transpose_Contig_F32_Tall)
     ->Arg(1024)->Arg(16384)->Arg(262144)
     ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Permute_Contig_F32_NchwToNhwc)
+    ->Args({64, 56})->Args({256, 14})->Args({3, 224})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_Permute_Contig_F32_HeadSplit)
+    ->Args({512, 64})->Args({2048, 64})
+    ->Unit(benchmark::kMicrosecond);
@@ -1,9 +1,12 @@
 #include <gtest/gtest.h>
 
 #include "SIMD/SIMD.hpp"
+#include "SIMD/SmallGemm.hpp"
 
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 
 using namespace bee::simd;
 
@@ -70,6 +73,7 @@ TEST(SimdScalar, Float_AddSubMulDiv)
     EXPECT_FLOAT_EQ(B::sub(B::set1(3.0f), B::set1(2.0f)), 1.0f);
     EXPECT_FLOAT_EQ(B::mul(B::set1(3.0f), B::set1(2.0f)), 6.0f);
     EXPECT_FLOAT_EQ(B::div(B::set1(6.0f), B::set1(2.0f)), 3.0f);
+    EXPECT_FLOAT_EQ(B::fma(B::set1(3.0f), B::set1(2.0f), B::set1(1.0f)), 7.0f);
 }
 
 TEST(SimdScalar, Float_MinMax)
@@ -184,6 +188,10 @@ TEST(SimdAvx2, Float_AddSubMulDiv)
 
     B::store(buf, B::div(a, b));
     EXPECT_FLOAT_EQ(buf[0], 3.0f);
+
+    B::store(buf, B::fma(a, b, B::set1(1.0f)));
+    for (int i = 0; i < 8; ++i)
+        EXPECT_FLOAT_EQ(buf[i], 13.0f);
 }
 
 TEST(SimdAvx2, Float_MinMax)
@@ -398,6 +406,112 @@ TEST(SimdAvx2, U8_ReduceSum)
 
 #endif // BEE_SIMD_ENABLE_AVX2
 
+// =====================================================================
+// 定长小矩阵乘（SmallGemm.hpp）
+// =====================================================================
+
+namespace
+{
+
+template <typename T>
+auto small_gemm_inputs(int count, int rows, int cols, int seed) -> std::vector<T>
+{
+    std::vector<T> v(static_cast<std::size_t>(count * rows * cols));
+    for (std::size_t i = 0; i < v.size(); ++i)
+        v[i] = static_cast<T>(static_cast<int>((i * 7 + static_cast<std::size_t>(seed) * 13) % 17) - 8) / T{4};
+    return v;
+}
+
+template <int M, int K, int N, typename T, typename ISA>
+auto check_small_gemm() -> void
+{
+    const auto     a = small_gemm_inputs<T>(1, M, K, 1);
+    const auto     b = small_gemm_inputs<T>(1, K, N, 2);
+    std::vector<T> c(static_cast<std::size_t>(M * N), T{-1});
+    bee::simd::small_gemm<M, K, N, T, ISA>(a.data(), b.data(), c.data());
+    for (int i = 0; i < M; ++i) {
+        for (int j = 0; j < N; ++j) {
+            T ref = T{0};
+            for (int k = 0; k < K; ++k)
+                ref += a[static_cast<std::size_t>(i * K + k)] * b[static_cast<std::size_t>(k * N + j)];
+            // 输入为 1/4 的整数倍，乘积与累加在 float 下均精确
+            EXPECT_EQ(c[static_cast<std::size_t>(i * N + j)], ref) << M << "x" << K << "x" << N << " i=" << i << " j=" << j;
+        }
+    }
+}
+
+template <typename T, typename ISA>
+auto check_small_gemm_shapes() -> void
+{
+    check_small_gemm<3, 3, 3, T, ISA>();
+    check_small_gemm<4, 4, 4, T, ISA>();
+    check_small_gemm<8, 8, 8, T, ISA>();
+    check_small_gemm<16, 16, 16, T, ISA>();
+    check_small_gemm<32, 32, 32, T, ISA>();
+    // 非方阵与向量宽度余数列
+    check_small_gemm<5, 7, 3, T, ISA>();
+    check_small_gemm<7, 9, 12, T, ISA>();
+    check_small_gemm<13, 6, 19, T, ISA>();
+    check_small_gemm<1, 32, 31, T, ISA>();
+}
+
+} // namespace
+
+TEST(SimdSmallGemm, MatchesNaive)
+{
+    check_small_gemm_shapes<float, bee::simd::SmallGemmIsa<float, 16>>();
+    check_small_gemm_shapes<double, bee::simd::SmallGemmIsa<double, 16>>();
+    check_small_gemm_shapes<float, IsaScalar>();
+#if defined(BEE_SMALL_GEMM_SSE2)
+    check_small_gemm_shapes<float, IsaSse2>();
+    check_small_gemm_shapes<double, IsaSse2>();
+#endif
+#if defined(BEE_SMALL_GEMM_AVX2)
+    check_small_gemm_shapes<float, IsaAvx2>();
+    check_small_gemm_shapes<double, IsaAvx2>();
+#endif
+#if defined(BEE_SMALL_GEMM_AVX512)
+    check_small_gemm_shapes<float, IsaAvx512>();
+    check_small_gemm_shapes<double, IsaAvx512>();
+#endif
+}
+
+TEST(SimdSmallGemm, DefaultIsaFitsWidth)
+{
+    // 默认 ISA 不会选比 N 更宽的寄存器
+    EXPECT_LE((SimdBackend<float, bee::simd::SmallGemmIsa<float, 3>>::width), 3u);
+    EXPECT_LE((SimdBackend<float, bee::simd::SmallGemmIsa<float, 4>>::width), 4u);
+    EXPECT_LE((SimdBackend<double, bee::simd::SmallGemmIsa<double, 3>>::width), 3u);
+#if defined(BEE_SMALL_GEMM_SSE2)
+    EXPECT_EQ((SimdBackend<float, bee::simd::SmallGemmIsa<float, 4>>::width), 4u);
+#endif
+}
+
+TEST(SimdSmallGemm, BatchedMatchesSingle)
+{
+    constexpr int count = 4099;
+    const auto    a     = small_gemm_inputs<float>(count, 4, 4, 3);
+    const auto    b     = small_gemm_inputs<float>(count, 4, 4, 4);
+    std::vector<float> c(static_cast<std::size_t>(count * 16));
+    bee::simd::small_gemm_batched<4, 4, 4>(count, a.data(), b.data(), c.data());
+
+    float ref[16];
+    for (int i = 0; i < count; ++i) {
+        bee::simd::small_gemm<4, 4, 4>(a.data() + i * 16, b.data() + i * 16, ref);
+        for (int j = 0; j < 16; ++j)
+            ASSERT_EQ(c[static_cast<std::size_t>(i * 16 + j)], ref[j]) << "i=" << i;
+    }
+
+    const auto          a3 = small_gemm_inputs<double>(100, 3, 3, 5);
+    const auto          b3 = small_gemm_inputs<double>(100, 3, 3, 6);
+    std::vector<double> c3(100 * 9);
+    bee::simd::small_gemm_batched<3, 3, 3>(100, a3.data(), b3.data(), c3.data());
+    double ref3[9];
+    bee::simd::small_gemm<3, 3, 3>(a3.data() + 99 * 9, b3.data() + 99 * 9, ref3);
+    for (int j = 0; j < 9; ++j)
+        EXPECT_EQ(c3[static_cast<std::size_t>(99 * 9 + j)], ref3[j]);
+}
+
 // =====================================================================
 // 运行期 ISA 检测测试
 // =====================================================================
@@ -440,3 +554,24 @@ TEST(SimdDetect, CompileCapabilityAtLeastRuntime)
     EXPECT_LT(isa, bee::simd::Isa::Sse2);
 #endif
 }
+
+TEST(SimdDetect, CacheSizesPlausible)
+{
+    // 探测失败的级别为 0；已知的级别应逐级不减，且多次调用结果一致
+    const auto c = bee::simd::detect_cache_sizes();
+    if (c.l1d != 0 && c.l2 != 0) {
+        EXPECT_GE(c.l2, c.l1d);
+    }
+    if (c.l2 != 0 && c.l3 != 0) {
+        EXPECT_GE(c.l3, c.l2);
+    }
+    if (c.l1d != 0) {
+        EXPECT_GE(c.l1d, std::size_t{4} * 1024);
+        EXPECT_LE(c.l1d, std::size_t{1024} * 1024);
+    }
+
+    const auto d = bee::simd::detect_cache_sizes();
+    EXPECT_EQ(c.l1d, d.l1d);
+    EXPECT_EQ(c.l2, d.l2);
+    EXPECT_EQ(c.l3, d.l3);
+}
@@ -0,0 +1,236 @@
+#include <gtest/gtest.h>
+
+#include "Tensor/Tensor.hpp"
+#include "TensorTestUtil.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace bee;
+using namespace bee::test;
+
+#define ASSERT_OK(expr)  ASSERT_TRUE((expr).has_value())
+#define ASSERT_ERR(expr) ASSERT_FALSE((expr).has_value())
+
+namespace
+{
+
+auto make_mask(const Shape& shape, const std::vector<bool>& vals) -> Tensor
+{
+    auto t = Tensor::empty(shape, DType::Bool);
+    EXPECT_TRUE(t.has_value());
+    auto* p = static_cast<bool*>(t->data_ptr());
+    for (std::size_t i = 0; i < vals.size(); ++i)
+        p[i] = vals[i];
+    return *t;
+}
+
+// 物化分数矩阵的朴素参考（double）；mask 为空表示不屏蔽，mask_stride 为 0 时所有头共享
+auto ref_attention(
+    int64_t                    BH,
+    int64_t                    Lq,
+    int64_t                    Lk,
+    int64_t                    D,
+    int64_t                    Dv,
+    const std::vector<double>& q,
+    const std::vector<double>& k,
+    const std::vector<double>& v,
+    const std::vector<bool>&   mask,
+    int64_t                    mask_stride,
+    bool                       causal,
+    double                     scale
+) -> std::vector<double>
+{
+    std::vector<double> out(static_cast<std::size_t>(BH * Lq * Dv), 0.0);
+    std::vector<double> s(static_cast<std::size_t>(Lk));
+    for (int64_t b = 0; b < BH; ++b)
+        for (int64_t i = 0; i < Lq; ++i) {
+            double mx = -std::numeric_limits<double>::infinity();
+            for (int64_t j = 0; j < Lk; ++j) {
+                const bool keep = (mask.empty() || mask[static_cast<std::size_t>(b * mask_stride + i * Lk + j)]) && (!causal || j <= i);
+                double     dot  = 0.0;
+                for (int64_t d = 0; d < D; ++d)
+                    dot += q[static_cast<std::size_t>((b * Lq + i) * D + d)] * k[static_cast<std::size_t>((b * Lk + j) * D + d)];
+                s[static_cast<std::size_t>(j)] = keep ? dot * scale : -std::numeric_limits<double>::infinity();
+                mx                             = std::max(mx, s[static_cast<std::size_t>(j)]);
+            }
+            if (mx == -std::numeric_limits<double>::infinity())
+                continue;
+            double sum = 0.0;
+            for (auto& x : s) {
+                x    = std::exp(x - mx);
+                sum += x;
+            }
+            for (int64_t j = 0; j < Lk; ++j)
+                for (int64_t c = 0; c < Dv; ++c)
+                    out[static_cast<std::size_t>((b * Lq + i) * Dv + c)] +=
+                        s[static_cast<std::size_t>(j)] / sum * v[static_cast<std::size_t>((b * Lk + j) * Dv + c)];
+        }
+    return out;
+}
+
+struct AttnCase
+{
+    int64_t B, H, Lq, Lk, D, Dv;
+    bool    causal = false;
+    double  scale  = 0.0;
+    double  amp    = 1.0;
+};
+
+template <typename T>
+auto run_case(const AttnCase& c, double tol) -> void
+{
+    const DType dt = std::is_same_v<T, float> ? DType::F32 : DType::F64;
+    const auto  qv = lcg_seq(static_cast<std::size_t>(c.B * c.H * c.Lq * c.D), 3u, c.amp);
+    const auto  kv = lcg_seq(static_cast<std::size_t>(c.B * c.H * c.Lk * c.D), 5u, c.amp);
+    const auto  vv = lcg_seq(static_cast<std::size_t>(c.B * c.H * c.Lk * c.Dv), 7u);
+
+    auto q = make_tensor<T>({c.B, c.H, c.Lq, c.D}, dt, qv);
+    auto k = make_tensor<T>({c.B, c.H, c.Lk, c.D}, dt, kv);
+    auto v = make_tensor<T>({c.B, c.H, c.Lk, c.Dv}, dt, vv);
+
+    auto out = attention(q, k, v, {}, {.scale = c.scale, .is_causal = c.causal});
+    ASSERT_OK(out);
+    EXPECT_EQ(out->shape(), (Shape{c.B, c.H, c.Lq, c.Dv}));
+
+    const double scale = c.scale != 0.0 ? c.scale : 1.0 / std::sqrt(static_cast<double>(c.D));
+    const auto   ref   = ref_attention(c.B * c.H, c.Lq, c.Lk, c.D, c.Dv, qv, kv, vv, {}, 0, c.causal, scale);
+    const auto   got   = values_of<T, double>(*out);
+    for (std::size_t i = 0; i < ref.size(); ++i)
+        ASSERT_NEAR(got[i], ref[i], tol) << "i=" << i;
+}
+
+} // namespace
+
+TEST(Attention, SingleHeadSmall)
+{
+    run_case<float>({1, 1, 5, 7, 4, 3}, 1e-5);
+}
+
+TEST(Attention, MultiHeadCrossesBlocks)
+{
+    // Lq 跨多个 query 块，Lk 跨多个 key 块且不是块大小的整数倍
+    run_case<float>({2, 3, 130, 600, 32, 40}, 1e-5);
+}
+
+TEST(Attention, OddHeadDims)
+{
+    run_case<float>({1, 2, 33, 65, 13, 7}, 1e-5);
+    run_case<float>({1, 1, 1, 1, 1, 1}, 1e-6);
+}
+
+TEST(Attention, Causal)
+{
+    run_case<float>({2, 2, 150, 150, 16, 16, true}, 1e-5);
+    run_case<float>({1, 1, 70, 300, 8, 8, true}, 1e-5); // Lq < Lk：第 i 行只看前 i + 1 个 key
+}
+
+TEST(Attention, CustomScaleAndLargeLogits)
+{
+    run_case<float>({1, 2, 40, 90, 16, 16, false, 0.5}, 1e-5);
+    // 分数量级 ~1e3：online softmax 的逐块重标定不能溢出
+    run_case<float>({1, 1, 64, 200, 16, 8, false, 0.0, 30.0}, 1e-3);
+}
+
+TEST(Attention, F64)
+{
+    run_case<double>({2, 2, 70, 130, 24, 20}, 1e-12);
+    run_case<double>({1, 1, 65, 65, 5, 3, true}, 1e-12);
+}
+
+TEST(Attention, MaskSharedAndPerHead)
+{
+    const int64_t BH = 2, Lq = 20, Lk = 37, D = 8, Dv = 6;
+    const auto    qv = lcg_seq(static_cast<std::size_t>(BH * Lq * D), 11u);
+    const auto    kv = lcg_seq(static_cast<std::size_t>(BH * Lk * D), 13u);
+    const auto    vv = lcg_seq(static_cast<std::size_t>(BH * Lk * Dv), 17u);
+    auto          q  = make_tensor<float>({BH, Lq, D}, DType::F32, qv);
+    auto          k  = make_tensor<float>({BH, Lk, D}, DType::F32, kv);
+    auto          v  = make_tensor<float>({BH, Lk, Dv}, DType::F32, vv);
+
+    const double scale = 1.0 / std::sqrt(static_cast<double>(D));
+
+    // 共享 mask：每行屏蔽一部分 key，第 3 行全部屏蔽（输出 0）
+    std::vector<bool> shared(static_cast<std::size_t>(Lq * Lk));
+    for (int64_t i = 0; i < Lq; ++i)
+        for (int64_t j = 0; j < Lk; ++j)
+            shared[static_cast<std::size_t>(i * Lk + j)] = i != 3 && (i + j) % 3 != 0;
+    auto out = attention(q, k, v, make_mask({Lq, Lk}, shared));
+    ASSERT_OK(out);
+    auto ref = ref_attention(BH, Lq, Lk, D, Dv, qv, kv, vv, shared, 0, false, scale);
+    auto got = values_of<float, double>(*out);
+    for (std::size_t i = 0; i < ref.size(); ++i)
+        ASSERT_NEAR(got[i], ref[i], 1e-5) << "i=" << i;
+    for (int64_t c = 0; c < Dv; ++c)
+        EXPECT_EQ(got[static_cast<std::size_t>(3 * Dv + c)], 0.0);
+
+    // 逐头 mask + causal
+    std::vector<bool> per_head(static_cast<std::size_t>(BH * Lq * Lk));
+    for (std::size_t i = 0; i < per_head.size(); ++i)
+        per_head[i] = (i * 7) % 5 != 0;
+    out = attention(q, k, v, make_mask({BH, Lq, Lk}, per_head), {.is_causal = true});
+    ASSERT_OK(out);
+    ref = ref_attention(BH, Lq, Lk, D, Dv, qv, kv, vv, per_head, Lq * Lk, true, scale);
+    got = values_of<float, double>(*out);
+    for (std::size_t i = 0; i < ref.size(); ++i)
+        ASSERT_NEAR(got[i], ref[i], 1e-5) << "i=" << i;
+}
+
+TEST(Attention, NonContiguousInputs)
+{
+    // {B, L, H, D} 布局经 transpose 得到 {B, H, L, D} 视图
+    const int64_t B = 2, L = 45, H = 3, D = 16;
+    const auto    qv = lcg_seq(static_cast<std::size_t>(B * L * H * D), 19u);
+    const auto    kv = lcg_seq(static_cast<std::size_t>(B * L * H * D), 23u);
+    const auto    vv = lcg_seq(static_cast<std::size_t>(B * L * H * D), 29u);
+    auto          q  = make_tensor<float>({B, L, H, D}, DType::F32, qv).transpose(1, 2);
+    auto          k  = make_tensor<float>({B, L, H, D}, DType::F32, kv).transpose(1, 2);
+    auto          v  = make_tensor<float>({B, L, H, D}, DType::F32, vv).transpose(1, 2);
+    ASSERT_OK(q);
+    ASSERT_OK(k);
+    ASSERT_OK(v);
+
+    auto out = attention(*q, *k, *v);
+    ASSERT_OK(out);
+
+    auto qc = q->contiguous();
+    auto kc = k->contiguous();
+    auto vc = v->contiguous();
+    ASSERT_OK(qc);
+    ASSERT_OK(kc);
+    ASSERT_OK(vc);
+    const double scale = 1.0 / std::sqrt(static_cast<double>(D));
+    const auto   qd    = values_of<float, double>(*qc);
+    const auto   kd    = values_of<float, double>(*kc);
+    const auto   vd    = values_of<float, double>(*vc);
+    const auto   ref   = ref_attention(B * H, L, L, D, D, qd, kd, vd, {}, 0, false, scale);
+    const auto   got   = values_of<float, double>(*out);
+    for (std::size_t i = 0; i < ref.size(); ++i)
+        ASSERT_NEAR(got[i], ref[i], 1e-5) << "i=" << i;
+}
+
+TEST(Attention, InvalidArguments)
+{
+    auto q  = make_tensor<float>({2, 4, 8}, DType::F32, lcg_seq(64, 1u));
+    auto k  = make_tensor<float>({2, 5, 8}, DType::F32, lcg_seq(80, 2u));
+    auto v  = make_tensor<float>({2, 5, 3}, DType::F32, lcg_seq(30, 3u));
+    auto kd = make_tensor<double>({2, 5, 8}, DType::F64, lcg_seq(80, 2u));
+    auto qi = Tensor::zeros({2, 4, 8}, DType::I32);
+    ASSERT_OK(qi);
+
+    ASSERT_OK(attention(q, k, v));
+    ASSERT_ERR(attention(Tensor{}, k, v));
+    ASSERT_ERR(attention(*qi, k, v));
+    ASSERT_ERR(attention(q, kd, v));
+    // D、Lk、前导维不一致
+    ASSERT_ERR(attention(q, make_tensor<float>({2, 5, 7}, DType::F32, lcg_seq(70, 2u)), v));
+    ASSERT_ERR(attention(q, k, make_tensor<float>({2, 6, 3}, DType::F32, lcg_seq(36, 3u))));
+    ASSERT_ERR(attention(q, make_tensor<float>({3, 5, 8}, DType::F32, lcg_seq(120, 2u)), v));
+    ASSERT_ERR(attention(make_tensor<float>({8}, DType::F32, lcg_seq(8, 1u)), k, v));
+    ASSERT_ERR(attention(q, k, v, make_mask({4, 4}, std::vector<bool>(16, true))));
+    ASSERT_ERR(attention(q, k, v, make_tensor<float>({4, 5}, DType::F32, lcg_seq(20, 1u))));
+    ASSERT_ERR(attention(q, k, v, {}, {.scale = -1.0}));
+}
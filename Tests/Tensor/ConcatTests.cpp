@@ -0,0 +1,277 @@
+#include <gtest/gtest.h>
+
+#include "Tensor/Tensor.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace bee;
+
+#define ASSERT_OK(expr)  ASSERT_TRUE((expr).has_value())
+#define ASSERT_ERR(expr) ASSERT_FALSE((expr).has_value())
+
+namespace
+{
+
+// 元素 i 取值 base + i（按 dtype 宽度写入位模式，适用于任意 dtype）
+auto make_iota(const Shape& shape, DType dt, uint64_t base) -> Tensor
+{
+    auto t = Tensor::empty(shape, dt);
+    EXPECT_TRUE(t.has_value());
+    const std::size_t es = dtype_size(dt);
+    auto*             p  = static_cast<uint8_t*>(t->data_ptr());
+    for (int64_t i = 0; i < t->numel(); ++i) {
+        const uint64_t v = base + static_cast<uint64_t>(i);
+        std::memcpy(p + i * static_cast<int64_t>(es), &v, es);
+    }
+    return *t;
+}
+
+// 按逻辑顺序取出全部元素的字节
+auto bytes_of(const Tensor& t) -> std::vector<uint8_t>
+{
+    auto c = t.contiguous();
+    EXPECT_TRUE(c.has_value());
+    const auto* p = static_cast<const uint8_t*>(c->data_ptr());
+    return {p, p + c->numel() * static_cast<int64_t>(dtype_size(t.dtype()))};
+}
+
+// out 沿 dim 依次切出与各输入等长的一段，逐字节比较
+void expect_cat_of(const Tensor& out, const std::vector<Tensor>& ins, int dim)
+{
+    int64_t start = 0;
+    for (const auto& in : ins) {
+        const int64_t n    = in.shape()[static_cast<std::size_t>(dim)];
+        auto          part = out.slice(dim, start, start + n);
+        ASSERT_OK(part);
+        EXPECT_EQ(part->shape(), in.shape());
+        EXPECT_EQ(bytes_of(*part), bytes_of(in));
+        start += n;
+    }
+    EXPECT_EQ(start, out.shape()[static_cast<std::size_t>(dim)]);
+}
+
+} // namespace
+
+// ═══════════════════════════════════════════════════════════════
+// cat
+// ═══════════════════════════════════════════════════════════════
+
+TEST(ConcatTests, CatEachDim)
+{
+    for (int dim = 0; dim < 3; ++dim) {
+        const auto d  = static_cast<std::size_t>(dim);
+        Shape      sa = {2, 3, 5};
+        Shape      sb = sa;
+
+        sb[d]  = 4;
+        auto a = make_iota(sa, DType::F32, 0);
+        auto b = make_iota(sb, DType::F32, 1000);
+        auto r = cat({a, b}, dim);
+        ASSERT_OK(r);
+        EXPECT_TRUE(r->is_contiguous());
+        sa[d] += 4;
+        EXPECT_EQ(r->shape(), sa);
+        expect_cat_of(*r, {a, b}, dim);
+    }
+}
+
+TEST(ConcatTests, CatKnownValues)
+{
+    // [[0,1],[2,3]] ++ [[10],[11]] 沿 dim=1 → [[0,1,10],[2,3,11]]
+    auto a = make_iota({2, 2}, DType::I32, 0);
+    auto b = make_iota({2, 1}, DType::I32, 10);
+    auto r = cat({a, b}, -1);
+    ASSERT_OK(r);
+    EXPECT_EQ(r->shape(), (Shape{2, 3}));
+    const auto* p = static_cast<const int32_t*>(r->data_ptr());
+    EXPECT_EQ((std::vector<int32_t>(p, p + 6)), (std::vector<int32_t>{0, 1, 10, 2, 3, 11}));
+}
+
+TEST(ConcatTests, CatManyInputsAndDTypes)
+{
+    for (DType dt : {DType::U8, DType::F16, DType::I64, DType::F64, DType::Bool}) {
+        std::vector<Tensor> ins;
+        for (int i = 0; i < 7; ++i)
+            ins.push_back(make_iota({3, 1 + i, 2}, dt, static_cast<uint64_t>(i) * 50));
+        auto r = cat(std::span<const Tensor>(ins), 1);
+        ASSERT_OK(r);
+        EXPECT_EQ(r->shape(), (Shape{3, 28, 2}));
+        expect_cat_of(*r, ins, 1);
+    }
+}
+
+TEST(ConcatTests, CatNonContiguousInputs)
+{
+    // dim=0 时输出区间连续，非连续输入直接 strided 拷贝到位；dim=1 时经临时连续张量
+    auto a  = make_iota({6, 4}, DType::F32, 0);
+    auto b  = make_iota({5, 4}, DType::F32, 100);
+    auto at = a.transpose(0, 1); // {4, 6}
+    auto bt = b.transpose(0, 1); // {4, 5}
+    ASSERT_OK(at);
+    ASSERT_OK(bt);
+    auto c = make_iota({3, 6}, DType::F32, 500);
+
+    auto r0 = cat({*at, c}, 0);
+    ASSERT_OK(r0);
+    expect_cat_of(*r0, {*at, c}, 0);
+
+    auto r1 = cat({*at, *bt}, 1);
+    ASSERT_OK(r1);
+    EXPECT_EQ(r1->shape(), (Shape{4, 11}));
+    expect_cat_of(*r1, {*at, *bt}, 1);
+
+    auto s = make_iota({4, 20}, DType::F32, 900).slice(1, 0, 20, 4); // {4, 5}，步长 4
+    ASSERT_OK(s);
+    auto r2 = cat({*bt, *s}, 1);
+    ASSERT_OK(r2);
+    expect_cat_of(*r2, {*bt, *s}, 1);
+}
+
+TEST(ConcatTests, CatLargeOutputStreamed)
+{
+    // 输出约 9 MB，超过 NT-store 阈值；奇数行长使各段与寄存器宽度错位
+    auto a = make_iota({1024, 1101}, DType::F32, 0);
+    auto b = make_iota({1024, 1097}, DType::F32, 1u << 24);
+    for (int dim : {0, 1}) {
+        const Tensor& rhs = dim == 0 ? make_iota({7, 1101}, DType::F32, 3) : b;
+        auto          r   = cat({a, rhs}, dim);
+        ASSERT_OK(r);
+        expect_cat_of(*r, {a, rhs}, dim);
+    }
+}
+
+TEST(ConcatTests, CatZeroSizedInput)
+{
+    auto a = make_iota({2, 3}, DType::F32, 0);
+    auto e = Tensor::empty({2, 0}, DType::F32);
+    ASSERT_OK(e);
+    auto b = make_iota({2, 1}, DType::F32, 40);
+    auto r = cat({a, *e, b}, 1);
+    ASSERT_OK(r);
+    EXPECT_EQ(r->shape(), (Shape{2, 4}));
+    expect_cat_of(*r, {a, *e, b}, 1);
+
+    auto z = cat({*e, *e}, 1);
+    ASSERT_OK(z);
+    EXPECT_EQ(z->shape(), (Shape{2, 0}));
+}
+
+TEST(ConcatTests, CatErrors)
+{
+    auto a = make_iota({2, 3}, DType::F32, 0);
+    auto b = make_iota({2, 3}, DType::F64, 0);
+    auto c = make_iota({3, 3}, DType::F32, 0);
+
+    ASSERT_ERR(cat(std::span<const Tensor>{}, 0)); // 空列表
+    ASSERT_ERR(cat({a, b}, 0));                    // dtype 不一致
+    ASSERT_ERR(cat({a, c}, 1));                    // 非拼接维长度不一致
+    ASSERT_ERR(cat({a, a}, 2));                    // dim 越界
+    ASSERT_ERR(cat({a, Tensor{}}, 0));             // 未定义
+
+    auto s = Tensor::empty({}, DType::F32);
+    ASSERT_OK(s);
+    ASSERT_ERR(cat({*s, *s}, 0)); // 0 维
+}
+
+// ═══════════════════════════════════════════════════════════════
+// stack
+// ═══════════════════════════════════════════════════════════════
+
+TEST(ConcatTests, StackEachDim)
+{
+    auto a = make_iota({3, 4}, DType::I32, 0);
+    auto b = make_iota({3, 4}, DType::I32, 100);
+    auto c = make_iota({3, 4}, DType::I32, 200);
+    for (int dim : {0, 1, 2, -1}) {
+        auto r = stack({a, b, c}, dim);
+        ASSERT_OK(r);
+        const int d = dim < 0 ? dim + 3 : dim;
+        Shape     want{3, 4};
+        want.insert(want.begin() + d, 3);
+        EXPECT_EQ(r->shape(), want);
+        const std::vector<Tensor> ins = {a, b, c};
+        for (int64_t i = 0; i < 3; ++i) {
+            auto part = r->slice(d, i, i + 1);
+            ASSERT_OK(part);
+            EXPECT_EQ(bytes_of(*part), bytes_of(ins[static_cast<std::size_t>(i)]));
+        }
+    }
+}
+
+TEST(ConcatTests, StackNonContiguousAndErrors)
+{
+    auto a  = make_iota({4, 3}, DType::F64, 0);
+    auto at = a.transpose(0, 1);
+    ASSERT_OK(at);
+    auto b = make_iota({3, 4}, DType::F64, 77);
+    auto r = stack({*at, b}, 0);
+    ASSERT_OK(r);
+    expect_cat_of(*r, {*at->unsqueeze(0), *b.unsqueeze(0)}, 0);
+
+    ASSERT_ERR(stack({a, b}, 0)); // 形状不一致
+    ASSERT_ERR(stack({b, b}, 3)); // dim 越界
+}
+
+// ═══════════════════════════════════════════════════════════════
+// split / chunk
+// ═══════════════════════════════════════════════════════════════
+
+TEST(ConcatTests, SplitBySizeReturnsViews)
+{
+    auto a     = make_iota({10, 3}, DType::F32, 0);
+    auto parts = split(a, 4, 0);
+    ASSERT_OK(parts);
+    ASSERT_EQ(parts->size(), 3u);
+    EXPECT_EQ((*parts)[0].shape(), (Shape{4, 3}));
+    EXPECT_EQ((*parts)[1].shape(), (Shape{4, 3}));
+    EXPECT_EQ((*parts)[2].shape(), (Shape{2, 3}));
+    for (const auto& p : *parts)
+        EXPECT_EQ(p.storage().get(), a.storage().get()); // 零拷贝
+
+    auto back = cat(std::span<const Tensor>(*parts), 0);
+    ASSERT_OK(back);
+    EXPECT_EQ(bytes_of(*back), bytes_of(a));
+
+    ASSERT_ERR(split(a, 0, 0));
+    ASSERT_ERR(split(a, 2, 2));
+}
+
+TEST(ConcatTests, SplitBySizesAlongLastDim)
+{
+    auto a     = make_iota({2, 9}, DType::I64, 0);
+    auto parts = split(a, {2, 0, 7}, -1);
+    ASSERT_OK(parts);
+    ASSERT_EQ(parts->size(), 3u);
+    EXPECT_EQ((*parts)[1].shape(), (Shape{2, 0}));
+    EXPECT_EQ((*parts)[2].shape(), (Shape{2, 7}));
+    EXPECT_EQ((*parts)[2].storage_offset(), 2);
+
+    auto back = cat(std::span<const Tensor>(*parts), 1);
+    ASSERT_OK(back);
+    EXPECT_EQ(bytes_of(*back), bytes_of(a));
+
+    ASSERT_ERR(split(a, {2, 3}, 1));   // 段长之和不等于维长
+    ASSERT_ERR(split(a, {10, -1}, 1)); // 负段长
+}
+
+TEST(ConcatTests, ChunkMatchesTorchSemantics)
+{
+    auto a = make_iota({10}, DType::F32, 0);
+    auto c = chunk(a, 4);
+    ASSERT_OK(c);
+    ASSERT_EQ(c->size(), 4u); // 3 + 3 + 3 + 1
+    EXPECT_EQ((*c)[3].shape(), (Shape{1}));
+
+    auto b = make_iota({6}, DType::F32, 0);
+    auto d = chunk(b, 4);
+    ASSERT_OK(d);
+    ASSERT_EQ(d->size(), 3u); // ceil(6/4)=2 → 2 + 2 + 2
+
+    auto e = chunk(b, 10);
+    ASSERT_OK(e);
+    EXPECT_EQ(e->size(), 6u);
+
+    ASSERT_ERR(chunk(b, 0));
+}
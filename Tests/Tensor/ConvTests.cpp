@@ -0,0 +1,260 @@
+#include <gtest/gtest.h>
+
+#include "Tensor/Tensor.hpp"
+#include "TensorTestUtil.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace bee;
+using namespace bee::test;
+
+#define ASSERT_OK(expr)  ASSERT_TRUE((expr).has_value())
+#define ASSERT_ERR(expr) ASSERT_FALSE((expr).has_value())
+
+namespace
+{
+
+struct ConvCase
+{
+    int64_t       N, C, H, W, Cout, KH, KW;
+    Conv2dOptions opt;
+    bool          with_bias;
+};
+
+// 朴素直接卷积参考（double 累加）
+auto ref_conv2d(const ConvCase& c, const std::vector<double>& x, const std::vector<double>& w, const std::vector<double>& b) -> std::vector<double>
+{
+    const int64_t G   = c.opt.groups;
+    const int64_t cig = c.C / G;
+    const int64_t cog = c.Cout / G;
+    const int64_t OH  = (c.H + 2 * c.opt.padding[0] - c.opt.dilation[0] * (c.KH - 1) - 1) / c.opt.stride[0] + 1;
+    const int64_t OW  = (c.W + 2 * c.opt.padding[1] - c.opt.dilation[1] * (c.KW - 1) - 1) / c.opt.stride[1] + 1;
+
+    std::vector<double> y(static_cast<std::size_t>(c.N * c.Cout * OH * OW));
+    for (int64_t n = 0; n < c.N; ++n)
+        for (int64_t co = 0; co < c.Cout; ++co)
+            for (int64_t oh = 0; oh < OH; ++oh)
+                for (int64_t ow = 0; ow < OW; ++ow) {
+                    double        acc = c.with_bias ? b[static_cast<std::size_t>(co)] : 0.0;
+                    const int64_t gi  = co / cog;
+                    for (int64_t ci = 0; ci < cig; ++ci)
+                        for (int64_t r = 0; r < c.KH; ++r)
+                            for (int64_t s = 0; s < c.KW; ++s) {
+                                const int64_t ih = oh * c.opt.stride[0] - c.opt.padding[0] + r * c.opt.dilation[0];
+                                const int64_t iw = ow * c.opt.stride[1] - c.opt.padding[1] + s * c.opt.dilation[1];
+                                if (ih < 0 || ih >= c.H || iw < 0 || iw >= c.W)
+                                    continue;
+                                const int64_t xi  = ((n * c.C + gi * cig + ci) * c.H + ih) * c.W + iw;
+                                const int64_t wi  = ((co * cig + ci) * c.KH + r) * c.KW + s;
+                                acc              += x[static_cast<std::size_t>(xi)] * w[static_cast<std::size_t>(wi)];
+                            }
+                    y[static_cast<std::size_t>(((n * c.Cout + co) * OH + oh) * OW + ow)] = acc;
+                }
+    return y;
+}
+
+template <typename T>
+auto run_conv_case(const ConvCase& c, double tol) -> void
+{
+    const DType dt = std::is_same_v<T, float> ? DType::F32 : DType::F64;
+    const auto  xv = lcg_seq(static_cast<std::size_t>(c.N * c.C * c.H * c.W), 7u);
+    const auto  wv = lcg_seq(static_cast<std::size_t>(c.Cout * (c.C / c.opt.groups) * c.KH * c.KW), 11u);
+    const auto  bv = lcg_seq(static_cast<std::size_t>(c.Cout), 13u);
+
+    auto x = make_tensor<T>({c.N, c.C, c.H, c.W}, dt, xv);
+    auto w = make_tensor<T>({c.Cout, c.C / c.opt.groups, c.KH, c.KW}, dt, wv);
+    auto b = c.with_bias ? make_tensor<T>({c.Cout}, dt, bv) : Tensor{};
+
+    auto y = conv2d(x, w, b, c.opt);
+    ASSERT_OK(y);
+    const auto ref = ref_conv2d(c, xv, wv, bv);
+    ASSERT_EQ(y->numel(), static_cast<int64_t>(ref.size()));
+    const auto got = values_of<T, double>(*y);
+    for (std::size_t i = 0; i < ref.size(); ++i)
+        ASSERT_NEAR(got[i], ref[i], tol) << "i=" << i;
+}
+
+// 朴素池化参考
+auto ref_pool2d(const std::vector<double>& x, int64_t planes, int64_t H, int64_t W, const Pool2dOptions& o, bool is_max) -> std::vector<double>
+{
+    const int64_t SH = o.stride[0] == 0 ? o.kernel[0] : o.stride[0];
+    const int64_t SW = o.stride[1] == 0 ? o.kernel[1] : o.stride[1];
+    const int64_t OH = (H + 2 * o.padding[0] - o.dilation[0] * (o.kernel[0] - 1) - 1) / SH + 1;
+    const int64_t OW = (W + 2 * o.padding[1] - o.dilation[1] * (o.kernel[1] - 1) - 1) / SW + 1;
+
+    std::vector<double> y(static_cast<std::size_t>(planes * OH * OW));
+    for (int64_t p = 0; p < planes; ++p)
+        for (int64_t oh = 0; oh < OH; ++oh)
+            for (int64_t ow = 0; ow < OW; ++ow) {
+                double  acc = is_max ? -std::numeric_limits<double>::infinity() : 0.0;
+                int64_t cnt = 0;
+                for (int64_t r = 0; r < o.kernel[0]; ++r)
+                    for (int64_t s = 0; s < o.kernel[1]; ++s) {
+                        const int64_t ih = oh * SH - o.padding[0] + r * o.dilation[0];
+                        const int64_t iw = ow * SW - o.padding[1] + s * o.dilation[1];
+                        if (ih < 0 || ih >= H || iw < 0 || iw >= W)
+                            continue;
+                        const double v = x[static_cast<std::size_t>((p * H + ih) * W + iw)];
+                        acc            = is_max ? std::max(acc, v) : acc + v;
+                        ++cnt;
+                    }
+                if (!is_max)
+                    acc /= static_cast<double>(o.count_include_pad ? o.kernel[0] * o.kernel[1] : cnt);
+                y[static_cast<std::size_t>((p * OH + oh) * OW + ow)] = acc;
+            }
+    return y;
+}
+
+template <typename T>
+auto run_pool_case(int64_t N, int64_t C, int64_t H, int64_t W, const Pool2dOptions& o, bool is_max) -> void
+{
+    const DType dt = std::is_same_v<T, float> ? DType::F32 : DType::F64;
+    const auto  xv = lcg_seq(static_cast<std::size_t>(N * C * H * W), 17u);
+    auto        x  = make_tensor<T>({N, C, H, W}, dt, xv);
+
+    auto y = is_max ? max_pool2d(x, o) : avg_pool2d(x, o);
+    ASSERT_OK(y);
+    const auto ref = ref_pool2d(xv, N * C, H, W, o, is_max);
+    ASSERT_EQ(y->numel(), static_cast<int64_t>(ref.size()));
+    const auto got = values_of<T, double>(*y);
+    for (std::size_t i = 0; i < ref.size(); ++i)
+        ASSERT_NEAR(got[i], ref[i], 1e-5) << "i=" << i;
+}
+
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// conv2d
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(Conv2d, Basic3x3NoPadding)
+{
+    run_conv_case<float>({1, 3, 8, 8, 4, 3, 3, {}, false}, 1e-4);
+}
+
+TEST(Conv2d, PaddingStrideBias)
+{
+    run_conv_case<float>({2, 5, 11, 13, 7, 3, 3, {.stride = {2, 2}, .padding = {1, 1}}, true}, 1e-4);
+    run_conv_case<float>({1, 4, 9, 10, 6, 5, 3, {.stride = {1, 3}, .padding = {2, 1}}, true}, 1e-4);
+}
+
+TEST(Conv2d, Dilation)
+{
+    run_conv_case<float>({1, 3, 15, 14, 5, 3, 3, {.padding = {2, 2}, .dilation = {2, 2}}, true}, 1e-4);
+    run_conv_case<float>({2, 2, 12, 12, 3, 3, 2, {.stride = {2, 1}, .dilation = {3, 2}}, false}, 1e-4);
+}
+
+TEST(Conv2d, GroupsAndDepthwise)
+{
+    run_conv_case<float>({2, 6, 10, 10, 9, 3, 3, {.padding = {1, 1}, .groups = 3}, true}, 1e-4);
+    run_conv_case<float>({2, 8, 12, 12, 8, 3, 3, {.padding = {1, 1}, .groups = 8}, true}, 1e-4);
+    run_conv_case<float>({1, 4, 9, 9, 8, 3, 3, {.stride = {2, 2}, .padding = {1, 1}, .groups = 4}, false}, 1e-4);
+}
+
+TEST(Conv2d, Pointwise1x1)
+{
+    run_conv_case<float>({3, 16, 7, 9, 11, 1, 1, {}, true}, 1e-4);
+    run_conv_case<float>({1, 8, 10, 10, 4, 1, 1, {.stride = {2, 2}}, false}, 1e-4);
+}
+
+TEST(Conv2d, F64)
+{
+    run_conv_case<double>({2, 3, 9, 11, 5, 3, 3, {.stride = {2, 1}, .padding = {1, 1}, .dilation = {1, 2}}, true}, 1e-10);
+}
+
+TEST(Conv2d, LargeParallel)
+{
+    // 足够多的 (样本, 列块) 任务与多个 kc 分块，覆盖并行与 K 分块累加
+    run_conv_case<float>({4, 64, 28, 28, 48, 3, 3, {.padding = {1, 1}}, true}, 2e-3);
+}
+
+TEST(Conv2d, UnbatchedAndNonContiguous)
+{
+    const auto xv = lcg_seq(3 * 6 * 5, 3u);
+    const auto wv = lcg_seq(2 * 3 * 3 * 3, 5u);
+    auto       x  = make_tensor<float>({3, 5, 6}, DType::F32, xv);
+    auto       xt = x.transpose(1, 2); // {3, 6, 5}，非连续
+    ASSERT_OK(xt);
+    auto w = make_tensor<float>({2, 3, 3, 3}, DType::F32, wv);
+
+    auto y = conv2d(*xt, w, {}, {.padding = {1, 1}});
+    ASSERT_OK(y);
+    EXPECT_EQ(y->shape(), (Shape{2, 6, 5}));
+
+    auto xc = xt->contiguous();
+    ASSERT_OK(xc);
+    const ConvCase c{1, 3, 6, 5, 2, 3, 3, {.padding = {1, 1}}, false};
+    const auto     ref = ref_conv2d(c, values_of<float, double>(*xc), wv, {});
+    const auto     got = values_of<float, double>(*y);
+    for (std::size_t i = 0; i < ref.size(); ++i)
+        ASSERT_NEAR(got[i], ref[i], 1e-4);
+}
+
+TEST(Conv2d, InvalidArguments)
+{
+    auto x  = make_tensor<float>({1, 4, 6, 6}, DType::F32, lcg_seq(144, 1u));
+    auto w  = make_tensor<float>({2, 4, 3, 3}, DType::F32, lcg_seq(72, 2u));
+    auto xi = Tensor::zeros({1, 4, 6, 6}, DType::I32);
+    ASSERT_OK(xi);
+
+    ASSERT_ERR(conv2d(Tensor{}, w));
+    ASSERT_ERR(conv2d(*xi, w));
+    ASSERT_ERR(conv2d(make_tensor<float>({4, 6}, DType::F32, lcg_seq(24, 1u)), w));
+    ASSERT_ERR(conv2d(x, make_tensor<double>({2, 4, 3, 3}, DType::F64, lcg_seq(72, 2u))));
+    ASSERT_ERR(conv2d(x, w, {}, {.groups = 3}));
+    ASSERT_ERR(conv2d(x, w, {}, {.groups = 2})); // weight 第 1 维应为 2
+    ASSERT_ERR(conv2d(x, w, {}, {.stride = {0, 1}}));
+    ASSERT_ERR(conv2d(x, w, {}, {.padding = {-1, 0}}));
+    ASSERT_ERR(conv2d(x, w, {}, {.dilation = {4, 4}})); // 有效核 9 > 6
+    ASSERT_ERR(conv2d(x, w, make_tensor<float>({3}, DType::F32, {0.0, 0.0, 0.0})));
+    ASSERT_OK(conv2d(x, w, make_tensor<float>({2}, DType::F32, {0.5, -0.5})));
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// max_pool2d / avg_pool2d
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(Pool2d, MaxBasic)
+{
+    run_pool_case<float>(2, 3, 8, 8, {.kernel = {2, 2}}, true);
+    run_pool_case<float>(1, 4, 13, 37, {.kernel = {3, 3}, .stride = {1, 1}}, true);
+}
+
+TEST(Pool2d, MaxPaddingStrideDilation)
+{
+    run_pool_case<float>(2, 3, 15, 17, {.kernel = {3, 3}, .stride = {2, 2}, .padding = {1, 1}}, true);
+    run_pool_case<float>(1, 2, 20, 40, {.kernel = {3, 3}, .stride = {1, 1}, .padding = {1, 1}, .dilation = {2, 2}}, true);
+    run_pool_case<double>(1, 3, 11, 9, {.kernel = {3, 2}, .stride = {2, 1}, .padding = {1, 1}}, true);
+}
+
+TEST(Pool2d, AvgIncludeAndExcludePad)
+{
+    run_pool_case<float>(2, 3, 14, 33, {.kernel = {3, 3}, .stride = {1, 1}, .padding = {1, 1}}, false);
+    run_pool_case<float>(2, 3, 14, 33, {.kernel = {3, 3}, .stride = {1, 1}, .padding = {1, 1}, .count_include_pad = false}, false);
+    run_pool_case<float>(1, 2, 9, 10, {.kernel = {2, 4}, .stride = {2, 2}, .padding = {1, 2}, .count_include_pad = false}, false);
+    run_pool_case<double>(3, 2, 8, 8, {.kernel = {2, 2}}, false);
+}
+
+TEST(Pool2d, LargeParallel)
+{
+    run_pool_case<float>(8, 32, 56, 56, {.kernel = {3, 3}, .stride = {2, 2}, .padding = {1, 1}}, true);
+    run_pool_case<float>(8, 32, 56, 56, {.kernel = {2, 2}}, false);
+}
+
+TEST(Pool2d, InvalidArguments)
+{
+    auto x = make_tensor<float>({1, 2, 6, 6}, DType::F32, lcg_seq(72, 1u));
+    ASSERT_ERR(max_pool2d(x, {.kernel = {0, 2}}));
+    ASSERT_ERR(max_pool2d(x, {.kernel = {2, 2}, .padding = {2, 0}}));
+    ASSERT_ERR(max_pool2d(x, {.kernel = {7, 7}}));
+    ASSERT_ERR(avg_pool2d(x, {.kernel = {2, 2}, .dilation = {2, 2}}));
+    ASSERT_ERR(avg_pool2d(Tensor{}, {.kernel = {2, 2}}));
+
+    auto y = max_pool2d(make_tensor<float>({2, 6, 6}, DType::F32, lcg_seq(72, 1u)), {.kernel = {2, 2}});
+    ASSERT_OK(y);
+    EXPECT_EQ(y->shape(), (Shape{2, 3, 3}));
+}
@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+
+#include "Tensor/Tensor.hpp"
+#include "Tensor/Core/dlpack.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace bee;
+
+namespace
+{
+
+// 外部生产方：持有一块 host 缓冲，deleter 被调用时置位标志
+struct ForeignBuffer
+{
+    DLManagedTensor      managed{};
+    std::vector<float>   data;
+    std::vector<int64_t> shape;
+    bool*                deleted = nullptr;
+};
+
+auto make_foreign(std::vector<float> data, std::vector<int64_t> shape, bool* deleted) -> DLManagedTensor*
+{
+    auto* fb    = new ForeignBuffer{};
+    fb->data    = std::move(data);
+    fb->shape   = std::move(shape);
+    fb->deleted = deleted;
+
+    auto& t       = fb->managed.dl_tensor;
+    t.data        = fb->data.data();
+    t.device      = DLDevice{kDLCPU, 0};
+    t.ndim        = static_cast<int32_t>(fb->shape.size());
+    t.dtype       = DLDataType{kDLFloat, 32, 1};
+    t.shape       = fb->shape.data();
+    t.strides     = nullptr;
+    t.byte_offset = 0;
+
+    fb->managed.manager_ctx = fb;
+    fb->managed.deleter     = [](DLManagedTensor* self) {
+        auto* owner     = static_cast<ForeignBuffer*>(self->manager_ctx);
+        *owner->deleted = true;
+        delete owner;
+    };
+    return &fb->managed;
+}
+
+} // namespace
+
+// ── 导出 ─────────────────────────────────────────────────────────────────────
+
+TEST(DLPackTests, ExportDescribesStridedViewWithoutCopy)
+{
+    auto a = Tensor::arange(0, 6, 1, DType::F32);
+    ASSERT_TRUE(a.has_value());
+    auto v = a->view({2, 3});
+    ASSERT_TRUE(v.has_value());
+    auto t = v->transpose(0, 1);
+    ASSERT_TRUE(t.has_value());
+
+    auto m = t->to_dlpack();
+    ASSERT_TRUE(m.has_value());
+    const DLTensor& dl = (*m)->dl_tensor;
+    EXPECT_EQ(dl.data, t->const_data_ptr());
+    EXPECT_EQ(dl.device.device_type, kDLCPU);
+    EXPECT_EQ(dl.ndim, 2);
+    EXPECT_EQ(dl.dtype.code, kDLFloat);
+    EXPECT_EQ(dl.dtype.bits, 32);
+    EXPECT_EQ(dl.dtype.lanes, 1);
+    EXPECT_EQ(dl.shape[0], 3);
+    EXPECT_EQ(dl.shape[1], 2);
+    EXPECT_EQ(dl.strides[0], 1);
+    EXPECT_EQ(dl.strides[1], 3);
+    EXPECT_EQ(dl.byte_offset, 0u);
+
+    // 导出对象持有 storage 引用，deleter 归还
+    const auto uses = a->storage().use_count();
+    (*m)->deleter(*m);
+    EXPECT_EQ(a->storage().use_count(), uses - 1);
+}
+
+TEST(DLPackTests, ExportKeepsStorageAliveAfterTensorDies)
+{
+    DLManagedTensor* m = nullptr;
+    {
+        auto a = Tensor::arange(0, 4, 1, DType::I64);
+        ASSERT_TRUE(a.has_value());
+        auto r = a->to_dlpack();
+        ASSERT_TRUE(r.has_value());
+        m = *r;
+    }
+    const auto* p = static_cast<const int64_t*>(m->dl_tensor.data);
+    EXPECT_EQ(p[3], 3);
+    m->deleter(m);
+}
+
+TEST(DLPackTests, ExportEndsCopyOnWriteSharing)
+{
+    auto a = Tensor::full({8}, DType::F32, 1.0);
+    ASSERT_TRUE(a.has_value());
+    auto c = a->clone();
+    ASSERT_TRUE(c.has_value());
+    ASSERT_TRUE(c->storage()->is_shared());
+
+    // 外部经裸指针写入不能改到 clone 来源；此后 clone 也不再共享
+    auto m = c->to_dlpack();
+    ASSERT_TRUE(m.has_value());
+    EXPECT_FALSE(a->storage()->is_shared());
+    static_cast<float*>((*m)->dl_tensor.data)[0] = 5.0f;
+    EXPECT_EQ(static_cast<const float*>(a->const_data_ptr())[0], 1.0f);
+    EXPECT_EQ(static_cast<const float*>(c->const_data_ptr())[0], 5.0f);
+
+    auto c2 = c->clone();
+    ASSERT_TRUE(c2.has_value());
+    EXPECT_FALSE(c2->storage()->is_shared());
+    EXPECT_NE(c2->const_data_ptr(), c->const_data_ptr());
+    (*m)->deleter(*m);
+}
+
+// ── 导入 ─────────────────────────────────────────────────────────────────────
+
+TEST(DLPackTests, RoundTripRestoresOriginalStorage)
+{
+    auto a = Tensor::arange(0, 12, 1, DType::I32);
+    ASSERT_TRUE(a.has_value());
+    auto s = a->slice(0, 2, 10, 2);
+    ASSERT_TRUE(s.has_value());
+
+    auto m = s->to_dlpack();
+    ASSERT_TRUE(m.has_value());
+    auto b = Tensor::from_dlpack(*m);
+    ASSERT_TRUE(b.has_value());
+
+    EXPECT_EQ(b->storage().get(), a->storage().get());
+    EXPECT_EQ(b->storage_offset(), 2);
+    EXPECT_EQ(b->shape(), s->shape());
+    EXPECT_EQ(b->strides(), s->strides());
+    static_cast<int32_t*>(b->data_ptr())[0] = -7;
+    EXPECT_EQ(static_cast<const int32_t*>(a->const_data_ptr())[2], -7);
+}
+
+TEST(DLPackTests, ImportForeignBufferZeroCopy)
+{
+    bool deleted = false;
+    auto* m      = make_foreign({1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f}, {2, 3}, &deleted);
+    auto* raw    = m->dl_tensor.data;
+    {
+        auto t = Tensor::from_dlpack(m);
+        ASSERT_TRUE(t.has_value());
+        EXPECT_EQ(t->const_data_ptr(), raw);
+        EXPECT_EQ(t->shape(), (Shape{2, 3}));
+        EXPECT_TRUE(t->is_contiguous());
+        EXPECT_EQ(t->dtype(), DType::F32);
+
+        auto s = sum(*t);
+        ASSERT_TRUE(s.has_value());
+        EXPECT_FLOAT_EQ(static_cast<const float*>(s->const_data_ptr())[0], 21.0f);
+
+        // 外部内存不参与写时复制：clone 立即拥有独立副本
+        auto c = t->clone();
+        ASSERT_TRUE(c.has_value());
+        EXPECT_NE(c->const_data_ptr(), raw);
+
+        auto row = t->slice(0, 1, 2);
+        ASSERT_TRUE(row.has_value());
+        t = Tensor();
+        EXPECT_FALSE(deleted); // 视图仍持有 storage
+    }
+    EXPECT_TRUE(deleted);
+}
+
+TEST(DLPackTests, ImportRejectsUnsupportedWithoutTakingOwnership)
+{
+    EXPECT_FALSE(Tensor::from_dlpack(nullptr).has_value());
+
+    bool  deleted = false;
+    auto* m       = make_foreign({1.0f, 2.0f}, {2}, &deleted);
+
+    m->dl_tensor.dtype.lanes = 4;
+    EXPECT_FALSE(Tensor::from_dlpack(m).has_value());
+    m->dl_tensor.dtype.lanes = 1;
+
+    m->dl_tensor.device.device_type = kDLOpenCL;
+    EXPECT_FALSE(Tensor::from_dlpack(m).has_value());
+    m->dl_tensor.device.device_type = kDLCPU;
+
+    int64_t neg_stride       = -1;
+    m->dl_tensor.strides     = &neg_stride;
+    EXPECT_FALSE(Tensor::from_dlpack(m).has_value());
+    m->dl_tensor.strides     = nullptr;
+    m->dl_tensor.byte_offset = 2; // 未按 4 字节对齐
+    EXPECT_FALSE(Tensor::from_dlpack(m).has_value());
+
+    EXPECT_FALSE(deleted);
+    m->deleter(m);
+    EXPECT_TRUE(deleted);
+
+    auto fp8 = Tensor::empty({2}, DType::FP8E4M3);
+    ASSERT_TRUE(fp8.has_value());
+    EXPECT_FALSE(fp8->to_dlpack().has_value());
+    EXPECT_FALSE(Tensor().to_dlpack().has_value());
+}
@@ -142,7 +142,18 @@ TEST(DTypeTests, ExtendedDtypeEmptyAllocOk)
 
 TEST(DTypeTests, ExtendedDtypeFullReturnsNotImpl)
 {
-    // full/ones 依赖标量填充：扩展 dtype 应返回 NotImplemented。
-    auto r = Tensor::full({4}, DType::BF16, 1.0, Device::CPU);
+    // full/ones 依赖标量填充：FP8 / FP4 占位 dtype 应返回 NotImplemented。
+    auto r = Tensor::full({4}, DType::FP8E4M3, 1.0, Device::CPU);
     ASSERT_FALSE(r);
 }
+
+TEST(DTypeTests, HalfDtypeFullFillsRoundedValue)
+{
+    auto h = Tensor::full({4}, DType::F16, 1.5, Device::CPU);
+    ASSERT_TRUE(h);
+    EXPECT_EQ(static_cast<const Half*>(h->data_ptr())[3].bits, 0x3E00u);
+
+    auto b = Tensor::full({4}, DType::BF16, -2.0, Device::CPU);
+    ASSERT_TRUE(b);
+    EXPECT_EQ(static_cast<const BFloat16*>(b->data_ptr())[0].bits, 0xC000u);
+}
@@ -6,8 +6,8 @@
  *
  * 专门针对新 AVX2/SSE2/Scalar GEMM 的正确性测试：
  * - 覆盖 F32/F64/I32/I8 四种 dtype
- * - 含非对齐尺寸（触发 M/N 尾部标量路径）
- * - 大矩阵触发三层分块（AVX2 MC=192, KC=384, NC=2048）
+ * - 含非对齐尺寸（触发补零 pack 的 M/N 边界 tile）
+ * - 大矩阵触发三层分块（MC/KC/NC 按缓存容量运行期推导，见 GemmCommon.hpp）
  * - I8 → I32 输出 dtype 转换
  */
 
@@ -127,6 +127,57 @@ TEST(GemmTests, F32_LargeBlocked)
     run_gemm_case<float, DType::F32>(256, 256, 256, rng, 1e-2);
 }
 
+// ── N 跨多个 NC 列分片：2D / 融合 / 批量（各 slice 不同 B）逐片 pack 的结果须与参考一致 ──
+TEST(GemmTests, F32_MultipleColumnSlabs)
+{
+    const auto bk = gemm_blocking_info(DType::F32);
+    if (bk.nc == 0)
+        GTEST_SKIP() << "Scalar ISA 不走分块 driver";
+    const int64_t M = 70, K = 40, N = 2 * bk.nc + 37;
+    std::mt19937  rng(0x5eed);
+    run_gemm_case<float, DType::F32>(M, K, N, rng, 1e-3);
+
+    constexpr int64_t  batch = 3;
+    std::vector<float> ra(static_cast<size_t>(batch * M * K));
+    std::vector<float> rb(static_cast<size_t>(batch * K * N));
+    std::vector<float> rbias(static_cast<size_t>(N));
+    fill_random(ra, rng, -2.0f, 2.0f);
+    fill_random(rb, rng, -2.0f, 2.0f);
+    fill_random(rbias, rng, -2.0f, 2.0f);
+    auto a    = Tensor::empty({batch, M, K}, DType::F32);
+    auto b    = Tensor::empty({batch, K, N}, DType::F32);
+    auto bias = Tensor::empty({N}, DType::F32);
+    ASSERT_OK(a);
+    ASSERT_OK(b);
+    ASSERT_OK(bias);
+    std::memcpy(a->data_ptr(), ra.data(), ra.size() * sizeof(float));
+    std::memcpy(b->data_ptr(), rb.data(), rb.size() * sizeof(float));
+    std::memcpy(bias->data_ptr(), rbias.data(), rbias.size() * sizeof(float));
+
+    auto c = matmul(*a, *b);
+    ASSERT_OK(c);
+    const auto*        pc = static_cast<const float*>(c->data_ptr());
+    std::vector<float> ref(static_cast<size_t>(M * N));
+    for (int64_t s = 0; s < batch; ++s) {
+        ref_gemm<float, float>(M, K, N, ra.data() + s * M * K, rb.data() + s * K * N, ref.data());
+        for (int64_t i = 0; i < M * N; ++i)
+            ASSERT_NEAR(pc[s * M * N + i], ref[static_cast<size_t>(i)], 1e-3) << "slice=" << s << " idx=" << i;
+    }
+
+    // 融合入口：最后一个 slice 的 x·w + bias，epilogue 的列坐标须按整个 N 计
+    auto x  = a->slice(0, batch - 1, batch); // {1, M, K}
+    auto ws = b->slice(0, batch - 1, batch);
+    ASSERT_OK(x);
+    ASSERT_OK(ws);
+    auto w = ws->reshape({K, N});
+    ASSERT_OK(w);
+    auto y = linear(*x, *w, *bias);
+    ASSERT_OK(y);
+    const auto* py = static_cast<const float*>(y->data_ptr());
+    for (int64_t i = 0; i < M * N; ++i)
+        ASSERT_NEAR(py[i], ref[static_cast<size_t>(i)] + rbias[static_cast<size_t>(i % N)], 1e-3) << "idx=" << i;
+}
+
 // ── I8 GEMM：输入 I8，输出 I32 ────────────────────────────────────────────────
 TEST(GemmTests, I8_Basic)
 {
@@ -187,3 +238,29 @@ TEST(GemmTests, I8_RandomSizes)
             EXPECT_EQ(pc[i], ref[i]) << "I8 mismatch idx=" << i << " M=" << M << " K=" << K << " N=" << N;
     }
 }
+
+TEST(GemmTests, BlockingInfoConsistent)
+{
+    // 分块参数按 cache 推导：Goto 路径的 dtype 三项均为正，且同一进程内稳定
+    const auto f32 = gemm_blocking_info(DType::F32);
+    const auto f64 = gemm_blocking_info(DType::F64);
+    if (simd::current_isa() == simd::Isa::Scalar) {
+        EXPECT_EQ(f32.kc, 0);
+        return;
+    }
+    for (const auto& bk : {f32, f64}) {
+        EXPECT_GT(bk.mc, 0);
+        EXPECT_GT(bk.kc, 0);
+        EXPECT_GT(bk.nc, 0);
+    }
+    // 元素越宽，同样 L1 能容纳的 K 深度越小
+    EXPECT_LE(f64.kc, f32.kc);
+
+    const auto again = gemm_blocking_info(DType::F32);
+    EXPECT_EQ(again.mc, f32.mc);
+    EXPECT_EQ(again.kc, f32.kc);
+    EXPECT_EQ(again.nc, f32.nc);
+
+    const auto i64 = gemm_blocking_info(DType::I64);
+    EXPECT_EQ(i64.kc, 0);
+}
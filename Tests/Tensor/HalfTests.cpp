@@ -0,0 +1,420 @@
+/**
+ * @File HalfTests.cpp
+ * @Brief This file is part of Bee.
+ *
+ * F16 / BF16 存储类型的正确性测试：
+ * - 标量转换：往返、舍入到最近偶数、NaN / Inf、次正规数与溢出
+ * - 批量 cast：SIMD 主体与尾部、经 F32 中转的非 F32 源 / 目标
+ * - 逐元素 / 归约：结果与“先展开为 F32 计算、再收窄”的参考逐位一致
+ * - matmul：GEMV / 小 M / 大尺寸 / 转置视图 / 批量，对照 F32 参考按相对误差比较
+ */
+
+#include <gtest/gtest.h>
+
+#include "Tensor/Tensor.hpp"
+#include "TensorTestUtil.hpp"
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#define ASSERT_OK(expr) ASSERT_TRUE((expr).has_value())
+
+using namespace bee;
+using namespace bee::test;
+
+namespace
+{
+
+template <typename H>
+auto to_half(const std::vector<float>& v) -> std::vector<H>
+{
+    std::vector<H> out(v.size());
+    for (std::size_t i = 0; i < v.size(); ++i)
+        out[i] = H(v[i]);
+    return out;
+}
+
+auto random_floats(std::size_t n, float lo, float hi, std::uint32_t seed) -> std::vector<float>
+{
+    std::mt19937                          rng(seed);
+    std::uniform_real_distribution<float> dist(lo, hi);
+    std::vector<float>                    v(n);
+    for (auto& x : v)
+        x = dist(rng);
+    return v;
+}
+
+// 以 F32 计算 half 张量的 matmul 参考（a: {M,K}，b: {K,N}，行主序）
+template <typename H>
+auto ref_matmul(const std::vector<H>& a, const std::vector<H>& b, int64_t M, int64_t K, int64_t N) -> std::vector<float>
+{
+    std::vector<float> c(static_cast<std::size_t>(M * N), 0.0f);
+    for (int64_t i = 0; i < M; ++i)
+        for (int64_t k = 0; k < K; ++k) {
+            const float av = static_cast<float>(a[static_cast<std::size_t>(i * K + k)]);
+            for (int64_t j = 0; j < N; ++j)
+                c[static_cast<std::size_t>(i * N + j)] += av * static_cast<float>(b[static_cast<std::size_t>(k * N + j)]);
+        }
+    return c;
+}
+
+// 结果已收窄为 H：误差上界取一个 H 的 ulp（相对）加上 K 项累加的 F32 误差
+template <typename H>
+auto expect_matmul_close(const Tensor& got, const std::vector<float>& ref, int64_t K) -> void
+{
+    ASSERT_EQ(got.dtype(), dtype_v<H>);
+    const auto  v   = values_of<H>(got);
+    const float eps = std::is_same_v<H, Half> ? 1.0f / 1024.0f : 1.0f / 128.0f;
+    ASSERT_EQ(v.size(), ref.size());
+    for (std::size_t i = 0; i < v.size(); ++i) {
+        const float tol = eps * std::fabs(ref[i]) + 1e-5f * static_cast<float>(K);
+        ASSERT_NEAR(static_cast<float>(v[i]), ref[i], tol) << "i=" << i;
+    }
+}
+
+template <typename H>
+auto run_matmul_case(int64_t M, int64_t K, int64_t N, std::uint32_t seed) -> void
+{
+    const auto a  = to_half<H>(random_floats(static_cast<std::size_t>(M * K), -1.0f, 1.0f, seed));
+    const auto b  = to_half<H>(random_floats(static_cast<std::size_t>(K * N), -1.0f, 1.0f, seed + 1));
+    auto       ta = make_tensor(a, {M, K});
+    auto       tb = make_tensor(b, {K, N});
+    auto       c  = matmul(ta, tb);
+    ASSERT_OK(c);
+    expect_matmul_close<H>(*c, ref_matmul(a, b, M, K, N), K);
+}
+
+template <typename H>
+class HalfTypedTests : public ::testing::Test
+{
+};
+
+using HalfTypes = ::testing::Types<Half, BFloat16>;
+TYPED_TEST_SUITE(HalfTypedTests, HalfTypes);
+
+} // namespace
+
+// ── 标量转换 ──────────────────────────────────────────────────────────────────
+
+TEST(HalfTests, F16ScalarConversion)
+{
+    EXPECT_EQ(Half(1.0f).bits, 0x3C00u);
+    EXPECT_EQ(Half(-2.0f).bits, 0xC000u);
+    EXPECT_EQ(Half(65504.0f).bits, 0x7BFFu);
+    EXPECT_EQ(Half(0.0f).bits, 0x0000u);
+    EXPECT_EQ(Half(-0.0f).bits, 0x8000u);
+
+    // 1 + 2^-11 恰在 1 与 1 + 2^-10 中点：舍入到偶数（1）；1 + 3·2^-11 舍入到 1 + 2^-9
+    EXPECT_EQ(Half(1.0f + 0x1p-11f).bits, 0x3C00u);
+    EXPECT_EQ(Half(1.0f + 0x3p-11f).bits, 0x3C02u);
+
+    // 溢出：≥ 65520 变为 Inf，65519 仍舍入到 65504
+    EXPECT_EQ(Half(65520.0f).bits, 0x7C00u);
+    EXPECT_EQ(Half(65519.0f).bits, 0x7BFFu);
+    EXPECT_EQ(Half(std::numeric_limits<float>::infinity()).bits, 0x7C00u);
+    EXPECT_EQ(Half(-1e30f).bits, 0xFC00u);
+
+    // 次正规数：最小正次正规数 2^-24，2^-25 为中点舍入到 0，3·2^-26 舍入到 2^-24
+    EXPECT_EQ(Half(0x1p-24f).bits, 0x0001u);
+    EXPECT_EQ(Half(0x1p-25f).bits, 0x0000u);
+    EXPECT_EQ(Half(0x3p-26f).bits, 0x0001u);
+    EXPECT_EQ(static_cast<float>(Half::from_bits(0x0001u)), 0x1p-24f);
+    EXPECT_EQ(static_cast<float>(Half::from_bits(0x03FFu)), 0x3FFp-24f);
+
+    // NaN 保持为 NaN
+    const Half n(std::numeric_limits<float>::quiet_NaN());
+    EXPECT_EQ(n.bits & 0x7C00u, 0x7C00u);
+    EXPECT_NE(n.bits & 0x03FFu, 0u);
+    EXPECT_TRUE(std::isnan(static_cast<float>(n)));
+    EXPECT_TRUE(std::isinf(static_cast<float>(Half::from_bits(0xFC00u))));
+}
+
+TEST(HalfTests, F16RoundTripAllFinite)
+{
+    // 所有有限 F16 经 F32 往返后位模式不变
+    for (std::uint32_t b = 0; b < 0x10000u; ++b) {
+        if ((b & 0x7C00u) == 0x7C00u)
+            continue;
+        const Half h = Half::from_bits(static_cast<std::uint16_t>(b));
+        ASSERT_EQ(Half(static_cast<float>(h)).bits, h.bits) << std::hex << b;
+    }
+}
+
+TEST(HalfTests, BF16ScalarConversion)
+{
+    EXPECT_EQ(BFloat16(1.0f).bits, 0x3F80u);
+    EXPECT_EQ(BFloat16(-2.0f).bits, 0xC000u);
+    // 1 + 2^-8 为中点：舍入到偶数（1）；1 + 3·2^-8 舍入到 1 + 2^-6
+    EXPECT_EQ(BFloat16(1.0f + 0x1p-8f).bits, 0x3F80u);
+    EXPECT_EQ(BFloat16(1.0f + 0x3p-8f).bits, 0x3F82u);
+    // 最大有限 F32 舍入溢出为 Inf
+    EXPECT_EQ(BFloat16(std::numeric_limits<float>::max()).bits, 0x7F80u);
+
+    // 截断会把低位非零的 NaN 变成 Inf：须保持为 NaN
+    const BFloat16 n(std::bit_cast<float>(0x7F800001u));
+    EXPECT_TRUE(std::isnan(static_cast<float>(n)));
+    EXPECT_EQ(static_cast<float>(BFloat16::from_bits(0x4049u)), 3.140625f);
+}
+
+// ── 批量 cast ─────────────────────────────────────────────────────────────────
+
+TYPED_TEST(HalfTypedTests, CastMatchesScalar)
+{
+    using H = TypeParam;
+
+    // 覆盖 SIMD 主体、尾部与分块边界；混入特殊值
+    for (const int64_t n : {int64_t{1}, int64_t{7}, int64_t{33}, int64_t{1029}, int64_t{70001}}) {
+        auto v = random_floats(static_cast<std::size_t>(n), -70000.0f, 70000.0f, static_cast<std::uint32_t>(n));
+        v[0]   = std::numeric_limits<float>::quiet_NaN();
+        if (n > 3) {
+            v[1] = std::numeric_limits<float>::infinity();
+            v[2] = 0x1p-20f;
+            v[3] = -0.0f;
+        }
+        auto h = cast(make_tensor(v, {n}), dtype_v<H>);
+        ASSERT_OK(h);
+        const auto hv = values_of<H>(*h);
+        for (std::size_t i = 0; i < v.size(); ++i)
+            ASSERT_EQ(hv[i].bits, H(v[i]).bits) << "n=" << n << " i=" << i;
+
+        auto back = cast(*h, DType::F32);
+        ASSERT_OK(back);
+        const auto fv = values_of<float>(*back);
+        for (std::size_t i = 0; i < v.size(); ++i) {
+            const float e = static_cast<float>(hv[i]);
+            if (std::isnan(e)) {
+                ASSERT_TRUE(std::isnan(fv[i]));
+            } else {
+                ASSERT_EQ(fv[i], e);
+            }
+        }
+    }
+}
+
+TYPED_TEST(HalfTypedTests, CastViaF32ForOtherDtypes)
+{
+    using H = TypeParam;
+
+    auto i = make_tensor(std::vector<int32_t>{-3, 0, 7, 1000}, {4});
+    auto h = cast(i, dtype_v<H>);
+    ASSERT_OK(h);
+    const auto hv = values_of<H>(*h);
+    EXPECT_EQ(static_cast<float>(hv[0]), -3.0f);
+    EXPECT_EQ(static_cast<float>(hv[2]), 7.0f);
+    EXPECT_EQ(static_cast<float>(hv[3]), 1000.0f);
+
+    auto d = cast(*h, DType::F64);
+    ASSERT_OK(d);
+    EXPECT_EQ(values_of<double>(*d)[3], 1000.0);
+
+    // F16 ↔ BF16 直接互转
+    auto o = cast(*h, std::is_same_v<H, Half> ? DType::BF16 : DType::F16);
+    ASSERT_OK(o);
+    auto f = cast(*o, DType::F32);
+    ASSERT_OK(f);
+    EXPECT_EQ(values_of<float>(*f)[2], 7.0f);
+}
+
+// ── 逐元素 ────────────────────────────────────────────────────────────────────
+
+TYPED_TEST(HalfTypedTests, ElementWiseMatchesF32ThenNarrow)
+{
+    using H = TypeParam;
+
+    const int64_t n  = 1500;
+    const auto    a  = to_half<H>(random_floats(static_cast<std::size_t>(n), -4.0f, 4.0f, 11));
+    const auto    b  = to_half<H>(random_floats(static_cast<std::size_t>(n), -4.0f, 4.0f, 12));
+    auto          ta = make_tensor(a, {n});
+    auto          tb = make_tensor(b, {n});
+
+    auto s = add(ta, tb);
+    auto m = mul(ta, tb);
+    auto e = exp(ta);
+    ASSERT_OK(s);
+    ASSERT_OK(m);
+    ASSERT_OK(e);
+    ASSERT_EQ(s->dtype(), dtype_v<H>);
+    const auto sv = values_of<H>(*s);
+    const auto mv = values_of<H>(*m);
+    const auto ev = values_of<H>(*e);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        const float x = static_cast<float>(a[i]);
+        const float y = static_cast<float>(b[i]);
+        ASSERT_EQ(sv[i].bits, H(x + y).bits) << i;
+        ASSERT_EQ(mv[i].bits, H(x * y).bits) << i;
+        ASSERT_NEAR(static_cast<float>(ev[i]), std::exp(x), std::exp(x) * 1e-2f) << i;
+    }
+}
+
+TYPED_TEST(HalfTypedTests, ElementWiseBroadcastAndStrided)
+{
+    using H = TypeParam;
+
+    const auto a  = to_half<H>(random_floats(6 * 5, -2.0f, 2.0f, 21));
+    const auto r  = to_half<H>(random_floats(5, -2.0f, 2.0f, 22));
+    auto       ta = make_tensor(a, {6, 5});
+    auto       tr = make_tensor(r, {5});
+
+    auto s = add(ta, tr);
+    ASSERT_OK(s);
+    const auto sv = values_of<H>(*s);
+    for (int64_t i = 0; i < 6; ++i)
+        for (int64_t j = 0; j < 5; ++j) {
+            const auto  k = static_cast<std::size_t>(i * 5 + j);
+            const float x = static_cast<float>(a[k]) + static_cast<float>(r[static_cast<std::size_t>(j)]);
+            ASSERT_EQ(sv[k].bits, H(x).bits);
+        }
+
+    auto t = ta.transpose(0, 1);
+    ASSERT_OK(t);
+    auto n = neg(*t);
+    ASSERT_OK(n);
+    const auto nv = values_of<H>(*n);
+    for (int64_t j = 0; j < 5; ++j)
+        for (int64_t i = 0; i < 6; ++i)
+            ASSERT_EQ(static_cast<float>(nv[static_cast<std::size_t>(j * 6 + i)]), -static_cast<float>(a[static_cast<std::size_t>(i * 5 + j)]));
+}
+
+// ── 归约 ──────────────────────────────────────────────────────────────────────
+
+TYPED_TEST(HalfTypedTests, GlobalReduceAccumulatesInF32)
+{
+    using H = TypeParam;
+
+    // 4096 个 1：若以 half 累加，F16 在 2048 后无法再 +1、BF16 在 256 后即停滞
+    auto ones = Tensor::full({4096}, dtype_v<H>, 1.0);
+    ASSERT_OK(ones);
+    auto s = sum(*ones);
+    ASSERT_OK(s);
+    ASSERT_EQ(s->dtype(), dtype_v<H>);
+    EXPECT_EQ(static_cast<float>(values_of<H>(*s)[0]), 4096.0f);
+
+    const auto v  = to_half<H>(random_floats(3001, -3.0f, 3.0f, 31));
+    auto       tv = make_tensor(v, {3001});
+    auto       mx = max(tv);
+    auto       mn = mean(tv);
+    ASSERT_OK(mx);
+    ASSERT_OK(mn);
+    ASSERT_EQ(mn->dtype(), dtype_v<H>);
+    float  ref_max = -INFINITY;
+    double ref_sum = 0.0;
+    for (const auto& x : v) {
+        ref_max = std::fmax(ref_max, static_cast<float>(x));
+        ref_sum += static_cast<float>(x);
+    }
+    EXPECT_EQ(static_cast<float>(values_of<H>(*mx)[0]), ref_max);
+    EXPECT_NEAR(static_cast<float>(values_of<H>(*mn)[0]), ref_sum / 3001.0, 1e-2);
+}
+
+TYPED_TEST(HalfTypedTests, AxisReduceAndVar)
+{
+    using H = TypeParam;
+
+    const auto a  = to_half<H>(random_floats(7 * 9, -1.0f, 1.0f, 41));
+    auto       ta = make_tensor(a, {7, 9});
+
+    auto s0 = sum(ta, 0);
+    auto m1 = mean(ta, 1, true);
+    ASSERT_OK(s0);
+    ASSERT_OK(m1);
+    EXPECT_EQ(s0->shape(), (Shape{9}));
+    EXPECT_EQ(m1->shape(), (Shape{7, 1}));
+    const auto sv = values_of<H>(*s0);
+    const auto mv = values_of<H>(*m1);
+    for (int64_t j = 0; j < 9; ++j) {
+        float acc = 0.0f;
+        for (int64_t i = 0; i < 7; ++i)
+            acc += static_cast<float>(a[static_cast<std::size_t>(i * 9 + j)]);
+        EXPECT_NEAR(static_cast<float>(sv[static_cast<std::size_t>(j)]), acc, 2e-2f);
+    }
+    for (int64_t i = 0; i < 7; ++i) {
+        double acc = 0.0;
+        for (int64_t j = 0; j < 9; ++j)
+            acc += static_cast<float>(a[static_cast<std::size_t>(i * 9 + j)]);
+        EXPECT_NEAR(static_cast<float>(mv[static_cast<std::size_t>(i)]), acc / 9.0, 1e-2);
+    }
+
+    auto vr = var(ta);
+    ASSERT_OK(vr);
+    ASSERT_EQ(vr->dtype(), dtype_v<H>);
+    double mu = 0.0;
+    for (const auto& x : a)
+        mu += static_cast<float>(x);
+    mu /= static_cast<double>(a.size());
+    double ss = 0.0;
+    for (const auto& x : a)
+        ss += (static_cast<float>(x) - mu) * (static_cast<float>(x) - mu);
+    EXPECT_NEAR(static_cast<float>(values_of<H>(*vr)[0]), ss / static_cast<double>(a.size() - 1), 1e-2);
+}
+
+// ── matmul ────────────────────────────────────────────────────────────────────
+
+TYPED_TEST(HalfTypedTests, MatmulShapes)
+{
+    using H = TypeParam;
+
+    run_matmul_case<H>(1, 257, 129, 51);   // GEMV
+    run_matmul_case<H>(3, 100, 67, 52);    // 小 M
+    run_matmul_case<H>(37, 45, 29, 53);    // 非对齐边界块
+    run_matmul_case<H>(130, 300, 140, 54); // 跨 MC / KC 分块
+    run_matmul_case<H>(64, 1, 64, 55);
+}
+
+TYPED_TEST(HalfTypedTests, MatmulTransposedView)
+{
+    using H = TypeParam;
+
+    const int64_t M  = 19;
+    const int64_t K  = 33;
+    const int64_t N  = 21;
+    const auto    a  = to_half<H>(random_floats(static_cast<std::size_t>(M * K), -1.0f, 1.0f, 61));
+    const auto    bt = to_half<H>(random_floats(static_cast<std::size_t>(N * K), -1.0f, 1.0f, 62));
+    auto          tb = make_tensor(bt, {N, K}).transpose(0, 1); // {K, N}，列步长为 K
+    ASSERT_OK(tb);
+
+    std::vector<H> b(static_cast<std::size_t>(K * N));
+    for (int64_t k = 0; k < K; ++k)
+        for (int64_t j = 0; j < N; ++j)
+            b[static_cast<std::size_t>(k * N + j)] = bt[static_cast<std::size_t>(j * K + k)];
+
+    auto c = matmul(make_tensor(a, {M, K}), *tb);
+    ASSERT_OK(c);
+    expect_matmul_close<H>(*c, ref_matmul(a, b, M, K, N), K);
+}
+
+TYPED_TEST(HalfTypedTests, MatmulBatched)
+{
+    using H = TypeParam;
+
+    const int64_t B  = 3;
+    const int64_t M  = 10;
+    const int64_t K  = 24;
+    const int64_t N  = 17;
+    const auto    a  = to_half<H>(random_floats(static_cast<std::size_t>(B * M * K), -1.0f, 1.0f, 71));
+    const auto    b  = to_half<H>(random_floats(static_cast<std::size_t>(K * N), -1.0f, 1.0f, 72));
+    auto          c  = matmul(make_tensor(a, {B, M, K}), make_tensor(b, {K, N}));
+    ASSERT_OK(c);
+    EXPECT_EQ(c->shape(), (Shape{B, M, N}));
+
+    std::vector<float> ref;
+    for (int64_t i = 0; i < B; ++i) {
+        const std::vector<H> ai(a.begin() + i * M * K, a.begin() + (i + 1) * M * K);
+        const auto           ri = ref_matmul(ai, b, M, K, N);
+        ref.insert(ref.end(), ri.begin(), ri.end());
+    }
+    expect_matmul_close<H>(*c, ref, K);
+}
+
+TEST(HalfTests, MatmulRejectsMixedHalfDtypes)
+{
+    auto a = Tensor::full({2, 2}, DType::F16, 1.0);
+    auto b = Tensor::full({2, 2}, DType::BF16, 1.0);
+    ASSERT_OK(a);
+    ASSERT_OK(b);
+    EXPECT_FALSE(matmul(*a, *b).has_value());
+}
@@ -0,0 +1,347 @@
+#include <gtest/gtest.h>
+
+#include "Tensor/Tensor.hpp"
+#include "TensorTestUtil.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace bee;
+using namespace bee::test;
+
+#define ASSERT_OK(expr)  ASSERT_TRUE((expr).has_value())
+#define ASSERT_ERR(expr) ASSERT_FALSE((expr).has_value())
+
+namespace
+{
+
+// 确定性伪随机索引，取值 [0, bound)
+auto rand_index(int64_t n, int64_t bound, uint64_t seed) -> std::vector<int64_t>
+{
+    std::vector<int64_t> v(static_cast<std::size_t>(n));
+    uint64_t             s = seed * 6364136223846793005ull + 1442695040888963407ull;
+    for (auto& x : v) {
+        s = s * 6364136223846793005ull + 1442695040888963407ull;
+        x = static_cast<int64_t>((s >> 33) % static_cast<uint64_t>(bound));
+    }
+    return v;
+}
+
+template <typename T>
+auto iota_values(int64_t n, T base) -> std::vector<T>
+{
+    std::vector<T> v(static_cast<std::size_t>(n));
+    for (int64_t i = 0; i < n; ++i)
+        v[static_cast<std::size_t>(i)] = static_cast<T>(base + static_cast<T>(i));
+    return v;
+}
+
+// 以 dim 为界的折叠尺寸 {O, N, I}
+struct Fold
+{
+    int64_t O = 1;
+    int64_t N = 0;
+    int64_t I = 1;
+};
+
+auto fold(const Shape& sh, int dim) -> Fold
+{
+    Fold f;
+    f.N = sh[static_cast<std::size_t>(dim)];
+    for (int k = 0; k < dim; ++k)
+        f.O *= sh[static_cast<std::size_t>(k)];
+    for (std::size_t k = static_cast<std::size_t>(dim) + 1; k < sh.size(); ++k)
+        f.I *= sh[k];
+    return f;
+}
+
+} // namespace
+
+// ═══════════════════════════════════════════════════════════════
+// index_select
+// ═══════════════════════════════════════════════════════════════
+
+TEST(IndexTests, IndexSelectKnownValues)
+{
+    auto a   = make_tensor<float>({3, 4}, DType::F32, iota_values<float>(12, 0));
+    auto idx = make_tensor<int64_t>({3}, DType::I64, {2, 0, 2});
+
+    auto r0 = index_select(a, 0, idx);
+    ASSERT_OK(r0);
+    EXPECT_EQ(r0->shape(), (Shape{3, 4}));
+    EXPECT_EQ(values_of<float>(*r0), (std::vector<float>{8, 9, 10, 11, 0, 1, 2, 3, 8, 9, 10, 11}));
+
+    auto r1 = index_select(a, -1, idx);
+    ASSERT_OK(r1);
+    EXPECT_EQ(r1->shape(), (Shape{3, 3}));
+    EXPECT_EQ(values_of<float>(*r1), (std::vector<float>{2, 0, 2, 6, 4, 6, 10, 8, 10}));
+}
+
+TEST(IndexTests, IndexSelectEachDimMatchesReference)
+{
+    const Shape sh = {3, 5, 7};
+    auto        a  = make_tensor<int64_t>(sh, DType::I64, iota_values<int64_t>(105, 1000));
+    for (int dim = 0; dim < 3; ++dim) {
+        const Fold f   = fold(sh, dim);
+        const auto iv  = rand_index(11, f.N, static_cast<uint64_t>(dim));
+        auto       idx = make_tensor<int64_t>({11}, DType::I64, iv);
+        auto       r   = index_select(a, dim, idx);
+        ASSERT_OK(r);
+
+        const auto           av = values_of<int64_t>(a);
+        std::vector<int64_t> want;
+        for (int64_t o = 0; o < f.O; ++o)
+            for (int64_t j = 0; j < 11; ++j)
+                for (int64_t i = 0; i < f.I; ++i)
+                    want.push_back(av[static_cast<std::size_t>((o * f.N + iv[static_cast<std::size_t>(j)]) * f.I + i)]);
+        EXPECT_EQ(values_of<int64_t>(*r), want) << "dim=" << dim;
+    }
+}
+
+TEST(IndexTests, IndexSelectNonContiguousAndI32Index)
+{
+    // 转置视图 + I32 索引；结果应与先物化再选取一致
+    auto a  = make_tensor<double>({6, 40}, DType::F64, iota_values<double>(240, 0));
+    auto at = a.transpose(0, 1); // {40, 6}
+    ASSERT_OK(at);
+    const std::vector<int32_t> sel = {39, 0, 17, 17, 3};
+    auto                       r   = index_select(*at, 0, make_tensor<int32_t>({5}, DType::I32, sel));
+    ASSERT_OK(r);
+    EXPECT_EQ(r->shape(), (Shape{5, 6}));
+
+    const auto atv = values_of<double>(*at);
+    const auto rv  = values_of<double>(*r);
+    for (std::size_t j = 0; j < 5; ++j)
+        for (std::size_t c = 0; c < 6; ++c)
+            EXPECT_EQ(rv[j * 6 + c], atv[static_cast<std::size_t>(sel[j]) * 6 + c]);
+}
+
+// ═══════════════════════════════════════════════════════════════
+// gather
+// ═══════════════════════════════════════════════════════════════
+
+TEST(IndexTests, GatherEachDimMatchesReference)
+{
+    const Shape sh = {4, 6, 9};
+    for (DType dt : {DType::F32, DType::I64}) {
+        auto a = dt == DType::F32 ? make_tensor<float>(sh, dt, iota_values<float>(216, 0))
+                                  : make_tensor<int64_t>(sh, dt, iota_values<int64_t>(216, 0));
+        for (int dim = 0; dim < 3; ++dim) {
+            const Fold f   = fold(sh, dim);
+            Shape      ish = sh;
+
+            ish[static_cast<std::size_t>(dim)] = 13; // 索引侧 J 与 N 不同
+            const auto iv                      = rand_index(13 * f.O * f.I, f.N, 7u + static_cast<uint64_t>(dim));
+            auto       idx                     = make_tensor<int64_t>(ish, DType::I64, iv);
+            auto       r                       = gather(a, dim, idx);
+            ASSERT_OK(r);
+            EXPECT_EQ(r->shape(), ish);
+
+            const auto           av = values_of<int64_t>(*cast(a, DType::I64));
+            std::vector<int64_t> want;
+            for (int64_t o = 0; o < f.O; ++o)
+                for (int64_t j = 0; j < 13; ++j)
+                    for (int64_t i = 0; i < f.I; ++i)
+                        want.push_back(av[static_cast<std::size_t>((o * f.N + iv[static_cast<std::size_t>((o * 13 + j) * f.I + i)]) * f.I + i)]);
+            EXPECT_EQ(values_of<int64_t>(*cast(*r, DType::I64)), want) << "dim=" << dim;
+        }
+    }
+}
+
+TEST(IndexTests, GatherKnownValues)
+{
+    // torch.gather([[1,2],[3,4]], 1, [[0,0],[1,0]]) = [[1,1],[4,3]]
+    auto a   = make_tensor<int32_t>({2, 2}, DType::I32, {1, 2, 3, 4});
+    auto idx = make_tensor<int32_t>({2, 2}, DType::I32, {0, 0, 1, 0});
+    auto r   = gather(a, 1, idx);
+    ASSERT_OK(r);
+    EXPECT_EQ(values_of<int32_t>(*r), (std::vector<int32_t>{1, 1, 4, 3}));
+}
+
+// ═══════════════════════════════════════════════════════════════
+// scatter / scatter_add
+// ═══════════════════════════════════════════════════════════════
+
+TEST(IndexTests, ScatterLastWriteWinsAndLeavesInputUntouched)
+{
+    auto a   = make_tensor<float>({5}, DType::F32, {-1, -1, -1, -1, -1});
+    auto idx = make_tensor<int64_t>({4}, DType::I64, {1, 3, 1, 0});
+    auto src = make_tensor<float>({4}, DType::F32, {10, 20, 30, 40});
+    auto r   = scatter(a, 0, idx, src);
+    ASSERT_OK(r);
+    EXPECT_EQ(values_of<float>(*r), (std::vector<float>{40, 30, -1, 20, -1}));
+    EXPECT_EQ(values_of<float>(a), (std::vector<float>{-1, -1, -1, -1, -1}));
+}
+
+TEST(IndexTests, ScatterEachDimMatchesReference)
+{
+    const Shape sh = {3, 8, 300}; // I = 300 跨越多个列块
+    auto        a  = make_tensor<int32_t>(sh, DType::I32, iota_values<int32_t>(7200, 0));
+    for (int dim = 0; dim < 3; ++dim) {
+        const Fold f   = fold(sh, dim);
+        Shape      ish = sh;
+
+        ish[static_cast<std::size_t>(dim)] = 5;
+        const auto n                       = 5 * f.O * f.I;
+        const auto iv                      = rand_index(n, f.N, 31u + static_cast<uint64_t>(dim));
+        auto       idx                     = make_tensor<int64_t>(ish, DType::I64, iv);
+        const auto sv                      = iota_values<int32_t>(n, -100000);
+        auto       src                     = make_tensor<int32_t>(ish, DType::I32, sv);
+        auto       r                       = scatter(a, dim, idx, src);
+        ASSERT_OK(r);
+
+        auto want = values_of<int32_t>(a);
+        for (int64_t o = 0; o < f.O; ++o)
+            for (int64_t j = 0; j < 5; ++j)
+                for (int64_t i = 0; i < f.I; ++i) {
+                    const auto k   = static_cast<std::size_t>((o * 5 + j) * f.I + i);
+                    const auto dst = static_cast<std::size_t>((o * f.N + iv[k]) * f.I + i);
+                    want[dst]      = sv[k];
+                }
+        EXPECT_EQ(values_of<int32_t>(*r), want) << "dim=" << dim;
+    }
+}
+
+TEST(IndexTests, ScatterAddMatchesSerial)
+{
+    // 一维大 J：目标少走分块部分和（浮点近似相等、整数精确），目标多走按目标区间划分（逐位一致）；
+    // 二维 dim=0 且索引沿行恒定走 SIMD 行累加（逐位一致）
+    for (const int64_t N : {97, 40000}) {
+        const int64_t      J  = 30000;
+        const auto         iv = rand_index(J, N, 3);
+        std::vector<float> sv(static_cast<std::size_t>(J));
+        for (int64_t j = 0; j < J; ++j)
+            sv[static_cast<std::size_t>(j)] = 1.0f / static_cast<float>(j + 3);
+        auto a  = make_tensor<float>({N}, DType::F32, iota_values<float>(N, 0.5f));
+        auto r  = scatter_add(a, 0, make_tensor<int64_t>({J}, DType::I64, iv), make_tensor<float>({J}, DType::F32, sv));
+        auto ai = make_tensor<int64_t>({N}, DType::I64, iota_values<int64_t>(N, 0));
+        auto ri = scatter_add(ai, 0, make_tensor<int64_t>({J}, DType::I64, iv), make_tensor<int64_t>({J}, DType::I64, iota_values<int64_t>(J, 1)));
+        ASSERT_OK(r);
+        ASSERT_OK(ri);
+
+        auto want  = values_of<float>(a);
+        auto wanti = values_of<int64_t>(ai);
+        for (int64_t j = 0; j < J; ++j) {
+            const auto k  = static_cast<std::size_t>(iv[static_cast<std::size_t>(j)]);
+            want[k]      += sv[static_cast<std::size_t>(j)];
+            wanti[k]     += j + 1;
+        }
+        const auto got = values_of<float>(*r);
+        for (std::size_t k = 0; k < want.size(); ++k)
+            EXPECT_NEAR(got[k], want[k], 1e-5f * (1.0f + std::abs(want[k])));
+        if (N > 20000) {
+            EXPECT_EQ(got, want);
+        }
+        EXPECT_EQ(values_of<int64_t>(*ri), wanti);
+    }
+    {
+        const int64_t        J    = 50;
+        const int64_t        N    = 7;
+        const int64_t        D    = 37;
+        const auto           rows = rand_index(J, N, 9);
+        std::vector<int64_t> iv;
+        for (int64_t j = 0; j < J; ++j)
+            iv.insert(iv.end(), static_cast<std::size_t>(D), rows[static_cast<std::size_t>(j)]);
+        const auto sv = iota_values<double>(J * D, 0.25);
+        auto       a  = make_tensor<double>({N, D}, DType::F64, std::vector<double>(static_cast<std::size_t>(N * D), 1.0));
+        auto       r  = scatter_add(a, 0, make_tensor<int64_t>({J, D}, DType::I64, iv), make_tensor<double>({J, D}, DType::F64, sv));
+        ASSERT_OK(r);
+
+        auto want = values_of<double>(a);
+        for (int64_t j = 0; j < J; ++j)
+            for (int64_t d = 0; d < D; ++d)
+                want[static_cast<std::size_t>(rows[static_cast<std::size_t>(j)] * D + d)] += sv[static_cast<std::size_t>(j * D + d)];
+        EXPECT_EQ(values_of<double>(*r), want);
+    }
+}
+
+TEST(IndexTests, ScatterAddIntegerAndMixedColumns)
+{
+    // dim=1、各列索引不同：逐元素路径
+    const auto iv  = rand_index(4 * 6, 3, 5);
+    auto       a   = make_tensor<int64_t>({4, 3}, DType::I64, std::vector<int64_t>(12, 0));
+    auto       src = make_tensor<int64_t>({4, 6}, DType::I64, iota_values<int64_t>(24, 1));
+    auto       r   = scatter_add(a, 1, make_tensor<int64_t>({4, 6}, DType::I64, iv), src);
+    ASSERT_OK(r);
+
+    std::vector<int64_t> want(12, 0);
+    for (int64_t o = 0; o < 4; ++o)
+        for (int64_t j = 0; j < 6; ++j)
+            want[static_cast<std::size_t>(o * 3 + iv[static_cast<std::size_t>(o * 6 + j)])] += o * 6 + j + 1;
+    EXPECT_EQ(values_of<int64_t>(*r), want);
+}
+
+TEST(IndexTests, ScatterErrors)
+{
+    auto a   = make_tensor<float>({3, 4}, DType::F32, iota_values<float>(12, 0));
+    auto idx = make_tensor<int64_t>({2, 4}, DType::I64, {0, 1, 2, 0, 1, 1, 1, 1});
+    auto src = make_tensor<float>({2, 4}, DType::F32, iota_values<float>(8, 0));
+    auto bad = make_tensor<int64_t>({2, 4}, DType::I64, {0, 1, 2, 3, 1, 1, 1, 1}); // 3 越界（N=3）
+
+    ASSERT_OK(scatter(a, 0, idx, src));
+    ASSERT_ERR(scatter(a, 0, bad, src));
+    ASSERT_ERR(scatter(a, 1, idx, src));                     // 除 dim 外长度不一致
+    ASSERT_ERR(scatter(a, 0, idx, *cast(src, DType::F64))); // dtype 不一致
+    ASSERT_ERR(scatter(a, 0, *cast(idx, DType::F32), src)); // 索引 dtype 非法
+    ASSERT_ERR(scatter_add(*cast(a, DType::U8), 0, idx, *cast(src, DType::U8)));
+    ASSERT_ERR(gather(a, 2, idx));
+    ASSERT_ERR(index_select(a, 0, idx)); // index 须为一维
+}
+
+// ═══════════════════════════════════════════════════════════════
+// embedding_bag
+// ═══════════════════════════════════════════════════════════════
+
+TEST(IndexTests, EmbeddingBagSumMeanAndWeights)
+{
+    for (const int64_t D : {5, 67}) {
+        const int64_t              N   = 10;
+        const auto                 wv  = iota_values<float>(N * D, 0.125f);
+        auto                       w   = make_tensor<float>({N, D}, DType::F32, wv);
+        const std::vector<int64_t> iv  = {3, 9, 0, 3, 3, 7, 1, 8, 2, 6, 6, 4};
+        const std::vector<int64_t> ov  = {0, 3, 3, 7}; // 第 1 个 bag 为空
+        const std::vector<float>   psv = {0.5f, 2, -1, 1, 0, 3, 1, 1, 0.25f, 4, 2, 1};
+        auto                       idx = make_tensor<int64_t>({12}, DType::I64, iv);
+        auto                       off = make_tensor<int64_t>({4}, DType::I64, ov);
+        auto                       ps  = make_tensor<float>({12}, DType::F32, psv);
+
+        for (int m = 0; m < 3; ++m) {
+            const auto mode = m == 1 ? EmbeddingBagMode::Mean : EmbeddingBagMode::Sum;
+            auto       r    = embedding_bag(w, idx, off, mode, m == 2 ? ps : Tensor{});
+            ASSERT_OK(r);
+            EXPECT_EQ(r->shape(), (Shape{4, D}));
+            const auto rv = values_of<float>(*r);
+            for (int64_t b = 0; b < 4; ++b) {
+                const int64_t s = ov[static_cast<std::size_t>(b)];
+                const int64_t e = b + 1 < 4 ? ov[static_cast<std::size_t>(b + 1)] : 12;
+                for (int64_t d = 0; d < D; ++d) {
+                    float acc = 0;
+                    for (std::size_t k = static_cast<std::size_t>(s); k < static_cast<std::size_t>(e); ++k) {
+                        const float x  = wv[static_cast<std::size_t>(iv[k] * D + d)];
+                        acc           += m == 2 ? psv[k] * x : x;
+                    }
+                    if (m == 1 && e > s)
+                        acc /= static_cast<float>(e - s);
+                    EXPECT_NEAR(rv[static_cast<std::size_t>(b * D + d)], acc, 1e-4f * (1.0f + std::abs(acc))) << "mode=" << m << " b=" << b;
+                }
+            }
+        }
+    }
+}
+
+TEST(IndexTests, EmbeddingBagErrors)
+{
+    auto w   = make_tensor<double>({4, 2}, DType::F64, iota_values<double>(8, 0));
+    auto idx = make_tensor<int64_t>({3}, DType::I64, {0, 1, 3});
+    auto ok  = make_tensor<int64_t>({2}, DType::I64, {0, 2});
+    auto ps  = make_tensor<double>({3}, DType::F64, {1, 1, 1});
+
+    ASSERT_OK(embedding_bag(w, idx, ok));
+    ASSERT_ERR(embedding_bag(w, idx, make_tensor<int64_t>({2}, DType::I64, {1, 2})));    // offsets[0] != 0
+    ASSERT_ERR(embedding_bag(w, idx, make_tensor<int64_t>({3}, DType::I64, {0, 2, 1}))); // 非单调
+    ASSERT_ERR(embedding_bag(w, idx, make_tensor<int64_t>({2}, DType::I64, {0, 4})));    // 超过 L
+    ASSERT_ERR(embedding_bag(w, make_tensor<int64_t>({1}, DType::I64, {4}), ok));        // 索引越界
+    ASSERT_ERR(embedding_bag(w, idx, ok, EmbeddingBagMode::Mean, ps));                   // 权重仅限 Sum
+    ASSERT_ERR(embedding_bag(*cast(w, DType::I32), idx, ok));
+}
@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+
+#include "Tensor/Tensor.hpp"
+#include "TensorTestUtil.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace bee;
+using namespace bee::test;
+
+#define ASSERT_OK(expr)  ASSERT_TRUE((expr).has_value())
+#define ASSERT_ERR(expr) ASSERT_FALSE((expr).has_value())
+
+namespace
+{
+
+auto scalar_i64(const Tensor& t) -> int64_t
+{
+    EXPECT_EQ(t.dtype(), DType::I64);
+    EXPECT_EQ(t.numel(), 1);
+    return *static_cast<const int64_t*>(t.const_data_ptr());
+}
+
+// 确定性伪随机掩码（0/1 字节），约 density 比例为 1
+auto rand_mask(int64_t n, double density, uint64_t seed) -> std::vector<uint8_t>
+{
+    std::vector<uint8_t> v(static_cast<std::size_t>(n));
+    uint64_t             s = seed * 6364136223846793005ull + 1442695040888963407ull;
+    for (auto& x : v) {
+        s = s * 6364136223846793005ull + 1442695040888963407ull;
+        x = static_cast<double>(s >> 11) * 0x1.0p-53 < density ? 1 : 0;
+    }
+    return v;
+}
+
+} // namespace
+
+// ── count_nonzero ────────────────────────────────────────────────────────────
+
+TEST(MaskTests, CountNonzeroAcrossDTypes)
+{
+    auto f = make_tensor<float>({2, 3}, DType::F32, {0.0f, 1.5f, -0.0f, std::numeric_limits<float>::quiet_NaN(), 0.0f, -2.0f});
+    auto c = count_nonzero(f);
+    ASSERT_OK(c);
+    EXPECT_EQ(c->shape(), Shape{});
+    EXPECT_EQ(scalar_i64(*c), 3); // -0.0 为零，NaN 非零
+
+    auto i = make_tensor<int64_t>({4}, DType::I64, {0, 7, 0, -1});
+    auto ci = count_nonzero(i);
+    ASSERT_OK(ci);
+    EXPECT_EQ(scalar_i64(*ci), 2);
+
+    auto u = make_tensor<uint8_t>({3}, DType::U8, {0, 255, 2});
+    auto cu = count_nonzero(u);
+    ASSERT_OK(cu);
+    EXPECT_EQ(scalar_i64(*cu), 2);
+
+    auto e = Tensor::empty({0, 5}, DType::Bool);
+    ASSERT_OK(e);
+    auto ce = count_nonzero(*e);
+    ASSERT_OK(ce);
+    EXPECT_EQ(scalar_i64(*ce), 0);
+}
+
+TEST(MaskTests, CountNonzeroLargeMultiChunk)
+{
+    // 跨多个固定块且长度非 64 的倍数：检验 SIMD 主体与尾部
+    const int64_t n    = 300'001;
+    const auto    bits = rand_mask(n, 0.3, 1);
+    int64_t       ref  = 0;
+    for (auto b : bits)
+        ref += b;
+    auto m = make_tensor<uint8_t>({n}, DType::Bool, bits);
+    auto c = count_nonzero(m);
+    ASSERT_OK(c);
+    EXPECT_EQ(scalar_i64(*c), ref);
+}
+
+// ── nonzero ──────────────────────────────────────────────────────────────────
+
+TEST(MaskTests, NonzeroReturnsRowMajorCoordinates)
+{
+    auto a = make_tensor<int32_t>({2, 3}, DType::I32, {0, 4, 0, 5, 0, 6});
+    auto z = nonzero(a);
+    ASSERT_OK(z);
+    EXPECT_EQ(z->shape(), (Shape{3, 2}));
+    EXPECT_EQ(z->dtype(), DType::I64);
+    EXPECT_EQ(values_of<int64_t>(*z), (std::vector<int64_t>{0, 1, 1, 0, 1, 2}));
+}
+
+TEST(MaskTests, NonzeroStridedLargeMatchesScalar)
+{
+    const int64_t rows = 257;
+    const int64_t cols = 611;
+    const auto    bits = rand_mask(rows * cols, 0.05, 7);
+    auto          m    = make_tensor<uint8_t>({rows, cols}, DType::Bool, bits);
+    auto          t    = m.transpose(0, 1);
+    ASSERT_OK(t);
+    auto z = nonzero(*t);
+    ASSERT_OK(z);
+
+    std::vector<int64_t> ref;
+    for (int64_t i = 0; i < cols; ++i) {
+        for (int64_t j = 0; j < rows; ++j) {
+            if (bits[static_cast<std::size_t>(j * cols + i)] != 0) {
+                ref.push_back(i);
+                ref.push_back(j);
+            }
+        }
+    }
+    EXPECT_EQ(z->shape(), (Shape{static_cast<int64_t>(ref.size() / 2), 2}));
+    EXPECT_EQ(values_of<int64_t>(*z), ref);
+}
+
+TEST(MaskTests, NonzeroEdgeShapes)
+{
+    auto none = Tensor::zeros({4, 4}, DType::F64);
+    ASSERT_OK(none);
+    auto z = nonzero(*none);
+    ASSERT_OK(z);
+    EXPECT_EQ(z->shape(), (Shape{0, 2}));
+
+    auto s = Tensor::full({}, DType::F32, 2.0);
+    ASSERT_OK(s);
+    auto zs = nonzero(*s);
+    ASSERT_OK(zs);
+    EXPECT_EQ(zs->shape(), (Shape{1, 0}));
+}
+
+// ── masked_select ────────────────────────────────────────────────────────────
+
+TEST(MaskTests, MaskedSelectKeepsOrder)
+{
+    auto a = make_tensor<double>({2, 3}, DType::F64, {1, 2, 3, 4, 5, 6});
+    auto m = make_tensor<uint8_t>({2, 3}, DType::Bool, {1, 0, 1, 0, 0, 1});
+    auto s = masked_select(a, m);
+    ASSERT_OK(s);
+    EXPECT_EQ(s->shape(), (Shape{3}));
+    EXPECT_EQ(values_of<double>(*s), (std::vector<double>{1, 3, 6}));
+}
+
+TEST(MaskTests, MaskedSelectLargeAllElementSizes)
+{
+    const int64_t n    = 200'003;
+    const auto    bits = rand_mask(n, 0.5, 3);
+    auto          m    = make_tensor<uint8_t>({n}, DType::Bool, bits);
+
+    auto check = [&]<typename T>(DType dt) {
+        std::vector<T> v(static_cast<std::size_t>(n));
+        for (int64_t i = 0; i < n; ++i)
+            v[static_cast<std::size_t>(i)] = static_cast<T>(i % 101);
+        std::vector<T> ref;
+        for (int64_t i = 0; i < n; ++i) {
+            if (bits[static_cast<std::size_t>(i)] != 0)
+                ref.push_back(v[static_cast<std::size_t>(i)]);
+        }
+        auto s = masked_select(make_tensor<T>({n}, dt, v), m);
+        ASSERT_OK(s);
+        EXPECT_EQ(values_of<T>(*s), ref);
+    };
+    check.template operator()<uint8_t>(DType::U8);
+    check.template operator()<uint16_t>(DType::F16);
+    check.template operator()<int32_t>(DType::I32);
+    check.template operator()<int64_t>(DType::I64);
+}
+
+TEST(MaskTests, MaskedSelectStridedInput)
+{
+    auto a = make_tensor<float>({2, 3}, DType::F32, {1, 2, 3, 4, 5, 6});
+    auto t = a.transpose(0, 1); // {3, 2}: 1 4 / 2 5 / 3 6
+    ASSERT_OK(t);
+    auto m = make_tensor<uint8_t>({3, 2}, DType::Bool, {0, 1, 1, 0, 1, 1});
+    auto s = masked_select(*t, m);
+    ASSERT_OK(s);
+    EXPECT_EQ(values_of<float>(*s), (std::vector<float>{4, 2, 3, 6}));
+}
+
+TEST(MaskTests, InvalidArguments)
+{
+    auto a  = Tensor::zeros({2, 2}, DType::F32);
+    auto mb = Tensor::zeros({2, 3}, DType::Bool);
+    auto mu = Tensor::zeros({2, 2}, DType::U8);
+    ASSERT_OK(a);
+    ASSERT_OK(mb);
+    ASSERT_OK(mu);
+    ASSERT_ERR(masked_select(*a, *mb)); // 形状不一致
+    ASSERT_ERR(masked_select(*a, *mu)); // mask 非 Bool
+    ASSERT_ERR(masked_select(Tensor(), *mu));
+    ASSERT_ERR(nonzero(Tensor()));
+    ASSERT_ERR(count_nonzero(Tensor()));
+}
@@ -2,9 +2,12 @@
 
 #include "Tensor/Tensor.hpp"
 
+#include <array>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <random>
+#include <type_traits>
 #include <vector>
 
 using namespace bee;
@@ -194,10 +197,20 @@ TEST(MatmulTests, ErrNonTwoD_1D)
     ASSERT_ERR(matmul(*a, *b));
 }
 
-TEST(MatmulTests, ErrNonTwoD_3D)
+TEST(MatmulTests, ErrBatchNotBroadcastable)
 {
     auto a = Tensor::zeros({2, 3, 4}, DType::F32);
-    auto b = Tensor::zeros({4, 2}, DType::F32);
+    auto b = Tensor::zeros({3, 4, 2}, DType::F32);
+    ASSERT_OK(a);
+    ASSERT_OK(b);
+
+    ASSERT_ERR(matmul(*a, *b));
+}
+
+TEST(MatmulTests, ErrBatched1D)
+{
+    auto a = Tensor::zeros({4}, DType::F32);
+    auto b = Tensor::zeros({2, 4, 3}, DType::F32);
     ASSERT_OK(a);
     ASSERT_OK(b);
 
@@ -342,3 +355,663 @@ TEST(MatmulTests, NZeroShape)
     EXPECT_EQ(c->shape(), (Shape{5, 0}));
     EXPECT_EQ(c->numel(), 0);
 }
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 批量 / 广播 matmul
+// ─────────────────────────────────────────────────────────────────────────────
+
+namespace
+{
+
+// 随机填充连续张量
+template <typename T>
+auto make_random(const Shape& shape, DType dt, uint32_t seed) -> Tensor
+{
+    auto t = Tensor::empty(shape, dt);
+    EXPECT_TRUE(t.has_value());
+    std::mt19937 rng(seed);
+    auto*        p = static_cast<T*>(t->data_ptr());
+    for (int64_t i = 0; i < t->numel(); ++i) {
+        if constexpr (std::is_floating_point_v<T>)
+            p[i] = static_cast<T>(std::uniform_real_distribution<double>(-1.0, 1.0)(rng));
+        else
+            p[i] = static_cast<T>(static_cast<int>(rng() % 7) - 3);
+    }
+    return *t;
+}
+
+// 逐 slice 与 2D matmul 结果比对；a_idx / b_idx 为各输出 batch 对应的输入 slice
+template <typename TO>
+auto expect_batched_eq(const Tensor& a, const Tensor& b, const Tensor& c, const std::vector<int64_t>& a_idx, const std::vector<int64_t>& b_idx, double tol)
+    -> void
+{
+    const int64_t M = a.shape()[a.ndim() - 2];
+    const int64_t K = a.shape()[a.ndim() - 1];
+    const int64_t N = b.shape()[b.ndim() - 1];
+    const auto    esz = dtype_size(a.dtype());
+    for (std::size_t i = 0; i < a_idx.size(); ++i) {
+        auto as = Tensor::empty({M, K}, a.dtype());
+        auto bs = Tensor::empty({K, N}, b.dtype());
+        ASSERT_OK(as);
+        ASSERT_OK(bs);
+        std::memcpy(as->data_ptr(), static_cast<const std::byte*>(a.data_ptr()) + a_idx[i] * M * K * esz, M * K * esz);
+        std::memcpy(bs->data_ptr(), static_cast<const std::byte*>(b.data_ptr()) + b_idx[i] * K * N * esz, K * N * esz);
+        auto ref = matmul(*as, *bs);
+        ASSERT_OK(ref);
+        const auto* pr = static_cast<const TO*>(ref->data_ptr());
+        const auto* pc = static_cast<const TO*>(c.data_ptr()) + static_cast<int64_t>(i) * M * N;
+        for (int64_t j = 0; j < M * N; ++j)
+            ASSERT_NEAR(static_cast<double>(pc[j]), static_cast<double>(pr[j]), tol) << "batch=" << i << " idx=" << j;
+    }
+}
+
+// 连续化副本：作为步长视图的参考输入
+auto contig(const Tensor& t) -> Tensor
+{
+    auto r = t.contiguous();
+    EXPECT_TRUE(r.has_value());
+    return *r;
+}
+
+// 同形状张量逐元素比对
+template <typename TO>
+auto expect_tensor_near(const Tensor& got, const Tensor& ref, double tol) -> void
+{
+    ASSERT_EQ(got.shape(), ref.shape());
+    const auto* pg = static_cast<const TO*>(got.data_ptr());
+    const auto* pr = static_cast<const TO*>(ref.data_ptr());
+    for (int64_t i = 0; i < got.numel(); ++i)
+        ASSERT_NEAR(static_cast<double>(pg[i]), static_cast<double>(pr[i]), tol) << "idx=" << i;
+}
+
+// 与朴素 double 累加比对；a / b 可为任意视图
+template <typename T>
+auto expect_matmul_naive(const Tensor& a, const Tensor& b, double tol) -> void
+{
+    auto c = matmul(a, b);
+    ASSERT_OK(c);
+    const auto    ac = contig(a);
+    const auto    bc = contig(b);
+    const int64_t M  = a.shape()[0];
+    const int64_t K  = a.shape()[1];
+    const int64_t N  = b.shape()[1];
+    const auto*   pa = static_cast<const T*>(ac.data_ptr());
+    const auto*   pb = static_cast<const T*>(bc.data_ptr());
+    const auto*   pc = static_cast<const T*>(c->data_ptr());
+    for (int64_t i = 0; i < M; ++i) {
+        for (int64_t j = 0; j < N; ++j) {
+            double acc = 0.0;
+            for (int64_t k = 0; k < K; ++k)
+                acc += static_cast<double>(pa[i * K + k]) * static_cast<double>(pb[k * N + j]);
+            ASSERT_NEAR(static_cast<double>(pc[i * N + j]), acc, tol) << "i=" << i << " j=" << j;
+        }
+    }
+}
+
+} // namespace
+
+TEST(MatmulTests, BatchedF32MatchesPerSlice)
+{
+    // M/N 非 MR/NR 整数倍，覆盖尾巴路径
+    const auto a = make_random<float>({3, 19, 23}, DType::F32, 1);
+    const auto b = make_random<float>({3, 23, 13}, DType::F32, 2);
+    auto       c = matmul(a, b);
+    ASSERT_OK(c);
+    EXPECT_EQ(c->shape(), (Shape{3, 19, 13}));
+    expect_batched_eq<float>(a, b, *c, {0, 1, 2}, {0, 1, 2}, 1e-4);
+
+    auto c2 = bmm(a, b);
+    ASSERT_OK(c2);
+    EXPECT_EQ(std::memcmp(c->data_ptr(), c2->data_ptr(), c->numel() * sizeof(float)), 0);
+}
+
+TEST(MatmulTests, BatchedBroadcastB2D)
+{
+    // {B,M,K} × {K,N}：B 只 pack 一次；规模超过并行阈值
+    const auto a = make_random<float>({4, 130, 96}, DType::F32, 3);
+    const auto b = make_random<float>({96, 203}, DType::F32, 4);
+    auto       c = matmul(a, b);
+    ASSERT_OK(c);
+    EXPECT_EQ(c->shape(), (Shape{4, 130, 203}));
+    expect_batched_eq<float>(a, b, *c, {0, 1, 2, 3}, {0, 0, 0, 0}, 1e-3);
+}
+
+TEST(MatmulTests, BatchedBroadcastA2D)
+{
+    const auto a = make_random<double>({7, 9}, DType::F64, 5);
+    const auto b = make_random<double>({2, 9, 6}, DType::F64, 6);
+    auto       c = matmul(a, b);
+    ASSERT_OK(c);
+    EXPECT_EQ(c->shape(), (Shape{2, 7, 6}));
+    expect_batched_eq<double>(a, b, *c, {0, 0}, {0, 1}, 1e-10);
+}
+
+TEST(MatmulTests, BatchedBroadcastBothSides)
+{
+    // {2,1,M,K} × {3,K,N} → {2,3,M,N}
+    const auto a = make_random<int32_t>({2, 1, 5, 8}, DType::I32, 7);
+    const auto b = make_random<int32_t>({3, 8, 10}, DType::I32, 8);
+    auto       c = matmul(a, b);
+    ASSERT_OK(c);
+    EXPECT_EQ(c->shape(), (Shape{2, 3, 5, 10}));
+    expect_batched_eq<int32_t>(a, b, *c, {0, 0, 0, 1, 1, 1}, {0, 1, 2, 0, 1, 2}, 0.0);
+}
+
+TEST(MatmulTests, BatchedI64AndI8)
+{
+    const auto a64 = make_random<int64_t>({3, 4, 5}, DType::I64, 9);
+    const auto b64 = make_random<int64_t>({3, 5, 6}, DType::I64, 10);
+    auto       c64 = matmul(a64, b64);
+    ASSERT_OK(c64);
+    expect_batched_eq<int64_t>(a64, b64, *c64, {0, 1, 2}, {0, 1, 2}, 0.0);
+
+    const auto a8 = make_random<int8_t>({2, 9, 17}, DType::I8, 11);
+    const auto b8 = make_random<int8_t>({17, 11}, DType::I8, 12);
+    auto       c8 = matmul(a8, b8);
+    ASSERT_OK(c8);
+    EXPECT_EQ(c8->dtype(), DType::I32);
+    expect_batched_eq<int32_t>(a8, b8, *c8, {0, 1}, {0, 0}, 0.0);
+}
+
+TEST(MatmulTests, BatchedNonContiguousAndEmpty)
+{
+    // 非连续输入：交换最后两维
+    const auto base = make_random<float>({3, 6, 5}, DType::F32, 13);
+    auto       a_t  = base.transpose(1, 2); // {3,5,6}，非连续
+    ASSERT_OK(a_t);
+    ASSERT_FALSE(a_t->is_contiguous());
+    const auto b = make_random<float>({3, 6, 4}, DType::F32, 14);
+    auto       c = matmul(*a_t, b);
+    ASSERT_OK(c);
+    auto a_c = a_t->contiguous();
+    ASSERT_OK(a_c);
+    expect_batched_eq<float>(*a_c, b, *c, {0, 1, 2}, {0, 1, 2}, 1e-5);
+
+    // batch 为 0 → 空输出
+    auto a0 = Tensor::zeros({0, 3, 4}, DType::F32);
+    auto b0 = Tensor::zeros({4, 2}, DType::F32);
+    ASSERT_OK(a0);
+    ASSERT_OK(b0);
+    auto c0 = matmul(*a0, *b0);
+    ASSERT_OK(c0);
+    EXPECT_EQ(c0->shape(), (Shape{0, 3, 2}));
+}
+
+TEST(MatmulTests, BmmRequires3DSameBatch)
+{
+    auto a = Tensor::zeros({2, 3, 4}, DType::F32);
+    auto b = Tensor::zeros({4, 5}, DType::F32);
+    auto d = Tensor::zeros({1, 4, 5}, DType::F32);
+    ASSERT_OK(a);
+    ASSERT_OK(b);
+    ASSERT_OK(d);
+    ASSERT_ERR(bmm(*a, *b));
+    ASSERT_ERR(bmm(*a, *d));
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 预打包 B（PackedMatrix）
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(MatmulTests, PackedMatchesMatmulF32)
+{
+    // 小 M（含 M < MR）与 N 非 NR 整数倍；最后一组规模超过并行阈值，走列组切分
+    const std::vector<std::array<int64_t, 3>> shapes = {
+        {1, 70, 45},
+        {3, 70, 45},
+        {8, 33, 64},
+        {17, 70, 45},
+        {4, 512, 1003},
+    };
+    for (const auto& [M, K, N] : shapes) {
+        const auto a  = make_random<float>({M, K}, DType::F32, 20);
+        const auto b  = make_random<float>({K, N}, DType::F32, 21);
+        auto       pb = pack_matrix(b);
+        ASSERT_OK(pb);
+        EXPECT_EQ(pb->rows(), K);
+        EXPECT_EQ(pb->cols(), N);
+
+        auto ref = matmul(a, b);
+        auto got = matmul(a, *pb);
+        ASSERT_OK(ref);
+        ASSERT_OK(got);
+        EXPECT_EQ(got->shape(), (Shape{M, N}));
+        const auto* pr = static_cast<const float*>(ref->data_ptr());
+        const auto* pg = static_cast<const float*>(got->data_ptr());
+        for (int64_t i = 0; i < M * N; ++i)
+            ASSERT_NEAR(pg[i], pr[i], 1e-3) << "M=" << M << " K=" << K << " N=" << N << " idx=" << i;
+    }
+}
+
+TEST(MatmulTests, PackedFoldsLeadingDimsAndDtypes)
+{
+    // {B,M,K} × packed{K,N}：前导维折叠进 M
+    const auto a  = make_random<double>({2, 5, 12}, DType::F64, 22);
+    const auto b  = make_random<double>({12, 7}, DType::F64, 23);
+    auto       pb = pack_matrix(b);
+    ASSERT_OK(pb);
+    auto c = matmul(a, *pb);
+    ASSERT_OK(c);
+    EXPECT_EQ(c->shape(), (Shape{2, 5, 7}));
+    expect_batched_eq<double>(a, b, *c, {0, 1}, {0, 0}, 1e-10);
+
+    const auto a32 = make_random<int32_t>({9, 11}, DType::I32, 24);
+    const auto b32 = make_random<int32_t>({11, 13}, DType::I32, 25);
+    auto       p32 = pack_matrix(b32);
+    ASSERT_OK(p32);
+    auto c32 = matmul(a32, *p32);
+    ASSERT_OK(c32);
+    expect_batched_eq<int32_t>(a32, b32, *c32, {0}, {0}, 0.0);
+
+    const auto a64 = make_random<int64_t>({3, 4}, DType::I64, 26);
+    const auto b64 = make_random<int64_t>({4, 5}, DType::I64, 27);
+    auto       p64 = pack_matrix(b64);
+    ASSERT_OK(p64);
+    auto c64 = matmul(a64, *p64);
+    ASSERT_OK(c64);
+    expect_batched_eq<int64_t>(a64, b64, *c64, {0}, {0}, 0.0);
+
+    const auto a8 = make_random<int8_t>({10, 21}, DType::I8, 28);
+    const auto b8 = make_random<int8_t>({21, 19}, DType::I8, 29);
+    auto       p8 = pack_matrix(b8);
+    ASSERT_OK(p8);
+    auto c8 = matmul(a8, *p8);
+    ASSERT_OK(c8);
+    EXPECT_EQ(c8->dtype(), DType::I32);
+    expect_batched_eq<int32_t>(a8, b8, *c8, {0}, {0}, 0.0);
+}
+
+TEST(MatmulTests, PackedErrors)
+{
+    auto b = Tensor::zeros({4, 3}, DType::F32);
+    ASSERT_OK(b);
+    auto pb = pack_matrix(*b);
+    ASSERT_OK(pb);
+
+    auto a_bad_k = Tensor::zeros({2, 5}, DType::F32);
+    auto a_bad_t = Tensor::zeros({2, 4}, DType::F64);
+    ASSERT_OK(a_bad_k);
+    ASSERT_OK(a_bad_t);
+    ASSERT_ERR(matmul(*a_bad_k, *pb));
+    ASSERT_ERR(matmul(*a_bad_t, *pb));
+    ASSERT_ERR(matmul(*a_bad_k, PackedMatrix{}));
+
+    auto b3 = Tensor::zeros({2, 4, 3}, DType::F32);
+    auto bu = Tensor::zeros({4, 3}, DType::U8);
+    ASSERT_OK(b3);
+    ASSERT_OK(bu);
+    ASSERT_ERR(pack_matrix(*b3));
+    ASSERT_ERR(pack_matrix(*bu));
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 融合 epilogue：linear / gemm
+// ─────────────────────────────────────────────────────────────────────────────
+
+namespace
+{
+
+auto ref_act(Activation act, double v) -> double
+{
+    switch (act) {
+    case Activation::ReLU: return v > 0.0 ? v : 0.0;
+    case Activation::GELU: return 0.5 * v * (1.0 + std::erf(v / std::sqrt(2.0)));
+    case Activation::SiLU: return v / (1.0 + std::exp(-v));
+    default: return v;
+    }
+}
+
+// 参考：out = act(alpha·A·B + beta·C0 + bias) + residual（A={M,K}，B={K,N}，均为连续张量）
+template <typename T>
+auto ref_fused(const Tensor& a, const Tensor& b, const T* c0, double alpha, double beta, const T* bias, Activation act, const T* res)
+    -> std::vector<double>
+{
+    const int64_t M  = a.numel() / a.shape().back();
+    const int64_t K  = a.shape().back();
+    const int64_t N  = b.shape()[1];
+    const auto*   pa = static_cast<const T*>(a.data_ptr());
+    const auto*   pb = static_cast<const T*>(b.data_ptr());
+
+    std::vector<double> out(static_cast<std::size_t>(M * N));
+    for (int64_t i = 0; i < M; ++i) {
+        for (int64_t j = 0; j < N; ++j) {
+            double acc = 0.0;
+            for (int64_t k = 0; k < K; ++k)
+                acc += static_cast<double>(pa[i * K + k]) * static_cast<double>(pb[k * N + j]);
+            double v = alpha * acc + (c0 != nullptr ? beta * static_cast<double>(c0[i * N + j]) : 0.0);
+            if (bias != nullptr)
+                v += static_cast<double>(bias[j]);
+            v = ref_act(act, v);
+            if (res != nullptr)
+                v += static_cast<double>(res[i * N + j]);
+            out[static_cast<std::size_t>(i * N + j)] = v;
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+TEST(MatmulTests, LinearFusedMatchesReference)
+{
+    // K 跨多个 KC 块（验证仅最后一个 K 块应用 epilogue），M/N 含尾巴
+    const std::vector<std::array<int64_t, 3>> shapes = {
+        {13, 700, 37},
+        {3, 20, 9},
+        {64, 96, 64},
+    };
+    for (const auto& [M, K, N] : shapes) {
+        const auto x    = make_random<float>({M, K}, DType::F32, 30);
+        const auto w    = make_random<float>({K, N}, DType::F32, 31);
+        const auto bias = make_random<float>({N}, DType::F32, 32);
+        const auto res  = make_random<float>({M, N}, DType::F32, 33);
+        for (auto act : {Activation::None, Activation::ReLU, Activation::GELU, Activation::SiLU}) {
+            auto y = linear(x, w, bias, act, res);
+            ASSERT_OK(y);
+            EXPECT_EQ(y->shape(), (Shape{M, N}));
+            const auto ref = ref_fused<float>(
+                x, w, nullptr, 1.0, 0.0, static_cast<const float*>(bias.data_ptr()), act, static_cast<const float*>(res.data_ptr())
+            );
+            const auto* py = static_cast<const float*>(y->data_ptr());
+            for (int64_t i = 0; i < M * N; ++i)
+                ASSERT_NEAR(py[i], ref[static_cast<std::size_t>(i)], 2e-3) << "M=" << M << " K=" << K << " N=" << N << " idx=" << i;
+        }
+    }
+}
+
+TEST(MatmulTests, LinearPackedAndLeadingDims)
+{
+    // x={2,5,K}，权重预打包，仅 bias + SiLU
+    const auto x    = make_random<double>({2, 5, 33}, DType::F64, 34);
+    const auto w    = make_random<double>({33, 10}, DType::F64, 35);
+    const auto bias = make_random<double>({10}, DType::F64, 36);
+    auto       pw   = pack_matrix(w);
+    ASSERT_OK(pw);
+
+    auto y = linear(x, *pw, bias, Activation::SiLU);
+    ASSERT_OK(y);
+    EXPECT_EQ(y->shape(), (Shape{2, 5, 10}));
+    const auto  ref = ref_fused<double>(x, w, nullptr, 1.0, 0.0, static_cast<const double*>(bias.data_ptr()), Activation::SiLU, nullptr);
+    const auto* py  = static_cast<const double*>(y->data_ptr());
+    for (int64_t i = 0; i < y->numel(); ++i)
+        ASSERT_NEAR(py[i], ref[static_cast<std::size_t>(i)], 1e-10);
+
+    // 与未打包版本一致
+    auto y2 = linear(x, w, bias, Activation::SiLU);
+    ASSERT_OK(y2);
+    const auto* py2 = static_cast<const double*>(y2->data_ptr());
+    for (int64_t i = 0; i < y->numel(); ++i)
+        ASSERT_NEAR(py[i], py2[i], 1e-12);
+}
+
+TEST(MatmulTests, GemmAlphaBetaInPlace)
+{
+    constexpr int64_t M = 19, K = 41, N = 27;
+    const auto        a    = make_random<float>({M, K}, DType::F32, 37);
+    const auto        b    = make_random<float>({K, N}, DType::F32, 38);
+    const auto        bias = make_random<float>({N}, DType::F32, 39);
+    auto              c    = make_random<float>({M, N}, DType::F32, 40);
+    const std::vector<float> c0(static_cast<const float*>(c.data_ptr()), static_cast<const float*>(c.data_ptr()) + M * N);
+
+    GemmOptions opts;
+    opts.alpha = 2.0;
+    opts.beta  = 0.5;
+    opts.bias  = bias;
+    opts.act   = Activation::ReLU;
+    ASSERT_OK(gemm(a, b, c, opts));
+
+    const auto  ref = ref_fused<float>(a, b, c0.data(), 2.0, 0.5, static_cast<const float*>(bias.data_ptr()), Activation::ReLU, nullptr);
+    const auto* pc  = static_cast<const float*>(c.data_ptr());
+    for (int64_t i = 0; i < M * N; ++i)
+        ASSERT_NEAR(pc[i], ref[static_cast<std::size_t>(i)], 1e-4);
+}
+
+TEST(MatmulTests, GemmAliasedOperands)
+{
+    // residual 即 c：须按调用前的 c 参与计算；M·N 跨多个并行块以覆盖并行 beta·C
+    constexpr int64_t M = 96, K = 33, N = 700;
+    const auto        a = make_random<float>({M, K}, DType::F32, 41);
+    const auto        b = make_random<float>({K, N}, DType::F32, 42);
+    for (double beta : {0.0, 0.5}) {
+        auto                     c = make_random<float>({M, N}, DType::F32, 43);
+        const std::vector<float> c0(static_cast<const float*>(c.data_ptr()), static_cast<const float*>(c.data_ptr()) + M * N);
+        auto                     row0 = c.slice(0, 0, 1); // {1, N} 视图作 bias 来源
+        ASSERT_OK(row0);
+        auto bias = row0->reshape({N});
+        ASSERT_OK(bias);
+
+        GemmOptions opts;
+        opts.beta     = beta;
+        opts.bias     = *bias;
+        opts.residual = c;
+        ASSERT_OK(gemm(a, b, c, opts));
+
+        const auto  ref = ref_fused<float>(a, b, c0.data(), 1.0, beta, c0.data(), Activation::None, c0.data());
+        const auto* pc  = static_cast<const float*>(c.data_ptr());
+        for (int64_t i = 0; i < M * N; ++i)
+            ASSERT_NEAR(pc[i], ref[static_cast<std::size_t>(i)], 1e-3) << "beta=" << beta << " idx=" << i;
+    }
+
+    // a / b 与 c 共享存储：拒绝
+    auto sq = make_random<float>({16, 16}, DType::F32, 44);
+    ASSERT_ERR(gemm(sq, sq, sq));
+    auto buf = make_random<float>({24, 16}, DType::F32, 45);
+    auto lhs = buf.slice(0, 0, 16);
+    auto out = buf.slice(0, 8, 24); // 与 lhs 共享第 8..15 行
+    ASSERT_OK(lhs);
+    ASSERT_OK(out);
+    ASSERT_ERR(gemm(*lhs, sq, *out));
+    auto lhs2 = make_random<float>({8, 16}, DType::F32, 46);
+    auto out2 = buf.slice(0, 0, 8);
+    ASSERT_OK(out2);
+    ASSERT_OK(gemm(lhs2, sq, *out2)); // 同一 storage 的不相交区域不算重叠
+}
+
+TEST(MatmulTests, FusedErrors)
+{
+    auto x  = Tensor::zeros({4, 3}, DType::F32);
+    auto w  = Tensor::zeros({3, 5}, DType::F32);
+    auto bb = Tensor::zeros({4}, DType::F32);
+    auto wi = Tensor::zeros({3, 5}, DType::I32);
+    auto xi = Tensor::zeros({4, 3}, DType::I32);
+    ASSERT_OK(x);
+    ASSERT_OK(w);
+    ASSERT_OK(bb);
+    ASSERT_OK(wi);
+    ASSERT_OK(xi);
+
+    ASSERT_ERR(linear(*x, *w, *bb));  // bias 长度不符
+    ASSERT_ERR(linear(*xi, *wi));     // 整型不支持融合
+    ASSERT_ERR(linear(*w, *w));       // 内维不符
+
+    auto c = Tensor::zeros({4, 4}, DType::F32);
+    ASSERT_OK(c);
+    ASSERT_ERR(gemm(*x, *w, *c));     // c shape 不符
+}
+
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 步长视图：转置 / 切片输入直接进入 pack，结果须与连续化后的输入一致
+// ─────────────────────────────────────────────────────────────────────────────
+
+namespace
+{
+
+// a = {K,M}ᵀ、b = {N,K}ᵀ，以及步长为 2 的行切片 + 列偏移切片
+template <typename T, typename TO>
+auto check_strided_views(DType dt, int64_t M, int64_t K, int64_t N, double tol) -> void
+{
+    auto at = make_random<T>({K, M}, dt, 50).transpose(0, 1);
+    auto bt = make_random<T>({N, K}, dt, 51).transpose(0, 1);
+    ASSERT_OK(at);
+    ASSERT_OK(bt);
+    auto c = matmul(*at, *bt);
+    ASSERT_OK(c);
+    auto ref = matmul(contig(*at), contig(*bt));
+    ASSERT_OK(ref);
+    expect_tensor_near<TO>(*c, *ref, tol);
+
+    auto as = make_random<T>({2 * M, K + 5}, dt, 52).slice(0, 0, 2 * M, 2);
+    ASSERT_OK(as);
+    auto as2 = as->slice(1, 3, K + 3);
+    ASSERT_OK(as2);
+    auto c2 = matmul(*as2, *bt);
+    ASSERT_OK(c2);
+    auto ref2 = matmul(contig(*as2), contig(*bt));
+    ASSERT_OK(ref2);
+    expect_tensor_near<TO>(*c2, *ref2, tol);
+}
+
+} // namespace
+
+TEST(MatmulTests, StridedViewsMatchContiguous)
+{
+    // 70×300×200 超过并行阈值，19×37×13 走串行 + 尾巴
+    check_strided_views<float, float>(DType::F32, 70, 300, 200, 1e-4);
+    check_strided_views<float, float>(DType::F32, 19, 37, 13, 1e-5);
+    check_strided_views<double, double>(DType::F64, 19, 37, 13, 1e-12);
+    check_strided_views<int32_t, int32_t>(DType::I32, 70, 300, 200, 0.0);
+    check_strided_views<int8_t, int32_t>(DType::I8, 19, 37, 13, 0.0);
+    check_strided_views<int64_t, int64_t>(DType::I64, 19, 37, 13, 0.0);
+}
+
+TEST(MatmulTests, StridedViewsBatchedAndPacked)
+{
+    // {B,M,K} × {N,K}ᵀ：常见的线性层写法
+    const auto x  = make_random<float>({3, 21, 40}, DType::F32, 53);
+    const auto w  = make_random<float>({17, 40}, DType::F32, 54);
+    auto       wt = w.transpose(0, 1);
+    ASSERT_OK(wt);
+    auto y = matmul(x, *wt);
+    ASSERT_OK(y);
+    auto ref = matmul(x, contig(*wt));
+    ASSERT_OK(ref);
+    expect_tensor_near<float>(*y, *ref, 1e-5);
+
+    // 两侧 batch 维均为转置视图：{K,B,M}.permute → {B,M,K}
+    auto xp = make_random<float>({40, 3, 21}, DType::F32, 55).permute({1, 2, 0});
+    ASSERT_OK(xp);
+    auto y2 = matmul(*xp, *wt);
+    ASSERT_OK(y2);
+    auto ref2 = matmul(contig(*xp), contig(*wt));
+    ASSERT_OK(ref2);
+    expect_tensor_near<float>(*y2, *ref2, 1e-5);
+
+    // 预打包与融合路径同样接受转置权重
+    auto pw = pack_matrix(*wt);
+    ASSERT_OK(pw);
+    auto y3 = matmul(x, *pw);
+    ASSERT_OK(y3);
+    expect_tensor_near<float>(*y3, *ref, 1e-5);
+
+    auto y4 = linear(*xp, *wt);
+    ASSERT_OK(y4);
+    expect_tensor_near<float>(*y4, *ref2, 1e-5);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 二维划分：小 M 大 N / 大 M 小 N 超过并行阈值时，jc × ic 网格结果须与朴素实现一致
+// ─────────────────────────────────────────────────────────────────────────────
+
+namespace
+{
+
+template <typename T>
+auto check_against_naive(int64_t M, int64_t K, int64_t N, DType dt, double tol) -> void
+{
+    expect_matmul_naive<T>(make_random<T>({M, K}, dt, 60), make_random<T>({K, N}, dt, 61), tol);
+}
+
+} // namespace
+
+TEST(MatmulTests, ShortWideAndTallSkinnyShapes)
+{
+    // 单个行块 + 大 N：列组切分；M 余数行与 N 余数列同时存在
+    check_against_naive<float>(5, 512, 2051, DType::F32, 1e-3);
+    check_against_naive<float>(197, 300, 1030, DType::F32, 1e-3);
+    check_against_naive<int32_t>(7, 256, 3003, DType::I32, 0.0);
+    // 大 M 小 N：行块充足，不切列
+    check_against_naive<float>(3001, 400, 13, DType::F32, 1e-3);
+}
+
+TEST(MatmulTests, EdgeTilesMatchNaive)
+{
+    // M / N 取遍 MR / NR 的各个余数：边界 tile 补零后走微内核，只写回有效部分
+    for (int64_t m = 9; m <= 17; m += 4)
+        for (int64_t n = 9; n <= 16; ++n) {
+            check_against_naive<float>(m, 67, n, DType::F32, 1e-3);
+            check_against_naive<double>(m, 67, n, DType::F64, 1e-10);
+            check_against_naive<int32_t>(m, 67, n, DType::I32, 0.0);
+        }
+    // 超过并行阈值：边界 tile 分散在各行块 / 列组任务中
+    check_against_naive<float>(301, 257, 103, DType::F32, 1e-3);
+    check_against_naive<double>(203, 300, 301, DType::F64, 1e-10);
+
+    // 预打包 B 的末尾列条带同样补零
+    const auto a  = make_random<float>({203, 129}, DType::F32, 62);
+    const auto b  = make_random<float>({129, 101}, DType::F32, 63);
+    auto       pb = pack_matrix(b);
+    ASSERT_OK(pb);
+    auto ref = matmul(a, b);
+    auto got = matmul(a, *pb);
+    ASSERT_OK(ref);
+    ASSERT_OK(got);
+    expect_tensor_near<float>(*got, *ref, 1e-4);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// 窄形状（GEMV / M ≤ MR）：行向量 × 矩阵、矩阵 × 列向量及其转置视图，含并行阈值之上的规模
+// ─────────────────────────────────────────────────────────────────────────────
+
+namespace
+{
+
+template <typename T>
+auto check_skinny(DType dt, double tol) -> void
+{
+    // 1×K×N：行向量 × 矩阵（N 含向量块 / 单向量 / 标量余数）
+    expect_matmul_naive<T>(make_random<T>({1, 300}, dt, 70), make_random<T>({300, 1037}, dt, 71), tol);
+    // M ≤ MR 的每个行数
+    for (int64_t m = 2; m <= 8; ++m)
+        expect_matmul_naive<T>(make_random<T>({m, 129}, dt, 72), make_random<T>({129, 77}, dt, 73), tol);
+    // M×K×1：矩阵 × 列向量（行数含 4 行一组的余数，K 含向量余数）
+    expect_matmul_naive<T>(make_random<T>({1031, 301}, dt, 74), make_random<T>({301, 1}, dt, 75), tol);
+    // 超过并行阈值
+    expect_matmul_naive<T>(make_random<T>({1, 2048}, dt, 76), make_random<T>({2048, 2500}, dt, 77), tol * 4);
+    expect_matmul_naive<T>(make_random<T>({2500, 2048}, dt, 78), make_random<T>({2048, 1}, dt, 79), tol * 4);
+
+    // 转置视图：行向量 × Bᵀ（逐列点积）、Aᵀ × 列向量（axpy）
+    auto bt = make_random<T>({1037, 300}, dt, 80).transpose(0, 1);
+    ASSERT_OK(bt);
+    expect_matmul_naive<T>(make_random<T>({1, 300}, dt, 81), *bt, tol);
+    auto at = make_random<T>({301, 1031}, dt, 82).transpose(0, 1);
+    ASSERT_OK(at);
+    expect_matmul_naive<T>(*at, make_random<T>({301, 1}, dt, 83), tol);
+}
+
+} // namespace
+
+TEST(MatmulTests, SkinnyShapesMatchNaive)
+{
+    check_skinny<float>(DType::F32, 1e-3);
+    check_skinny<double>(DType::F64, 1e-10);
+    // 整型不走向量化窄路径，结果仍须一致
+    expect_matmul_naive<int32_t>(make_random<int32_t>({1, 300}, DType::I32, 84), make_random<int32_t>({300, 1037}, DType::I32, 85), 0.0);
+    expect_matmul_naive<int32_t>(make_random<int32_t>({517, 300}, DType::I32, 86), make_random<int32_t>({300, 1}, DType::I32, 87), 0.0);
+}
+
+TEST(MatmulTests, BatchedSkinnyMatchesPerSlice)
+{
+    // 解码注意力形态：{B,1,K} × {B,K,N} 与 {B,M,K} × {B,K,1}
+    const auto q = make_random<float>({4, 1, 64}, DType::F32, 88);
+    const auto k = make_random<float>({4, 64, 300}, DType::F32, 89);
+    auto       s = matmul(q, k);
+    ASSERT_OK(s);
+    expect_batched_eq<float>(q, k, *s, {0, 1, 2, 3}, {0, 1, 2, 3}, 1e-4);
+
+    const auto a = make_random<float>({3, 257, 64}, DType::F32, 90);
+    const auto v = make_random<float>({3, 64, 1}, DType::F32, 91);
+    auto       o = matmul(a, v);
+    ASSERT_OK(o);
+    expect_batched_eq<float>(a, v, *o, {0, 1, 2}, {0, 1, 2}, 1e-4);
+}
@@ -0,0 +1,247 @@
+#include <gtest/gtest.h>
+
+#include "Tensor/Tensor.hpp"
+#include "TensorTestUtil.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace bee;
+using namespace bee::test;
+
+#define ASSERT_OK(expr)  ASSERT_TRUE((expr).has_value())
+#define ASSERT_ERR(expr) ASSERT_FALSE((expr).has_value())
+
+namespace
+{
+
+auto ref_var(const std::vector<double>& v, std::size_t begin, std::size_t n, std::size_t stride, int64_t correction) -> double
+{
+    double m = 0.0;
+    for (std::size_t k = 0; k < n; ++k)
+        m += v[begin + k * stride];
+    m /= static_cast<double>(n);
+    double ss = 0.0;
+    for (std::size_t k = 0; k < n; ++k) {
+        const double d  = v[begin + k * stride] - m;
+        ss             += d * d;
+    }
+    return ss / static_cast<double>(static_cast<int64_t>(n) - correction);
+}
+
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+// var / std
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(NormTests, VarStdGlobalF32)
+{
+    auto a = make_tensor<float>({4}, DType::F32, {1.0f, 2.0f, 3.0f, 4.0f});
+
+    auto v1 = var(a);
+    ASSERT_OK(v1);
+    EXPECT_EQ(v1->ndim(), 0);
+    EXPECT_NEAR(*static_cast<const float*>(v1->data_ptr()), 5.0f / 3.0f, 1e-6f);
+
+    auto v0 = var(a, 0);
+    ASSERT_OK(v0);
+    EXPECT_NEAR(*static_cast<const float*>(v0->data_ptr()), 1.25f, 1e-6f);
+
+    auto s0 = stddev(a, 0);
+    ASSERT_OK(s0);
+    EXPECT_NEAR(*static_cast<const float*>(s0->data_ptr()), std::sqrt(1.25f), 1e-6f);
+}
+
+TEST(NormTests, VarGlobalLargeParallelF64)
+{
+    // 超过并行阈值，且带 1e6 偏移：分块 + Chan 合并应与双遍参考值一致
+    const std::size_t n    = 3 * 1024 * 1024 + 17;
+    const auto        vals = lcg_seq(n, 12345u, 0.5, 1.0e6);
+    auto              a    = make_tensor<double>({static_cast<int64_t>(n)}, DType::F64, vals);
+
+    auto v = var(a);
+    ASSERT_OK(v);
+    const double ref = ref_var(vals, 0, n, 1, 1);
+    EXPECT_NEAR(*static_cast<const double*>(v->data_ptr()), ref, ref * 1e-9);
+}
+
+TEST(NormTests, VarGlobalIntegerToF64)
+{
+    auto a = make_tensor<int32_t>({3}, DType::I32, {2, 4, 6});
+    auto v = var(a);
+    ASSERT_OK(v);
+    EXPECT_EQ(v->dtype(), DType::F64);
+    EXPECT_DOUBLE_EQ(*static_cast<const double*>(v->data_ptr()), 4.0);
+}
+
+TEST(NormTests, VarCorrectionExceedsCountIsNaN)
+{
+    auto a = make_tensor<double>({1}, DType::F64, {3.0});
+    auto v = var(a);
+    ASSERT_OK(v);
+    EXPECT_TRUE(std::isnan(*static_cast<const double*>(v->data_ptr())));
+}
+
+TEST(NormTests, VarRejectsInvalidInput)
+{
+    auto b = Tensor::zeros({4}, DType::Bool);
+    ASSERT_OK(b);
+    ASSERT_ERR(var(*b));
+
+    auto f = Tensor::zeros({4}, DType::F32);
+    ASSERT_OK(f);
+    ASSERT_ERR(var(*f, -1));
+    ASSERT_ERR(stddev(*f, 1, 1));
+    ASSERT_ERR(var(Tensor{}));
+}
+
+TEST(NormTests, VarAxisInnerAndRowPaths)
+{
+    // [5, 37, 300]：dim=1 走逐列 SIMD Welford；dim=2 走按行连续路径
+    const int64_t D0 = 5, D1 = 37, D2 = 300;
+    const auto    vals = lcg_seq(static_cast<std::size_t>(D0 * D1 * D2), 12345u, 0.5, 100.0);
+    std::vector<float> fv(vals.begin(), vals.end());
+    std::vector<double> dv(fv.begin(), fv.end());
+    auto a = make_tensor<float>({D0, D1, D2}, DType::F32, fv);
+
+    auto v1 = var(a, 1, 1, true);
+    ASSERT_OK(v1);
+    EXPECT_EQ(v1->shape(), (Shape{D0, 1, D2}));
+    const auto* p1 = static_cast<const float*>(v1->data_ptr());
+    for (int64_t o = 0; o < D0; ++o)
+        for (int64_t i = 0; i < D2; ++i) {
+            const double ref = ref_var(dv, static_cast<std::size_t>(o * D1 * D2 + i), D1, D2, 1);
+            ASSERT_NEAR(p1[o * D2 + i], ref, 1e-4) << o << "," << i;
+        }
+
+    auto s2 = stddev(a, -1, 0);
+    ASSERT_OK(s2);
+    EXPECT_EQ(s2->shape(), (Shape{D0, D1}));
+    const auto* p2 = static_cast<const float*>(s2->data_ptr());
+    for (int64_t r = 0; r < D0 * D1; ++r) {
+        const double ref = std::sqrt(ref_var(dv, static_cast<std::size_t>(r * D2), D2, 1, 0));
+        ASSERT_NEAR(p2[r], ref, 1e-4) << r;
+    }
+}
+
+TEST(NormTests, VarAxisNonContiguous)
+{
+    auto a = make_tensor<double>({2, 3}, DType::F64, {1.0, 2.0, 3.0, 5.0, 7.0, 9.0});
+    auto t = a.transpose(0, 1);
+    ASSERT_OK(t);
+    // t = [[1,5],[2,7],[3,9]]，沿 dim=1 的总体方差 = {4, 6.25, 9}
+    auto v = var(*t, 1, 0);
+    ASSERT_OK(v);
+    const auto* p = static_cast<const double*>(v->data_ptr());
+    EXPECT_DOUBLE_EQ(p[0], 4.0);
+    EXPECT_DOUBLE_EQ(p[1], 6.25);
+    EXPECT_DOUBLE_EQ(p[2], 9.0);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// layer_norm / rms_norm
+// ─────────────────────────────────────────────────────────────────────────────
+
+TEST(NormTests, LayerNormWithAffine)
+{
+    const int64_t R = 7, N = 45;
+    const auto    vals = lcg_seq(static_cast<std::size_t>(R * N), 12345u, 0.5, -3.0);
+    auto          x    = make_tensor<double>({R, N}, DType::F64, vals);
+
+    std::vector<double> wv(N), bv(N);
+    for (int64_t j = 0; j < N; ++j) {
+        wv[static_cast<std::size_t>(j)] = 0.5 + 0.01 * static_cast<double>(j);
+        bv[static_cast<std::size_t>(j)] = -0.25 * static_cast<double>(j % 3);
+    }
+    auto w = make_tensor<double>({N}, DType::F64, wv);
+    auto b = make_tensor<double>({N}, DType::F64, bv);
+
+    const double eps = 1e-5;
+    auto         y   = layer_norm(x, {N}, w, b, eps);
+    ASSERT_OK(y);
+    EXPECT_EQ(y->shape(), x.shape());
+    const auto* py = static_cast<const double*>(y->data_ptr());
+    for (int64_t r = 0; r < R; ++r) {
+        double m = 0.0;
+        for (int64_t j = 0; j < N; ++j)
+            m += vals[static_cast<std::size_t>(r * N + j)];
+        m                 /= static_cast<double>(N);
+        const double rstd  = 1.0 / std::sqrt(ref_var(vals, static_cast<std::size_t>(r * N), N, 1, 0) + eps);
+        for (int64_t j = 0; j < N; ++j) {
+            const auto   k   = static_cast<std::size_t>(j);
+            const double ref = (vals[static_cast<std::size_t>(r * N + j)] - m) * rstd * wv[k] + bv[k];
+            ASSERT_NEAR(py[r * N + j], ref, 1e-9);
+        }
+    }
+}
+
+TEST(NormTests, LayerNormMultiDimNoAffineF32)
+{
+    auto x = Tensor::full({3, 2, 4}, DType::F32, 2.0);
+    ASSERT_OK(x);
+    auto y = layer_norm(*x, {2, 4});
+    ASSERT_OK(y);
+    const auto* p = static_cast<const float*>(y->data_ptr());
+    for (int64_t i = 0; i < y->numel(); ++i)
+        EXPECT_FLOAT_EQ(p[i], 0.0f);
+}
+
+TEST(NormTests, LayerNormLongRowParallel)
+{
+    // 单行超过并行阈值：统计与归一化都走行内并行
+    const int64_t N    = 1100 * 1000;
+    const auto    vals = lcg_seq(static_cast<std::size_t>(N), 12345u, 0.5, 10.0);
+    std::vector<float> fv(vals.begin(), vals.end());
+    auto x = make_tensor<float>({1, N}, DType::F32, fv);
+
+    auto y = layer_norm(x, {N});
+    ASSERT_OK(y);
+    auto m = mean(*y);
+    ASSERT_OK(m);
+    EXPECT_NEAR(*static_cast<const float*>(m->data_ptr()), 0.0f, 1e-4f);
+    auto v = var(*y, 0);
+    ASSERT_OK(v);
+    EXPECT_NEAR(*static_cast<const float*>(v->data_ptr()), 1.0f, 1e-3f);
+}
+
+TEST(NormTests, RmsNormWithWeight)
+{
+    auto x = make_tensor<float>({2, 3}, DType::F32, {1.0f, 2.0f, 2.0f, -3.0f, 0.0f, 4.0f});
+    auto w = make_tensor<float>({3}, DType::F32, {1.0f, 0.5f, 2.0f});
+
+    auto y = rms_norm(x, {3}, w, 0.0);
+    ASSERT_OK(y);
+    const auto* p = static_cast<const float*>(y->data_ptr());
+    // 行 0：rms = sqrt(9/3) = sqrt(3)；行 1：rms = sqrt(25/3)
+    const float r0 = std::sqrt(3.0f), r1 = std::sqrt(25.0f / 3.0f);
+    EXPECT_NEAR(p[0], 1.0f / r0, 1e-6f);
+    EXPECT_NEAR(p[1], 1.0f / r0, 1e-6f);
+    EXPECT_NEAR(p[2], 4.0f / r0, 1e-6f);
+    EXPECT_NEAR(p[3], -3.0f / r1, 1e-6f);
+    EXPECT_NEAR(p[4], 0.0f, 1e-6f);
+    EXPECT_NEAR(p[5], 8.0f / r1, 1e-6f);
+}
+
+TEST(NormTests, NormRejectsInvalidInput)
+{
+    auto x = Tensor::zeros({2, 3}, DType::F32);
+    ASSERT_OK(x);
+    ASSERT_ERR(layer_norm(*x, {2}));
+    ASSERT_ERR(layer_norm(*x, {}));
+    ASSERT_ERR(layer_norm(*x, {1, 2, 3}));
+
+    auto w_bad = Tensor::zeros({4}, DType::F32);
+    ASSERT_OK(w_bad);
+    ASSERT_ERR(rms_norm(*x, {3}, *w_bad));
+
+    auto w_f64 = Tensor::zeros({3}, DType::F64);
+    ASSERT_OK(w_f64);
+    ASSERT_ERR(layer_norm(*x, {3}, *w_f64));
+
+    auto xi = Tensor::zeros({2, 3}, DType::I32);
+    ASSERT_OK(xi);
+    ASSERT_ERR(rms_norm(*xi, {3}));
+}
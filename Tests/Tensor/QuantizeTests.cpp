@@ -0,0 +1,354 @@
+/**
+ * @File QuantizeTests.cpp
+ * @Brief This file is part of Bee.
+ *
+ * 仿射量化与量化 GEMM 的正确性测试：
+ * - per-tensor / per-channel（最内维与中间维）量化、反量化与舍入 / 饱和语义
+ * - u8 × s8 量化矩阵乘：F32 输出对照双精度参考，U8 / I8 再量化输出允许 ±1
+ * - 权重含 |w0| + |w1| > 128 的成对值且激活含 ≥ 128 的值（maddubs 饱和风险路径）
+ * - 非对齐尺寸、转置权重视图、预打包权重与参数校验
+ */
+
+#include <gtest/gtest.h>
+
+#include "Tensor/Tensor.hpp"
+#include "TensorTestUtil.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#define ASSERT_OK(expr)  ASSERT_TRUE((expr).has_value())
+#define ASSERT_ERR(expr) ASSERT_FALSE((expr).has_value())
+
+using namespace bee;
+using namespace bee::test;
+
+namespace
+{
+
+// 与内核相同的舍入语义：round_half_even(x · (1 / scale) + zp)，再饱和
+// 内核可能使用 FMA，恰在 .5 边界附近的值与参考相差 1，批量比较时允许 ±1
+auto ref_quantize(float x, float scale, int32_t zp, int32_t lo, int32_t hi) -> int32_t
+{
+    const float y = std::nearbyint(x * (1.0f / scale) + static_cast<float>(zp));
+    return static_cast<int32_t>(std::fmin(std::fmax(y, static_cast<float>(lo)), static_cast<float>(hi)));
+}
+
+// 量化 GEMM 的双精度参考：y = a_s · w_s[j] · Σ (a - a_zp) · w + bias[j]
+auto ref_qmatmul(
+    int64_t                     M,
+    int64_t                     K,
+    int64_t                     N,
+    const std::vector<uint8_t>& a,
+    QuantParams                 a_qp,
+    const std::vector<int8_t>&  w,
+    const std::vector<float>&   w_scales,
+    const std::vector<float>&   bias
+) -> std::vector<double>
+{
+    std::vector<double> y(static_cast<size_t>(M * N));
+    for (int64_t i = 0; i < M; ++i)
+        for (int64_t j = 0; j < N; ++j) {
+            int64_t acc = 0;
+            for (int64_t k = 0; k < K; ++k)
+                acc += (static_cast<int64_t>(a[static_cast<size_t>(i * K + k)]) - a_qp.zero_point) * w[static_cast<size_t>(k * N + j)];
+            const double ws = w_scales.size() == 1 ? w_scales[0] : w_scales[static_cast<size_t>(j)];
+            y[static_cast<size_t>(i * N + j)] = a_qp.scale * ws * static_cast<double>(acc) + (bias.empty() ? 0.0 : bias[static_cast<size_t>(j)]);
+        }
+    return y;
+}
+
+struct QmmCase
+{
+    int64_t M, K, N;
+    int     w_lo, w_hi; // 权重取值范围
+    int     a_lo, a_hi; // 激活取值范围
+    bool    per_channel;
+};
+
+auto run_qmm_case(const QmmCase& c, std::mt19937& rng) -> void
+{
+    std::uniform_int_distribution<int> da(c.a_lo, c.a_hi);
+    std::uniform_int_distribution<int> dw(c.w_lo, c.w_hi);
+    std::uniform_real_distribution<float> ds(0.005f, 0.02f);
+    std::uniform_real_distribution<float> db(-2.0f, 2.0f);
+
+    std::vector<uint8_t> a(static_cast<size_t>(c.M * c.K));
+    std::vector<int8_t>  w(static_cast<size_t>(c.K * c.N));
+    for (auto& v : a)
+        v = static_cast<uint8_t>(da(rng));
+    for (auto& v : w)
+        v = static_cast<int8_t>(dw(rng));
+    std::vector<float> ws(c.per_channel ? static_cast<size_t>(c.N) : 1);
+    for (auto& v : ws)
+        v = ds(rng);
+    std::vector<float> bias(static_cast<size_t>(c.N));
+    for (auto& v : bias)
+        v = db(rng);
+
+    const QuantParams a_qp{0.05, 117};
+    const auto        ref = ref_qmatmul(c.M, c.K, c.N, a, a_qp, w, ws, bias);
+
+    const Tensor ta  = make_tensor(a, {c.M, c.K});
+    const Tensor tw  = make_tensor(w, {c.K, c.N});
+    const Tensor tws = make_tensor(ws, {static_cast<int64_t>(ws.size())});
+    const Tensor tb  = make_tensor(bias, {c.N});
+
+    auto yf = quantized_matmul(ta, a_qp, tw, tws, tb, DType::F32);
+    ASSERT_OK(yf);
+    ASSERT_EQ(yf->shape(), (Shape{c.M, c.N}));
+    const auto pf = values_of<float>(*yf);
+    for (size_t i = 0; i < ref.size(); ++i)
+        ASSERT_NEAR(pf[i], ref[i], 1e-4 * std::abs(ref[i]) + 1e-4) << "idx=" << i << " M=" << c.M << " K=" << c.K << " N=" << c.N;
+
+    // 再量化输出：参考值在 float 精度下可能恰落在舍入边界，允许 ±1
+    const QuantParams out_qp{0.25, 3};
+    for (const DType odt : {DType::I8, DType::U8}) {
+        auto yq = quantized_matmul(ta, a_qp, tw, tws, tb, odt, out_qp);
+        ASSERT_OK(yq);
+        ASSERT_EQ(yq->dtype(), odt);
+        const int32_t lo = odt == DType::U8 ? 0 : -128;
+        const int32_t hi = odt == DType::U8 ? 255 : 127;
+        for (size_t i = 0; i < ref.size(); ++i) {
+            const int32_t expect = ref_quantize(static_cast<float>(ref[i]), 0.25f, 3, lo, hi);
+            const int32_t got    = odt == DType::U8 ? static_cast<const uint8_t*>(yq->data_ptr())[i] : static_cast<const int8_t*>(yq->data_ptr())[i];
+            ASSERT_LE(std::abs(got - expect), 1) << "idx=" << i << " M=" << c.M << " K=" << c.K << " N=" << c.N;
+        }
+    }
+}
+
+} // namespace
+
+// ── per-tensor 量化：就近偶数舍入、饱和与反量化 ──────────────────────────────
+TEST(QuantizeTests, PerTensorRoundTrip)
+{
+    const std::vector<float> xs = {0.0f, 0.25f, 0.75f, -0.25f, 1.0f, 100.0f, -100.0f, 12.3f};
+    const Tensor             x  = make_tensor(xs, {8});
+
+    auto q = quantize_per_tensor(x, {0.5, 10}, DType::U8);
+    ASSERT_OK(q);
+    ASSERT_EQ(q->dtype(), DType::U8);
+    // 10.5 → 10、11.5 → 12、9.5 → 10（就近偶数）；210 / -190 饱和
+    const std::vector<uint8_t> expect = {10, 10, 12, 10, 12, 210, 0, 35};
+    EXPECT_EQ(values_of<uint8_t>(*q), expect);
+
+    auto d = dequantize_per_tensor(*q, {0.5, 10});
+    ASSERT_OK(d);
+    ASSERT_EQ(d->dtype(), DType::F32);
+    const auto pd = values_of<float>(*d);
+    EXPECT_FLOAT_EQ(pd[2], 1.0f);
+    EXPECT_FLOAT_EQ(pd[6], -5.0f);
+    EXPECT_FLOAT_EQ(pd[7], 12.5f);
+}
+
+TEST(QuantizeTests, PerTensorLargeMatchesReference)
+{
+    // 超过并行阈值并含 SIMD 尾部
+    const int64_t      n = 300007;
+    std::mt19937       rng(7);
+    std::uniform_real_distribution<float> dist(-3.0f, 3.0f);
+    std::vector<float> xs(static_cast<size_t>(n));
+    for (auto& v : xs)
+        v = dist(rng);
+    const Tensor x = make_tensor(xs, {n});
+
+    auto q = quantize_per_tensor(x, {0.02, -5}, DType::I8);
+    ASSERT_OK(q);
+    const auto pq = values_of<int8_t>(*q);
+    for (int64_t i = 0; i < n; ++i)
+        ASSERT_LE(std::abs(pq[static_cast<size_t>(i)] - ref_quantize(xs[static_cast<size_t>(i)], 0.02f, -5, -128, 127)), 1) << "idx=" << i;
+
+    auto d = dequantize_per_tensor(*q, {0.02, -5});
+    ASSERT_OK(d);
+    const auto pd = values_of<float>(*d);
+    for (int64_t i = 0; i < n; ++i) {
+        const float expect = (static_cast<float>(pq[static_cast<size_t>(i)]) + 5.0f) * 0.02f;
+        ASSERT_FLOAT_EQ(pd[static_cast<size_t>(i)], expect) << "idx=" << i;
+    }
+}
+
+// ── per-channel：通道为最内维与中间维 ─────────────────────────────────────────
+TEST(QuantizeTests, PerChannelAxes)
+{
+    const int64_t      A = 3, C = 5, B = 7;
+    std::vector<float> xs(static_cast<size_t>(A * C * B));
+    for (size_t i = 0; i < xs.size(); ++i)
+        xs[i] = static_cast<float>(static_cast<int>(i % 23) - 11) * 0.37f;
+    const Tensor x = make_tensor(xs, {A, C, B});
+
+    const std::vector<float>   sc = {0.1f, 0.2f, 0.05f, 0.5f, 1.0f};
+    const std::vector<int32_t> zp = {0, 3, -7, 100, -128};
+    const Tensor               ts = make_tensor(sc, {C});
+    const Tensor               tz = make_tensor(zp, {C});
+
+    for (const int64_t axis : {int64_t{1}, int64_t{-2}}) {
+        auto q = quantize_per_channel(x, ts, tz, axis, DType::I8);
+        ASSERT_OK(q);
+        const auto pq = values_of<int8_t>(*q);
+        for (int64_t i = 0; i < A * C * B; ++i) {
+            const auto c = static_cast<size_t>((i / B) % C);
+            ASSERT_LE(std::abs(pq[static_cast<size_t>(i)] - ref_quantize(xs[static_cast<size_t>(i)], sc[c], zp[c], -128, 127)), 1) << "idx=" << i;
+        }
+        auto d = dequantize_per_channel(*q, ts, tz, axis);
+        ASSERT_OK(d);
+        const auto pd = values_of<float>(*d);
+        for (int64_t i = 0; i < A * C * B; ++i) {
+            const auto c = static_cast<size_t>((i / B) % C);
+            ASSERT_FLOAT_EQ(pd[static_cast<size_t>(i)], (static_cast<float>(pq[static_cast<size_t>(i)]) - static_cast<float>(zp[c])) * sc[c]);
+        }
+    }
+
+    // 通道为最内维：参数逐元素取
+    auto xt = x.reshape({A * C, B});
+    ASSERT_OK(xt);
+    std::vector<float> sb(static_cast<size_t>(B));
+    for (int64_t j = 0; j < B; ++j)
+        sb[static_cast<size_t>(j)] = 0.01f * static_cast<float>(j + 1);
+    auto q = quantize_per_channel(*xt, make_tensor(sb, {B}), {}, -1, DType::U8);
+    ASSERT_OK(q);
+    const auto pq = values_of<uint8_t>(*q);
+    for (int64_t i = 0; i < A * C * B; ++i)
+        ASSERT_LE(std::abs(pq[static_cast<size_t>(i)] - ref_quantize(xs[static_cast<size_t>(i)], sb[static_cast<size_t>(i % B)], 0, 0, 255)), 1)
+            << "idx=" << i;
+}
+
+TEST(QuantizeTests, NonContiguousAndF64Input)
+{
+    const std::vector<double> xs = {0.1, 0.2, 0.3, 0.4, 0.5, 0.6};
+    const Tensor              x  = make_tensor(xs, {2, 3});
+    auto                      xt = x.transpose(0, 1);
+    ASSERT_OK(xt);
+    auto q = quantize_per_tensor(*xt, {0.1, 0}, DType::I8);
+    ASSERT_OK(q);
+    ASSERT_EQ(q->shape(), (Shape{3, 2}));
+    EXPECT_EQ(values_of<int8_t>(*q), (std::vector<int8_t>{1, 4, 2, 5, 3, 6}));
+}
+
+TEST(QuantizeTests, InvalidParams)
+{
+    const Tensor x = make_tensor(std::vector<float>{1.0f, 2.0f}, {2});
+    ASSERT_ERR(quantize_per_tensor(x, {0.0, 0}, DType::U8));
+    ASSERT_ERR(quantize_per_tensor(x, {-1.0, 0}, DType::U8));
+    ASSERT_ERR(quantize_per_tensor(x, {1.0, 256}, DType::U8));
+    ASSERT_ERR(quantize_per_tensor(x, {1.0, -129}, DType::I8));
+    ASSERT_ERR(quantize_per_tensor(x, {1.0, 0}, DType::I32));
+    ASSERT_ERR(quantize_per_channel(x, make_tensor(std::vector<float>{1.0f}, {1}), {}, 0, DType::U8));
+    ASSERT_ERR(quantize_per_channel(x, make_tensor(std::vector<float>{1.0f, 1.0f}, {2}), {}, 1, DType::U8));
+    ASSERT_ERR(dequantize_per_tensor(x, {1.0, 0}));
+}
+
+// ── 量化 GEMM ────────────────────────────────────────────────────────────────
+TEST(QuantizeTests, QMatmulSmall)
+{
+    // a - zp = [[1, 2], [3, 4]]，w = [[1, -1], [2, 0]] → acc = [[5, -1], [11, -3]]
+    const Tensor a  = make_tensor(std::vector<uint8_t>{11, 12, 13, 14}, {2, 2});
+    const Tensor w  = make_tensor(std::vector<int8_t>{1, -1, 2, 0}, {2, 2});
+    const Tensor ws = make_tensor(std::vector<float>{0.5f, 2.0f}, {2});
+    const Tensor b  = make_tensor(std::vector<float>{1.0f, 0.0f}, {2});
+
+    auto y = quantized_matmul(a, {0.5, 10}, w, ws, b, DType::F32);
+    ASSERT_OK(y);
+    EXPECT_EQ(values_of<float>(*y), (std::vector<float>{2.25f, -1.0f, 3.75f, -3.0f}));
+
+    auto yq = quantized_matmul(a, {0.5, 10}, w, ws, b, DType::I8, {0.5, -1});
+    ASSERT_OK(yq);
+    EXPECT_EQ(values_of<int8_t>(*yq), (std::vector<int8_t>{4, -3, 6, -7}));
+}
+
+TEST(QuantizeTests, QMatmulSizes)
+{
+    std::mt19937 rng(0x51A7);
+    for (const auto& c : std::vector<QmmCase>{
+             {1, 1, 1, -127, 127, 0, 255, false},
+             {8, 16, 8, -127, 127, 0, 255, true},
+             {7, 5, 3, -127, 127, 0, 255, true},
+             {9, 33, 13, -127, 127, 0, 255, false},
+             {65, 127, 70, -127, 127, 0, 255, true},
+             {200, 300, 129, -127, 127, 0, 255, true},
+         }) {
+        run_qmm_case(c, rng);
+    }
+}
+
+// 权重成对和可超过 128 且激活 ≥ 128：maddubs 会饱和，必须走精确路径
+TEST(QuantizeTests, QMatmulSaturationProne)
+{
+    std::mt19937 rng(0xFEED);
+    run_qmm_case({33, 64, 40, -128, 127, 128, 255, true}, rng);
+    run_qmm_case({17, 31, 24, 100, 127, 200, 255, false}, rng);
+    // 小权重 / 小激活：可走 maddubs 快路径
+    run_qmm_case({33, 64, 40, -64, 64, 0, 255, true}, rng);
+    run_qmm_case({33, 64, 40, -128, 127, 0, 127, true}, rng);
+}
+
+TEST(QuantizeTests, QMatmulPackedAndViews)
+{
+    const int64_t        M = 5, K = 19, N = 11;
+    std::mt19937         rng(99);
+    std::uniform_int_distribution<int> dw(-128, 127);
+    std::uniform_int_distribution<int> da(0, 255);
+    std::vector<int8_t>  wt(static_cast<size_t>(N * K)); // {N, K} 存放，取转置视图
+    std::vector<uint8_t> a(static_cast<size_t>(2 * M * K));
+    for (auto& v : wt)
+        v = static_cast<int8_t>(dw(rng));
+    for (auto& v : a)
+        v = static_cast<uint8_t>(da(rng));
+
+    const Tensor tw = make_tensor(wt, {N, K});
+    auto         wv = tw.transpose(0, 1);
+    ASSERT_OK(wv);
+    const Tensor ws = make_tensor(std::vector<float>{0.01f}, {1});
+    auto         pw = pack_qmatrix(*wv, ws);
+    ASSERT_OK(pw);
+    EXPECT_EQ(pw->rows(), K);
+    EXPECT_EQ(pw->cols(), N);
+    EXPECT_FALSE(pw->per_channel());
+
+    // 3D 激活：前导维折叠进 M
+    const Tensor ta = make_tensor(a, {2, M, K});
+    auto         y  = quantized_matmul(ta, {0.1, 128}, *pw, {}, DType::F32);
+    ASSERT_OK(y);
+    ASSERT_EQ(y->shape(), (Shape{2, M, N}));
+
+    std::vector<int8_t> w(static_cast<size_t>(K * N));
+    for (int64_t k = 0; k < K; ++k)
+        for (int64_t j = 0; j < N; ++j)
+            w[static_cast<size_t>(k * N + j)] = wt[static_cast<size_t>(j * K + k)];
+    const auto ref = ref_qmatmul(2 * M, K, N, a, {0.1, 128}, w, {0.01f}, {});
+    const auto py  = values_of<float>(*y);
+    for (size_t i = 0; i < ref.size(); ++i)
+        ASSERT_NEAR(py[i], ref[i], 1e-4 * std::abs(ref[i]) + 1e-4) << "idx=" << i;
+
+    // 2D 激活的列切片视图按步长读取
+    const Tensor ta2 = make_tensor(a, {M, 2 * K});
+    auto         av  = ta2.slice(1, K, 2 * K);
+    ASSERT_OK(av);
+    auto y2 = quantized_matmul(*av, {0.1, 128}, *pw, {}, DType::F32);
+    ASSERT_OK(y2);
+    std::vector<uint8_t> a2(static_cast<size_t>(M * K));
+    for (int64_t i = 0; i < M; ++i)
+        for (int64_t k = 0; k < K; ++k)
+            a2[static_cast<size_t>(i * K + k)] = a[static_cast<size_t>(i * 2 * K + K + k)];
+    const auto ref2 = ref_qmatmul(M, K, N, a2, {0.1, 128}, w, {0.01f}, {});
+    const auto py2  = values_of<float>(*y2);
+    for (size_t i = 0; i < ref2.size(); ++i)
+        ASSERT_NEAR(py2[i], ref2[i], 1e-4 * std::abs(ref2[i]) + 1e-4) << "idx=" << i;
+}
+
+TEST(QuantizeTests, QMatmulInvalid)
+{
+    const Tensor a  = make_tensor(std::vector<uint8_t>{1, 2, 3, 4}, {2, 2});
+    const Tensor w  = make_tensor(std::vector<int8_t>{1, 2, 3, 4}, {2, 2});
+    const Tensor ws = make_tensor(std::vector<float>{1.0f}, {1});
+    ASSERT_ERR(quantized_matmul(a, {1.0, 0}, w, make_tensor(std::vector<float>{1.0f, 1.0f, 1.0f}, {3}), {}, DType::F32));
+    ASSERT_ERR(quantized_matmul(a, {1.0, 0}, a, ws, {}, DType::F32));
+    ASSERT_ERR(quantized_matmul(w, {1.0, 0}, w, ws, {}, DType::F32));
+    ASSERT_ERR(quantized_matmul(a, {1.0, 0}, w, ws, {}, DType::I32));
+    ASSERT_ERR(quantized_matmul(a, {1.0, 300}, w, ws, {}, DType::F32));
+    ASSERT_ERR(quantized_matmul(a, {1.0, 0}, w, ws, make_tensor(std::vector<float>{1.0f}, {1}), DType::F32));
+    const Tensor a3 = make_tensor(std::vector<uint8_t>{1, 2, 3}, {1, 3});
+    ASSERT_ERR(quantized_matmul(a3, {1.0, 0}, w, ws, {}, DType::F32));
+}
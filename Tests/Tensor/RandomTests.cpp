@@ -2,8 +2,11 @@
 
 #include "Tensor/Tensor.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <limits>
+#include <numbers>
 #include <numeric>
 
 using namespace bee;
@@ -133,3 +136,287 @@ TEST(RandomTests, Randint_U8_HighTooLarge)
     auto r = randint(0, 300, {8}, DType::U8, 1);
     EXPECT_FALSE(r.has_value());
 }
+
+// ── Philox4x32-10：CPU 与 CUDA 共用同一条流 ──────────────────────────────────
+
+namespace
+{
+
+struct PhiloxOut
+{
+    uint32_t v[4];
+};
+
+// 逐轮标量参考实现（Salmon et al., SC'11）
+auto ref_philox(uint32_t c0, uint32_t c1, uint32_t c2, uint32_t c3, uint32_t k0, uint32_t k1) -> PhiloxOut
+{
+    for (int r = 0; r < 10; ++r) {
+        const uint64_t p0 = static_cast<uint64_t>(0xD2511F53u) * c0;
+        const uint64_t p1 = static_cast<uint64_t>(0xCD9E8D57u) * c2;
+        c0                = static_cast<uint32_t>(p1 >> 32) ^ c1 ^ k0;
+        c1                = static_cast<uint32_t>(p1);
+        c2                = static_cast<uint32_t>(p0 >> 32) ^ c3 ^ k1;
+        c3                = static_cast<uint32_t>(p0);
+        k0               += 0x9E3779B9u;
+        k1               += 0xBB67AE85u;
+    }
+    return {{c0, c1, c2, c3}};
+}
+
+// seed → key，第 c 个 counter、子流 subseq（0 = rand，1 = randn，2 = randint）
+auto ref_stream(uint64_t seed, uint32_t subseq, uint32_t c) -> PhiloxOut
+{
+    return ref_philox(c, subseq, 0, 0, static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32));
+}
+
+} // namespace
+
+TEST(RandomTests, Philox_ReferenceKnownAnswers)
+{
+    // Random123 发布的 philox4x32_10 已知答案
+    const auto a = ref_philox(0, 0, 0, 0, 0, 0);
+    EXPECT_EQ(a.v[0], 0x6627E8D5u);
+    EXPECT_EQ(a.v[1], 0xE169C58Du);
+    EXPECT_EQ(a.v[2], 0xBC57AC4Cu);
+    EXPECT_EQ(a.v[3], 0x9B00DBD8u);
+
+    const auto b = ref_philox(0x243F6A88u, 0x85A308D3u, 0x13198A2Eu, 0x03707344u, 0xA4093822u, 0x299F31D0u);
+    EXPECT_EQ(b.v[0], 0xD16CFE09u);
+    EXPECT_EQ(b.v[1], 0x94FDCCEBu);
+    EXPECT_EQ(b.v[2], 0x5001E420u);
+    EXPECT_EQ(b.v[3], 0x24126EA1u);
+}
+
+TEST(RandomTests, Rand_MatchesReferencePhilox)
+{
+    constexpr uint64_t seed = 0x0123456789ABCDEFull;
+    constexpr int64_t  n    = 10007; // 跨多个批次与并行任务，且末批不满
+
+    auto f = rand({n}, DType::F32, seed);
+    ASSERT_TRUE(f.has_value());
+    const auto* pf = static_cast<const float*>(f->data_ptr());
+    for (int64_t i = 0; i < n; ++i) {
+        const auto  r = ref_stream(seed, 0, static_cast<uint32_t>(i / 4));
+        const float e = static_cast<float>(r.v[i % 4] >> 8) * (1.0f / 16777216.0f);
+        ASSERT_EQ(pf[i], e) << "index=" << i;
+    }
+
+    auto d = rand({n}, DType::F64, seed);
+    ASSERT_TRUE(d.has_value());
+    const auto* pd = static_cast<const double*>(d->data_ptr());
+    for (int64_t i = 0; i < n; ++i) {
+        const auto     r = ref_stream(seed, 0, static_cast<uint32_t>(i / 2));
+        const uint64_t x = (static_cast<uint64_t>(r.v[2 * (i % 2) + 1]) << 32) | r.v[2 * (i % 2)];
+        ASSERT_EQ(pd[i], static_cast<double>(x >> 11) * (1.0 / 9007199254740992.0)) << "index=" << i;
+    }
+}
+
+TEST(RandomTests, Randint_MatchesReferencePhilox)
+{
+    constexpr uint64_t seed = 99;
+    constexpr int64_t  n    = 5003;
+
+    auto a = randint(-7, 1000, {n}, DType::I32, seed);
+    ASSERT_TRUE(a.has_value());
+    const auto* pa = static_cast<const int32_t*>(a->data_ptr());
+    for (int64_t i = 0; i < n; ++i) {
+        const auto r = ref_stream(seed, 2, static_cast<uint32_t>(i / 4));
+        ASSERT_EQ(pa[i], static_cast<int32_t>(r.v[i % 4] % 1007u) - 7) << "index=" << i;
+    }
+
+    constexpr int64_t low   = -(int64_t{1} << 40);
+    constexpr int64_t range = int64_t{3} << 41;
+    auto              b     = randint(low, low + range, {n}, DType::I64, seed);
+    ASSERT_TRUE(b.has_value());
+    const auto* pb = static_cast<const int64_t*>(b->data_ptr());
+    for (int64_t i = 0; i < n; ++i) {
+        const auto     r = ref_stream(seed, 2, static_cast<uint32_t>(i / 2));
+        const uint64_t x = (static_cast<uint64_t>(r.v[2 * (i % 2) + 1]) << 32) | r.v[2 * (i % 2)];
+        ASSERT_EQ(pb[i], low + static_cast<int64_t>(x % static_cast<uint64_t>(range))) << "index=" << i;
+    }
+}
+
+// 元素只取决于 (seed, 下标)：不同长度（因而不同的并行切分）下公共前缀逐位相同
+TEST(RandomTests, PrefixIndependentOfLength)
+{
+    constexpr int64_t kShort = 4099;
+    constexpr int64_t kLong  = 1 << 18;
+
+    auto expect_prefix = [](const Tensor& s, const Tensor& l) {
+        ASSERT_EQ(std::memcmp(s.data_ptr(), l.data_ptr(), static_cast<size_t>(s.numel()) * dtype_size(s.dtype())), 0);
+    };
+    for (DType dt : {DType::F32, DType::F64}) {
+        expect_prefix(*rand({kShort}, dt, 5), *rand({kLong}, dt, 5));
+        expect_prefix(*randn({kShort}, dt, 5), *randn({kLong}, dt, 5));
+    }
+    for (DType dt : {DType::U8, DType::I32, DType::I64})
+        expect_prefix(*randint(3, 200, {kShort}, dt, 5), *randint(3, 200, {kLong}, dt, 5));
+}
+
+TEST(RandomTests, Randn_LargeSampleStatistics)
+{
+    constexpr int64_t n = 1 << 20;
+    for (DType dt : {DType::F32, DType::F64}) {
+        auto g = randn({n}, dt, 123);
+        ASSERT_TRUE(g.has_value());
+        auto r = cast(*g, DType::F64);
+        ASSERT_TRUE(r.has_value());
+        const auto* p      = static_cast<const double*>(r->data_ptr());
+        double      sum    = 0.0;
+        double      sum2   = 0.0;
+        int64_t     within = 0;
+        for (int64_t i = 0; i < n; ++i) {
+            sum    += p[i];
+            sum2   += p[i] * p[i];
+            within += std::abs(p[i]) < 1.0 ? 1 : 0;
+        }
+        const double mean = sum / n;
+        EXPECT_LT(std::abs(mean), 0.005);
+        EXPECT_NEAR(sum2 / n - mean * mean, 1.0, 0.01);
+        EXPECT_NEAR(static_cast<double>(within) / n, 0.682689, 0.003);
+    }
+}
+
+// F32 的 Box-Muller 用多项式 log / sincos，与 std 数学库逐元素比较
+TEST(RandomTests, Randn_F32MatchesReferenceBoxMuller)
+{
+    constexpr uint64_t seed = 31337;
+    constexpr int64_t  n    = 20000;
+
+    auto r = randn({n}, DType::F32, seed);
+    ASSERT_TRUE(r.has_value());
+    const auto* p = static_cast<const float*>(r->data_ptr());
+    for (int64_t i = 0; i < n; i += 2) {
+        const auto   v  = ref_stream(seed, 1, static_cast<uint32_t>(i / 4));
+        const double u0 = std::max(static_cast<double>(v.v[i % 4] >> 8) / 16777216.0, static_cast<double>(std::numeric_limits<float>::min()));
+        const double u1 = static_cast<double>(v.v[i % 4 + 1] >> 8) / 16777216.0;
+        const double rr = std::sqrt(-2.0 * std::log(u0));
+        ASSERT_NEAR(p[i], rr * std::cos(2.0 * std::numbers::pi * u1), 2e-6 * std::max(1.0, rr)) << "index=" << i;
+        ASSERT_NEAR(p[i + 1], rr * std::sin(2.0 * std::numbers::pi * u1), 2e-6 * std::max(1.0, rr)) << "index=" << i + 1;
+    }
+}
+
+// ── bernoulli / 融合 dropout ─────────────────────────────────────────────────
+
+TEST(RandomTests, Bernoulli_MatchesRandBelowP)
+{
+    constexpr uint64_t seed = 2024;
+    constexpr int64_t  n    = 10007;
+
+    auto u = rand({n}, DType::F32, seed);
+    ASSERT_TRUE(u.has_value());
+    const auto* pu = static_cast<const float*>(u->data_ptr());
+    for (double p : {0.0, 0.3, 0.5, 1.0}) {
+        auto b = bernoulli({n}, p, DType::Bool, seed);
+        auto f = bernoulli({n}, p, DType::F64, seed);
+        ASSERT_TRUE(b.has_value());
+        ASSERT_TRUE(f.has_value());
+        const auto* pb = static_cast<const bool*>(b->data_ptr());
+        const auto* pf = static_cast<const double*>(f->data_ptr());
+        for (int64_t i = 0; i < n; ++i) {
+            ASSERT_EQ(pb[i], pu[i] < p) << "p=" << p << " index=" << i;
+            ASSERT_EQ(pf[i], pb[i] ? 1.0 : 0.0) << "p=" << p << " index=" << i;
+        }
+    }
+}
+
+TEST(RandomTests, Bernoulli_InvalidArgs)
+{
+    EXPECT_FALSE(bernoulli({4}, -0.1).has_value());
+    EXPECT_FALSE(bernoulli({4}, 1.5).has_value());
+    EXPECT_FALSE(bernoulli({4}, std::numeric_limits<double>::quiet_NaN()).has_value());
+    EXPECT_FALSE(bernoulli({4}, 0.5, DType::I8).has_value());
+}
+
+// 融合 dropout 与 rand → 比较 → 缩放的分步实现逐位一致，掩码按位压缩
+TEST(RandomTests, Dropout_MatchesUnfusedPipeline)
+{
+    constexpr uint64_t seed = 77;
+    constexpr int64_t  n    = 10003; // 非 8 的倍数：检查掩码末字节
+    constexpr double   p    = 0.25;
+
+    auto x = randn({n}, DType::F32, 1);
+    auto u = rand({n}, DType::F32, seed);
+    auto r = dropout_with_mask(*x, p, seed);
+    ASSERT_TRUE(r.has_value());
+    ASSERT_EQ(r->mask.dtype(), DType::U8);
+    ASSERT_EQ(r->mask.numel(), (n + 7) / 8);
+
+    const auto* px    = static_cast<const float*>(x->data_ptr());
+    const auto* pu    = static_cast<const float*>(u->data_ptr());
+    const auto* po    = static_cast<const float*>(r->output.data_ptr());
+    const auto* pm    = static_cast<const uint8_t*>(r->mask.data_ptr());
+    const float scale = static_cast<float>(1.0 / (1.0 - p));
+    int64_t     kept  = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        const bool keep  = !(pu[i] < p);
+        kept            += keep ? 1 : 0;
+        ASSERT_EQ(po[i], keep ? px[i] * scale : 0.0f) << "index=" << i;
+        ASSERT_EQ(((pm[i / 8] >> (i % 8)) & 1) != 0, keep) << "index=" << i;
+    }
+    EXPECT_EQ(pm[(n - 1) / 8] >> (n % 8), 0);
+    EXPECT_NEAR(static_cast<double>(kept) / n, 1.0 - p, 0.02);
+
+    auto plain = dropout(*x, p, seed);
+    ASSERT_TRUE(plain.has_value());
+    EXPECT_EQ(std::memcmp(plain->data_ptr(), po, n * sizeof(float)), 0);
+}
+
+TEST(RandomTests, Dropout_ApplyMaskAndEdgeCases)
+{
+    constexpr uint64_t seed = 5;
+
+    // 非连续输入按逻辑行主序编号：与先物化再 dropout 相同
+    auto x  = randn({37, 29}, DType::F64, 3);
+    auto xt = x->transpose(0, 1);
+    ASSERT_TRUE(xt.has_value());
+    auto a = dropout_with_mask(*xt, 0.4, seed);
+    auto b = dropout_with_mask(*xt->contiguous(), 0.4, seed);
+    ASSERT_TRUE(a.has_value());
+    ASSERT_TRUE(b.has_value());
+    const auto n = static_cast<size_t>(xt->numel());
+    EXPECT_EQ(std::memcmp(a->output.data_ptr(), b->output.data_ptr(), n * sizeof(double)), 0);
+
+    // 掩码重放
+    auto replay = dropout_apply_mask(*xt, a->mask, 0.4);
+    ASSERT_TRUE(replay.has_value());
+    EXPECT_EQ(std::memcmp(replay->data_ptr(), a->output.data_ptr(), n * sizeof(double)), 0);
+
+    // p = 0 恒等，p = 1 全 0
+    auto keep_all = dropout(*xt, 0.0, seed);
+    auto drop_all = dropout(*xt, 1.0, seed);
+    ASSERT_TRUE(keep_all.has_value());
+    ASSERT_TRUE(drop_all.has_value());
+    EXPECT_EQ(std::memcmp(keep_all->data_ptr(), xt->contiguous()->data_ptr(), n * sizeof(double)), 0);
+    const auto* pd = static_cast<const double*>(drop_all->data_ptr());
+    EXPECT_TRUE(std::all_of(pd, pd + n, [](double v) { return v == 0.0; }));
+
+    // 被丢弃的 Inf / NaN 输出 0（选择而非乘 0），保留的照常缩放
+    auto inf = Tensor::full({1001}, DType::F32, std::numeric_limits<double>::infinity());
+    auto nan = Tensor::full({1001}, DType::F32, std::numeric_limits<double>::quiet_NaN());
+    ASSERT_TRUE(inf.has_value());
+    ASSERT_TRUE(nan.has_value());
+    auto di = dropout_with_mask(*inf, 0.5, seed);
+    ASSERT_TRUE(di.has_value());
+    auto dn = dropout_apply_mask(*nan, di->mask, 0.5);
+    ASSERT_TRUE(dn.has_value());
+    const auto* pi = static_cast<const float*>(di->output.data_ptr());
+    const auto* pn = static_cast<const float*>(dn->data_ptr());
+    const auto* pm = static_cast<const uint8_t*>(di->mask.data_ptr());
+    for (int64_t i = 0; i < 1001; ++i) {
+        const bool keep = ((pm[i / 8] >> (i % 8)) & 1) != 0;
+        EXPECT_EQ(pi[i], keep ? std::numeric_limits<float>::infinity() : 0.0f) << "index=" << i;
+        EXPECT_EQ(std::isnan(pn[i]), keep) << "index=" << i;
+        if (!keep) {
+            EXPECT_EQ(pn[i], 0.0f) << "index=" << i;
+        }
+    }
+    auto drop_inf = dropout(*inf, 1.0, seed);
+    ASSERT_TRUE(drop_inf.has_value());
+    const auto* pdi = static_cast<const float*>(drop_inf->data_ptr());
+    EXPECT_TRUE(std::all_of(pdi, pdi + 1001, [](float v) { return v == 0.0f; }));
+
+    EXPECT_FALSE(dropout(*xt, 1.2, seed).has_value());
+    EXPECT_FALSE(dropout(*randint(0, 5, {8}, DType::I32, 1), 0.5, seed).has_value());
+    EXPECT_FALSE(dropout_apply_mask(*xt, *Tensor::empty(Shape{3}, DType::U8), 0.4).has_value());
+}
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include "Tensor/Tensor.hpp"
+#include "TensorTestUtil.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace bee;
+using namespace bee::test;
+
+#define ASSERT_OK(expr)  ASSERT_TRUE((expr).has_value())
+#define ASSERT_ERR(expr) ASSERT_FALSE((expr).has_value())
+
+TEST(ScanTests, CumsumRowsF32)
+{
+    auto a = make_tensor<float>({2, 4}, DType::F32, {1, 2, 3, 4, 5, 6, 7, 8});
+    auto r = cumsum(a, 1);
+    ASSERT_OK(r);
+    EXPECT_EQ(r->shape(), a.shape());
+    EXPECT_EQ(values_of<float>(*r), (std::vector<float>{1, 3, 6, 10, 5, 11, 18, 26}));
+}
+
+TEST(ScanTests, CumsumInnerAxisI32)
+{
+    // dim=0 且 inner=3：沿列 SIMD 推进
+    auto a = make_tensor<int32_t>({3, 3}, DType::I32, {1, 2, 3, 4, 5, 6, 7, 8, 9});
+    auto r = cumsum(a, 0);
+    ASSERT_OK(r);
+    EXPECT_EQ(values_of<int32_t>(*r), (std::vector<int32_t>{1, 2, 3, 5, 7, 9, 12, 15, 18}));
+}
+
+TEST(ScanTests, CumprodNegativeDimF64)
+{
+    auto a = make_tensor<double>({2, 3}, DType::F64, {1, 2, 3, 2, 0.5, 4});
+    auto r = cumprod(a, -1);
+    ASSERT_OK(r);
+    EXPECT_EQ(values_of<double>(*r), (std::vector<double>{1, 2, 6, 2, 1, 4}));
+}
+
+TEST(ScanTests, CummaxCumminU8AndI64)
+{
+    auto u = make_tensor<uint8_t>({6}, DType::U8, {3, 1, 4, 1, 5, 9});
+    auto mx = cummax(u, 0);
+    ASSERT_OK(mx);
+    EXPECT_EQ(values_of<uint8_t>(*mx), (std::vector<uint8_t>{3, 3, 4, 4, 5, 9}));
+
+    auto l  = make_tensor<int64_t>({6}, DType::I64, {3, 1, 4, -1, 5, -9});
+    auto mn = cummin(l, 0);
+    ASSERT_OK(mn);
+    EXPECT_EQ(values_of<int64_t>(*mn), (std::vector<int64_t>{3, 1, 1, -1, -1, -9}));
+}
+
+TEST(ScanTests, NonContiguousInput)
+{
+    auto a = make_tensor<int64_t>({2, 3}, DType::I64, {1, 2, 3, 4, 5, 6});
+    auto t = a.transpose(0, 1); // [[1,4],[2,5],[3,6]]
+    ASSERT_OK(t);
+    auto r = cumsum(*t, 0);
+    ASSERT_OK(r);
+    EXPECT_EQ(r->shape(), (Shape{3, 2}));
+    EXPECT_EQ(values_of<int64_t>(*r), (std::vector<int64_t>{1, 4, 3, 9, 6, 15}));
+}
+
+TEST(ScanTests, LongAxisParallelMatchesSerial)
+{
+    // 单行超过长轴阈值：三阶段并行扫描，整型结果必须逐元素精确
+    const int64_t        n = 3 * 1024 * 1024 + 5;
+    std::vector<int64_t> v(static_cast<std::size_t>(n));
+    for (int64_t i = 0; i < n; ++i)
+        v[static_cast<std::size_t>(i)] = (i * 7919) % 13 - 6;
+    auto a = make_tensor<int64_t>({n}, DType::I64, v);
+
+    auto s = cumsum(a, 0);
+    ASSERT_OK(s);
+    auto mx = cummax(a, 0);
+    ASSERT_OK(mx);
+    const auto* ps  = static_cast<const int64_t*>(s->data_ptr());
+    const auto* pmx = static_cast<const int64_t*>(mx->data_ptr());
+
+    int64_t acc = 0, best = v[0];
+    for (int64_t i = 0; i < n; ++i) {
+        acc  += v[static_cast<std::size_t>(i)];
+        best  = std::max(best, v[static_cast<std::size_t>(i)]);
+        ASSERT_EQ(ps[i], acc) << i;
+        ASSERT_EQ(pmx[i], best) << i;
+    }
+}
+
+TEST(ScanTests, ManyShortRowsF32)
+{
+    const int64_t      R = 5000, K = 9;
+    std::vector<float> v(static_cast<std::size_t>(R * K));
+    for (std::size_t i = 0; i < v.size(); ++i)
+        v[i] = static_cast<float>(i % 5);
+    auto a = make_tensor<float>({R, K}, DType::F32, v);
+    auto r = cumsum(a, 1);
+    ASSERT_OK(r);
+    const auto* p = static_cast<const float*>(r->data_ptr());
+    for (int64_t row = 0; row < R; ++row) {
+        float acc = 0.0f;
+        for (int64_t k = 0; k < K; ++k) {
+            acc += v[static_cast<std::size_t>(row * K + k)];
+            ASSERT_FLOAT_EQ(p[row * K + k], acc);
+        }
+    }
+}
+
+TEST(ScanTests, SignedOverflowWraps)
+{
+    // 整型溢出按补码回绕：覆盖行内串行、inner > 1 列推进与 cumprod
+    constexpr int32_t i32_max = std::numeric_limits<int32_t>::max();
+    constexpr int32_t i32_min = std::numeric_limits<int32_t>::min();
+    auto              a       = make_tensor<int32_t>({3}, DType::I32, {i32_max, 1, 1});
+    auto              r       = cumsum(a, 0);
+    ASSERT_OK(r);
+    EXPECT_EQ(values_of<int32_t>(*r), (std::vector<int32_t>{i32_max, i32_min, i32_min + 1}));
+
+    auto c  = make_tensor<int32_t>({2, 1}, DType::I32, {i32_min, -1});
+    auto rc = cumsum(c, 0);
+    ASSERT_OK(rc);
+    EXPECT_EQ(values_of<int32_t>(*rc), (std::vector<int32_t>{i32_min, i32_max}));
+
+    constexpr int64_t i64_max = std::numeric_limits<int64_t>::max();
+    auto              l       = make_tensor<int64_t>({2, 2}, DType::I64, {i64_max, 2, 1, 2});
+    auto              rl      = cumsum(l, 0);
+    ASSERT_OK(rl);
+    EXPECT_EQ(values_of<int64_t>(*rl), (std::vector<int64_t>{i64_max, 2, std::numeric_limits<int64_t>::min(), 4}));
+
+    auto p  = make_tensor<int64_t>({3}, DType::I64, {int64_t{1} << 62, 2, 2});
+    auto rp = cumprod(p, 0);
+    ASSERT_OK(rp);
+    EXPECT_EQ(values_of<int64_t>(*rp), (std::vector<int64_t>{int64_t{1} << 62, std::numeric_limits<int64_t>::min(), 0}));
+}
+
+TEST(ScanTests, RejectsInvalidInput)
+{
+    auto b = Tensor::zeros({4}, DType::Bool);
+    ASSERT_OK(b);
+    ASSERT_ERR(cumsum(*b, 0));
+
+    auto u = Tensor::zeros({4}, DType::U8);
+    ASSERT_OK(u);
+    ASSERT_ERR(cumprod(*u, 0));
+
+    auto f = Tensor::zeros({4}, DType::F32);
+    ASSERT_OK(f);
+    ASSERT_ERR(cumsum(*f, 1));
+    ASSERT_ERR(cummax(Tensor{}, 0));
+
+    auto s = Tensor::zeros({}, DType::F32);
+    ASSERT_OK(s);
+    ASSERT_ERR(cumsum(*s, 0));
+}
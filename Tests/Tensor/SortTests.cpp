@@ -0,0 +1,208 @@
+#include <gtest/gtest.h>
+
+#include "Tensor/Tensor.hpp"
+#include "TensorTestUtil.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+using namespace bee;
+using namespace bee::test;
+
+#define ASSERT_OK(expr)  ASSERT_TRUE((expr).has_value())
+#define ASSERT_ERR(expr) ASSERT_FALSE((expr).has_value())
+
+namespace
+{
+
+// 确定性伪随机值，取值范围较小以制造大量相等元素（检验稳定性）
+template <typename T>
+auto rand_values(int64_t n, int64_t range, uint64_t seed) -> std::vector<T>
+{
+    std::vector<T> v(static_cast<std::size_t>(n));
+    uint64_t       s = seed * 6364136223846793005ull + 1442695040888963407ull;
+    for (auto& x : v) {
+        s = s * 6364136223846793005ull + 1442695040888963407ull;
+        x = static_cast<T>(static_cast<int64_t>((s >> 33) % static_cast<uint64_t>(range)) - (std::is_unsigned_v<T> ? 0 : range / 2));
+    }
+    return v;
+}
+
+// 参考实现：沿 {O, N, I} 的每一行做 std::stable_sort（NaN 视为最大）
+template <typename T>
+void reference_sort(const std::vector<T>& v, int64_t O, int64_t N, int64_t I, bool desc, std::vector<T>& vals, std::vector<int64_t>& idx)
+{
+    auto less = [](T a, T b) {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (std::isnan(a))
+                return false;
+            if (std::isnan(b))
+                return true;
+        }
+        return a < b;
+    };
+    vals.assign(v.size(), T{});
+    idx.assign(v.size(), 0);
+    std::vector<int64_t> order(static_cast<std::size_t>(N));
+    for (int64_t o = 0; o < O; ++o) {
+        for (int64_t i = 0; i < I; ++i) {
+            const int64_t base = o * N * I + i;
+            std::iota(order.begin(), order.end(), int64_t{0});
+            std::stable_sort(order.begin(), order.end(), [&](int64_t a, int64_t b) {
+                const T x = v[base + a * I];
+                const T y = v[base + b * I];
+                return desc ? less(y, x) : less(x, y);
+            });
+            for (int64_t j = 0; j < N; ++j) {
+                idx[base + j * I]  = order[j];
+                vals[base + j * I] = v[base + order[j] * I];
+            }
+        }
+    }
+}
+
+template <typename T>
+void check_sort(const Shape& shape, DType dt, int dim, bool desc, const std::vector<T>& v)
+{
+    const auto d = static_cast<std::size_t>(dim < 0 ? dim + static_cast<int>(shape.size()) : dim);
+    int64_t    O = 1;
+    int64_t    I = 1;
+    for (std::size_t k = 0; k < d; ++k)
+        O *= shape[k];
+    for (std::size_t k = d + 1; k < shape.size(); ++k)
+        I *= shape[k];
+    std::vector<T>       ref_v;
+    std::vector<int64_t> ref_i;
+    reference_sort(v, O, shape[d], I, desc, ref_v, ref_i);
+
+    auto a = make_tensor<T>(shape, dt, v);
+    auto r = sort(a, dim, desc);
+    ASSERT_OK(r);
+    EXPECT_EQ(r->values.shape(), shape);
+    EXPECT_EQ(r->indices.dtype(), DType::I64);
+    EXPECT_TRUE(r->values.is_contiguous());
+    EXPECT_TRUE(r->indices.is_contiguous());
+    EXPECT_EQ(values_of<int64_t>(r->indices), ref_i);
+    const auto got = values_of<T>(r->values);
+    for (std::size_t k = 0; k < got.size(); ++k) {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (std::isnan(ref_v[k])) {
+                EXPECT_TRUE(std::isnan(got[k])) << "k=" << k;
+                continue;
+            }
+        }
+        ASSERT_EQ(got[k], ref_v[k]) << "k=" << k;
+    }
+
+    auto ai = argsort(a, dim, desc);
+    ASSERT_OK(ai);
+    EXPECT_EQ(values_of<int64_t>(*ai), ref_i);
+}
+
+} // namespace
+
+// ── 短行（排序网络）─────────────────────────────────────────────────────────
+
+TEST(SortTests, ShortRowsAllLengths)
+{
+    // 行数 37 不是任何向量宽度的倍数，覆盖残余行；N = 2..16 覆盖全部网络规模及填充
+    for (int64_t n = 1; n <= 16; ++n) {
+        for (bool desc : {false, true}) {
+            check_sort<float>({37, n}, DType::F32, -1, desc, rand_values<float>(37 * n, 9, static_cast<uint64_t>(n)));
+            check_sort<int32_t>({37, n}, DType::I32, 1, desc, rand_values<int32_t>(37 * n, 7, static_cast<uint64_t>(n + 100)));
+        }
+    }
+}
+
+TEST(SortTests, ShortRowsStridedAxis)
+{
+    check_sort<float>({5, 12, 7}, DType::F32, 1, false, rand_values<float>(5 * 12 * 7, 11, 3));
+    check_sort<uint8_t>({9, 33}, DType::U8, 0, true, rand_values<uint8_t>(9 * 33, 200, 4));
+}
+
+TEST(SortTests, FloatSpecialValues)
+{
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+    auto        a   = make_tensor<float>({6}, DType::F32, {1.0f, nan, -inf, -0.0f, 0.0f, inf});
+    auto        r   = sort(a);
+    ASSERT_OK(r);
+    EXPECT_EQ(values_of<int64_t>(r->indices), (std::vector<int64_t>{2, 3, 4, 0, 5, 1})); // -0.0 与 0.0 相等，保持原序
+    auto d = argsort(a, 0, true);
+    ASSERT_OK(d);
+    EXPECT_EQ(values_of<int64_t>(*d), (std::vector<int64_t>{1, 5, 0, 3, 4, 2}));
+
+    // 长行（基数排序路径）的特殊值顺序与短行一致
+    std::vector<double> v = rand_values<double>(3000, 50, 8);
+    v[17]                 = std::numeric_limits<double>::quiet_NaN();
+    v[2500]               = -std::numeric_limits<double>::infinity();
+    v[40]                 = -0.0;
+    check_sort<double>({3000}, DType::F64, 0, false, v);
+    check_sort<double>({3000}, DType::F64, 0, true, v);
+}
+
+// ── 中等行（行内 std::sort / 串行基数排序）────────────────────────────────────
+
+TEST(SortTests, MediumRowsAllDTypes)
+{
+    for (bool desc : {false, true}) {
+        check_sort<float>({13, 200}, DType::F32, 1, desc, rand_values<float>(13 * 200, 1000, 1));
+        check_sort<double>({7, 150}, DType::F64, -1, desc, rand_values<double>(7 * 150, 40, 2));
+        check_sort<int64_t>({11, 1000}, DType::I64, 1, desc, rand_values<int64_t>(11 * 1000, 1 << 20, 3));
+        check_sort<int32_t>({4, 5000}, DType::I32, 1, desc, rand_values<int32_t>(4 * 5000, 300, 4));
+        check_sort<uint8_t>({6, 700}, DType::U8, 1, desc, rand_values<uint8_t>(6 * 700, 256, 5));
+    }
+}
+
+// ── 长轴（行内并行基数排序）──────────────────────────────────────────────────
+
+TEST(SortTests, LongAxisParallelRadix)
+{
+    const int64_t n = 200'003;
+    for (bool desc : {false, true}) {
+        check_sort<float>({n}, DType::F32, 0, desc, rand_values<float>(n, 5000, 11));
+        check_sort<int64_t>({n}, DType::I64, 0, desc, rand_values<int64_t>(n, int64_t{1} << 40, 12));
+    }
+    // 两行长轴且轴非最内维
+    check_sort<int32_t>({100'000, 2}, DType::I32, 0, false, rand_values<int32_t>(200'000, 1 << 30, 13));
+}
+
+// ── 边界与参数校验 ───────────────────────────────────────────────────────────
+
+TEST(SortTests, EdgeShapes)
+{
+    auto s = Tensor::full({}, DType::F32, 3.0);
+    ASSERT_OK(s);
+    auto r = sort(*s);
+    ASSERT_OK(r);
+    EXPECT_EQ(r->values.shape(), Shape{});
+    EXPECT_EQ(values_of<float>(r->values), (std::vector<float>{3.0f}));
+    EXPECT_EQ(values_of<int64_t>(r->indices), (std::vector<int64_t>{0}));
+
+    auto e = Tensor::empty({3, 0}, DType::I32);
+    ASSERT_OK(e);
+    auto re = sort(*e, 1);
+    ASSERT_OK(re);
+    EXPECT_EQ(re->indices.shape(), (Shape{3, 0}));
+
+    check_sort<float>({4, 1, 3}, DType::F32, 1, false, rand_values<float>(12, 5, 6));
+}
+
+TEST(SortTests, InvalidArguments)
+{
+    auto a = Tensor::zeros({2, 3}, DType::F32);
+    ASSERT_OK(a);
+    ASSERT_ERR(sort(*a, 2));
+    ASSERT_ERR(sort(*a, -3));
+    ASSERT_ERR(argsort(Tensor()));
+    auto b = Tensor::zeros({4}, DType::Bool);
+    ASSERT_OK(b);
+    ASSERT_ERR(sort(*b));
+    auto s = Tensor::full({}, DType::F32, 1.0);
+    ASSERT_OK(s);
+    ASSERT_ERR(sort(*s, 1));
+}
@@ -0,0 +1,242 @@
+#include <gtest/gtest.h>
+
+#include "Tensor/Tensor.hpp"
+#include "TensorTestUtil.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace bee;
+using namespace bee::test;
+
+#define ASSERT_OK(expr)  ASSERT_TRUE((expr).has_value())
+#define ASSERT_ERR(expr) ASSERT_FALSE((expr).has_value())
+
+namespace
+{
+
+// 确定性稀疏矩阵：第 r 行的非零个数由 row_nnz(r) 给出，列位置与取值由 LCG 决定（可能重复，稠密写入时覆盖）
+template <typename T, typename RowNnz>
+auto make_sparse_dense(int64_t rows, int64_t cols, DType dt, RowNnz row_nnz, uint64_t seed) -> Tensor
+{
+    std::vector<T> v(static_cast<std::size_t>(rows * cols), T(0));
+    uint64_t       s = seed * 6364136223846793005ull + 1442695040888963407ull;
+    for (int64_t r = 0; r < rows; ++r) {
+        const int64_t k = row_nnz(r);
+        for (int64_t i = 0; i < k; ++i) {
+            s               = s * 6364136223846793005ull + 1442695040888963407ull;
+            const auto c    = static_cast<int64_t>((s >> 33) % static_cast<uint64_t>(cols));
+            v[r * cols + c] = static_cast<T>(static_cast<int64_t>((s >> 20) % 17) - 8) / T(4) + T(0.125);
+        }
+    }
+    return make_tensor<T>({rows, cols}, dt, v);
+}
+
+template <typename T>
+auto dense_random(const Shape& shape, DType dt, uint64_t seed) -> Tensor
+{
+    std::vector<T> v(static_cast<std::size_t>(numel(shape)));
+    uint64_t       s = seed;
+    for (auto& x : v) {
+        s = s * 6364136223846793005ull + 1442695040888963407ull;
+        x = static_cast<T>(static_cast<int64_t>((s >> 33) % 2001) - 1000) / T(500);
+    }
+    return make_tensor<T>(shape, dt, v);
+}
+
+template <typename T>
+void expect_near_all(const Tensor& got, const Tensor& ref, double tol)
+{
+    ASSERT_EQ(got.shape(), ref.shape());
+    const auto g = values_of<T>(got);
+    const auto e = values_of<T>(ref);
+    for (std::size_t i = 0; i < g.size(); ++i)
+        ASSERT_NEAR(g[i], e[i], tol * (1.0 + std::abs(e[i]))) << "i=" << i;
+}
+
+} // namespace
+
+// ── 构造与稠密化 ─────────────────────────────────────────────────────────────
+
+TEST(SparseTests, FromDenseBuildsSortedCsr)
+{
+    auto d = make_tensor<float>({3, 4}, DType::F32, {0, 2, 0, 1, 0, 0, 0, 0, 5, 0, -3, 0});
+    auto a = to_sparse_csr(d);
+    ASSERT_OK(a);
+    EXPECT_EQ(a->rows(), 3);
+    EXPECT_EQ(a->cols(), 4);
+    EXPECT_EQ(a->nnz(), 4);
+    EXPECT_EQ(a->dtype(), DType::F32);
+    EXPECT_EQ(values_of<int64_t>(a->crow_indices()), (std::vector<int64_t>{0, 2, 2, 4}));
+    EXPECT_EQ(values_of<int32_t>(a->col_indices()), (std::vector<int32_t>{1, 3, 0, 2}));
+    EXPECT_EQ(values_of<float>(a->values()), (std::vector<float>{2, 1, 5, -3}));
+
+    auto back = to_dense(*a);
+    ASSERT_OK(back);
+    EXPECT_EQ(values_of<float>(*back), values_of<float>(d));
+}
+
+TEST(SparseTests, FromDenseStridedInputF64)
+{
+    auto d = make_sparse_dense<double>(37, 53, DType::F64, [](int64_t r) { return r % 5; }, 3);
+    auto t = d.transpose(0, 1);
+    ASSERT_OK(t);
+    auto a = to_sparse_csr(*t);
+    ASSERT_OK(a);
+    EXPECT_EQ(a->rows(), 53);
+    auto back = to_dense(*a);
+    ASSERT_OK(back);
+    EXPECT_EQ(values_of<double>(*back), values_of<double>(*t));
+}
+
+TEST(SparseTests, TripletsSortAndSumDuplicates)
+{
+    auto ri = make_tensor<int32_t>({6}, DType::I32, {2, 0, 2, 0, 2, 1});
+    auto ci = make_tensor<int32_t>({6}, DType::I32, {3, 1, 0, 1, 3, 2});
+    auto v  = make_tensor<float>({6}, DType::F32, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+    auto a  = sparse_csr_from_triplets(4, 4, ri, ci, v);
+    ASSERT_OK(a);
+    EXPECT_EQ(values_of<int64_t>(a->crow_indices()), (std::vector<int64_t>{0, 1, 2, 4, 4}));
+    EXPECT_EQ(values_of<int32_t>(a->col_indices()), (std::vector<int32_t>{1, 2, 0, 3}));
+    EXPECT_EQ(values_of<float>(a->values()), (std::vector<float>{6.0f, 6.0f, 3.0f, 6.0f}));
+
+    auto back = to_dense(*a);
+    ASSERT_OK(back);
+    EXPECT_EQ(values_of<float>(*back), (std::vector<float>{0, 6, 0, 0, 0, 0, 6, 0, 3, 0, 0, 6, 0, 0, 0, 0}));
+}
+
+TEST(SparseTests, EmptyMatrices)
+{
+    auto ri = make_tensor<int64_t>({0}, DType::I64, {});
+    auto v  = make_tensor<double>({0}, DType::F64, {});
+    auto a  = sparse_csr_from_triplets(3, 5, ri, ri, v);
+    ASSERT_OK(a);
+    EXPECT_EQ(a->nnz(), 0);
+    EXPECT_EQ(values_of<int64_t>(a->crow_indices()), (std::vector<int64_t>{0, 0, 0, 0}));
+
+    auto x = Tensor::full({5}, DType::F64, 1.0);
+    ASSERT_OK(x);
+    auto y = spmv(*a, *x);
+    ASSERT_OK(y);
+    EXPECT_EQ(values_of<double>(*y), (std::vector<double>{0, 0, 0}));
+
+    auto z = Tensor::zeros({0, 4}, DType::F32);
+    ASSERT_OK(z);
+    auto e = to_sparse_csr(*z);
+    ASSERT_OK(e);
+    EXPECT_EQ(e->rows(), 0);
+    auto b = Tensor::full({4, 3}, DType::F32, 1.0);
+    ASSERT_OK(b);
+    auto c = spmm(*e, *b);
+    ASSERT_OK(c);
+    EXPECT_EQ(c->shape(), (Shape{0, 3}));
+}
+
+// ── 稀疏 × 稠密 ──────────────────────────────────────────────────────────────
+
+TEST(SparseTests, SpmvMatchesDenseWithSkewedRows)
+{
+    // 前几行极长、其余行短或为空：验证按 nnz 切分后每行仍恰好处理一次
+    auto row_nnz = [](int64_t r) -> int64_t { return r < 3 ? 3000 : (r % 7 == 0 ? 0 : r % 13); };
+    auto d       = make_sparse_dense<float>(700, 4096, DType::F32, row_nnz, 11);
+    auto a       = to_sparse_csr(d);
+    ASSERT_OK(a);
+    auto x = dense_random<float>({4096}, DType::F32, 5);
+    auto y = spmv(*a, x);
+    ASSERT_OK(y);
+
+    auto xm = x.view({4096, 1});
+    ASSERT_OK(xm);
+    auto ref = matmul(d, *xm);
+    ASSERT_OK(ref);
+    auto rv = ref->view({700});
+    ASSERT_OK(rv);
+    expect_near_all<float>(*y, *rv, 1e-4);
+}
+
+TEST(SparseTests, SpmvF64AllRowLengths)
+{
+    // 行长 0..40 覆盖 gather 的整块与各种掩码尾部
+    auto d = make_sparse_dense<double>(41, 97, DType::F64, [](int64_t r) { return r; }, 2);
+    auto a = to_sparse_csr(d);
+    ASSERT_OK(a);
+    auto x = dense_random<double>({97}, DType::F64, 9);
+    auto y = spmv(*a, x);
+    ASSERT_OK(y);
+    auto xm = x.view({97, 1});
+    ASSERT_OK(xm);
+    auto ref = matmul(d, *xm);
+    ASSERT_OK(ref);
+    auto rv = ref->view({41});
+    ASSERT_OK(rv);
+    expect_near_all<double>(*y, *rv, 1e-12);
+}
+
+TEST(SparseTests, SpmmMatchesDenseAcrossColumnTails)
+{
+    auto d = make_sparse_dense<float>(129, 211, DType::F32, [](int64_t r) { return r % 9 == 0 ? 40 : r % 4; }, 7);
+    auto a = to_sparse_csr(d);
+    ASSERT_OK(a);
+    for (int64_t n : {1, 3, 8, 17, 64, 77}) {
+        auto b = dense_random<float>({211, n}, DType::F32, static_cast<uint64_t>(n));
+        auto c = spmm(*a, b);
+        ASSERT_OK(c);
+        auto ref = matmul(d, b);
+        ASSERT_OK(ref);
+        expect_near_all<float>(*c, *ref, 1e-4);
+    }
+}
+
+TEST(SparseTests, SpmmF64StridedOperand)
+{
+    auto d = make_sparse_dense<double>(50, 60, DType::F64, [](int64_t r) { return (r * 7) % 11; }, 4);
+    auto a = to_sparse_csr(d);
+    ASSERT_OK(a);
+    auto bt = dense_random<double>({19, 60}, DType::F64, 8);
+    auto b  = bt.transpose(0, 1);
+    ASSERT_OK(b);
+    auto c = spmm(*a, *b);
+    ASSERT_OK(c);
+    auto ref = matmul(d, *b);
+    ASSERT_OK(ref);
+    expect_near_all<double>(*c, *ref, 1e-12);
+}
+
+// ── 参数校验 ─────────────────────────────────────────────────────────────────
+
+TEST(SparseTests, InvalidArguments)
+{
+    auto i32 = Tensor::zeros({2, 2}, DType::I32);
+    ASSERT_OK(i32);
+    ASSERT_ERR(to_sparse_csr(*i32));
+    auto v3 = Tensor::zeros({2, 2, 2}, DType::F32);
+    ASSERT_OK(v3);
+    ASSERT_ERR(to_sparse_csr(*v3));
+    ASSERT_ERR(to_sparse_csr(Tensor()));
+
+    auto ri = make_tensor<int64_t>({2}, DType::I64, {0, 3});
+    auto ci = make_tensor<int64_t>({2}, DType::I64, {0, 1});
+    auto v  = make_tensor<float>({2}, DType::F32, {1.0f, 2.0f});
+    ASSERT_ERR(sparse_csr_from_triplets(3, 2, ri, ci, v)); // 行越界
+    ASSERT_ERR(sparse_csr_from_triplets(4, 1, ri, ci, v)); // 列越界
+    ASSERT_ERR(sparse_csr_from_triplets(-1, 2, ci, ci, v));
+    auto v1 = make_tensor<float>({1}, DType::F32, {1.0f});
+    ASSERT_ERR(sparse_csr_from_triplets(4, 2, ri, ci, v1)); // 长度不一致
+    auto fi = make_tensor<float>({2}, DType::F32, {0.0f, 1.0f});
+    ASSERT_ERR(sparse_csr_from_triplets(4, 2, fi, ci, v)); // 索引须为整数
+
+    auto a = sparse_csr_from_triplets(4, 2, ri, ci, v);
+    ASSERT_OK(a);
+    auto x_bad_len = Tensor::zeros({3}, DType::F32);
+    ASSERT_OK(x_bad_len);
+    ASSERT_ERR(spmv(*a, *x_bad_len));
+    auto x_bad_dt = Tensor::zeros({2}, DType::F64);
+    ASSERT_OK(x_bad_dt);
+    ASSERT_ERR(spmv(*a, *x_bad_dt));
+    auto b_bad = Tensor::zeros({3, 4}, DType::F32);
+    ASSERT_OK(b_bad);
+    ASSERT_ERR(spmm(*a, *b_bad));
+    ASSERT_ERR(spmv(SparseCsr(), *x_bad_len));
+    ASSERT_ERR(to_dense(SparseCsr()));
+}
@@ -3,6 +3,9 @@
 #include "Base/Memory/Allocator.hpp"
 #include "Tensor/Core/Storage.hpp"
 
+#include <cstring>
+#include <utility>
+
 using namespace bee;
 
 // ── 基本分配测试 ─────────────────────────────────────────────────────────────
@@ -52,6 +55,52 @@ TEST(StorageTests, SharedOwnership)
     EXPECT_NE(sp1->data(), nullptr); // 内存仍有效
 }
 
+// ── 写时复制 ─────────────────────────────────────────────────────────────────
+
+TEST(StorageTests, ShareCopiesOnFirstWrite)
+{
+    auto result = Storage::allocate(64, CpuAllocator::instance());
+    ASSERT_TRUE(result.has_value());
+    auto src = std::move(*result);
+    std::memset(src->data(), 0x11, 64);
+
+    auto cow = src->share();
+    EXPECT_NE(src.get(), cow.get());
+    EXPECT_TRUE(src->is_shared());
+    EXPECT_TRUE(cow->is_shared());
+    // 只读访问零拷贝
+    EXPECT_EQ(std::as_const(*src).data(), std::as_const(*cow).data());
+
+    // 写入方复制出私有副本，另一方保留原内存与内容
+    const void* before = std::as_const(*src).data();
+    auto*       p      = static_cast<unsigned char*>(cow->data());
+    EXPECT_NE(p, before);
+    EXPECT_FALSE(src->is_shared());
+    EXPECT_FALSE(cow->is_shared());
+    p[0] = 0x22;
+    EXPECT_EQ(static_cast<const unsigned char*>(std::as_const(*src).data())[0], 0x11);
+    EXPECT_EQ(p[1], 0x11);
+    EXPECT_EQ(std::as_const(*src).data(), before);
+
+    // 独占后 materialize 为空操作
+    ASSERT_TRUE(cow->materialize().has_value());
+    EXPECT_EQ(cow->data(), p);
+}
+
+TEST(StorageTests, SharedBlockOutlivesSource)
+{
+    auto result = Storage::allocate(32, CpuAllocator::instance());
+    ASSERT_TRUE(result.has_value());
+    auto src = std::move(*result);
+    std::memset(src->data(), 0x5a, 32);
+
+    auto cow = src->share();
+    src.reset();
+    // 来源释放后内存块仍由 cow 持有，且不再处于共享状态
+    EXPECT_FALSE(cow->is_shared());
+    EXPECT_EQ(static_cast<const unsigned char*>(std::as_const(*cow).data())[31], 0x5a);
+}
+
 // ── 大分配失败测试 ───────────────────────────────────────────────────────────
 
 TEST(StorageTests, HugeAllocationFails)
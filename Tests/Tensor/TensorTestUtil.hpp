@@ -0,0 +1,65 @@
+/**
+ * @File TensorTestUtil.hpp
+ * @Author dfnzhc (https://github.com/dfnzhc)
+ * @Brief Tensor 测试共享工具：由 std::vector 构造张量、把张量读回 std::vector、确定性伪随机序列。
+ */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Tensor/Tensor.hpp"
+
+namespace bee::test
+{
+
+// 按 dtype 构造张量并逐元素写入 static_cast<T>(vals[i])；vals 可为其他类型（如 double 参考序列）
+template <typename T, typename V = T>
+auto make_tensor(const Shape& shape, DType dt, const std::vector<V>& vals) -> Tensor
+{
+    auto t = Tensor::empty(shape, dt);
+    EXPECT_TRUE(t.has_value());
+    EXPECT_EQ(static_cast<std::size_t>(t->numel()), vals.size());
+    auto* p = static_cast<T*>(t->data_ptr());
+    for (std::size_t i = 0; i < vals.size(); ++i)
+        p[i] = static_cast<T>(vals[i]);
+    return *t;
+}
+
+// 同上，dtype 由元素类型推出
+template <typename T>
+auto make_tensor(const std::vector<T>& vals, const Shape& shape) -> Tensor
+{
+    return make_tensor<T>(shape, dtype_v<T>, vals);
+}
+
+// 按元素类型 T 读出全部元素（非连续张量先连续化），并转换为 R
+template <typename T, typename R = T>
+auto values_of(const Tensor& t) -> std::vector<R>
+{
+    auto c = t.contiguous();
+    EXPECT_TRUE(c.has_value());
+    const auto*    p = static_cast<const T*>(c->const_data_ptr());
+    std::vector<R> v(static_cast<std::size_t>(c->numel()));
+    for (std::size_t i = 0; i < v.size(); ++i)
+        v[i] = static_cast<R>(p[i]);
+    return v;
+}
+
+// 确定性伪随机序列（LCG），取值 center + [-amp, amp)
+inline auto lcg_seq(std::size_t n, std::uint32_t seed, double amp = 1.0, double center = 0.0) -> std::vector<double>
+{
+    std::vector<double> v(n);
+    std::uint32_t       s = seed;
+    for (auto& x : v) {
+        s = s * 1664525u + 1013904223u;
+        x = center + amp * (static_cast<double>(s >> 8) / static_cast<double>(1u << 23) - 1.0);
+    }
+    return v;
+}
+
+} // namespace bee::test
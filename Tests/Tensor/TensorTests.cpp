@@ -2,6 +2,8 @@
 
 #include "Tensor/Tensor.hpp"
 
+#include <cmath>
+
 using namespace bee;
 
 // ── 默认构造 ─────────────────────────────────────────────────────────────────
@@ -109,6 +111,96 @@ TEST(TensorTests, CloneUndefinedReturnsError)
     EXPECT_FALSE(result.has_value());
 }
 
+// ── clone 写时复制 ───────────────────────────────────────────────────────────
+
+TEST(TensorTests, CloneSharesUntilFirstWrite)
+{
+    auto a = Tensor::arange(0, 8, 1, DType::F32);
+    ASSERT_TRUE(a.has_value());
+    auto c = a->clone();
+    ASSERT_TRUE(c.has_value());
+
+    // 只读访问不触发拷贝
+    EXPECT_EQ(a->const_data_ptr(), c->const_data_ptr());
+    EXPECT_TRUE(c->storage()->is_shared());
+
+    // 经非 const data_ptr() 写 clone：clone 物化，来源不变
+    auto* pc = static_cast<float*>(c->data_ptr());
+    EXPECT_NE(static_cast<const void*>(pc), a->const_data_ptr());
+    pc[0] = 100.0f;
+    EXPECT_EQ(static_cast<const float*>(a->const_data_ptr())[0], 0.0f);
+    EXPECT_EQ(pc[7], 7.0f);
+    EXPECT_FALSE(a->storage()->is_shared());
+}
+
+TEST(TensorTests, CloneSourceWriteDoesNotLeak)
+{
+    auto a = Tensor::arange(0, 6, 1, DType::I32);
+    ASSERT_TRUE(a.has_value());
+    auto c = a->clone();
+    ASSERT_TRUE(c.has_value());
+
+    // 来源的视图与来源共用 Storage：经视图写入后两者一起物化，clone 保持旧内容
+    auto v = a->view({2, 3});
+    ASSERT_TRUE(v.has_value());
+    static_cast<int32_t*>(v->data_ptr())[1] = -1;
+    EXPECT_EQ(static_cast<const int32_t*>(a->const_data_ptr())[1], -1);
+    EXPECT_EQ(static_cast<const int32_t*>(c->const_data_ptr())[1], 1);
+}
+
+TEST(TensorTests, CloneInplaceOpMaterializes)
+{
+    auto a = Tensor::full({4, 4}, DType::F32, 2.0);
+    ASSERT_TRUE(a.has_value());
+    auto c = a->clone();
+    ASSERT_TRUE(c.has_value());
+
+    // dst 与 src 同源：in-place 先物化 dst，仍以旧内容为输入
+    ASSERT_TRUE(add_inplace(*c, *a).has_value());
+    ASSERT_TRUE(exp_inplace(*a).has_value());
+    const auto* pa = static_cast<const float*>(a->const_data_ptr());
+    const auto* pc = static_cast<const float*>(c->const_data_ptr());
+    for (int i = 0; i < 16; ++i) {
+        EXPECT_FLOAT_EQ(pc[i], 4.0f);
+        EXPECT_FLOAT_EQ(pa[i], std::exp(2.0f));
+    }
+}
+
+TEST(TensorTests, ClonePartialViewCopiesEagerly)
+{
+    auto a = Tensor::arange(0, 12, 1, DType::F32);
+    ASSERT_TRUE(a.has_value());
+    auto v = a->view({3, 4});
+    ASSERT_TRUE(v.has_value());
+    auto row = v->slice(0, 1, 2);
+    ASSERT_TRUE(row.has_value());
+
+    // 部分视图不走写时复制，clone 立即拥有独立且紧凑的内存
+    auto c = row->clone();
+    ASSERT_TRUE(c.has_value());
+    EXPECT_FALSE(c->storage()->is_shared());
+    EXPECT_EQ(c->storage()->nbytes(), 4 * sizeof(float));
+    EXPECT_EQ(static_cast<const float*>(c->const_data_ptr())[0], 4.0f);
+}
+
+TEST(TensorTests, CloneAfterDataPtrCopiesEagerly)
+{
+    auto a = Tensor::arange(0, 8, 1, DType::I32);
+    ASSERT_TRUE(a.has_value());
+
+    // clone 之前交出的可写指针：storage 不再共享，经旧指针的写入不影响 clone
+    auto* p = static_cast<int32_t*>(a->data_ptr());
+    auto  c = a->clone();
+    ASSERT_TRUE(c.has_value());
+    EXPECT_FALSE(c->storage()->is_shared());
+    EXPECT_NE(c->const_data_ptr(), a->const_data_ptr());
+
+    p[0] = -5;
+    EXPECT_EQ(static_cast<const int32_t*>(a->const_data_ptr())[0], -5);
+    EXPECT_EQ(static_cast<const int32_t*>(c->const_data_ptr())[0], 0);
+    EXPECT_EQ(static_cast<const int32_t*>(c->const_data_ptr())[7], 7);
+}
+
 // ── 负维度与零维度 ────────────────────────────────────────────────────────────
 
 TEST(TensorTests, EmptyRejectsNegativeDimensions)
@@ -2,6 +2,9 @@
 
 #include "Tensor/Tensor.hpp"
 
+#include <cstring>
+#include <vector>
+
 using namespace bee;
 
 // ═══════════════════════════════════════════════════════════════
@@ -424,3 +427,145 @@ TEST(ViewTests, SliceNegativeDimIndex)
     ASSERT_TRUE(sr.has_value());
     EXPECT_EQ(sr->shape(), (Shape{6}));
 }
+
+// ═══════════════════════════════════════════════════════════════
+// contiguous：N 维视图物化
+// ═══════════════════════════════════════════════════════════════
+
+namespace
+{
+
+// 按元素宽度填入互不相同的位模式（元素 i 的值为 i），与 dtype 的数值语义无关
+auto make_pattern(const Shape& shape, DType dt) -> Tensor
+{
+    auto r = Tensor::empty(shape, dt);
+    EXPECT_TRUE(r.has_value());
+    const std::size_t es = dtype_size(dt);
+    auto*             p  = static_cast<uint8_t*>(r->data_ptr());
+    for (int64_t i = 0; i < r->numel(); ++i) {
+        const uint64_t v = static_cast<uint64_t>(i);
+        std::memcpy(p + i * static_cast<int64_t>(es), &v, es);
+    }
+    return *r;
+}
+
+// 逐元素按 stride 读取视图并与 contiguous() 的结果逐字节比较
+void expect_materialized(const Tensor& view)
+{
+    auto c = view.contiguous();
+    ASSERT_TRUE(c.has_value());
+    ASSERT_TRUE(c->is_contiguous());
+    ASSERT_EQ(c->shape(), view.shape());
+
+    const std::size_t    es  = dtype_size(view.dtype());
+    const auto*          src = static_cast<const uint8_t*>(view.data_ptr());
+    const auto*          dst = static_cast<const uint8_t*>(c->data_ptr());
+    const auto&          sh  = view.shape();
+    const auto&          st  = view.strides();
+    std::vector<int64_t> idx(sh.size(), 0);
+    for (int64_t linear = 0; linear < view.numel(); ++linear) {
+        int64_t off = 0;
+        for (std::size_t d = 0; d < sh.size(); ++d)
+            off += idx[d] * st[d];
+        ASSERT_EQ(std::memcmp(dst + linear * static_cast<int64_t>(es), src + off * static_cast<int64_t>(es), es), 0) << "linear=" << linear;
+        for (std::size_t d = sh.size(); d-- > 0;) {
+            if (++idx[d] < sh[d])
+                break;
+            idx[d] = 0;
+        }
+    }
+}
+
+} // namespace
+
+TEST(ViewTests, ContiguousNchwToNhwc)
+{
+    // 合并后为 {N, C, H·W} → {N, H·W, C} 的批量转置平面；尺寸非 8 的倍数以覆盖尾块
+    for (DType dt : {DType::F32, DType::I32, DType::F64, DType::U8, DType::F16}) {
+        auto x = make_pattern({2, 13, 19, 23}, dt);
+        auto p = x.permute({0, 2, 3, 1});
+        ASSERT_TRUE(p.has_value());
+        expect_materialized(*p);
+    }
+}
+
+TEST(ViewTests, ContiguousNhwcToNchw)
+{
+    for (DType dt : {DType::F32, DType::I64, DType::BF16}) {
+        auto x = make_pattern({3, 17, 11, 37}, dt);
+        auto p = x.permute({0, 3, 1, 2});
+        ASSERT_TRUE(p.has_value());
+        expect_materialized(*p);
+    }
+}
+
+TEST(ViewTests, ContiguousHeadSplitPermute)
+{
+    // {B, L, H, D} → {B, H, L, D}：最内维连续，按 D 长度的连续段拷贝
+    auto x = make_pattern({2, 65, 4, 24}, DType::F32);
+    auto p = x.permute({0, 2, 1, 3});
+    ASSERT_TRUE(p.has_value());
+    expect_materialized(*p);
+}
+
+TEST(ViewTests, ContiguousLargeTransposeParallel)
+{
+    // 足够大，行块会被拆成多个并行任务
+    auto x = make_pattern({3, 300, 257}, DType::F32);
+    auto p = x.permute({2, 0, 1});
+    ASSERT_TRUE(p.has_value());
+    expect_materialized(*p);
+
+    auto t = x.transpose(1, 2);
+    ASSERT_TRUE(t.has_value());
+    expect_materialized(*t);
+}
+
+TEST(ViewTests, ContiguousStridedSliceAndPermute)
+{
+    // 带步长切片后无单位步长维 → strided gather；再叠加 permute
+    for (DType dt : {DType::F32, DType::F64, DType::U8}) {
+        auto x = make_pattern({4, 9, 30}, dt);
+        auto s = x.slice(2, 1, 29, 3);
+        ASSERT_TRUE(s.has_value());
+        expect_materialized(*s);
+
+        auto p = s->permute({1, 0, 2});
+        ASSERT_TRUE(p.has_value());
+        expect_materialized(*p);
+
+        auto q = x.slice(1, 2, 7);
+        ASSERT_TRUE(q.has_value());
+        auto qp = q->permute({2, 1, 0});
+        ASSERT_TRUE(qp.has_value());
+        expect_materialized(*qp);
+    }
+}
+
+TEST(ViewTests, ContiguousSizeOneAndEmptyDims)
+{
+    auto x = make_pattern({1, 7, 1, 5}, DType::F32);
+    auto p = x.permute({3, 2, 1, 0});
+    ASSERT_TRUE(p.has_value());
+    expect_materialized(*p);
+
+    auto e = Tensor::empty({4, 0, 3}, DType::F32);
+    ASSERT_TRUE(e.has_value());
+    auto ep = e->permute({2, 1, 0});
+    ASSERT_TRUE(ep.has_value());
+    auto ec = ep->contiguous();
+    ASSERT_TRUE(ec.has_value());
+    EXPECT_EQ(ec->shape(), (Shape{3, 0, 4}));
+}
+
+TEST(ViewTests, CloneNonContiguousPermute)
+{
+    auto x = make_pattern({5, 6, 7}, DType::I32);
+    auto p = x.permute({1, 2, 0});
+    ASSERT_TRUE(p.has_value());
+    auto c = p->clone();
+    ASSERT_TRUE(c.has_value());
+    auto r = p->contiguous();
+    ASSERT_TRUE(r.has_value());
+    EXPECT_EQ(std::memcmp(c->data_ptr(), r->data_ptr(), static_cast<std::size_t>(r->numel()) * sizeof(int32_t)), 0);
+}